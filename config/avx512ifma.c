@@ -0,0 +1,11 @@
+#include <immintrin.h>
+#include <stdint.h>
+
+int main () {
+  uint64_t digits[8] = { 0 };
+  __m512i a = _mm512_loadu_si512((void *)digits);
+  __m512i r = _mm512_madd52lo_epu64(a, a, a);
+  r = _mm512_madd52hi_epu64(r, a, a);
+  _mm512_storeu_si512((void *)digits, r);
+  return (int)digits[0];
+}
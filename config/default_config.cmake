@@ -19,6 +19,7 @@ set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/Hacl_Bignum4096_32.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_GenericField32.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_Chacha20Poly1305.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_XChacha20Poly1305.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20_Vec32.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_P256.c
@@ -33,17 +34,31 @@ set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP32_SHA256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP32_SHA512.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_P256_CP32_SHA256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_DHKEM.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Hybrid.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_KeySchedule.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_X25519MLKEM768_CP32_SHA256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_P256MLKEM768_CP32_SHA256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo1344.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo_KEM.c
 	${PROJECT_SOURCE_DIR}/src/Lib_RandomBuffer_System.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo640.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo976.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo64.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo640_AES.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo976_AES.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo1344_AES.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_MLKEM.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_MLKEM512.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_MLKEM768.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_MLKEM1024.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_DRBG.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Random.c
 	${PROJECT_SOURCE_DIR}/src/Lib_RandomBuffer_System.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_HMAC.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Hash.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_AutoConfig2.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Dispatch.c
 	${PROJECT_SOURCE_DIR}/src/Lib_Memzero0.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Ed25519.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Curve25519.c
@@ -52,12 +67,21 @@ set(SOURCES_std
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Chacha20Poly1305.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_Poly1305.c
 	${PROJECT_SOURCE_DIR}/src/EverCrypt_AEAD.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_HPKE.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_FFDHE.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_Bignum4096.c
+	${PROJECT_SOURCE_DIR}/src/EverCrypt_NaCl.c
 )
 set(SOURCES_vec256
 	${PROJECT_SOURCE_DIR}/src/Hacl_Hash_Blake2b_Simd256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_Chacha20Poly1305_Simd256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_XChacha20Poly1305_Simd256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_MAC_Poly1305_Simd256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Hash_SHA3_Simd256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Frodo_KEM_Simd256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_MLKEM_Simd256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20_Vec256.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Salsa20_Vec256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_SHA2_Vec256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HKDF_Blake2b_256.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HMAC_Blake2b_256.c
@@ -65,14 +89,19 @@ set(SOURCES_vec256
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve51_CP256_SHA512.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_P256_CP256_SHA256.c
 )
+set(SOURCES_avx512ifma
+	${PROJECT_SOURCE_DIR}/src/Hacl_Bignum4096_IFMA.c
+)
 set(SOURCES_vec128
 	${PROJECT_SOURCE_DIR}/src/Hacl_Hash_Blake2s_Simd128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Bignum4096.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Bignum64.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_GenericField64.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_Chacha20Poly1305_Simd128.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_AEAD_XChacha20Poly1305_Simd128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_MAC_Poly1305_Simd128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_Chacha20_Vec128.c
+	${PROJECT_SOURCE_DIR}/src/Hacl_Salsa20_Vec128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_SHA2_Vec128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HKDF_Blake2s_128.c
 	${PROJECT_SOURCE_DIR}/src/Hacl_HMAC_Blake2s_128.c
@@ -99,7 +128,8 @@ set(SOURCES_std_vale
 	${PROJECT_SOURCE_DIR}/src/Hacl_HPKE_Curve64_CP32_SHA512.c
 )
 set(INCLUDES
-	${PROJECT_SOURCE_DIR}/include/Hacl_NaCl.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_NaCl.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_NaCl.h
 	${PROJECT_SOURCE_DIR}/karamel/include/krml/internal/types.h
 	${PROJECT_SOURCE_DIR}/karamel/include/krml/lowstar_endianness.h
 	${PROJECT_SOURCE_DIR}/karamel/krmllib/dist/minimal/fstar_uint128_gcc64.h
@@ -152,22 +182,30 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096_32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096_IFMA.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum64.h
+	${PROJECT_SOURCE_DIR}/include/bignum-inline.h
+	${PROJECT_SOURCE_DIR}/include/aes-inline.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_GenericField32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_GenericField64.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec32.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Chacha20.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Chacha20.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305_Simd128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_MAC_Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec128.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_MAC_Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_MAC_Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305_Simd256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_MAC_Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_MAC_Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_MAC_Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Curve25519_64.h
@@ -181,9 +219,11 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Bignum_K256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_K256_ECDSA.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_EC_K256.h
-	${PROJECT_SOURCE_DIR}/include/Hacl_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_FFDHE.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Impl_FFDHE_Constants.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_FFDHE_PrecompTable.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Hash_SHA3.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Hash_SHA3.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_SHA2_Vec128.h
@@ -215,21 +255,40 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_Curve51_CP32_SHA512.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP128_SHA256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP32_SHA256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_X25519MLKEM768_CP32_SHA256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256MLKEM768_CP32_SHA256.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_HPKE_DHKEM.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_HPKE_Hybrid.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_HPKE_KeySchedule.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Hash_SHA3.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Hash_SHA3_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo_KEM.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_Frodo_KEM_Simd256.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_MLKEM.h
+	${PROJECT_SOURCE_DIR}/include/internal/Hacl_MLKEM_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Lib_RandomBuffer_System.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM512.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM768.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM1024.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Random.h
 	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_HMAC.h
 	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_Hash.h
+	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_Dispatch.h
+	${PROJECT_SOURCE_DIR}/include/internal/EverCrypt_DRBG.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_Hash.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Error.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AutoConfig2.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Dispatch.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_HMAC.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Ed25519.h
@@ -239,6 +298,10 @@ set(INCLUDES
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Chacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AEAD.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_HPKE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Bignum4096.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_NaCl.h
 )
 set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_NaCl.h
@@ -280,20 +343,28 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096_32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum4096_IFMA.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Bignum64.h
+	${PROJECT_SOURCE_DIR}/include/bignum-inline.h
+	${PROJECT_SOURCE_DIR}/include/aes-inline.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_GenericField32.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_GenericField64.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec32.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Chacha20.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305_Simd128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_MAC_Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec128.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec128.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_MAC_Poly1305_Simd128.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_Chacha20Poly1305_Simd256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_AEAD_XChacha20Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_MAC_Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Chacha20_Vec256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Salsa20_Vec256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_MAC_Poly1305_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Curve25519_64.h
 	${PROJECT_SOURCE_DIR}/include/curve25519-inline.h
@@ -329,17 +400,28 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_Curve51_CP32_SHA512.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP128_SHA256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256_CP32_SHA256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_X25519MLKEM768_CP32_SHA256.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_HPKE_P256MLKEM768_CP32_SHA256.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Hash_SHA3.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Hash_SHA3_Simd256.h
 	${PROJECT_SOURCE_DIR}/include/internal/../Hacl_Spec.h
 	${PROJECT_SOURCE_DIR}/include/Lib_RandomBuffer_System.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo64.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo640_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo976_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_Frodo1344_AES.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM512.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM768.h
+	${PROJECT_SOURCE_DIR}/include/Hacl_MLKEM1024.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_DRBG.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Random.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_Hash.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Error.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AutoConfig2.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Dispatch.h
 	${PROJECT_SOURCE_DIR}/include/internal/../EverCrypt_HMAC.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Ed25519.h
 	${PROJECT_SOURCE_DIR}/include/Hacl_Ed25519.h
@@ -349,6 +431,10 @@ set(PUBLIC_INCLUDES
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Chacha20Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_Poly1305.h
 	${PROJECT_SOURCE_DIR}/include/EverCrypt_AEAD.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_HPKE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_FFDHE.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_Bignum4096.h
+	${PROJECT_SOURCE_DIR}/include/EverCrypt_NaCl.h
 )
 set(ALGORITHMS
 	nacl
@@ -373,6 +459,7 @@ set(ALGORITHMS
 	rsapss
 	hpke
 	frodo
+	mlkem
 )
 set(INCLUDE_PATHS
 	${PROJECT_SOURCE_DIR}/include
@@ -385,6 +472,10 @@ set(TEST_SOURCES
 	${PROJECT_SOURCE_DIR}/tests/detection.cc
 	${PROJECT_SOURCE_DIR}/tests/bignum.cc
 	${PROJECT_SOURCE_DIR}/tests/generic_field.cc
+	${PROJECT_SOURCE_DIR}/tests/ffdhe.cc
+	${PROJECT_SOURCE_DIR}/tests/frodo.cc
+	${PROJECT_SOURCE_DIR}/tests/mlkem.cc
+	${PROJECT_SOURCE_DIR}/tests/hpke.cc
 	${PROJECT_SOURCE_DIR}/tests/blake2b.cc
 	${PROJECT_SOURCE_DIR}/tests/blake2s.cc
 	${PROJECT_SOURCE_DIR}/tests/p256_ecdh.cc
@@ -456,6 +547,10 @@ set(ALGORITHM_TEST_FILES
 	TEST_FILES_detection
 	TEST_FILES_bignum
 	TEST_FILES_generic_field
+	TEST_FILES_ffdhe
+	TEST_FILES_frodo
+	TEST_FILES_mlkem
+	TEST_FILES_hpke
 	TEST_FILES_blake2
 	TEST_FILES_p256
 	TEST_FILES_k256
@@ -484,6 +579,18 @@ set(TEST_FILES_bignum
 set(TEST_FILES_generic_field
 	generic_field.cc
 )
+set(TEST_FILES_ffdhe
+	ffdhe.cc
+)
+set(TEST_FILES_frodo
+	frodo.cc
+)
+set(TEST_FILES_mlkem
+	mlkem.cc
+)
+set(TEST_FILES_hpke
+	hpke.cc
+)
 set(TEST_FILES_blake2
 	blake2b.cc
 	blake2s.cc
@@ -3,6 +3,7 @@
 # They all default to off and have to be explicitely enabled.
 option(DISABLE_VEC128 "Disable code requiring vec128 hardware support.")
 option(DISABLE_VEC256 "Disable code requiring vec256 hardware support.")
+option(DISABLE_AVX512IFMA "Disable code requiring AVX-512 IFMA hardware support.")
 option(DISABLE_VALE "Disable vale code.")
 option(DISABLE_INLINE_ASM "Disable inline assembly code.")
 option(DISABLE_INTRINSICS "Disable intrinsics.")
@@ -14,6 +15,10 @@ if(DISABLE_VEC256)
     set(TOOLCHAIN_CAN_COMPILE_VEC256 OFF)
     message(STATUS "vec256 support: ${TOOLCHAIN_CAN_COMPILE_VEC256} (MANUALLY DISABLED)")
 endif()
+if(DISABLE_AVX512IFMA)
+    set(TOOLCHAIN_CAN_COMPILE_AVX512IFMA OFF)
+    message(STATUS "avx512ifma support: ${TOOLCHAIN_CAN_COMPILE_AVX512IFMA} (MANUALLY DISABLED)")
+endif()
 if(DISABLE_VALE)
     set(TOOLCHAIN_CAN_COMPILE_VALE OFF)
     message(STATUS "vale support: ${TOOLCHAIN_CAN_COMPILE_VALE} (MANUALLY DISABLED)")
@@ -82,6 +82,25 @@ if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_VEC256)
 endif()
 message(STATUS "vec256 support: ${TOOLCHAIN_CAN_COMPILE_VEC256}")
 
+## Check for AVX-512 IFMA support
+if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_AVX512IFMA)
+    set(TOOLCHAIN_CAN_COMPILE_AVX512IFMA FALSE)
+    # Only available on x64
+    if(CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|amd64|AMD64")
+        if(MSVC)
+            set(CPU_FLAGS "/arch:AVX512")
+        else()
+            set(CPU_FLAGS "-mavx512f -mavx512ifma")
+        endif()
+        try_compile(TOOLCHAIN_CAN_COMPILE_AVX512IFMA
+                            ${PROJECT_SOURCE_DIR}/config/build
+                            ${PROJECT_SOURCE_DIR}/config/avx512ifma.c
+                            COMPILE_DEFINITIONS "${CPU_FLAGS}"
+                    )
+    endif()
+endif()
+message(STATUS "avx512ifma support: ${TOOLCHAIN_CAN_COMPILE_AVX512IFMA}")
+
 ## Check for vale support
 if(NOT DEFINED TOOLCHAIN_CAN_COMPILE_VALE)
     # Always enable for x64
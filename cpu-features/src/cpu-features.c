@@ -70,6 +70,18 @@ cpuid(unsigned long leaf,
 }
 #endif
 
+#if (defined(CPU_FEATURES_LINUX) || defined(CPU_FEATURES_MACOS)) &&            \
+  (defined(CPU_FEATURES_X64) || defined(CPU_FEATURES_X86))
+// The low 32 bits of XCR0, the state components enabled by the OS.
+static unsigned long
+xcr0()
+{
+  unsigned long eax, edx;
+  __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return eax;
+}
+#endif
+
 // ECX
 #define ECX_SSE3 (1 << 0)
 #define ECX_PCLMUL (1 << 1)
@@ -79,13 +91,16 @@ cpuid(unsigned long leaf,
 #define ECX_SSE4_2 (1 << 20)
 #define ECX_MOVBE (1 << 22)
 #define ECX_AESNI (1 << 25)
+#define ECX_OSXSAVE (1 << 27)
 #define ECX_AVX (1 << 28)
 
 // EBX
 #define EBX_BMI1 (1 << 3)
 #define EBX_AVX2 (1 << 5)
 #define EBX_BMI2 (1 << 8)
+#define EBX_AVX512F (1 << 16)
 #define EBX_ADX (1 << 19)
+#define EBX_AVX512IFMA (1 << 21)
 #define EBX_SHA (1 << 29)
 
 // EDX
@@ -93,6 +108,9 @@ cpuid(unsigned long leaf,
 #define EDX_SSE2 (1 << 26)
 #define EDX_CMOV (1 << 15)
 
+// XCR0: SSE, AVX and the three AVX-512 states (opmask, ZMM_Hi256, Hi16_ZMM).
+#define XCR0_AVX512 0xe6
+
 // === End x86 | x64
 
 // === MacOS ARM
@@ -116,6 +134,9 @@ static unsigned int _bmi2 = 0;
 static unsigned int _pclmul = 0;
 static unsigned int _movbe = 0;
 static unsigned int _cmov = 0;
+static unsigned int _avx512f = 0;
+static unsigned int _avx512ifma = 0;
+static unsigned int _avx512_os = 0;
 
 // API
 
@@ -137,6 +158,12 @@ hacl_vec256_support()
   return _avx && _avx2;
 }
 
+unsigned int
+hacl_avx512ifma_support()
+{
+  return _avx512f && _avx512ifma && _avx512_os;
+}
+
 unsigned int
 vale_aesgcm_support()
 {
@@ -175,6 +202,8 @@ hacl_init_cpu_features()
   _bmi2 = (ebx_sub & EBX_BMI2) != 0;
   _adx = (ebx_sub & EBX_ADX) != 0;
   _sha = (ebx_sub & EBX_SHA) != 0;
+  _avx512f = (ebx_sub & EBX_AVX512F) != 0;
+  _avx512ifma = (ebx_sub & EBX_AVX512IFMA) != 0;
 
   _sse = (edx & EDX_SSE) != 0;
   _sse2 = (edx & EDX_SSE2) != 0;
@@ -184,6 +213,10 @@ hacl_init_cpu_features()
   _ssse3 = (ecx & ECX_SSSE3) != 0;
   _sse41 = (ecx & ECX_SSE4_1) != 0;
   _sse42 = (ecx & ECX_SSE4_2) != 0;
+
+  // AVX-512 code also needs the OS to save the opmask and zmm registers.
+  _avx512_os =
+    (ecx & ECX_OSXSAVE) != 0 && (xcr0() & XCR0_AVX512) == XCR0_AVX512;
 #endif
 
 #if defined(CPU_FEATURES_MACOS) && defined(CPU_FEATURES_ARM64)
@@ -64,8 +64,9 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 
 @param a The argument `a` must be either of:
   * `Spec_Agile_AEAD_AES128_GCM` (KEY_LEN=16),
-  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32), or
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32).
+  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32), or
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (KEY_LEN=32).
 @param dst Pointer to a pointer where the address of the allocated AEAD state will be written to.
 @param k Pointer to `KEY_LEN` bytes of memory where the key is read from. The size depends on the used algorithm, see above.
 
@@ -81,7 +82,8 @@ Encrypt and authenticate a message (`plain`) with associated data (`ad`).
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce and
+  XChaCha20Poly1305 a 24 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param plain Pointer to `plain_len` bytes of memory where the to-be-encrypted plaintext is read from.
@@ -92,6 +94,7 @@ Encrypt and authenticate a message (`plain`) with associated data (`ad`).
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (TAG_LEN=16)
 
 @return `EverCrypt_AEAD_encrypt` may return either `EverCrypt_Error_Success` or `EverCrypt_Error_InvalidKey` (`EverCrypt_error.h`). The latter is returned if and only if the `s` parameter is `NULL`.
 */
@@ -189,6 +192,19 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   uint8_t *tag
 );
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+);
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -208,7 +224,8 @@ Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce and
+  XChaCha20Poly1305 a 24 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
@@ -218,6 +235,7 @@ Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (TAG_LEN=16)
 @param dst Pointer to `cipher_len` bytes of memory where the decrypted plaintext will be written to.
 
 @return `EverCrypt_AEAD_decrypt` returns ...
@@ -328,6 +346,19 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   uint8_t *dst
 );
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+);
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -57,10 +57,26 @@ bool EverCrypt_AutoConfig2_has_rdrand(void);
 
 bool EverCrypt_AutoConfig2_has_avx512(void);
 
+bool EverCrypt_AutoConfig2_has_avx512ifma(void);
+
 void EverCrypt_AutoConfig2_recall(void);
 
+/**
+Detect the CPU features again.
+
+The EverCrypt entry points do not read these flags on each call: they use the
+implementations that `EverCrypt_Dispatch_init` chose when the library was loaded.
+Call `EverCrypt_Dispatch_refresh` after this function to choose them again.
+*/
 void EverCrypt_AutoConfig2_init(void);
 
+/**
+The `disable` functions below clear one feature flag, e.g. to test the portable
+code on a machine that has the feature.
+
+They do not change the implementations used by the EverCrypt entry points until
+`EverCrypt_Dispatch_refresh` is called.
+*/
 typedef void (*EverCrypt_AutoConfig2_disabler)(void);
 
 void EverCrypt_AutoConfig2_disable_avx2(void);
@@ -85,6 +101,8 @@ void EverCrypt_AutoConfig2_disable_rdrand(void);
 
 void EverCrypt_AutoConfig2_disable_avx512(void);
 
+void EverCrypt_AutoConfig2_disable_avx512ifma(void);
+
 bool EverCrypt_AutoConfig2_has_vec128(void);
 
 bool EverCrypt_AutoConfig2_has_vec256(void);
@@ -94,6 +94,31 @@ Create a DRBG state.
 */
 EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a);
 
+/**
+Create a DRBG state that uses a ChaCha20 fast-key-erasure generator instead of
+HMAC-DRBG. It is driven through the same `instantiate`, `reseed`, `generate` and
+`uninstantiate` functions, but is several times faster for bulk output. Note that
+this generator is not an SP 800-90A DRBG.
+
+@return DRBG state. Needs to be freed via `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void);
+
+/**
+Create a CTR_DRBG (NIST SP 800-90A) state, using AES-256 without a derivation
+function. It is driven through the same `instantiate`, `reseed`, `generate` and
+`uninstantiate` functions. Since no derivation function is used, the
+personalization string and additional input are limited to 48 bytes (the seed
+length); longer inputs make these functions return false.
+
+This relies on the Vale AES-NI kernels.
+
+@return DRBG state, or NULL if AES-NI/PCLMULQDQ/AVX/MOVBE are not available on
+  this machine or the Vale code was not compiled in. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_aes256_ctr(void);
+
 /**
 Instantiate the DRBG.
 
@@ -0,0 +1,106 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Dispatch_H
+#define __EverCrypt_Dispatch_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#define EverCrypt_Dispatch_CHACHA20_POLY1305 0
+#define EverCrypt_Dispatch_POLY1305 1
+#define EverCrypt_Dispatch_CURVE25519 2
+#define EverCrypt_Dispatch_SHA2_256 3
+#define EverCrypt_Dispatch_BIGNUM 4
+#define EverCrypt_Dispatch_MOD_EXP 5
+#define EverCrypt_Dispatch_FRODO 6
+#define EverCrypt_Dispatch_FRODO_AES 7
+#define EverCrypt_Dispatch_MLKEM 8
+#define EverCrypt_Dispatch_NACL 9
+#define EverCrypt_Dispatch_HPKE 10
+#define EverCrypt_Dispatch_AES_GCM 11
+#define EverCrypt_Dispatch_CHACHA20 12
+#define EverCrypt_Dispatch_SHA2_256_MB 13
+
+/* The number of primitives above. */
+#define EverCrypt_Dispatch_COUNT 14
+
+typedef uint8_t EverCrypt_Dispatch_primitive;
+
+#define EverCrypt_Dispatch_Portable 0
+#define EverCrypt_Dispatch_Vec128 1
+#define EverCrypt_Dispatch_Vec256 2
+#define EverCrypt_Dispatch_Vale 3
+#define EverCrypt_Dispatch_Adx 4
+#define EverCrypt_Dispatch_Avx512ifma 5
+#define EverCrypt_Dispatch_Aesni 6
+
+typedef uint8_t EverCrypt_Dispatch_impl;
+
+/**
+Detect the CPU features with `EverCrypt_AutoConfig2_init` and choose the
+implementation of every dispatched primitive from them. The EverCrypt entry points
+of the dispatched primitives then call the chosen implementation directly, without
+testing CPU features. It also installs the kernels used by the 64-bit `Hacl_Bignum`
+modules, by FrodoKEM and by ML-KEM.
+
+This runs when the library is loaded with GCC, Clang and MSVC; elsewhere, call it
+before using EverCrypt. Only the first call does anything, and it is safe to call
+from several threads.
+*/
+void EverCrypt_Dispatch_init(void);
+
+/**
+Choose the implementations again, from the current state of
+`EverCrypt_AutoConfig2`, e.g. after `EverCrypt_AutoConfig2_disable_avx2`.
+
+This is meant for tests. Each slot of the table is replaced atomically, so a
+concurrent call still runs a valid implementation, but calls made while this runs
+may mix old and new ones.
+*/
+void EverCrypt_Dispatch_refresh(void);
+
+/**
+Return the implementation currently serving the primitive `p`.
+*/
+EverCrypt_Dispatch_impl EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_primitive p);
+
+/**
+Return a printable name for the implementation `i`, e.g. "vec256".
+*/
+const char *EverCrypt_Dispatch_impl_name(EverCrypt_Dispatch_impl i);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Dispatch_H_DEFINED
+#endif
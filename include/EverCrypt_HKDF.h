@@ -36,6 +36,7 @@ extern "C" {
 #include "krml/internal/target.h"
 
 #include "Hacl_Streaming_Types.h"
+#include "EverCrypt_HMAC.h"
 
 /**
 Expand pseudorandom key to desired length.
@@ -86,6 +87,97 @@ EverCrypt_HKDF_extract(
   uint32_t ikmlen
 );
 
+/**
+An HKDF context, keyed once with a pseudorandom key. `key` holds the
+precomputed HMAC pad states for the PRK; for SHA2-256, `sha256_inner` and
+`sha256_outer` additionally hold the same states as raw words, for use by the
+multi-lane batch expansion (and are NULL otherwise). The expansion functions only
+read the context, so one context may be used from several threads at once.
+*/
+typedef struct EverCrypt_HKDF_context_t_s
+{
+  EverCrypt_HMAC_key_t *key;
+  uint32_t *sha256_inner;
+  uint32_t *sha256_outer;
+}
+EverCrypt_HKDF_context_t;
+
+/**
+Allocate an HKDF context for pseudorandom key `prk`, usually the output of
+`EverCrypt_HKDF_extract`. Returns NULL if `a` is not one of the algorithms
+listed in `EverCrypt_HKDF_extract`. The context is to be freed by calling
+`free_context`.
+*/
+EverCrypt_HKDF_context_t
+*EverCrypt_HKDF_malloc_context(Spec_Hash_Definitions_hash_alg a, uint8_t *prk, uint32_t prklen);
+
+/**
+Free (and clear) a context previously allocated with `malloc_context`.
+*/
+void EverCrypt_HKDF_free_context(EverCrypt_HKDF_context_t *ctx);
+
+/**
+Same as `EverCrypt_HKDF_expand`, with the pseudorandom key taken from `ctx`.
+
+@param len Length of output keying material. At most 255 * `HashLen`.
+*/
+void
+EverCrypt_HKDF_expand_with_context(
+  EverCrypt_HKDF_context_t *ctx,
+  uint8_t *okm,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+);
+
+/**
+TLS 1.3 HKDF-Expand-Label (RFC 8446, Section 7.1), with the pseudorandom key
+(the `Secret`) taken from `ctx`. The "tls13 " prefix is added to `label`.
+
+@param label Pointer to `label_len` bytes, without the "tls13 " prefix. `label_len` is at most 249.
+@param context Pointer to `context_len` bytes. `context_len` is at most 255.
+@param len Length of output keying material. At most 255 * `HashLen` and 65535.
+*/
+void
+EverCrypt_HKDF_expand_label(
+  EverCrypt_HKDF_context_t *ctx,
+  uint8_t *okm,
+  uint8_t *label,
+  uint32_t label_len,
+  uint8_t *context,
+  uint32_t context_len,
+  uint32_t len
+);
+
+/**
+A single derivation for `EverCrypt_HKDF_expand_label_batch`; the fields are as
+in `EverCrypt_HKDF_expand_label`.
+*/
+typedef struct EverCrypt_HKDF_label_t_s
+{
+  uint8_t *okm;
+  uint8_t *label;
+  uint32_t label_len;
+  uint8_t *context;
+  uint32_t context_len;
+  uint32_t len;
+}
+EverCrypt_HKDF_label_t;
+
+/**
+Run `n` independent HKDF-Expand-Label derivations under the same context, e.g.
+the key, iv and hp secrets of a TLS 1.3 or QUIC key schedule. With SHA2-256 on
+AVX2 machines, derivations of at most `HashLen` bytes whose labels have equal
+encoded length are computed eight at a time on SIMD lanes; the others fall back
+to `EverCrypt_HKDF_expand_label`.
+*/
+void
+EverCrypt_HKDF_expand_label_batch(
+  EverCrypt_HKDF_context_t *ctx,
+  EverCrypt_HKDF_label_t *labels,
+  uint32_t n
+);
+
 #if defined(__cplusplus)
 }
 #endif
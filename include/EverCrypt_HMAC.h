@@ -40,6 +40,7 @@ extern "C" {
 #include "Hacl_Hash_SHA2.h"
 #include "Hacl_Hash_Blake2s.h"
 #include "Hacl_Hash_Blake2b.h"
+#include "EverCrypt_Hash.h"
 
 bool EverCrypt_HMAC_is_supported_alg(Spec_Hash_Definitions_hash_alg uu___);
 
@@ -57,6 +58,112 @@ EverCrypt_HMAC_compute(
   uint32_t datalen
 );
 
+/**
+A precomputed HMAC key. `inner` and `outer` hold the hash states obtained after
+compressing the first block, i.e. the key xor'd with ipad (resp. opad). `ipad`
+retains that first block, which is needed to MAC the empty message with BLAKE2
+(where the final-block flag must be set on the key block itself). The functions
+taking a key only read it, so one key may be used from several threads at once.
+*/
+typedef struct EverCrypt_HMAC_key_t_s
+{
+  EverCrypt_Hash_state_s *inner;
+  EverCrypt_Hash_state_s *outer;
+  uint8_t *ipad;
+}
+EverCrypt_HMAC_key_t;
+
+/**
+Precompute the inner and outer pad states for `key` under hash algorithm `a`.
+Keys longer than the block length of `a` are hashed first, as per RFC 2104.
+Returns NULL if `a` is not supported (see `EverCrypt_HMAC_is_supported_alg`).
+The key is to be freed by calling `free_key`.
+*/
+EverCrypt_HMAC_key_t
+*EverCrypt_HMAC_malloc_key(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/**
+Allocate an independent copy of a precomputed key.
+*/
+EverCrypt_HMAC_key_t *EverCrypt_HMAC_copy_key(EverCrypt_HMAC_key_t *k);
+
+/**
+Free (and clear) a key previously allocated with `malloc_key` or `copy_key`.
+*/
+void EverCrypt_HMAC_free_key(EverCrypt_HMAC_key_t *k);
+
+/**
+Compute the HMAC of `data` under the precomputed key `k` and write it into `mac`,
+an array of the hash length of the key's algorithm. Unlike
+`EverCrypt_HMAC_compute`, this does not re-derive the pad states from the raw
+key, saving two compression function calls per MAC.
+*/
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_t *k,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+);
+
+typedef struct EverCrypt_HMAC_state_t_s
+{
+  EverCrypt_HMAC_key_t *key;
+  EverCrypt_Hash_state_s *block_state;
+  uint8_t *buf;
+  uint64_t total_len;
+}
+EverCrypt_HMAC_state_t;
+
+/**
+Allocate a streaming HMAC state for the precomputed key `k`. The state holds its
+own copy of `k`, which may thus be freed independently. The state is to be freed
+by calling `free`.
+*/
+EverCrypt_HMAC_state_t *EverCrypt_HMAC_malloc_with_key(EverCrypt_HMAC_key_t *k);
+
+/**
+Allocate a streaming HMAC state for `key` under hash algorithm `a`. This is
+equivalent to `malloc_key` followed by `malloc_with_key`, without the
+intermediate copy of the key. Returns NULL if `a` is not supported. The state is
+to be freed by calling `free`.
+*/
+EverCrypt_HMAC_state_t
+*EverCrypt_HMAC_malloc(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len);
+
+/**
+Reset an existing state to the MAC of the empty message under the same key. The
+pad states are not recomputed.
+*/
+void EverCrypt_HMAC_reset(EverCrypt_HMAC_state_t *state);
+
+/**
+Perform a run-time test to determine which algorithm was chosen for the given piece of state.
+*/
+Spec_Hash_Definitions_hash_alg EverCrypt_HMAC_alg_of_state(EverCrypt_HMAC_state_t *state);
+
+/**
+Feed an arbitrary amount of data into the MAC. This function returns
+EverCrypt_Error_Success for success, or EverCrypt_Error_MaximumLengthExceeded if
+the combined length of all of the data (plus the key block) exceeds the maximum
+input length of the underlying hash.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HMAC_update(EverCrypt_HMAC_state_t *state, uint8_t *chunk, uint32_t chunk_len);
+
+/**
+Write the MAC of all the data fed so far into `output`. The state remains valid
+after a call to `digest`, meaning the user may feed more data via `update`.
+Finalization only costs the compression of the buffered tail plus one
+compression on top of the precomputed outer state.
+*/
+void EverCrypt_HMAC_digest(EverCrypt_HMAC_state_t *state, uint8_t *output);
+
+/**
+Free a state previously allocated with `malloc` or `malloc_with_key`.
+*/
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_t *state);
+
 #if defined(__cplusplus)
 }
 #endif
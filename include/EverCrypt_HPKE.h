@@ -0,0 +1,362 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* This is a hand-written file. */
+
+#ifndef __EverCrypt_HPKE_H
+#define __EverCrypt_HPKE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_HPKE_Interface_Hacl_Impl_HPKE_Hacl_Meta_HPKE.h"
+#include "EverCrypt_Error.h"
+#include "EverCrypt_AutoConfig2.h"
+
+/*******************************************************************************
+
+Agile HPKE (RFC 9180), keyed by the KEM, KDF and AEAD identifiers of the RFC.
+
+Every call picks the fastest Hacl_HPKE_* instantiation of the suite for the
+current CPU: Curve64 over Curve51 when BMI2 and ADX are available, and the
+256-bit or 128-bit vectorized ChaCha20-Poly1305 when AVX2 or SSE/NEON are
+available. All instantiations of a suite compute the same values, so a context
+may be set up and used on different machines.
+
+Public keys of DHKEM(P-256) are the 64-byte raw point, while encapsulations are
+the 65-byte uncompressed point 0x04 || x || y.
+
+All functions return EverCrypt_Error_UnsupportedAlgorithm for a suite that is
+not listed below, and for the PSK and Auth modes of the hybrid KEMs.
+
+*******************************************************************************/
+
+#define EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256 (0x0010U)
+#define EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256 (0x0020U)
+#define EverCrypt_HPKE_kem_p256_mlkem768 (0x0050U)
+#define EverCrypt_HPKE_kem_xwing (0x647aU)
+
+#define EverCrypt_HPKE_kdf_hkdf_sha256 (0x0001U)
+#define EverCrypt_HPKE_kdf_hkdf_sha512 (0x0003U)
+
+#define EverCrypt_HPKE_aead_chacha20_poly1305 (0x0003U)
+
+/**
+Return the name of the Hacl_HPKE_* instantiation that serves the suite on this
+CPU, for example "Hacl_HPKE_Curve64_CP256_SHA256", or NULL if the suite is not
+supported. DHKEM(X25519) is supported with both KDFs, and the other KEMs with
+HKDF-SHA256 only; the AEAD is always ChaCha20-Poly1305.
+*/
+const char *EverCrypt_HPKE_implementation(uint16_t kem, uint16_t kdf, uint16_t aead);
+
+/**
+Return the length of public keys of the KEM, or 0 if it is not supported.
+*/
+uint32_t EverCrypt_HPKE_public_key_len(uint16_t kem);
+
+/**
+Return the length of secret keys of the KEM, or 0 if it is not supported.
+*/
+uint32_t EverCrypt_HPKE_secret_key_len(uint16_t kem);
+
+/**
+Return the length of the fresh randomness skE taken by the sender functions,
+or 0 if the KEM is not supported.
+*/
+uint32_t EverCrypt_HPKE_ephemeral_key_len(uint16_t kem);
+
+/**
+Return the length of encapsulations of the KEM, or 0 if it is not supported.
+*/
+uint32_t EverCrypt_HPKE_enc_len(uint16_t kem);
+
+/**
+Return the length of the exporter secret of Hacl_Impl_HPKE_context_s for the
+KDF, or 0 if it is not supported.
+*/
+uint32_t EverCrypt_HPKE_exporter_len(uint16_t kdf);
+
+/**
+Encapsulate to pkR and set up the sender context o_ctx in base mode.
+
+  Returns EverCrypt_Error_InvalidKey if skE or pkR is invalid.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupBaseS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Decapsulate enc and set up the receiver context o_ctx in base mode.
+
+  Returns EverCrypt_Error_InvalidKey if enc or skR is invalid.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupBaseR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up the sender context in psk mode.
+
+  Returns EverCrypt_Error_InvalidKey if a key is invalid or if psk or psk_id
+  is empty.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupPSKS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/**
+Set up the receiver context in psk mode.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupPSKR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/**
+Set up the sender context in auth mode, authenticated with the sender's secret
+key skS.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up the receiver context in auth mode, for the sender's public key pkS.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Set up the sender context in auth_psk mode.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthPSKS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/**
+Set up the receiver context in auth_psk mode.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthPSKR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/**
+Single-shot base mode encryption of plain into o_ct (plainlen + 16 bytes).
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_sealBase(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_enc,
+  uint8_t *o_ct
+);
+
+/**
+Single-shot base mode decryption of ct into o_pt (ctlen - 16 bytes).
+
+  Returns EverCrypt_Error_AuthenticationFailure if enc or ct is invalid.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_openBase(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+/**
+Seal one message with a sender context and increment its sequence number.
+
+  Returns EverCrypt_Error_MaximumLengthExceeded once the sequence number is
+  exhausted.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_seal(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+);
+
+/**
+Open one message with a receiver context and increment its sequence number.
+
+  Returns EverCrypt_Error_AuthenticationFailure, without incrementing the
+  sequence number, if ct is invalid, and EverCrypt_Error_MaximumLengthExceeded
+  once the sequence number is exhausted.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_open(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+/**
+Export l bytes of secret for exp_ctx from a sender or receiver context.
+
+  Returns EverCrypt_Error_MaximumLengthExceeded if l is larger than 255 times
+  the hash length of the KDF.
+*/
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_export(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_HPKE_H_DEFINED
+#endif
@@ -0,0 +1,196 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_NaCl_H
+#define __EverCrypt_NaCl_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/* The functions below are the same as the Hacl_NaCl ones with the same name, and
+   produce the same output, but their bulk Salsa20 and Poly1305 passes use the
+   widest vector implementation the CPU supports. Use Hacl_NaCl_crypto_box_beforenm
+   to compute the shared key of the `_afternm` functions. */
+
+/**
+Same as Hacl_NaCl_crypto_secretbox_detached.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_secretbox_open_detached.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_secretbox_easy.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_easy(uint8_t *c, uint8_t *m, uint32_t mlen, uint8_t *n, uint8_t *k);
+
+/**
+Same as Hacl_NaCl_crypto_secretbox_open_easy.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_detached_afternm.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached_afternm(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_detached.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_open_detached_afternm.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_open_detached.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_easy_afternm.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_afternm(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_easy.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_easy(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_open_easy_afternm.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+);
+
+/**
+Same as Hacl_NaCl_crypto_box_open_easy.
+*/
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_NaCl_H_DEFINED
+#endif
@@ -0,0 +1,65 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __EverCrypt_Random_H
+#define __EverCrypt_Random_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "EverCrypt_DRBG.h"
+
+/**
+Fill `output` with `len` cryptographically secure random bytes.
+
+Each thread lazily instantiates its own `EverCrypt_DRBG` state (seeded from the
+operating system) along with a small output buffer that is refilled in bulk, so
+this function takes no locks and may be called concurrently from any number of
+threads. Bytes are erased from the buffer as they are handed out. The state of a
+thread is freed when the thread exits.
+
+The per-thread state is discarded in a child process after `fork`, either via
+`MADV_WIPEONFORK` or, where that is not available, by comparing process ids.
+
+@param output Pointer to `len` bytes of memory where random output is written to.
+@param len Length of desired output.
+
+@return True if and only if the output was generated. This only fails if the DRBG
+  could not be (re)seeded from the operating system.
+*/
+bool EverCrypt_Random_bytes(uint8_t *output, uint32_t len);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __EverCrypt_Random_H_DEFINED
+#endif
@@ -0,0 +1,171 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_AEAD_XChacha20Poly1305_Simd256_H
+#define __Hacl_AEAD_XChacha20Poly1305_Simd256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_AEAD_Chacha20Poly1305_Simd256.h"
+
+/**
+Encrypt a message `input` with key `key` and a 24-byte extended nonce.
+
+The nonce is long enough to be drawn at random for every message. The first 16 bytes
+of `nonce` derive a subkey with HChaCha20, and the message is encrypted with
+ChaCha20-Poly1305 under that subkey and the last 8 bytes of `nonce`.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `input` and `output` can point to the same memory.
+
+@param output Pointer to `input_len` bytes of memory where the ciphertext is written to.
+@param tag Pointer to 16 bytes of memory where the mac is written to.
+@param input Pointer to `input_len` bytes of memory where the message is read from.
+@param input_len Length of the message.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 24 bytes of memory where the AEAD nonce is read from.
+*/
+void
+Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+);
+
+/**
+Decrypt a ciphertext `input` with key `key` and a 24-byte extended nonce.
+
+The arguments `key`, `nonce`, `data`, and `data_len` are same in encryption/decryption.
+Note: Encryption and decryption can be executed in-place, i.e., `input` and `output` can point to the same memory.
+
+If decryption succeeds, the resulting plaintext is stored in `output` and the function returns the success code 0.
+If decryption fails, the array `output` remains unchanged and the function returns the error code 1.
+
+@param output Pointer to `input_len` bytes of memory where the message is written to.
+@param input Pointer to `input_len` bytes of memory where the ciphertext is read from.
+@param input_len Length of the ciphertext.
+@param data Pointer to `data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to 24 bytes of memory where the AEAD nonce is read from.
+@param tag Pointer to 16 bytes of memory where the mac is read from.
+
+@returns 0 on succeess; 1 on failure.
+*/
+uint32_t
+Hacl_AEAD_XChacha20Poly1305_Simd256_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+);
+
+/**
+Encrypt `n` messages of `input_len` bytes each under the same key, each with its own nonce.
+
+The messages, ciphertexts, tags, associated data and nonces are stored one after the
+other. The HChaCha20 subkeys of 8 objects are derived at once, one per vector lane.
+The result is the same as calling `Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt` on every message.
+
+@param n Number of messages.
+@param output Pointer to `n * input_len` bytes of memory where the ciphertexts are written to.
+@param tag Pointer to `n * 16` bytes of memory where the macs are written to.
+@param input Pointer to `n * input_len` bytes of memory where the messages are read from.
+@param input_len Length of each message.
+@param data Pointer to `n * data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data of each message.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to `n * 24` bytes of memory where the AEAD nonces are read from.
+*/
+void
+Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt_batch(
+  uint32_t n,
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+);
+
+/**
+Decrypt `n` ciphertexts of `input_len` bytes each, laid out as by
+`Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt_batch`.
+
+Every ciphertext is verified and decrypted independently: the plaintext of each
+authentic ciphertext is written to `output`, and the output of any other is left unchanged.
+
+@param n Number of ciphertexts.
+@param output Pointer to `n * input_len` bytes of memory where the messages are written to.
+@param input Pointer to `n * input_len` bytes of memory where the ciphertexts are read from.
+@param input_len Length of each ciphertext.
+@param data Pointer to `n * data_len` bytes of memory where the associated data is read from.
+@param data_len Length of the associated data of each ciphertext.
+@param key Pointer to 32 bytes of memory where the AEAD key is read from.
+@param nonce Pointer to `n * 24` bytes of memory where the AEAD nonces are read from.
+@param tag Pointer to `n * 16` bytes of memory where the macs are read from.
+
+@returns 0 if every ciphertext is authentic; 1 otherwise.
+*/
+uint32_t
+Hacl_AEAD_XChacha20Poly1305_Simd256_decrypt_batch(
+  uint32_t n,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_AEAD_XChacha20Poly1305_Simd256_H_DEFINED
+#endif
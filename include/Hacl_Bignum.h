@@ -56,6 +56,14 @@ typedef struct Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64_s
 }
 Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64;
 
+typedef struct Hacl_Bignum_MontArithmetic_bn_mont_table_u64_s
+{
+  uint32_t len;
+  uint32_t wBits;
+  uint64_t *table;
+}
+Hacl_Bignum_MontArithmetic_bn_mont_table_u64;
+
 #if defined(__cplusplus)
 }
 #endif
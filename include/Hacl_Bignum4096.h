@@ -57,6 +57,12 @@ We strongly encourage users to go through the conversion functions, e.g.
 bn_from_bytes_be, to i) not depend on internal representation choices and ii)
 have the ability to switch easily to a 32-bit optimized version in the future.
 
+The multiplication and Montgomery reduction kernels are chosen at run time. The
+library starts with the portable ones; `EverCrypt_Dispatch_init` installs the
+ADX ones when the CPU supports them. It runs when the library is loaded with GCC,
+Clang and MSVC, but a static link only includes it if the program references
+EverCrypt_Dispatch; call `EverCrypt_Dispatch_init` once to make sure.
+
 *******************************************************************************/
 
 /************************/
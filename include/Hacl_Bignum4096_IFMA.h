@@ -0,0 +1,115 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Bignum4096_IFMA_H
+#define __Hacl_Bignum4096_IFMA_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/*******************************************************************************
+
+Constant-time modular exponentiation for bignums of up to 4096 bits on top of
+AVX-512 IFMA (VPMADD52LUQ/VPMADD52HUQ).
+
+Operands use the same representation as Hacl_Bignum64, i.e. `len` little-endian
+64-bit limbs, and the same precomputed values as a
+Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64. Internally, they are converted to
+radix 2^52 and multiplied with an almost Montgomery multiplication.
+
+These functions must only be called when EverCrypt_AutoConfig2_has_avx512ifma
+returns true. EverCrypt_Bignum4096 and EverCrypt_FFDHE dispatch here
+automatically.
+
+*******************************************************************************/
+
+/**
+Write `a ^ b mod n` in `res`.
+
+  The arguments n, a and the outparam res are meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument mu is `-n^(-1) mod 2^64` and r2 is `2^(128 * len) mod n`.
+
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b. This function is constant-time over a and b.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • 0 < len <= 64
+  • n % 2 = 1
+  • 1 < n
+  • a < n
+*/
+void
+Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
+/**
+Write `a0 ^ b0 mod n0` in `res0` and `a1 ^ b1 mod n1` in `res1`.
+
+  This computes two independent exponentiations with the same shape, e.g. the two
+  halves of an RSA-CRT private key operation, interleaving their Montgomery
+  multiplications so that each one hides the latency of the other.
+
+  The arguments are as for Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp, both
+  moduli are `len` limbs in size and bBits bounds the size of both b0 and b1.
+*/
+void
+Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp2(
+  uint32_t len,
+  uint64_t *n0,
+  uint64_t mu0,
+  uint64_t *r20,
+  uint64_t *a0,
+  uint64_t *b0,
+  uint64_t *res0,
+  uint64_t *n1,
+  uint64_t mu1,
+  uint64_t *r21,
+  uint64_t *a1,
+  uint64_t *b1,
+  uint64_t *res1,
+  uint32_t bBits
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Bignum4096_IFMA_H_DEFINED
+#endif
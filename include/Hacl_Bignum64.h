@@ -40,6 +40,8 @@ extern "C" {
 
 typedef Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *Hacl_Bignum64_pbn_mont_ctx_u64;
 
+typedef Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *Hacl_Bignum64_pbn_mont_table_u64;
+
 /*******************************************************************************
 
 A verified bignum library.
@@ -47,6 +49,12 @@ A verified bignum library.
 This is a 64-bit optimized version, where bignums are represented as an array
 of `len` unsigned 64-bit integers, i.e. uint64_t[len].
 
+The multiplication and Montgomery reduction kernels are chosen at run time. The
+library starts with the portable ones; `EverCrypt_Dispatch_init` installs the
+ADX ones when the CPU supports them. It runs when the library is loaded with GCC,
+Clang and MSVC, but a static link only includes it if the program references
+EverCrypt_Dispatch; call `EverCrypt_Dispatch_init` once to make sure.
+
 *******************************************************************************/
 
 /************************/
@@ -322,6 +330,62 @@ Hacl_Bignum64_mod_inv_prime_vartime_precomp(
   uint64_t *res
 );
 
+/**
+Precompute the powers of `a` used by Hacl_Bignum64_mod_exp_vartime_table.
+
+  The argument a is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+
+  The argument bBits is the largest exponent size the table will be used with;
+  it selects the window size, i.e. how many powers are precomputed. The table
+  can be reused for any number of exponentiations of the same base with the
+  same modulus, e.g. when verifying several signatures against one key.
+
+  The caller will need to call Hacl_Bignum64_mont_table_free on the return value
+  to avoid memory leaks.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • a < n
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_table_u64
+*Hacl_Bignum64_mont_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits
+);
+
+/**
+Deallocate the memory previously allocated by Hacl_Bignum64_mont_table_init.
+
+  The argument t is a table obtained through Hacl_Bignum64_mont_table_init.
+*/
+void Hacl_Bignum64_mont_table_free(Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *t);
+
+/**
+Write `a ^ b mod n` in `res`, where `a` is the base of the table t.
+
+  The outparam res is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is the montgomery context t was obtained with.
+
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  The function is *NOT* constant-time on the argument b.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+void
+Hacl_Bignum64_mod_exp_vartime_table(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *t,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
 
 /********************/
 /* Loads and stores */
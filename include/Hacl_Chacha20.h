@@ -55,6 +55,15 @@ Hacl_Chacha20_chacha20_decrypt(
   uint32_t ctr
 );
 
+/**
+Derive a subkey with HChaCha20, as used by XChaCha20.
+
+@param out Pointer to 32 bytes of memory where the subkey is written to.
+@param key Pointer to 32 bytes of memory where the key is read from.
+@param n Pointer to 16 bytes of memory where the first part of the extended nonce is read from.
+*/
+void Hacl_Chacha20_hchacha20(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -55,6 +55,15 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   uint32_t ctr
 );
 
+/**
+Derive 4 independent subkeys at once with HChaCha20, one per vector lane.
+
+@param out Pointer to 4 * 32 bytes of memory where the subkeys are written to.
+@param key Pointer to 4 * 32 bytes of memory where the keys are read from.
+@param n Pointer to 4 * 16 bytes of memory where the nonces are read from.
+*/
+void Hacl_Chacha20_Vec128_hchacha20_128(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #if defined(__cplusplus)
 }
 #endif
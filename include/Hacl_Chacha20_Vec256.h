@@ -55,6 +55,15 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   uint32_t ctr
 );
 
+/**
+Derive 8 independent subkeys at once with HChaCha20, one per vector lane.
+
+@param out Pointer to 8 * 32 bytes of memory where the subkeys are written to.
+@param key Pointer to 8 * 32 bytes of memory where the keys are read from.
+@param n Pointer to 8 * 16 bytes of memory where the nonces are read from.
+*/
+void Hacl_Chacha20_Vec256_hchacha20_256(uint8_t *out, uint8_t *key, uint8_t *n);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,104 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __Hacl_Frodo1344_AES_H
+#define __Hacl_Frodo1344_AES_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_Hash_SHA3.h"
+
+extern uint32_t Hacl_Frodo1344_AES_crypto_bytes;
+
+extern uint32_t Hacl_Frodo1344_AES_crypto_publickeybytes;
+
+extern uint32_t Hacl_Frodo1344_AES_crypto_secretkeybytes;
+
+extern uint32_t Hacl_Frodo1344_AES_crypto_ciphertextbytes;
+
+uint32_t Hacl_Frodo1344_AES_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+
+uint32_t Hacl_Frodo1344_AES_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+uint32_t Hacl_Frodo1344_AES_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+/**
+Generate a key pair from the 80-byte coins, i.e. s || seedSE || z in the FrodoKEM
+specification.
+*/
+void Hacl_Frodo1344_AES_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins);
+
+/**
+Encapsulate with the 32-byte coins, i.e. mu in the FrodoKEM specification.
+
+  Returns as Hacl_Frodo1344_AES_crypto_kem_enc.
+*/
+uint32_t
+Hacl_Frodo1344_AES_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins);
+
+/**
+The size in bytes of the scratch memory taken by the `_scratch` functions below.
+
+They keep every matrix in scratch instead of on the stack, so that they can run
+on threads and coroutines with small stacks. The memory must not be shared by
+concurrent calls, and it may hold intermediate values derived from secrets on
+return, so it should be cleared before it is released.
+*/
+uint32_t Hacl_Frodo1344_AES_scratch_size(void);
+
+/**
+Same as Hacl_Frodo1344_AES_crypto_kem_keypair, with Hacl_Frodo1344_AES_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo1344_AES_crypto_kem_keypair_scratch(uint8_t *pk, uint8_t *sk, uint16_t *scratch);
+
+/**
+Same as Hacl_Frodo1344_AES_crypto_kem_enc, with Hacl_Frodo1344_AES_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo1344_AES_crypto_kem_enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint16_t *scratch);
+
+/**
+Same as Hacl_Frodo1344_AES_crypto_kem_dec, with Hacl_Frodo1344_AES_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo1344_AES_crypto_kem_dec_scratch(uint8_t *ss, uint8_t *ct, uint8_t *sk, uint16_t *scratch);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Frodo1344_AES_H_DEFINED
+#endif
@@ -51,6 +51,50 @@ uint32_t Hacl_Frodo640_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
 
 uint32_t Hacl_Frodo640_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
 
+/**
+Generate a key pair from the 48-byte coins, i.e. s || seedSE || z in the FrodoKEM
+specification.
+*/
+void Hacl_Frodo640_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins);
+
+/**
+Encapsulate with the 16-byte coins, i.e. mu in the FrodoKEM specification.
+
+  Returns as Hacl_Frodo640_crypto_kem_enc.
+*/
+uint32_t Hacl_Frodo640_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins);
+
+/**
+The size in bytes of the scratch memory taken by the `_scratch` functions below.
+
+They keep every matrix in scratch instead of on the stack, so that they can run
+on threads and coroutines with small stacks. The memory must not be shared by
+concurrent calls, and it may hold intermediate values derived from secrets on
+return, so it should be cleared before it is released.
+*/
+uint32_t Hacl_Frodo640_scratch_size(void);
+
+/**
+Same as Hacl_Frodo640_crypto_kem_keypair, with Hacl_Frodo640_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo640_crypto_kem_keypair_scratch(uint8_t *pk, uint8_t *sk, uint16_t *scratch);
+
+/**
+Same as Hacl_Frodo640_crypto_kem_enc, with Hacl_Frodo640_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo640_crypto_kem_enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint16_t *scratch);
+
+/**
+Same as Hacl_Frodo640_crypto_kem_dec, with Hacl_Frodo640_scratch_size() bytes of
+scratch memory.
+*/
+uint32_t
+Hacl_Frodo640_crypto_kem_dec_scratch(uint8_t *ss, uint8_t *ct, uint8_t *sk, uint16_t *scratch);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -53,6 +53,12 @@ All the functions below preserve the following invariant for a bignum `aM` in
 Montgomery form.
   • aM < n
 
+The multiplication and Montgomery reduction kernels are chosen at run time. The
+library starts with the portable ones; `EverCrypt_Dispatch_init` installs the
+ADX ones when the CPU supports them. It runs when the library is loaded with GCC,
+Clang and MSVC, but a static link only includes it if the program references
+EverCrypt_Dispatch; call `EverCrypt_Dispatch_init` once to make sure.
+
 *******************************************************************************/
 
 
@@ -262,6 +268,87 @@ Hacl_GenericField64_inverse(
   uint64_t *aInvM
 );
 
+/**
+Write `aM[i] ^ (-1) mod n` in `aInvM[i]` for each of the `count` elements of aM.
+
+  The arguments aM and aInvM are meant to be `count` consecutive field elements
+  of `len` limbs each, i.e. uint64_t[count * len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  This uses Montgomery's trick, i.e. a single inversion and 3 * (count - 1)
+  multiplications. This function is constant-time over the elements of aM.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • n is a prime
+  • 0 < count
+  • 0 < aM[i] for all i
+  • aM and aInvM are disjoint
+*/
+void
+Hacl_GenericField64_batch_inverse(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint64_t *aInvM
+);
+
+/**
+Write `aM[0] ^ b[0] * ... * aM[count - 1] ^ b[count - 1] mod n` in `resM`.
+
+  The argument aM is meant to be `count` consecutive field elements of `len`
+  limbs each, i.e. uint64_t[count * len], and the outparam resM is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  The argument b is meant to be `count` consecutive bignums of `bLen` limbs each,
+  where bLen = (bBits - 1) / 64 + 1 (or 1 if bBits = 0), and bBits is an upper
+  bound on the number of significant bits of every b[i].
+
+  The bases are processed in chunks of 8 (Straus' method): the exponentiations
+  of a chunk share one chain of about bBits squarings, and each chunk keeps a
+  16-entry table per base on the stack, i.e. 128 * len limbs. The whole call
+  thus costs about ceil(count / 8) * bBits squarings, count * bBits / 4
+  multiplications and 15 * count multiplications for the tables, which is
+  several times faster than `count` calls to exp_consttime. This function is
+  constant-time over its argument b.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for all i
+*/
+void
+Hacl_GenericField64_multi_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
+/**
+Write `aM[0] ^ b[0] * ... * aM[count - 1] ^ b[count - 1] mod n` in `resM`.
+
+  The arguments are as for Hacl_GenericField64_multi_exp_consttime.
+
+  The function is *NOT* constant-time on the argument b. See the
+  multi_exp_consttime function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for all i
+*/
+void
+Hacl_GenericField64_multi_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -59,6 +59,112 @@ Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR(
   uint8_t *info
 );
 
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupAuthS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupAuthR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_context_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_context_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+uint32_t
+Hacl_HPKE_Curve51_CP32_SHA256_context_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+);
+
 uint32_t
 Hacl_HPKE_Curve51_CP32_SHA256_sealBase(
   uint8_t *skE,
@@ -35,6 +35,15 @@ extern "C" {
 #include "krml/lowstar_endianness.h"
 #include "krml/internal/target.h"
 
+/**
+An HPKE encryption context, as in Section 5 of RFC 9180.
+
+  The caller owns the buffers: ctx_key is as long as the AEAD key (32 bytes),
+  ctx_nonce is 12 bytes and ctx_exporter is as long as the KDF output (32 or 64
+  bytes). setupBaseS and setupBaseR fill them in. Every successful context_seal or
+  context_open then uses the nonce ctx_nonce XOR *ctx_seq and increments *ctx_seq,
+  so a context must not be used from two threads at once.
+*/
 typedef struct Hacl_Impl_HPKE_context_s_s
 {
   uint8_t *ctx_key;
@@ -0,0 +1,173 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_HPKE_P256MLKEM768_CP32_SHA256_H
+#define __Hacl_HPKE_P256MLKEM768_CP32_SHA256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_HPKE_Interface_Hacl_Impl_HPKE_Hacl_Meta_HPKE.h"
+
+/*******************************************************************************
+
+HPKE with a hybrid P-256 + ML-KEM-768 KEM, HKDF-SHA256 and ChaCha20-Poly1305.
+
+This is X-Wing with P-256 in place of X25519: the shared secret is
+SHA3-256(ss_M || ss_P || ct_P || pk_P || "P256MLKEM768"), where ss_P is the
+x-coordinate of the ECDH point and ct_P, pk_P are uncompressed points. It uses
+KEM identifier 0x0050 but is not a standardized construction, so it only
+interoperates with itself.
+
+Public keys are pk_M || pk_P (1249 bytes) and encapsulations ct_M || ct_P (1153
+bytes). Secret keys are kept expanded as sk_M || sk_P || pk_P (2497 bytes).
+
+*******************************************************************************/
+
+/**
+Derive a key pair from a 32-byte seed, expanded with SHAKE256 into the ML-KEM
+seeds d || z and the P-256 secret key.
+
+  Returns 1 if the derived P-256 secret key is out of range.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_keypair(uint8_t *o_pk, uint8_t *o_sk, uint8_t *seed);
+
+/**
+Encapsulate to pkR and run the key schedule into o_ctx.
+
+  skE is 64 bytes of fresh randomness: the ML-KEM-768 message m followed by the
+  ephemeral P-256 secret key. Returns 0 on success and 1 if pkR or the
+  P-256 secret key is invalid.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS(
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Decapsulate enc with skR and run the key schedule into o_ctx.
+
+  Returns 0 on success and 1 if skR or the P-256 point of enc is invalid.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+);
+
+/**
+Seal one message with the context of setupBaseS.
+
+  Returns 1 once the sequence number of ctx is exhausted.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+);
+
+/**
+Open one message with the context of setupBaseR.
+
+  Returns 1 if the tag does not verify, in which case the sequence number of ctx
+  is not incremented.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+/**
+Export l bytes of secret bound to exp_ctx.
+
+  Returns 1 if l exceeds 8160.
+*/
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+);
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_sealBase(
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_enc,
+  uint8_t *o_ct
+);
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_openBase(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_HPKE_P256MLKEM768_CP32_SHA256_H_DEFINED
+#endif
@@ -74,6 +74,29 @@ Hacl_MAC_Poly1305_Simd256_mac(
   uint8_t *key
 );
 
+/**
+Compute the Poly1305 tags of four independent messages of equal length, each
+under its own one-time key. Each message occupies one 64-bit lane of the
+vector state, so short messages do not pay for the r^4 precomputation of
+`Hacl_MAC_Poly1305_Simd256_mac`.
+*/
+void
+Hacl_MAC_Poly1305_Simd256_mac4(
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *key0,
+  uint8_t *key1,
+  uint8_t *key2,
+  uint8_t *key3
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,124 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_MLKEM768_H
+#define __Hacl_MLKEM768_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/*******************************************************************************
+
+ML-KEM-768, the module-lattice-based key-encapsulation mechanism of FIPS 203.
+
+Public keys are 1184 bytes, secret keys 2400 bytes, ciphertexts 1088 bytes
+and shared secrets 32 bytes.
+
+The NTT, the pointwise products and the expansion of the public matrix use AVX2
+when EverCrypt_AutoConfig2_has_avx2 returns true.
+
+The _batch functions run n independent operations on consecutive keys,
+ciphertexts and shared secrets, e.g. pk is uint8_t[n * 1184]. They share the
+sampling of the public matrices between operations.
+
+*******************************************************************************/
+
+extern uint32_t Hacl_MLKEM768_crypto_bytes;
+
+extern uint32_t Hacl_MLKEM768_crypto_publickeybytes;
+
+extern uint32_t Hacl_MLKEM768_crypto_secretkeybytes;
+
+extern uint32_t Hacl_MLKEM768_crypto_ciphertextbytes;
+
+/**
+Generate a key pair.
+
+  Returns 0. The randomness comes from Lib_RandomBuffer_System_crypto_random.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_keypair(uint8_t *pk, uint8_t *sk);
+
+/**
+Encapsulate a fresh shared secret ss to the public key pk.
+
+  Returns 0 on success and 1 if pk fails the modulus check of FIPS 203, in which
+  case ct and ss are not written.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+/**
+Decapsulate the shared secret ss of the ciphertext ct.
+
+  Returns 0 on success and 1 if sk fails the hash check of FIPS 203, in which case
+  ss is not written. An invalid ciphertext yields a pseudorandom shared secret.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+/**
+Generate a key pair from the 64-byte seed coins, i.e. d || z in FIPS 203.
+*/
+void Hacl_MLKEM768_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins);
+
+/**
+Encapsulate with the 32-byte message coins, i.e. m in FIPS 203.
+
+  Returns as Hacl_MLKEM768_crypto_kem_enc.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins);
+
+/**
+Generate n key pairs.
+
+  Returns 0.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_keypair_batch(uint32_t n, uint8_t *pk, uint8_t *sk);
+
+/**
+Encapsulate n shared secrets, the i-th one to the i-th public key.
+
+  Returns 1 without writing anything if one of the public keys is invalid.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_enc_batch(uint32_t n, uint8_t *ct, uint8_t *ss, uint8_t *pk);
+
+/**
+Decapsulate n ciphertexts, the i-th one with the i-th secret key.
+
+  Returns 1 without writing anything if one of the secret keys is invalid.
+*/
+uint32_t Hacl_MLKEM768_crypto_kem_dec_batch(uint32_t n, uint8_t *ss, uint8_t *ct, uint8_t *sk);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_MLKEM768_H_DEFINED
+#endif
@@ -80,6 +80,35 @@ Hacl_SHA2_Vec256_sha256_8(
   uint8_t *input7
 );
 
+/**
+Hash eight messages of equal length, each continuing from the same intermediate
+SHA-256 state `st0` (eight 32-bit words) that has already absorbed `prev_len`
+bytes, a multiple of the block size. This is the building block for computing
+several HMACs under one key, starting from the precomputed pad states.
+*/
+void
+Hacl_SHA2_Vec256_sha256_8_with_state(
+  uint32_t *st0,
+  uint64_t prev_len,
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+);
+
 void
 Hacl_SHA2_Vec256_sha384_4(
   uint8_t *dst0,
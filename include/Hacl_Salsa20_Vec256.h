@@ -0,0 +1,81 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __Hacl_Salsa20_Vec256_H
+#define __Hacl_Salsa20_Vec256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/**
+Encrypt `len` bytes with Salsa20, computing 8 blocks of keystream at a time.
+
+The output is the same as `Hacl_Salsa20_salsa20_encrypt`.
+
+@param len Length of the message.
+@param out Pointer to `len` bytes of memory where the ciphertext is written to.
+@param text Pointer to `len` bytes of memory where the message is read from.
+@param key Pointer to 32 bytes of memory where the key is read from.
+@param n Pointer to 8 bytes of memory where the nonce is read from.
+@param ctr Initial block counter.
+*/
+void
+Hacl_Salsa20_Vec256_salsa20_encrypt_256(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+);
+
+/**
+Decrypt `len` bytes with Salsa20, computing 8 blocks of keystream at a time.
+
+The output is the same as `Hacl_Salsa20_salsa20_decrypt`.
+*/
+void
+Hacl_Salsa20_Vec256_salsa20_decrypt_256(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *cipher,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __Hacl_Salsa20_Vec256_H_DEFINED
+#endif
@@ -50,6 +50,7 @@ typedef uint8_t Spec_FFDHE_ffdhe_alg;
 #define Spec_Agile_AEAD_AES256_CCM 4
 #define Spec_Agile_AEAD_AES128_CCM8 5
 #define Spec_Agile_AEAD_AES256_CCM8 6
+#define Spec_Agile_AEAD_XCHACHA20_POLY1305 7
 
 typedef uint8_t Spec_Agile_AEAD_alg;
 
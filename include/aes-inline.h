@@ -0,0 +1,78 @@
+#ifdef __GNUC__
+#if defined(__x86_64__) || defined(_M_X64)
+#pragma once
+#include <inttypes.h>
+
+// Encrypts the eight 16-byte blocks in[0..128) into out[0..128) with AES-128,
+// using the standard AES-NI key schedule rk[0..176). The eight blocks are
+// independent, so each round issues eight AESENC back to back and hides their
+// latency.
+static inline void aes128_encrypt8 (uint8_t *out, uint8_t *in, uint8_t *rk)
+{
+  __asm__ volatile(
+    "  movdqu 0(%2), %%xmm8;"
+    "  movdqu 0(%1), %%xmm0;"    "  pxor %%xmm8, %%xmm0;"
+    "  movdqu 16(%1), %%xmm1;"    "  pxor %%xmm8, %%xmm1;"
+    "  movdqu 32(%1), %%xmm2;"    "  pxor %%xmm8, %%xmm2;"
+    "  movdqu 48(%1), %%xmm3;"    "  pxor %%xmm8, %%xmm3;"
+    "  movdqu 64(%1), %%xmm4;"    "  pxor %%xmm8, %%xmm4;"
+    "  movdqu 80(%1), %%xmm5;"    "  pxor %%xmm8, %%xmm5;"
+    "  movdqu 96(%1), %%xmm6;"    "  pxor %%xmm8, %%xmm6;"
+    "  movdqu 112(%1), %%xmm7;"    "  pxor %%xmm8, %%xmm7;"
+
+    "  movdqu 16(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 32(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 48(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 64(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 80(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 96(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 112(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 128(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 144(%2), %%xmm8;"
+    "  aesenc %%xmm8, %%xmm0;"    "  aesenc %%xmm8, %%xmm1;"    "  aesenc %%xmm8, %%xmm2;"    "  aesenc %%xmm8, %%xmm3;"
+    "  aesenc %%xmm8, %%xmm4;"    "  aesenc %%xmm8, %%xmm5;"    "  aesenc %%xmm8, %%xmm6;"    "  aesenc %%xmm8, %%xmm7;"
+
+    "  movdqu 160(%2), %%xmm8;"
+    "  aesenclast %%xmm8, %%xmm0;"    "  aesenclast %%xmm8, %%xmm1;"    "  aesenclast %%xmm8, %%xmm2;"    "  aesenclast %%xmm8, %%xmm3;"
+    "  aesenclast %%xmm8, %%xmm4;"    "  aesenclast %%xmm8, %%xmm5;"    "  aesenclast %%xmm8, %%xmm6;"    "  aesenclast %%xmm8, %%xmm7;"
+
+    "  movdqu %%xmm0, 0(%0);"
+    "  movdqu %%xmm1, 16(%0);"
+    "  movdqu %%xmm2, 32(%0);"
+    "  movdqu %%xmm3, 48(%0);"
+    "  movdqu %%xmm4, 64(%0);"
+    "  movdqu %%xmm5, 80(%0);"
+    "  movdqu %%xmm6, 96(%0);"
+    "  movdqu %%xmm7, 112(%0);"
+  :
+  : "r" (out), "r" (in), "r" (rk)
+  : "%xmm0", "%xmm1", "%xmm2", "%xmm3", "%xmm4", "%xmm5", "%xmm6", "%xmm7", "%xmm8", "memory"
+  );
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+#endif /* __GNUC__ */
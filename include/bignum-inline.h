@@ -0,0 +1,44 @@
+#ifdef __GNUC__
+#if defined(__x86_64__) || defined(_M_X64)
+#pragma once
+#include <inttypes.h>
+
+// Computes res[0..4*n4) += a[0..4*n4) * b and returns the carry limb.
+// n4 must be non-zero. The products come from MULX and are accumulated with
+// two independent carry chains: ADCX folds in the high half of the previous
+// product and ADOX folds in the current limb of res. Neither MULX, LEA, MOV
+// nor JRCXZ touch the flags, so both chains survive across loop iterations.
+static inline uint64_t bn_mul_add_row4 (uint64_t *res, uint64_t *a, uint64_t b, uint64_t n4)
+{
+  uint64_t c;
+  __asm__ volatile(
+    // Clear CF and OF, and the incoming high half
+    "  xor %%r10d, %%r10d;"
+
+    "1:"
+    "  mulxq 0(%2), %%r8, %%r11;"      "  adcx %%r10, %%r8;"     "  adoxq 0(%1), %%r8;"     "  movq %%r8, 0(%1);"
+    "  mulxq 8(%2), %%r8, %%r10;"      "  adcx %%r11, %%r8;"     "  adoxq 8(%1), %%r8;"     "  movq %%r8, 8(%1);"
+    "  mulxq 16(%2), %%r8, %%r11;"     "  adcx %%r10, %%r8;"     "  adoxq 16(%1), %%r8;"    "  movq %%r8, 16(%1);"
+    "  mulxq 24(%2), %%r8, %%r10;"     "  adcx %%r11, %%r8;"     "  adoxq 24(%1), %%r8;"    "  movq %%r8, 24(%1);"
+    "  leaq 32(%1), %1;"
+    "  leaq 32(%2), %2;"
+    "  leaq -1(%3), %3;"
+    "  jrcxz 2f;"
+    "  jmp 1b;"
+    "2:"
+
+    // Fold both pending carry bits into the last high half;
+    // res + a * b < 2^(64 * (4 * n4 + 1)) so this cannot overflow
+    "  mov $0, %%r8;"
+    "  adcx %%r8, %%r10;"
+    "  adox %%r8, %%r10;"
+    "  movq %%r10, %0;"
+  : "=&r" (c), "+&r" (res), "+&r" (a), "+&c" (n4)
+  : "d" (b)
+  : "%r8", "%r10", "%r11", "memory", "cc"
+  );
+  return c;
+}
+
+#endif /* defined(__x86_64__) || defined(_M_X64) */
+#endif /* __GNUC__ */
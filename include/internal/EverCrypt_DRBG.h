@@ -0,0 +1,65 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_DRBG_H
+#define __internal_EverCrypt_DRBG_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../EverCrypt_DRBG.h"
+
+/* Known-answer entry points for the CTR_DRBG: (re)seed from the given 48 bytes
+   of `entropy_input` instead of the system generator. They return false if
+   `st` is not an AES-256 CTR_DRBG state. Not for production use. */
+
+bool
+EverCrypt_DRBG_instantiate_aes256_ctr_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+);
+
+bool
+EverCrypt_DRBG_reseed_aes256_ctr_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_DRBG_H_DEFINED
+#endif
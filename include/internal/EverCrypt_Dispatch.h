@@ -0,0 +1,129 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef __internal_EverCrypt_Dispatch_H
+#define __internal_EverCrypt_Dispatch_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_Bignum.h"
+#include "internal/Hacl_Frodo_KEM.h"
+#include "internal/Hacl_MLKEM.h"
+#include "internal/Hacl_NaCl.h"
+#include "../EverCrypt_Dispatch.h"
+#include "config.h"
+
+typedef void
+(*EverCrypt_Dispatch_aead_encrypt)(
+  uint8_t *x0,
+  uint8_t *x1,
+  uint8_t *x2,
+  uint32_t x3,
+  uint8_t *x4,
+  uint32_t x5,
+  uint8_t *x6,
+  uint8_t *x7
+);
+
+typedef uint32_t
+(*EverCrypt_Dispatch_aead_decrypt)(
+  uint8_t *x0,
+  uint8_t *x1,
+  uint32_t x2,
+  uint8_t *x3,
+  uint32_t x4,
+  uint8_t *x5,
+  uint8_t *x6,
+  uint8_t *x7
+);
+
+typedef void (*EverCrypt_Dispatch_mac)(uint8_t *x0, uint8_t *x1, uint32_t x2, uint8_t *x3);
+
+typedef void (*EverCrypt_Dispatch_secret_to_public)(uint8_t *x0, uint8_t *x1);
+
+typedef void (*EverCrypt_Dispatch_scalarmult)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+
+typedef bool (*EverCrypt_Dispatch_ecdh)(uint8_t *x0, uint8_t *x1, uint8_t *x2);
+
+typedef void (*EverCrypt_Dispatch_update_multi)(uint32_t *x0, uint8_t *x1, uint32_t x2);
+
+typedef void
+(*EverCrypt_Dispatch_mod_exp)(
+  uint32_t x0,
+  uint64_t *x1,
+  uint64_t x2,
+  uint64_t *x3,
+  uint64_t *x4,
+  uint32_t x5,
+  uint64_t *x6,
+  uint64_t *x7
+);
+
+typedef struct EverCrypt_Dispatch_table_s
+{
+  EverCrypt_Dispatch_aead_encrypt chacha20poly1305_encrypt;
+  EverCrypt_Dispatch_aead_decrypt chacha20poly1305_decrypt;
+  EverCrypt_Dispatch_mac poly1305_mac;
+  EverCrypt_Dispatch_secret_to_public curve25519_secret_to_public;
+  EverCrypt_Dispatch_scalarmult curve25519_scalarmult;
+  EverCrypt_Dispatch_ecdh curve25519_ecdh;
+  EverCrypt_Dispatch_update_multi sha2_256_update_multi;
+  const Hacl_Bignum_Kernels_u64 *bignum_kernels;
+  EverCrypt_Dispatch_mod_exp mod_exp_consttime_precomp;
+  const Hacl_Impl_Frodo_Kernels *frodo_kernels;
+  const Hacl_Impl_MLKEM_Kernels *mlkem_kernels;
+  const Hacl_Impl_NaCl_Kernels *nacl_kernels;
+  EverCrypt_Dispatch_impl impl[EverCrypt_Dispatch_COUNT];
+}
+EverCrypt_Dispatch_table;
+
+/* The implementations currently chosen by EverCrypt_Dispatch_init. It is statically
+   initialized with the portable implementations, so it is usable before the library
+   constructor runs. The slots that only have an `impl` entry (HPKE, AES_GCM,
+   CHACHA20 and SHA2_256_MB) are read by the EverCrypt modules that own the
+   implementations. */
+extern EverCrypt_Dispatch_table EverCrypt_Dispatch_functions;
+
+/* Vale implementations wrapped by the EverCrypt modules that own their constants. */
+
+#if HACL_CAN_COMPILE_VALE
+void EverCrypt_Poly1305_mac_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key);
+
+void EverCrypt_Hash_update_multi_256_vale(uint32_t *s, uint8_t *blocks, uint32_t n);
+#endif
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_EverCrypt_Dispatch_H_DEFINED
+#endif
@@ -98,6 +98,19 @@ EverCrypt_HMAC_compute_blake2b(
   uint32_t data_len
 );
 
+/**
+Same as `EverCrypt_HMAC_compute_with_key`, using `scratch`, a hash state of the
+key's algorithm, as working space instead of allocating one.
+*/
+void
+EverCrypt_HMAC_compute_with_key_in(
+  EverCrypt_HMAC_key_t *k,
+  EverCrypt_Hash_state_s *scratch,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -47,8 +47,36 @@ extern "C" {
 #include "internal/Hacl_Hash_Blake2b.h"
 #include "../EverCrypt_Hash.h"
 
+Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s);
+
+EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg a);
+
+void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s);
+
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n);
 
+void
+EverCrypt_Hash_update_multi(
+  EverCrypt_Hash_state_s *s,
+  uint64_t prevlen,
+  uint8_t *blocks,
+  uint32_t len
+);
+
+void
+EverCrypt_Hash_update_last(
+  EverCrypt_Hash_state_s *s,
+  uint64_t prev_len,
+  uint8_t *last,
+  uint32_t last_len
+);
+
+void EverCrypt_Hash_finish(EverCrypt_Hash_state_s *s, uint8_t *dst);
+
+void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s);
+
+void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *s_dst);
+
 void EverCrypt_Hash_Incremental_hash_256(uint8_t *output, uint8_t *input, uint32_t input_len);
 
 #if defined(__cplusplus)
@@ -40,6 +40,77 @@ extern "C" {
 #include "../Hacl_Bignum.h"
 #include "lib_intrinsics.h"
 
+/**
+The 64-bit kernels under the generic bignum code: the schoolbook multiplication
+  and squaring used below the Karatsuba thresholds, the row multiply-accumulate
+  and the Montgomery reductions.
+
+  Hacl_Bignum_Kernels_portable_u64 is always available. Hacl_Bignum_Kernels_adx_u64
+  uses MULX/ADCX/ADOX; it is only defined when HACL_CAN_COMPILE_INLINE_ASM is set
+  and must only be installed on CPUs with BMI2 and ADX.
+*/
+typedef struct Hacl_Bignum_Kernels_u64_s
+{
+  uint32_t karatsuba_mul_threshold;
+  uint32_t karatsuba_sqr_threshold;
+  uint64_t (*mul1_add)(uint32_t len, uint64_t *a, uint64_t b, uint64_t *res);
+  void (*mul)(uint32_t aLen, uint64_t *a, uint32_t bLen, uint64_t *b, uint64_t *res);
+  void (*sqr)(uint32_t aLen, uint64_t *a, uint64_t *res);
+  void (*mont_reduction)(uint32_t len, uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res);
+  void
+  (*almost_mont_reduction)(uint32_t len, uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res);
+}
+Hacl_Bignum_Kernels_u64;
+
+extern const Hacl_Bignum_Kernels_u64 Hacl_Bignum_Kernels_portable_u64;
+
+extern const Hacl_Bignum_Kernels_u64 Hacl_Bignum_Kernels_adx_u64;
+
+/**
+Install the kernels used by the 64-bit bignum code from now on.
+
+  The library starts with Hacl_Bignum_Kernels_portable_u64; EverCrypt_Dispatch_init
+  installs the ADX ones when the CPU supports them. A static link that does not
+  reference EverCrypt_Dispatch keeps the portable kernels. The pointer is replaced
+  atomically, so an operation running concurrently uses either the old or the new
+  kernels.
+*/
+void Hacl_Bignum_Kernels_set_u64(const Hacl_Bignum_Kernels_u64 *k);
+
+/**
+Return the kernels currently used by the 64-bit bignum code.
+*/
+const Hacl_Bignum_Kernels_u64 *Hacl_Bignum_Kernels_get_u64(void);
+
+void
+Hacl_Bignum_Adx_bn_mul_u64(
+  uint32_t aLen,
+  uint64_t *a,
+  uint32_t bLen,
+  uint64_t *b,
+  uint64_t *res
+);
+
+void Hacl_Bignum_Adx_bn_sqr_u64(uint32_t aLen, uint64_t *a, uint64_t *res);
+
+void
+Hacl_Bignum_Adx_bn_mont_reduction_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+);
+
+void
+Hacl_Bignum_Adx_bn_almost_mont_reduction_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+);
+
 void
 Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint32(
   uint32_t aLen,
@@ -292,6 +363,32 @@ Hacl_Bignum_Exponentiation_bn_check_mod_exp_u64(
   uint64_t *b
 );
 
+uint32_t Hacl_Bignum_Exponentiation_bn_exp_vartime_window_bits(uint32_t bBits);
+
+void
+Hacl_Bignum_Exponentiation_bn_precomp_odd_powers_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t wBits,
+  uint64_t *table
+);
+
+void
+Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_table_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t wBits,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+);
+
 void
 Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(
   uint32_t len,
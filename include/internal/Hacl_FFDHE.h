@@ -0,0 +1,89 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_FFDHE_H
+#define __internal_Hacl_FFDHE_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "internal/Hacl_Bignum.h"
+#include "../Hacl_FFDHE.h"
+
+/**
+A constant-time modular exponentiation with the arguments of
+  Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64.
+*/
+typedef void
+(*Hacl_FFDHE_mod_exp)(
+  uint32_t x0,
+  uint64_t *x1,
+  uint64_t x2,
+  uint64_t *x3,
+  uint64_t *x4,
+  uint32_t x5,
+  uint64_t *x6,
+  uint64_t *x7
+);
+
+/**
+Same as Hacl_FFDHE_ffdhe_secret_to_public_precomp, but raises the generator with
+  `exp` instead of the fixed-base comb.
+*/
+void
+Hacl_FFDHE_ffdhe_secret_to_public_precomp_exp(
+  Hacl_FFDHE_mod_exp exp,
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk
+);
+
+/**
+Same as Hacl_FFDHE_ffdhe_shared_secret_precomp, with the exponentiation `exp`.
+*/
+uint64_t
+Hacl_FFDHE_ffdhe_shared_secret_precomp_exp(
+  Hacl_FFDHE_mod_exp exp,
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk,
+  uint8_t *ss
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_FFDHE_H_DEFINED
+#endif
@@ -0,0 +1,1800 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef __internal_Hacl_FFDHE_PrecompTable_H
+#define __internal_Hacl_FFDHE_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+static const
+uint64_t
+Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_2048[512U] =
+  {
+    1ULL, 8616720652127675240ULL, 4110860504540188677ULL, 4211163054503197773ULL,
+    14144121169518649338ULL, 4323953603796554380ULL, 8192309187197107836ULL, 7966024840978791424ULL,
+    4597044040449118366ULL, 7060803219010100499ULL, 17651955733026411151ULL, 5884254285051282662ULL,
+    16334764051874099723ULL, 5086012348022918039ULL, 3384268977381776388ULL, 4896906469902582942ULL,
+    14939343422031758981ULL, 16289140927792027850ULL, 2114851401515407245ULL,
+    7471739577835287688ULL, 5379809933286454986ULL, 8835106627185206540ULL, 15838045949444854063ULL,
+    3179788908133259934ULL, 684069943791820421ULL, 9426065479060130343ULL, 3705444559692808454ULL,
+    6205619158396947460ULL, 2830013720935188842ULL, 5774645926098551566ULL, 5910881771259737445ULL,
+    0ULL, 2ULL, 17233441304255350480ULL, 8221721009080377354ULL, 8422326109006395546ULL,
+    9841498265327747060ULL, 8647907207593108761ULL, 16384618374394215672ULL,
+    15932049681957582848ULL, 9194088080898236732ULL, 14121606438020200998ULL,
+    16857167392343270686ULL, 11768508570102565325ULL, 14222784030038647830ULL,
+    10172024696045836079ULL, 6768537954763552776ULL, 9793812939805165884ULL,
+    11431942770353966346ULL, 14131537781874504085ULL, 4229702803030814491ULL,
+    14943479155670575376ULL, 10759619866572909972ULL, 17670213254370413080ULL,
+    13229347825180156510ULL, 6359577816266519869ULL, 1368139887583640842ULL, 405386884410709070ULL,
+    7410889119385616909ULL, 12411238316793894920ULL, 5660027441870377684ULL,
+    11549291852197103132ULL, 11821763542519474890ULL, 0ULL, 5125846487394259921ULL,
+    10770087541877544987ULL, 1613832506802342784ULL, 6074631849649421731ULL,
+    12440075180724826333ULL, 14827368869694517870ULL, 12652738944566136824ULL,
+    9784735558087578366ULL, 9357367893040747508ULL, 13605155801640626138ULL, 743065988130070591ULL,
+    3686412832182587831ULL, 4690721429226684360ULL, 1367168918791665899ULL, 4067465180905267932ULL,
+    2180543071902943178ULL, 18162773507746925512ULL, 15352227562630001043ULL,
+    5427844020790291108ULL, 6405117106714632177ULL, 14530649084515533305ULL,
+    17929325994908951087ULL, 6396257326796480345ULL, 11025373116724906834ULL,
+    3001864415995209581ULL, 10665341172510340164ULL, 14761304317288019567ULL,
+    7640232162296115065ULL, 1649401997030544785ULL, 923920925970699836ULL, 10500551324086478690ULL,
+    14673315312877899348ULL, 10251692974788519843ULL, 11710151662173213598ULL,
+    7338525518144874246ULL, 16360426753802041235ULL, 2130783383549198772ULL,
+    15531947269476038506ULL, 15051043002619829869ULL, 9088751883444396541ULL,
+    4865035752821061767ULL, 15824370748581801160ULL, 691343635577000718ULL, 13257079949416458325ULL,
+    7269462836617916827ULL, 7820350185606249838ULL, 11519199339192312252ULL, 9257992613708469298ULL,
+    14371402290106506773ULL, 10100107905632926706ULL, 12970539443095989463ULL,
+    1835229717555000426ULL, 15994364028607969981ULL, 7800270469584005483ULL,
+    10183816529328263139ULL, 6783791067873521987ULL, 6687798775782239584ULL,
+    12310003750371259055ULL, 14781309120559295973ULL, 3039339409279625975ULL,
+    6128817714996278413ULL, 7622487778039951238ULL, 8465240345723143209ULL, 10899886552046247081ULL,
+    10274430634823821383ULL, 4331579066965516851ULL, 12371455381168943042ULL,
+    11641762920895174824ULL, 16096221985221827423ULL, 4994765401757877266ULL,
+    3730611656679661023ULL, 17429139084351569635ULL, 15329715237074226266ULL,
+    13567806251020268629ULL, 8439671371662585183ULL, 9477770861938723577ULL, 6054299510907669787ULL,
+    11273316265300865323ULL, 11208947966898619413ULL, 1708830325897496673ULL,
+    15385014713536788594ULL, 15609885261175060180ULL, 5562663695554965782ULL,
+    3372006745781353346ULL, 5143237800682696096ULL, 14620281616396729629ULL, 3865951981000483346ULL,
+    12877670423078710887ULL, 16265213825624980841ULL, 6134003625097665050ULL,
+    16698135761701821777ULL, 15670457305643280586ULL, 17865480482900835718ULL,
+    9136746580839623203ULL, 17197657893904562205ULL, 13922732782367025252ULL,
+    2102117195938091151ULL, 17279878786058708943ULL, 10407027193168523145ULL,
+    9047944822583995806ULL, 9443076992543200953ULL, 14313484407312308914ULL,
+    15653532500556429882ULL, 5930814862262827462ULL, 16809730440888019284ULL,
+    15749671647341086142ULL, 16084554402642029902ULL, 6393051935219178201ULL,
+    9996618999979887682ULL, 9185900804915097070ULL, 7355420837469463599ULL, 8314567121697576289ULL,
+    8815884701686232937ULL, 10615423302723044980ULL, 13240178792625338811ULL,
+    14215753069397994380ULL, 15666285534651847178ULL, 1182181712559562566ULL,
+    5123205837736269141ULL, 10488385680581130093ULL, 14767753521332230488ULL,
+    3247328655545908828ULL, 208227935677348777ULL, 653045622264405402ULL, 1667486539317757048ULL,
+    5601395014068246358ULL, 3412709411649758624ULL, 9398721491024498890ULL, 17585615074484463336ULL,
+    9558371051136662233ULL, 8220097227756288256ULL, 13063683640626030536ULL,
+    11403490885478589438ULL, 2559073330770727718ULL, 5330076620059273977ULL, 2861518316094819596ULL,
+    16526120305450213245ULL, 5543894393959938321ULL, 5043773369668603230ULL, 1773120270678714793ULL,
+    15601229662259936993ULL, 5373782928548465751ULL, 16403957531027220823ULL,
+    8648002698390075647ULL, 3714620912268627992ULL, 12813635744611512859ULL, 9183054214602289056ULL,
+    5874709910215819092ULL, 4319804507305633449ULL, 6290841818750439792ULL, 398102795299679450ULL,
+    7332712835667050125ULL, 1763435033753006549ULL, 7591365440344202554ULL, 2986833666915448228ULL,
+    16636713392767450308ULL, 6263198217155888928ULL, 10277960260434054112ULL,
+    6861172312217049699ULL, 11727515268762537663ULL, 16724486075259375057ULL,
+    9286718680691448091ULL, 2104310886343213574ULL, 11891786262045707230ULL, 57614793056724983ULL,
+    9442100265338009818ULL, 405718353606104174ULL, 13689061473168430617ULL, 755796503930441624ULL,
+    18148592006929977143ULL, 9292758398654065995ULL, 9430494826408712249ULL,
+    10643735228974870477ULL, 15833578205119849543ULL, 17745439965726666418ULL,
+    3746167792973182621ULL, 3921841172859463350ULL, 5022924269595950337ULL, 2034215757010433743ULL,
+    774415324557374257ULL, 14019418947897721885ULL, 2970046190976534508ULL, 16634251540044212964ULL,
+    17845214579467360184ULL, 4210940011297833519ULL, 6162052286038983835ULL, 9679111893523704911ULL,
+    2585557796512744844ULL, 15356410155246966700ULL, 7883822373257108174ULL, 1186482321984285228ULL,
+    5008286463815523711ULL, 15048133959055595040ULL, 8245533682076879305ULL, 8007016779878397177ULL,
+    10937494797348826054ULL, 14011039171810138585ULL, 8275675228548706620ULL,
+    16608195779649609447ULL, 9248295947387554036ULL, 8672737523189627411ULL,
+    11008079446110097451ULL, 7495737444841369320ULL, 12038769612117291805ULL,
+    15592459078705444151ULL, 2730675289086431718ULL, 4534349525117289898ULL, 8264636815118947896ULL,
+    9201749861639317178ULL, 4224721144644679586ULL, 14372875175858242141ULL,
+    17499780468831913253ULL, 4624133591605539208ULL, 18373959240996273064ULL,
+    16027117004529392614ULL, 7246102767513944813ULL, 12112526655420294975ULL,
+    17486345132006437925ULL, 5507651921018979727ULL, 14088603629824056015ULL, 249753238897298283ULL,
+    17937934449335251222ULL, 14075270723960647521ULL, 1207845397318214627ULL,
+    11649523844401638464ULL, 16491067364153758611ULL, 16014033559756794354ULL,
+    3428245520988100492ULL, 9575334269910725555ULL, 16551350457097413241ULL,
+    14769647485589667278ULL, 49847821065556457ULL, 17345475046379254823ULL, 3569414818510643286ULL,
+    14991474889682738641ULL, 5630795150525031994ULL, 12738174083701336687ULL,
+    5461350578172863437ULL, 9068699050234579796ULL, 16529273630237895792ULL,
+    18403499723278634356ULL, 8449442289289359172ULL, 10299006278006932666ULL,
+    16552816863954274891ULL, 9248267183211078417ULL, 18301174408282994512ULL,
+    13607489935349233613ULL, 14492205535027889627ULL, 5778309237131038334ULL,
+    16525946190303324235ULL, 11015303842037959455ULL, 9730463185938560414ULL, 499506477794596567ULL,
+    17429124824960950828ULL, 9703797374211743427ULL, 2415690794636429255ULL,
+    17237686469956393623ULL, 13363213394704711337ULL, 11551420569966293880ULL,
+    15826158751037942189ULL, 12675246672548061893ULL, 17068814569848645530ULL,
+    5589073165678600830ULL, 11701718596142391868ULL, 6790346695917084506ULL, 2014565510318950669ULL,
+    11106529365754735115ULL, 5393601607271770561ULL, 10654627968868048591ULL,
+    17205165063810056818ULL, 5716941846718649531ULL, 10122121557065931085ULL,
+    2861995908086451328ULL, 14575633132756453164ULL, 11502142465835480153ULL,
+    9679843542141260856ULL, 14675178078918971528ULL, 5419278685759632336ULL,
+    13908204286483315770ULL, 13585397088887629650ULL, 6386214313867757743ULL,
+    1011430946292331319ULL, 11563849991202577513ULL, 4274059336481549052ULL,
+    16243390493880145548ULL, 3635495876887043615ULL, 1629867393589050521ULL, 5585032769050498875ULL,
+    16028628866203235630ULL, 8279682715699871059ULL, 4656097066223036145ULL,
+    13205573428366332763ULL, 6903749271386572171ULL, 15690885065987739445ULL,
+    11178146331357201661ULL, 4956693118575232120ULL, 13580693391834169013ULL,
+    4029131020637901338ULL, 3766314657799918614ULL, 10787203214543541123ULL, 2862511864026545566ULL,
+    15963586053910562021ULL, 11433883693437299063ULL, 1797499040422310554ULL,
+    5723991816172902657ULL, 10704522191803354712ULL, 4557540857961408691ULL, 912943010572970097ULL,
+    10903612084128391441ULL, 10838557371519264673ULL, 9369664499257079924ULL,
+    8724050104065707685ULL, 12772428627735515487ULL, 2022861892584662638ULL, 4680955908695603410ULL,
+    8548118672963098105ULL, 14040036914050739480ULL, 7270991753774087231ULL, 3259734787178101042ULL,
+    11170065538100997750ULL, 18334754495137922790ULL, 12621576869300609821ULL,
+    15018708187870357398ULL, 15031253289150744130ULL, 8039142529659061484ULL,
+    18108052903560064930ULL, 16093095799956133901ULL, 14939061117653222824ULL,
+    2154149836279609058ULL, 14544899069888022653ULL, 6987246010362141639ULL, 1855771075912086780ULL,
+    1823346459157837486ULL, 10686243927635922532ULL, 219970914475676027ULL, 8924268997923009830ULL,
+    5399977621487264887ULL, 15520913528534588138ULL, 2219792709156122707ULL,
+    12177104622847603003ULL, 20466937358833603ULL, 4536328678714966398ULL, 183189263498649466ULL,
+    9769476994985337019ULL, 15897620440277911834ULL, 5247276970474383548ULL,
+    11655872387760116102ULL, 1131021367003747360ULL, 612835368883090219ULL, 17103302196205396919ULL,
+    17153051050434800580ULL, 10059639438532876146ULL, 18222764916566293965ULL,
+    15413130317019343267ULL, 15701532806571351858ULL, 15826925559095134418ULL,
+    11775662155127220691ULL, 3646571263497581009ULL, 3485012639690272408ULL, 950658928866133842ULL,
+    8905343713008336484ULL, 17703857285076594189ULL, 13179703680041142814ULL,
+    9595796436875456223ULL, 1534712896480223079ULL, 8011756129585211488ULL, 3824210806333128443ULL,
+    4298700392039050986ULL, 7292554591296737140ULL, 10437479837442100895ULL, 6554436819827652661ULL,
+    13379204749820942078ULL, 5420743808004122193ULL, 17907763984615139336ULL,
+    16204424476442152995ULL, 4271998824394382356ULL, 14032566750638092474ULL,
+    1473875346299345824ULL, 8570445261503489043ULL, 8467661892404442181ULL, 4055684458701369280ULL,
+    3087762171090242172ULL, 3323495724710235375ULL, 1672534803356200678ULL, 16008606427556150557ULL,
+    14696039084209209293ULL, 16492572292270987697ULL, 17659188458025791437ULL,
+    5275981490361469289ULL, 3531538908644371201ULL, 10167201012736107695ULL, 1312330679527377738ULL,
+    14478353749515767068ULL, 15781065463511944090ULL, 9336349890141266043ULL,
+    18236614920005990027ULL, 4315774860284079968ULL, 17831096038332524769ULL,
+    4298059100968639169ULL, 8472028315033755796ULL, 10843785310575738874ULL,
+    16492798194759914397ULL, 5027926449479902579ULL, 10018126584658821413ULL,
+    6291935006259190497ULL, 17606173945445985374ULL, 5226815340913413909ULL, 5052166941663859408ULL,
+    7944682143129797044ULL, 9554740911358167222ULL, 6001522980458866326ULL, 2555645867240935709ULL,
+    93923403084641734ULL, 12433553126501559696ULL, 4254120478508943041ULL, 18130279211003004562ULL,
+    13570468781402749499ULL, 1115310673126990595ULL, 202516941663060841ULL, 2636051823135677417ULL,
+    6249340076532036302ULL, 11387031421085296783ULL, 10079967138959771610ULL,
+    10590686200033546901ULL, 15107007465771100886ULL, 1729445998614885448ULL,
+    17877911439599391623ULL, 5463995977644159485ULL, 6519569698732708045ULL, 3854716277268864346ULL,
+    11980387179319054728ULL, 3394219026260542918ULL, 18180169969473685114ULL,
+    12381249169892753413ULL, 12170704300475212405ULL, 9061248673443378898ULL,
+    17963679945804835981ULL, 7153966370658074056ULL, 7844932557562130267ULL,
+    13284122791460978751ULL, 16573434230051414509ULL, 10088803228066913171ULL,
+    15708490520610541107ULL, 11316910892878818878ULL, 3017860527104472310ULL,
+    12195008105392119342ULL, 14419122728277623528ULL, 17813814348296457508ULL
+  };
+
+static const
+uint64_t
+Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_3072[768U] =
+  {
+    1ULL, 15716404727371125192ULL, 14115652399417418371ULL, 17673021675528790544ULL,
+    16303142514212976561ULL, 6069407987786716453ULL, 1698653358766278130ULL,
+    11768325102693910881ULL, 11172619105163981824ULL, 793402836563571244ULL, 5471015293666756283ULL,
+    5837207135417298319ULL, 11994017116559320803ULL, 9594605479641221137ULL,
+    11406369043538065144ULL, 4885010457282477511ULL, 2434939712866548900ULL, 8616720652128235555ULL,
+    4110860504540188677ULL, 4211163054503197773ULL, 14144121169518649338ULL, 4323953603796554380ULL,
+    8192309187197107836ULL, 7966024840978791424ULL, 4597044040449118366ULL, 7060803219010100499ULL,
+    17651955733026411151ULL, 5884254285051282662ULL, 16334764051874099723ULL,
+    5086012348022918039ULL, 3384268977381776388ULL, 4896906469902582942ULL, 14939343422031758981ULL,
+    16289140927792027850ULL, 2114851401515407245ULL, 7471739577835287688ULL, 5379809933286454986ULL,
+    8835106627185206540ULL, 15838045949444854063ULL, 3179788908133259934ULL, 684069943791820421ULL,
+    9426065479060130343ULL, 3705444559692808454ULL, 6205619158396947460ULL, 2830013720935188842ULL,
+    5774645926098551566ULL, 5910881771259737445ULL, 0ULL, 2ULL, 12986065381032698768ULL,
+    9784560725125285127ULL, 16899299277348029473ULL, 14159540954716401507ULL,
+    12138815975573432907ULL, 3397306717532556260ULL, 5089906131678270146ULL, 3898494136618412033ULL,
+    1586805673127142489ULL, 10942030587333512566ULL, 11674414270834596638ULL,
+    5541290159409089990ULL, 742466885572890659ULL, 4365994013366578673ULL, 9770020914564955023ULL,
+    4869879425733097800ULL, 17233441304256471110ULL, 8221721009080377354ULL, 8422326109006395546ULL,
+    9841498265327747060ULL, 8647907207593108761ULL, 16384618374394215672ULL,
+    15932049681957582848ULL, 9194088080898236732ULL, 14121606438020200998ULL,
+    16857167392343270686ULL, 11768508570102565325ULL, 14222784030038647830ULL,
+    10172024696045836079ULL, 6768537954763552776ULL, 9793812939805165884ULL,
+    11431942770353966346ULL, 14131537781874504085ULL, 4229702803030814491ULL,
+    14943479155670575376ULL, 10759619866572909972ULL, 17670213254370413080ULL,
+    13229347825180156510ULL, 6359577816266519869ULL, 1368139887583640842ULL, 405386884410709070ULL,
+    7410889119385616909ULL, 12411238316793894920ULL, 5660027441870377684ULL,
+    11549291852197103132ULL, 11821763542519474890ULL, 0ULL, 16434063171749754859ULL,
+    5075784310584985343ULL, 5993049497995151378ULL, 4557114170906938684ULL, 7507750208029019751ULL,
+    14175935316299190464ULL, 16817307341612429280ULL, 280048871903062322ULL, 4175398606330449499ULL,
+    11588418063623183059ULL, 6904392752075227967ULL, 18337812164396287354ULL,
+    4535609662957471019ULL, 4081801609605706981ULL, 17646764183866815657ULL, 4365696558812920637ULL,
+    8068799814521025483ULL, 16000260888441335615ULL, 10727005784626287482ULL,
+    6392637321404913962ULL, 2411826375998294758ULL, 5667746815389576407ULL, 7448250613788525386ULL,
+    11199393206787687090ULL, 2774303105360609936ULL, 5473956103759333301ULL, 9530133442955724206ULL,
+    2338921405572405511ULL, 9465906927249755102ULL, 9042097896092456517ULL, 13200985650838344549ULL,
+    12415231348669463051ULL, 1285925255380228149ULL, 6702690297754839574ULL, 8537529466525790955ULL,
+    2459102033356463971ULL, 10013791196381936648ULL, 3942535141567066084ULL,
+    10763931933614699409ULL, 7391001242313727461ULL, 3366021784917997710ULL,
+    16271033144068479067ULL, 10809546368549981854ULL, 9713738658255246734ULL,
+    10257503670649350393ULL, 3459252994585167779ULL, 2126567102843446288ULL,
+    15432773126562251837ULL, 14421382269789958103ULL, 7421229274831544263ULL,
+    7655007321698169512ULL, 8340505943633116297ULL, 12871898856561464448ULL,
+    15974534546675545766ULL, 16886523968281585075ULL, 12328422846500035526ULL,
+    1076672244115329206ULL, 5523494890100385747ULL, 833056724107660602ULL, 5619343316790769796ULL,
+    2618492368764711227ULL, 17758208698852635100ULL, 9806409263852593226ULL,
+    13616403574908318787ULL, 125795268199048250ULL, 3723754281591803554ULL, 7118128000083212027ULL,
+    16996437697313025698ULL, 521029847805687238ULL, 15659447234575707195ULL, 4642066341064606992ULL,
+    11918067180844613989ULL, 10145650251170338239ULL, 18008715426528767101ULL,
+    18265478545228307947ULL, 10562097096196093685ULL, 16819833832664058311ULL,
+    4723464066498279458ULL, 11339496205348913871ULL, 11280625093531957429ULL,
+    17511193932792215280ULL, 11247777449592155382ULL, 743166260857437540ULL,
+    12389943644548215631ULL, 6960648252340776666ULL, 16720176910319338709ULL, 472421669255149649ULL,
+    17961791392760714858ULL, 7416113513627815841ULL, 5074643619777985245ULL, 6877793223083220548ULL,
+    7186352401197889313ULL, 4898276988524338013ULL, 12693151915268887125ULL,
+    10164015976946630021ULL, 12418802179414952058ULL, 751541993313213156ULL,
+    13444538201648153139ULL, 13849050154326646060ULL, 4238837493252941402ULL,
+    5634898908166241017ULL, 9098113072272901377ULL, 3160581268712211712ULL, 13944939694675257466ULL,
+    10691769342073043163ULL, 1403158460343430928ULL, 15166052897900474883ULL,
+    10935564774464072346ULL, 13793415856289981293ULL, 4709846052962232455ULL,
+    15965785172101086584ULL, 12782178790366819392ULL, 13873845718922303076ULL,
+    12033143305437175200ULL, 9633452567187600927ULL, 9035325000953914501ULL, 6970931712812332959ULL,
+    4965757220075075889ULL, 1365273190484178769ULL, 7883388098247567412ULL, 390162089379325107ULL,
+    11043507960413939855ULL, 2789626328597213908ULL, 3770413844885423855ULL, 5480377571981579469ULL,
+    8241333856416747861ULL, 6881634120267128505ULL, 16789414458876531172ULL,
+    14263582886765070456ULL, 5593281374692970515ULL, 10401473277808096023ULL,
+    8118817318099653892ULL, 2516557756684622494ULL, 7451536353944485014ULL, 759546146573557197ULL,
+    17003143085487841662ULL, 13070579248273493288ULL, 8511170085822616473ULL,
+    16956406201501685783ULL, 18290487322167252917ULL, 4867049785176647412ULL,
+    9698543583812445896ULL, 13407513198818464883ULL, 15094417420656441044ULL,
+    1503083986626426313ULL, 5711992983248328238ULL, 4920264560651607261ULL, 7703952588325121734ULL,
+    9126196256835906980ULL, 5818890058622967592ULL, 8019815896190701555ULL, 2764716344625322581ULL,
+    14109413715600516536ULL, 3599719757250433101ULL, 17356377015758154433ULL,
+    9261592610635891396ULL, 2687360681720180158ULL, 567553511856134433ULL, 6444451240321135081ULL,
+    12002623964306564681ULL, 11735887077001603437ULL, 14236263189293034340ULL,
+    4931021565205838916ULL, 3835068982701475160ULL, 9639240521433763641ULL, 14255468043946706159ULL,
+    10922855568165465374ULL, 5286056963764374632ULL, 5377368219207768581ULL,
+    10701075066128428593ULL, 4784464316511287352ULL, 13425081974822130373ULL,
+    8848775122127707045ULL, 3121935987146862146ULL, 17147537217916033399ULL, 1582247240236542054ULL,
+    6573021048142796663ULL, 9028959603468417266ULL, 4471053883422047676ULL, 5262630140325043857ULL,
+    10412925446655699975ULL, 5291435261364624952ULL, 17357138242591968458ULL, 292586931689840026ULL,
+    8378484366629255383ULL, 8001661576995811674ULL, 724768815277076789ULL, 5893105655312350064ULL,
+    12564113291288483668ULL, 6724989020013891742ULL, 14279164095187115596ULL,
+    11742090767603330473ULL, 15962792816546330616ULL, 9351140968681186272ULL,
+    3258817742552144850ULL, 17067947389863677944ULL, 6127374502400156216ULL, 6932487090227785665ULL,
+    14175114752309544027ULL, 4260712469610285101ULL, 583287756671859751ULL, 14579876537431479280ULL,
+    663421018130802078ULL, 4752936176986221577ULL, 4739436086204257828ULL, 15211085618593347791ULL,
+    12784757535002733305ULL, 2137855921161343984ULL, 16210373642602473199ULL,
+    16540904956311032175ULL, 4002116774357031639ULL, 9159533555962517142ULL, 7262575055026285147ULL,
+    3485955270487882107ULL, 13704067173381046846ULL, 1373544467180003236ULL, 5346603760488091803ULL,
+    124774339932757332ULL, 2796010907861563369ULL, 11212221589260374685ULL, 13812529368130981454ULL,
+    9299900704423599395ULL, 3488053147988613173ULL, 7189856118090314380ULL, 18343515844095259871ULL,
+    13050047139407141806ULL, 7157911551432501411ULL, 3632498248329928386ULL,
+    14392958933363077312ULL, 4031012892221115822ULL, 14617171427180532029ULL,
+    2162234530813403936ULL, 15433071890378044346ULL, 9515939532975066187ULL, 619208180934620192ULL,
+    5404189660072330989ULL, 206141721098924190ULL, 9197321059394906486ULL, 3254591478631258368ULL,
+    6472975223781456518ULL, 13478841559383109616ULL, 255537863652820929ULL, 6517635485104289701ULL,
+    15689150706017804272ULL, 12254749004800312433ULL, 13864974180455571330ULL,
+    9903485430909536438ULL, 8521424939220570203ULL, 1166575513343719502ULL, 10713009001153406944ULL,
+    1326842036261604157ULL, 9505872353972443154ULL, 9478872172408515656ULL, 11975427163477143966ULL,
+    7122770996295914995ULL, 4275711842322687969ULL, 13974003211495394782ULL,
+    14635065838912512735ULL, 8004233548714063279ULL, 18319067111925034284ULL,
+    14525150110052570294ULL, 6971910540975764214ULL, 8961390273052542076ULL, 2747088934360006473ULL,
+    10693207520976183606ULL, 249548679865514664ULL, 5592021815723126738ULL, 3977699104811197754ULL,
+    9178314662552411293ULL, 153057335137647175ULL, 6976106295977226347ULL, 14379712236180628760ULL,
+    18240287614480968126ULL, 7653350205104731997ULL, 14315823102865002823ULL,
+    7264996496659856772ULL, 10339173793016603008ULL, 8062025784442231645ULL,
+    10787598780651512442ULL, 4324469061626807873ULL, 12419399707046537076ULL, 585134992240580759ULL,
+    1238416361869240385ULL, 10808379320144661978ULL, 412283442197848380ULL, 18394642118789812972ULL,
+    6509182957262516736ULL, 12945950447562913036ULL, 18193006059853553455ULL,
+    18106154196714472374ULL, 12046700479746610565ULL, 9902372568146229661ULL,
+    18074966800209364875ULL, 5196531695485691999ULL, 6863254311194606909ULL,
+    10830220331750339598ULL, 17756687461898327880ULL, 9045632684025594617ULL,
+    16168414395797322741ULL, 1787515711114173580ULL, 17587728757662030137ULL,
+    7511446920629012393ULL, 2852336705821418680ULL, 7191446382804383354ULL, 14739047028655067507ULL,
+    1600655163805171452ULL, 11918868871812957476ULL, 4909363736570981930ULL, 4949082175927439069ULL,
+    1715871865460230747ULL, 16722780705468362740ULL, 13222594868563981273ULL,
+    10971766351877446928ULL, 8265730045717628900ULL, 12280295680559848677ULL,
+    15042446419499536160ULL, 10636303170093544229ULL, 5755192661690751471ULL,
+    3234169248262346777ULL, 9926374241768515712ULL, 9583657619093165806ULL, 15495924188007390391ULL,
+    6389327947853122861ULL, 10677850449414781501ULL, 17396308466841515738ULL, 519595173079674970ULL,
+    6692766657266916340ULL, 4698807905225619999ULL, 10675464041133823327ULL,
+    18195374534995621878ULL, 17790563914292367101ULL, 17936128576804022121ULL,
+    5520282732294905751ULL, 4978781344574609901ULL, 2191362958692674410ULL, 4576148190887837796ULL,
+    17939268045997555294ULL, 17765564319719393133ULL, 5646656885783669515ULL,
+    1358001062582907707ULL, 17703189526709178135ULL, 10393063390971383999ULL,
+    13726508622389213818ULL, 3213696589791127580ULL, 17066630850087104145ULL,
+    18091265368051189235ULL, 13890084717885093866ULL, 3575031422228347161ULL,
+    16728713441614508658ULL, 15022893841258024787ULL, 5704673411642837360ULL,
+    14382892765608766708ULL, 11031349983600583398ULL, 3201310327610342905ULL,
+    5390993669916363336ULL, 9818727473141963861ULL, 9898164351854878138ULL, 3431743730920461494ULL,
+    14998817337227173864ULL, 7998445663418410931ULL, 3496788630045342241ULL,
+    16531460091435257801ULL, 6113847287410145738ULL, 11638148765289520705ULL,
+    2825862266477536843ULL, 11510385323381502943ULL, 6468338496524693554ULL, 1406004409827479808ULL,
+    720571164476779997ULL, 12545104302305229167ULL, 12778655895706245723ULL, 2908956825120011386ULL,
+    16345872859973479861ULL, 1039190346159349941ULL, 13385533314533832680ULL,
+    9397615810451239998ULL, 2904184008558095038ULL, 17944004996281692141ULL,
+    17134383754875182587ULL, 17425513079898492627ULL, 11040565464589811503ULL,
+    9957562689149219802ULL, 4382725917385348820ULL, 9152296381775675592ULL, 11143307656144658026ULL,
+    1028115470674392222ULL, 17913069129793705303ULL, 18251815799595434088ULL,
+    11627397673104932478ULL, 1795406361032894331ULL, 13515508179793348686ULL,
+    8523377901803698954ULL, 4749535006854792237ULL, 1644581285739865232ULL, 2626994471866091319ULL,
+    12082638499794831435ULL, 3414831383652922238ULL, 11167424325497271924ULL,
+    17635584165959324779ULL, 2855377658296793336ULL, 14698137399788861436ULL,
+    7813327294486634096ULL, 14023763694853525432ULL, 3063068065803053384ULL,
+    11474969587018305189ULL, 5876844910126492000ULL, 17398456369681387715ULL,
+    3121709422034671232ULL, 5175390576530651880ULL, 7039882184087280510ULL, 11169575364815760887ULL,
+    13400733486841808853ULL, 7346788752570915973ULL, 1541248897147184344ULL, 1945657019445676588ULL,
+    212700915359041972ULL, 14655880753680112045ULL, 8924074315217357325ULL, 8605097290594962816ULL,
+    17420203128294633599ULL, 4916371226624792399ULL, 17075528519442303791ULL,
+    16127941837195311289ULL, 15168992703820884135ULL, 8597551034903412772ULL,
+    9159009209054440026ULL, 16238448157862046789ULL, 4436868200437978293ULL,
+    18169971278401807550ULL, 832555097280722429ULL, 14139258292067435174ULL,
+    16526586620581384449ULL, 3839871238579764437ULL, 17772635668719909637ULL,
+    13048302511585725745ULL, 17283165127300555490ULL, 2664449713003738287ULL,
+    9660220709852505117ULL, 10282925644643423886ULL, 10368336832591757174ULL,
+    2224945045164014683ULL, 4082565408043301709ULL, 10725004237398938921ULL,
+    11555740061297409573ULL, 376935810155613664ULL, 13482710056926213370ULL, 9784049228037611471ULL,
+    10595765773876064185ULL, 13384470438734720156ULL, 5796631167391952132ULL,
+    13711643820537687926ULL, 10337299186109304542ULL, 200572196136156484ULL,
+    16077643424049538382ULL, 6095733779140780034ULL, 14209443685048133890ULL,
+    14947825193510422126ULL, 2693823513475109903ULL, 3097618315238829694ULL,
+    14238977185025348754ULL, 12581597483306380054ULL, 8168510142317286728ULL,
+    7275583016273129564ULL, 5322308300620666886ULL, 7357616781972879839ULL, 15690545484517190886ULL,
+    878301908995781262ULL, 5418657687005451655ULL, 15212552386536039786ULL, 6092675518650710890ULL,
+    11200441476416373411ULL, 15071030242065476590ULL, 17879172013598645966ULL,
+    9297339823459458779ULL, 17735596801707350417ULL, 15079355559272904047ULL,
+    2276468130319700710ULL, 7439756120659996426ULL, 15742654281685056177ULL,
+    14606429167453217283ULL, 7573625851616403570ULL, 12942219993258832657ULL,
+    14823148407706000033ULL, 3741683844110457590ULL, 8555769794441641789ULL,
+    11469259653420863335ULL, 10196828043172451489ULL, 15376589866188448594ULL,
+    3268740524319791652ULL, 3290467635937377799ULL, 15648254305780356698ULL,
+    12019002337106568521ULL, 17512827693357135758ULL, 2228269043741319935ULL,
+    8014535698578268012ULL, 1744861480886679555ULL, 2487857735773852431ULL, 10564306364035643109ULL,
+    3242212950043613691ULL, 6975739654270857512ULL, 10269476359111161766ULL, 8906082207010998762ULL,
+    8524114244507635262ULL, 8008910012802510888ULL, 11266167659891264498ULL, 2562312940966622073ULL,
+    10764430968029255301ULL, 7003137146839008533ULL, 11604018070580975143ULL,
+    18175513182808049089ULL, 10432261896431608713ULL, 2067202470600443376ULL,
+    7271829478739118665ULL, 13764453854909524255ULL, 4637800547735735908ULL, 8113846881914081548ULL,
+    1598570864397738297ULL, 17824509656359620274ULL, 12334921863720111517ULL,
+    11606924327566942056ULL, 2008143021601805641ULL, 13201474369668264769ULL,
+    8021541450596219369ULL, 5674843784449954132ULL, 13736387484387764210ULL, 9555125583375024313ULL,
+    15621177828310502231ULL, 14944708507283036536ULL, 15147251703232807141ULL,
+    4707356566469687274ULL, 6868461067410315207ULL, 6709645290040154110ULL, 14967938029386708524ULL,
+    10561183220918891508ULL, 3645565371401629493ULL, 5628016687651704838ULL,
+    17710100153803565130ULL, 7374338108438326842ULL, 18320779831517918063ULL,
+    11428467735920883746ULL, 10126184355854489088ULL, 14051143567123861009ULL,
+    8988696366985049552ULL, 8374733419055836622ULL, 7410655184414253762ULL, 11298589306489970157ULL,
+    10595286404627416060ULL, 18162642363044912797ULL, 16236329814031421254ULL,
+    3689373944109000289ULL, 6793793602502826745ULL, 5537100792874261585ULL, 8682635286522095747ULL,
+    12185429100943344646ULL, 2287329521665818521ULL, 1443784505019748114ULL, 2649312045616946778ULL,
+    4543550566219912987ULL, 5802048696535442200ULL, 9031311411103469695ULL, 11036258305800444695ULL,
+    6924560490191973129ULL, 11390452496986879063ULL, 5252689267953899168ULL, 8576951662081931581ULL,
+    7590637792485343856ULL, 3614401529465973867ULL, 7946893489557592432ULL, 4700355986995431704ULL,
+    17382270144687108265ULL, 1301783387175695577ULL, 17555306727296855725ULL,
+    11856044616001165646ULL, 6438153019139048577ULL, 259749280461638676ULL, 11442672940856521458ULL,
+    5373509492729824370ULL, 14262025262981040135ULL, 12462349318233805564ULL,
+    3728129799977947692ULL, 11608386439235437524ULL, 14167338995939289355ULL,
+    8881525288599596246ULL, 5458645203940656686ULL, 16746060406371548860ULL, 9680027494535267767ULL,
+    8928638169745463516ULL, 17345024039127224015ULL, 2899141188958479745ULL, 569336121539618270ULL,
+    4961875320232101941ULL, 16695843945619911744ULL, 14782637872858703907ULL,
+    5040431734116985556ULL, 10372220277455541974ULL, 13479660456320646096ULL, 673748041345540756ULL,
+    9033738264287292659ULL, 13705212895850338951ULL, 14891143636925953734ULL,
+    16152530706839409489ULL, 15527968573177598546ULL, 899664711169738366ULL, 9085578081829304982ULL,
+    3794715413552682370ULL, 4649126229606183949ULL, 16867715892114048409ULL,
+    12500934815354410158ULL, 4798400904431078869ULL, 5298482235128922699ULL, 3333595563435026055ULL,
+    3227387240673544326ULL, 10627889283042561795ULL, 14350867458027642211ULL,
+    8699898642569487484ULL, 16223469705073222696ULL, 14313667030550785819ULL,
+    5770310729971108522ULL, 2819352359979358264ULL, 15251338297518785489ULL, 3594057152556098716ULL,
+    10656188978825154778ULL, 14683723980441267944ULL, 15720305165227709900ULL,
+    10747018985459648741ULL, 7346967105914102230ULL, 2146862888465926269ULL, 6682537201775134314ULL,
+    2626427245264748378ULL, 15957341905955743549ULL, 1014959862255919007ULL, 4238871436865672638ULL,
+    7771251770487976313ULL, 1706713751924555164ULL, 4881547559448131700ULL, 3633767066252643118ULL,
+    17792299494476280295ULL, 10733277722720457677ULL, 2883375610292717410ULL,
+    1383210201103197768ULL, 13553471384874405100ULL, 250840046652655052ULL, 6408556985741721010ULL,
+    12723739893434938350ULL, 15491617252209730851ULL, 3944686058661588082ULL,
+    17155990905188234123ULL, 854823967411595661ULL, 8617306708834114ULL, 1223252217946194361ULL,
+    1004541081656336269ULL, 5608666375000341011ULL, 5477450805269912848ULL, 14384264807235285938ULL,
+    226212614190769974ULL, 11452032026901851644ULL, 6089401157184365104ULL, 8439361324340321633ULL,
+    8782042528385459356ULL, 13926514059182376340ULL, 8188844425662026960ULL, 643353395821387731ULL,
+    14791099160874277417ULL, 17179984244570153711ULL, 10864659931183840444ULL,
+    2519942865292795772ULL, 9344149279651524983ULL, 18261551679724966822ULL,
+    10018128026047386275ULL, 8640279810039309506ULL, 16831585658432721718ULL,
+    12993866256745868185ULL
+  };
+
+static const
+uint64_t
+Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_4096[1024U] =
+  {
+    1ULL, 4140496364664168597ULL, 12847177292060720414ULL, 8157789849713597332ULL,
+    17689416073234252336ULL, 15398142846501582131ULL, 16564880180854652867ULL,
+    17786516327095366789ULL, 10536319790460633031ULL, 6266934757955653435ULL,
+    1339224948780144589ULL, 10289097291785293429ULL, 8649906742950245253ULL, 9843796635614494715ULL,
+    6017548786423861991ULL, 9714007226925426761ULL, 10489074009276287748ULL,
+    15716404727373750542ULL, 14115652399417418371ULL, 17673021675528790544ULL,
+    16303142514212976561ULL, 6069407987786716453ULL, 1698653358766278130ULL,
+    11768325102693910881ULL, 11172619105163981824ULL, 793402836563571244ULL, 5471015293666756283ULL,
+    5837207135417298319ULL, 11994017116559320803ULL, 9594605479641221137ULL,
+    11406369043538065144ULL, 4885010457282477511ULL, 2434939712866548900ULL, 8616720652128235555ULL,
+    4110860504540188677ULL, 4211163054503197773ULL, 14144121169518649338ULL, 4323953603796554380ULL,
+    8192309187197107836ULL, 7966024840978791424ULL, 4597044040449118366ULL, 7060803219010100499ULL,
+    17651955733026411151ULL, 5884254285051282662ULL, 16334764051874099723ULL,
+    5086012348022918039ULL, 3384268977381776388ULL, 4896906469902582942ULL, 14939343422031758981ULL,
+    16289140927792027850ULL, 2114851401515407245ULL, 7471739577835287688ULL, 5379809933286454986ULL,
+    8835106627185206540ULL, 15838045949444854063ULL, 3179788908133259934ULL, 684069943791820421ULL,
+    9426065479060130343ULL, 3705444559692808454ULL, 6205619158396947460ULL, 2830013720935188842ULL,
+    5774645926098551566ULL, 5910881771259737445ULL, 0ULL, 2ULL, 8280992729328337194ULL,
+    7247610510411889212ULL, 16315579699427194665ULL, 16932088072758953056ULL,
+    12349541619293612647ULL, 14683016287999754119ULL, 17126288580481181963ULL,
+    2625895507211714447ULL, 12533869515911306871ULL, 2678449897560289178ULL, 2131450509861035242ULL,
+    17299813485900490507ULL, 1240849197519437814ULL, 12035097572847723983ULL, 981270380141301906ULL,
+    2531403944843023881ULL, 12986065381037949469ULL, 9784560725125285127ULL,
+    16899299277348029473ULL, 14159540954716401507ULL, 12138815975573432907ULL,
+    3397306717532556260ULL, 5089906131678270146ULL, 3898494136618412033ULL, 1586805673127142489ULL,
+    10942030587333512566ULL, 11674414270834596638ULL, 5541290159409089990ULL, 742466885572890659ULL,
+    4365994013366578673ULL, 9770020914564955023ULL, 4869879425733097800ULL, 17233441304256471110ULL,
+    8221721009080377354ULL, 8422326109006395546ULL, 9841498265327747060ULL, 8647907207593108761ULL,
+    16384618374394215672ULL, 15932049681957582848ULL, 9194088080898236732ULL,
+    14121606438020200998ULL, 16857167392343270686ULL, 11768508570102565325ULL,
+    14222784030038647830ULL, 10172024696045836079ULL, 6768537954763552776ULL,
+    9793812939805165884ULL, 11431942770353966346ULL, 14131537781874504085ULL,
+    4229702803030814491ULL, 14943479155670575376ULL, 10759619866572909972ULL,
+    17670213254370413080ULL, 13229347825180156510ULL, 6359577816266519869ULL,
+    1368139887583640842ULL, 405386884410709070ULL, 7410889119385616909ULL, 12411238316793894920ULL,
+    5660027441870377684ULL, 11549291852197103132ULL, 11821763542519474890ULL, 0ULL,
+    8723709457974937732ULL, 7286188596357095436ULL, 17279582275371769026ULL,
+    12638928732598505429ULL, 1073679087217546651ULL, 18149101301254451150ULL,
+    3905313497331878392ULL, 6402888197392364935ULL, 11218583244539462591ULL,
+    14821791463740481697ULL, 15624071356913574295ULL, 1824852501186321361ULL,
+    1542900419558219716ULL, 2333606047248263891ULL, 2022071169658965047ULL, 10048744596381493616ULL,
+    9426690623701408438ULL, 10404442578070818181ULL, 8862483594725344078ULL,
+    16212788163078772847ULL, 4274712995164234392ULL, 17484916012378723531ULL,
+    2138835557123674628ULL, 10359961257630417235ULL, 8638995906145611624ULL,
+    17230274067532930651ULL, 7457610519860382939ULL, 10466997891465290765ULL,
+    12799046937302638943ULL, 14619385793237538351ULL, 11789548021119050718ULL,
+    6280239437076465767ULL, 1020419817140878416ULL, 8511989044845273587ULL, 12041643856178578663ULL,
+    6280716577227265437ULL, 7799325453842344244ULL, 1055557962351061066ULL, 14196184770808072077ULL,
+    13422824396575918002ULL, 15622191164493656603ULL, 1293505806643880657ULL,
+    13000445462724499347ULL, 4873790568373542927ULL, 10401722963794400153ULL,
+    10495753815920622447ULL, 15398059417447696833ULL, 13605865765075405645ULL,
+    14296397912029208745ULL, 2243310810847981403ULL, 17993668705782611514ULL,
+    12466471324027548510ULL, 2443545461096633230ULL, 3940352066668246917ULL,
+    17843203306502192216ULL, 10221842388460810243ULL, 3452603126433746494ULL, 664825082099333711ULL,
+    13016460263064211729ULL, 5573231870557294652ULL, 13053322486273129005ULL,
+    1215248698127679284ULL, 5599203128881427211ULL, 11683785620697850922ULL,
+    17447418915949875465ULL, 266129483668807853ULL, 10512853695385155235ULL,
+    14988903241201056576ULL, 1390030173959794023ULL, 14802857301591381200ULL,
+    5928763101808858037ULL, 12145548648170545044ULL, 14526742205830006598ULL,
+    17463773611727065214ULL, 14140623588897741564ULL, 13938802294157936152ULL,
+    11735707582066684685ULL, 14511008730111022497ULL, 10061691125741792085ULL,
+    11364752345978862377ULL, 10895711182969553009ULL, 18078545809805835289ULL,
+    13393875515158554912ULL, 13205109854267233007ULL, 6405824430831893731ULL,
+    4145751865125060284ULL, 5976324473013627388ULL, 14041503544245193735ULL,
+    10003866843745653457ULL, 16807206897919880931ULL, 1939492259677970546ULL,
+    8324458844638328234ULL, 698622843745495458ULL, 1939888918697194609ULL, 16538721012066614966ULL,
+    17445489331435409046ULL, 4475779347148305732ULL, 7193954668109231113ULL, 9747404143187794388ULL,
+    16772596208957728648ULL, 11296028003493786210ULL, 6435069528498676513ULL,
+    18137934655103700374ULL, 16364929560421075813ULL, 17394682295726879957ULL,
+    9647814832297861814ULL, 6759358511056306613ULL, 15631835421798368518ULL, 244721832043796797ULL,
+    7630775906154611319ULL, 15733643738567618439ULL, 13661893926343842617ULL,
+    6638651098671073240ULL, 2329018475778439042ULL, 1208700665661527042ULL, 13957938152180833094ULL,
+    10266900855479721447ULL, 16715810760521700374ULL, 14630964415030135263ULL,
+    5176729611345328806ULL, 7589276196659313410ULL, 10755715643258797765ULL,
+    11291621012111680296ULL, 17352082899511536765ULL, 10489914619771895236ULL,
+    8205143322353910135ULL, 17109288029022591867ULL, 4920827167686150228ULL, 8721961288027528717ULL,
+    16971607604333167065ULL, 7641997383127955872ULL, 10555200406674274442ULL,
+    15314271698335359958ULL, 5176454219008063230ULL, 10711205385302931143ULL,
+    16766974410215779204ULL, 10254965416612716698ULL, 9426652865487908229ULL,
+    9574664495983578818ULL, 15696021227931621416ULL, 16567030058755929765ULL,
+    5690177813513447344ULL, 12751437748037319958ULL, 7740520541051436454ULL, 5776874728256275509ULL,
+    313001678839195731ULL, 14051282351518317919ULL, 7082566162817475261ULL, 6548583472135454082ULL,
+    11518134912621346510ULL, 9735650008538979947ULL, 11823554266583851109ULL,
+    5587802163115361960ULL, 17108704049433346484ULL, 12024408992555351192ULL,
+    14006661560592130781ULL, 1826381100889754124ULL, 9198694238724228401ULL,
+    16579136111895531648ULL, 7393098173657102779ULL, 10631209144317587977ULL,
+    8882596412812637269ULL, 6164371425070358911ULL, 3153557730881271995ULL, 4066074878776570954ULL,
+    1977069047391031648ULL, 7404350828945177105ULL, 2586728384669654096ULL, 15064731419172721020ULL,
+    15127075858755853049ULL, 10298442278126418808ULL, 3241105831256176017ULL,
+    17671863222401683673ULL, 12744192659504109037ULL, 4568411823014383736ULL,
+    12560378178496063848ULL, 6592018476247795084ULL, 1008717233462245098ULL,
+    16951773408453335499ULL, 15709840443021855677ULL, 153994158425767871ULL,
+    11931895365299271984ULL, 13680799627945215385ULL, 555078945755858207ULL,
+    15626050712844641280ULL, 8017378691991827793ULL, 13272351659520895736ULL,
+    2003507554504479333ULL, 8199658567801831913ULL, 6626219126286875387ULL, 2642546160302226056ULL,
+    9884722007125867765ULL, 17443922576055057435ULL, 1190223425911399495ULL, 9684427984607080544ULL,
+    10821446589352594601ULL, 11424471322485869021ULL, 7304307210808156977ULL,
+    1093802804041411922ULL, 14426977000107821967ULL, 12599506549976514813ULL,
+    6673496415221918278ULL, 2041809867037750610ULL, 4787651600229433030ULL, 4890478713043001553ULL,
+    2777408188931837789ULL, 13073680208788950292ULL, 6748304235318748054ULL, 3596079392079287151ULL,
+    16342408085052142005ULL, 5324728955034950977ULL, 13391409927454189452ULL,
+    10953565384774333110ULL, 10658933739319857858ULL, 2723209302134686409ULL,
+    16968689562152061484ULL, 3901479357685154129ULL, 16564066861720712597ULL,
+    11073089205067907052ULL, 15403786182892008266ULL, 15646779318338829052ULL,
+    9545249883380126323ULL, 7671153119910025209ULL, 1224462730887131455ULL, 5250613927792173239ULL,
+    7935169404043958478ULL, 16439603354680906500ULL, 10518278516265741763ULL,
+    3829526853362239630ULL, 8278091698578617677ULL, 4554266771377910430ULL, 13139481610318099617ULL,
+    16279762805085008790ULL, 421466789102703366ULL, 1355352141860145537ULL, 12366465947563634698ULL,
+    14785002349258363837ULL, 12127653593321584499ULL, 12521092623410543861ULL,
+    11570918753185159022ULL, 9676636300817797534ULL, 18306575394716518047ULL,
+    17571654144712526627ULL, 1997932316459895811ULL, 5687798250137990730ULL,
+    14252153284074198892ULL, 6306157057916181602ULL, 4289946799644976350ULL,
+    13489427295771551365ULL, 7014078789334234314ULL, 11803403805025048311ULL,
+    10212634267405906127ULL, 782586782829301052ULL, 580340104962750725ULL, 11195974091864189558ULL,
+    1322699940542183914ULL, 4011014546356115945ULL, 16605911683851857087ULL, 3831471033490815075ULL,
+    16055068254457322887ULL, 2666548765882182721ULL, 14809314756110058137ULL,
+    14685201683008769224ULL, 8986603626583355008ULL, 3628220380757807637ULL,
+    14483045573160074485ULL, 1108663652456002387ULL, 2614232841929969700ULL, 9906537827402012982ULL,
+    15015252086341736200ULL, 14038383048697740639ULL, 12733517519467686335ULL,
+    576479003439573867ULL, 4708809083158254195ULL, 17360323254134317643ULL, 4072426854778708991ULL,
+    14652263607270138875ULL, 9046220795538357389ULL, 11462289598826448029ULL,
+    5826066352111323099ULL, 10589571335778875429ULL, 2568377890161200650ULL, 8105622517533911578ULL,
+    12459025223509355791ULL, 4712021541807269893ULL, 6597219265145187947ULL,
+    15138494995827373559ULL, 17797886048774012064ULL, 13001942309323889676ULL,
+    6571128374376300860ULL, 5415846522074065508ULL, 13445656017295124459ULL, 3864901869879497460ULL,
+    4344872745727541806ULL, 17770342888408382687ULL, 6687164044251089433ULL,
+    15368672970378318051ULL, 185707438321753489ULL, 14239920487730803117ULL, 6444796210668896096ULL,
+    9507316738058682372ULL, 17257526371282610252ULL, 737269407799342139ULL, 16031285522665679583ULL,
+    15180062363940930181ULL, 12617962394229931835ULL, 1779958874086345568ULL,
+    11025574894701602654ULL, 4736767254911727556ULL, 13836322436026614346ULL, 398664740674316752ULL,
+    7542816988837339719ULL, 8936661975480355266ULL, 8945912067143440137ULL, 12671432013357058486ULL,
+    1882887120417468163ULL, 16146679519071417811ULL, 15448386180011788044ULL,
+    2685495556790087067ULL, 13173743710885170135ULL, 8022029092712231891ULL, 458831584948779539ULL,
+    2063375285332798950ULL, 3374438211209139875ULL, 4575769531289066164ULL, 8123284211302595174ULL,
+    9041795399453088085ULL, 17312979506552525191ULL, 17792760551976248306ULL,
+    16786281830566250789ULL, 3556552253692149364ULL, 15517562975645232829ULL,
+    10016238324044719601ULL, 2980812660878863884ULL, 15647570810109791655ULL,
+    16734298192151247816ULL, 11642032016155435483ULL, 6687278819980707316ULL,
+    11942810760266950426ULL, 7371131311376656912ULL, 8714181581334151080ULL, 5715105505153879617ULL,
+    6176488482709622573ULL, 4973713733207005464ULL, 13905017703012181067ULL, 5930158616885972545ULL,
+    3235516255025027823ULL, 12308513508726458286ULL, 2971316126464308974ULL, 4342299936222045416ULL,
+    4789870887773709031ULL, 3587294407411398409ULL, 9992080257804776638ULL, 3312233327171285660ULL,
+    14942553548688319694ULL, 12655731015383895075ULL, 3427180835568092643ULL,
+    13013699095251637993ULL, 6839506816594769978ULL, 2893608855771418676ULL,
+    16887645907496202853ULL, 7432218095653607478ULL, 9238308561068914153ULL, 327102632679523240ULL,
+    16902653454281912852ULL, 2707576943169035312ULL, 4858807792980460668ULL, 65989367814838876ULL,
+    8405980002494516113ULL, 4631577568832788290ULL, 5674769149688098383ULL, 11076145293528941380ULL,
+    14853344443109910099ULL, 18061007425528883616ULL, 16635375430793487568ULL,
+    18265422885807939372ULL, 110649821042979337ULL, 8871145539637459002ULL, 10601564512697373811ULL,
+    9971393399231883787ULL, 16676628685368472848ULL, 18224674212412576039ULL,
+    11281872884839911580ULL, 7900743348060788654ULL, 15386865805116381633ULL,
+    15019236131279956422ULL, 3739258706760179666ULL, 8765610717673796280ULL, 2383368034041647189ULL,
+    5550996017307159638ULL, 18261740817127569499ULL, 6742401326320685472ULL, 102218035127392035ULL,
+    15272872435440203730ULL, 17476961490410566003ULL, 3863833803603326207ULL,
+    17069234120402884647ULL, 6945292707828956155ULL, 11733601017949690341ULL,
+    2114620289076734597ULL, 8024832349585469971ULL, 13951371509326846790ULL,
+    12017579600331504646ULL, 10390584195782819862ULL, 14045618678861734798ULL,
+    14531433369686514378ULL, 12504386564656529391ULL, 6984861499655412196ULL,
+    2192803117881095664ULL, 14487585028790566755ULL, 18170259866849721867ULL,
+    2732902490513474203ULL, 15635811523069315532ULL, 9404568725036697533ULL,
+    17412026082114058573ULL, 7582538909206983610ULL, 7324978734465957722ULL, 7208210041723727626ULL,
+    18190099721141009512ULL, 1591347315326854443ULL, 4557219559307046342ULL,
+    10043354402533950747ULL, 4898655704124624645ULL, 10539289066620749321ULL,
+    14097458046253178822ULL, 2398302077808040887ULL, 18102550787879604255ULL,
+    1263289785070602404ULL, 14256536373729689904ULL, 7870352326269415528ULL,
+    13595482044538553874ULL, 7691229962935560942ULL, 15140162296290401765ULL,
+    2173470031282635742ULL, 1099476127025442584ULL, 15983060136335641646ULL, 9198597410199805803ULL,
+    3697523811705093144ULL, 9313756848182066529ULL, 2408500320489388790ULL, 2994389860652705480ULL,
+    11494872260847713040ULL, 3253096113179591950ULL, 18035620869332993463ULL,
+    16694225253125962682ULL, 16763599950268455994ULL, 14679801939901587234ULL,
+    10783611861541044159ULL, 12326987536523211651ULL, 15732224553514529826ULL,
+    1878950631871528131ULL, 7242267211351638277ULL, 4009408067607995099ULL, 8053390807406349792ULL,
+    16194873667690688634ULL, 12824574906027186119ULL, 10740755860715417102ULL,
+    18365935555126509279ULL, 17846403855891724980ULL, 18016764898991945844ULL,
+    5894886836336911315ULL, 5287637977562855411ULL, 11038006748613691058ULL,
+    13943247805078895956ULL, 8091994634737676074ULL, 6725659598608340891ULL, 1257323452661324433ULL,
+    1560701919675327038ULL, 7500891724517342927ULL, 16685530653450193595ULL, 8260682414369785297ULL,
+    7291304028295183658ULL, 15558225340926173153ULL, 11321828820435153138ULL,
+    4918046879947096786ULL, 11303012116444246727ULL, 6372152015278848635ULL, 9956998856005064589ULL,
+    9336933060347079059ULL, 1603344201986893117ULL, 17084897181798464345ULL, 4586396661866139191ULL,
+    3597571799403104470ULL, 7393857685156906661ULL, 4811816214423190406ULL, 5963918335154904259ULL,
+    17989620595446357127ULL, 10597858900510738450ULL, 14345216059245924395ULL,
+    11857407374626182274ULL, 16963569161366516429ULL, 8410833855192487472ULL,
+    7954348651914376299ULL, 2379972926852197481ULL, 12128488992749332521ULL, 1832622322064153211ULL,
+    8326179867193459280ULL, 2189336916647747720ULL, 4313803655566292414ULL, 2544371703087467748ULL,
+    5330260679976514978ULL, 16230154250595392829ULL, 16018815572099435505ULL,
+    7996789549112037515ULL, 6672849665097231381ULL, 13969065927046004807ULL,
+    10211636786051992355ULL, 5383372749643831154ULL, 17771720153477562592ULL,
+    2408357679216360323ULL, 16823741577353360299ULL, 3120479649372536703ULL, 4156512587079565595ULL,
+    5278100720682599647ULL, 9949314827259779377ULL, 4762831985138922184ULL, 14600495539049861274ULL,
+    3325901346001091235ULL, 1911399738610382568ULL, 17327008939072998351ULL,
+    17227966215036950401ULL, 9577622565710387804ULL, 18072425858546160774ULL,
+    5957820777833274451ULL, 2677581430966294701ULL, 15923206685925904245ULL,
+    10611945754598263408ULL, 5655730155770816025ULL, 12626946813458118797ULL,
+    4107306387644069368ULL, 4476819328450589470ULL, 5477964156990418743ULL, 5821663042759343650ULL,
+    10922467640613341703ULL, 8891670361850646126ULL, 14956345901404357913ULL,
+    3577506692760125478ULL, 4143930634297946541ULL, 5679759008705542803ULL, 14230553877430391312ULL,
+    4344339903076307447ULL, 14515324701787653423ULL, 5757031204167417531ULL,
+    11543589381165644374ULL, 14531535459739875300ULL, 14449334169763971524ULL,
+    4318542240379474353ULL, 741132766326835453ULL, 6627120600867406770ULL, 8808126635667085679ULL,
+    1212741104506854184ULL, 4710635021235547727ULL, 3410797289357503953ULL, 10681875852186940521ULL,
+    661554394703974981ULL, 6670298729098748580ULL, 13744236189668400698ULL, 7820120476249794190ULL,
+    980817392125443244ULL, 12954218462756799369ULL, 659508012140703068ULL, 1163409756945800873ULL,
+    10997225868294013776ULL, 14229016763884394478ULL, 1770344031783392969ULL,
+    3742543334629479087ULL, 9682038679261232743ULL, 8387733594039756821ULL, 1687856784955132718ULL,
+    4229288933082514561ULL, 5726181787096001894ULL, 6103592449244408766ULL, 7250102016841276198ULL,
+    13783857542724328048ULL, 14455222176645390767ULL, 6955864840067808102ULL,
+    8313025174159131190ULL, 10556201441365199294ULL, 1451885580810007138ULL, 9525663970277844369ULL,
+    10754247004390170932ULL, 6651802692002182471ULL, 3822799477220765136ULL,
+    16207273804436445086ULL, 16009188356364349187ULL, 708501057711223993ULL,
+    17698107643382769933ULL, 11915641555666548903ULL, 5355162861932589402ULL,
+    13399669298142256874ULL, 2777147435486975201ULL, 11311460311541632051ULL,
+    6807149553206685978ULL, 8214612775288138737ULL, 8953638656901178940ULL, 10955928313980837486ULL,
+    11643326085518687300ULL, 3398191207517131790ULL, 17783340723701292253ULL,
+    11465947729099164210ULL, 7155013385520250957ULL, 8287861268595893082ULL,
+    11359518017411085606ULL, 10014363681151231008ULL, 8688679806152614895ULL,
+    10583905329865755230ULL, 11514062408334835063ULL, 4640434688621737132ULL,
+    10616326845770198985ULL, 10451924265818391433ULL, 8637084480758948707ULL,
+    1482265532653670906ULL, 13254241201734813540ULL, 17616253271334171358ULL,
+    2425482209013708368ULL, 9421270042471095454ULL, 6821594578715007906ULL, 2917007630664329426ULL,
+    1323108789407949963ULL, 13340597458197497160ULL, 9041728305627249780ULL,
+    15640240952499588381ULL, 1961634784250886488ULL, 7461692851804047122ULL, 1319016024281406137ULL,
+    2326819513891601746ULL, 3547707662878475936ULL, 10011289454059237341ULL, 3540688063566785939ULL,
+    7485086669258958174ULL, 917333284812913870ULL, 16775467188079513643ULL, 3375713569910265436ULL,
+    8458577866165029122ULL, 11452363574192003788ULL, 12207184898488817532ULL,
+    14500204033682552396ULL, 9120971011739104480ULL, 10463700279581229919ULL,
+    13911729680135616205ULL, 16077113584296650986ULL, 11858413046667864450ULL,
+    568180552351960586ULL, 5352815491819374005ULL, 2379462637684527518ULL, 14385250123812753008ULL,
+    18218772387079983709ULL, 17290870854193010622ULL, 5403867846158692737ULL,
+    4803291797544181492ULL, 5498940759947930464ULL, 8791089135210048829ULL, 17735972756185554549ULL,
+    4585273305500435389ULL, 9989906000728941218ULL, 14575657258638393764ULL, 9225271907733102271ULL,
+    9045403089224257341ULL, 15477249927413505911ULL, 13094106390539597918ULL,
+    6042694650044821518ULL, 3003655084756191959ULL, 11998522037035704089ULL, 3676860619260797560ULL,
+    11332176593777304824ULL, 11359173803114308081ULL, 11305671094783136930ULL,
+    17672521071235871183ULL, 4496545911942654489ULL, 138015862200250879ULL, 4309488255866696843ULL,
+    15166747965246075515ULL, 9730812078180539211ULL, 16245437894812382888ULL,
+    2817111026281235411ULL, 10751849651548584010ULL, 7114255991714893402ULL, 4144139515913191142ULL,
+    18024168764246710512ULL, 8995903192259340233ULL, 13276723990786705420ULL,
+    7189242928583595472ULL, 5506861062747834874ULL, 4889402004459139099ULL, 1715558436562657576ULL,
+    15681156878749227556ULL, 872099473499867840ULL, 9392371954012883373ULL, 9891423966563400159ULL,
+    13203784901574398316ULL, 3295407905839046208ULL, 1738054296063864240ULL, 2739418344379048660ULL,
+    4544916525347503556ULL, 7053850046437495936ULL, 5896205670548577216ULL, 8891645987058115422ULL,
+    9481111628929593078ULL, 4829504170280014205ULL, 5333548629213483671ULL, 11894535703892829754ULL,
+    7352434360210087252ULL, 2803131256437854753ULL, 10849116209250154039ULL,
+    13707483094883750357ULL, 9410578384290345882ULL, 13983538396764641587ULL, 416676759642793726ULL,
+    4001597274893755757ULL, 7275154946707984916ULL, 16108936807595517055ULL,
+    15474769888062284803ULL, 2897311409068466891ULL, 15873518353044016420ULL,
+    12337106468676005517ULL, 9424531488495839471ULL, 7228364107902251120ULL, 567599172905813879ULL,
+    7550616714172192812ULL, 1971833596783111058ULL, 10492873751032940676ULL,
+    15360466832112713609ULL, 8176664106825326962ULL, 6967746309188883150ULL, 9941787740593067983ULL,
+    12076718157299100372ULL, 7248953359128134692ULL, 675302267505954386ULL, 15390228219009039857ULL,
+    5065006369082635791ULL, 9635613409523478528ULL, 4288761130469937454ULL, 2540364866735078167ULL,
+    9870637204041722896ULL, 1578601481561907214ULL, 16771762314065076926ULL, 3449819795518075707ULL,
+    4214108294333898100ULL, 9745082557102659501ULL, 7268118283890814177ULL, 9925889079238884527ULL,
+    12612232635622936665ULL, 7347158568271425628ULL, 7511087151787920276ULL,
+    12703747948312977591ULL, 2992545002467739828ULL, 10218933784812529284ULL,
+    15663058293969560861ULL, 1319136851289863259ULL, 18001582031811821536ULL,
+    5128467924381512069ULL, 5234906304218798072ULL, 16275447281449007684ULL, 5803222583521721251ULL,
+    8705667213193499663ULL, 10947848169963016168ULL, 10858646622044552306ULL,
+    17924939677880213652ULL, 11499001968610294319ULL, 14972200249230414367ULL, 20617844198499649ULL,
+    9941544663209764884ULL, 13364452900252836865ULL, 16872716416823914802ULL,
+    8172341055011296734ULL, 2032770572809174455ULL, 11517144284135446952ULL, 3251488344790756462ULL,
+    17902896769215813636ULL, 13528657162919294975ULL, 1629777047653686026ULL,
+    10917702102754445619ULL, 17483441364394461351ULL, 5611759089820470869ULL,
+    10780373623447831198ULL, 3053462222299424711ULL, 4727746649982425768ULL, 8941915598192139568ULL,
+    5721954648141712804ULL, 5393282250928778599ULL, 4190571550920335588ULL, 14156616576243401338ULL,
+    11584670334183592847ULL, 14946770541582726959ULL, 3271708419673728078ULL,
+    15478609454504388504ULL, 15209188356220947708ULL, 10317321569600093658ULL,
+    2948387527932219912ULL, 2210904487719880357ULL, 15770682896545973250ULL, 9288064620734905692ULL,
+    5619961238098298985ULL, 17874192594342090386ULL, 10895260617015754974ULL,
+    7811365344562579477ULL, 18143620316773048228ULL, 8374109724550179335ULL, 2728779431600274558ULL,
+    18361128503078621171ULL, 17472681638904765500ULL, 1710657418261757317ULL,
+    1051611472428585430ULL, 9680098400851771521ULL, 11650935757490782283ULL,
+    11111949145853860137ULL, 13160454668884989882ULL, 13087731878906901181ULL,
+    17579370874593761489ULL, 14984523916945383512ULL, 15299467291136869281ULL,
+    1666245542655709545ULL, 12821152466194520205ULL, 12107840339065653907ULL,
+    7506773194382335548ULL, 12387122172224470997ULL, 10314176940431416792ULL,
+    8397926249592850646ULL, 8272534272052407056ULL, 3325834203963901382ULL, 9412453658760113021ULL,
+    12804596115016464175ULL, 9248375912294459838ULL, 12841168536150373954ULL,
+    10782321566925290392ULL, 1479718304791874393ULL, 4115308784920328903ULL, 9328823222188271722ULL,
+    5324754581603286439ULL, 13826339352918423962ULL, 1054407392237157971ULL, 3374663670529640418ULL,
+    17359049464722075656ULL, 8610570252129038335ULL, 3259554095307372053ULL, 3388660131799339622ULL,
+    16520138655079371087ULL, 11223518179640941739ULL, 3114003173186110780ULL,
+    6106924444598849423ULL, 9455493299964851536ULL, 17883831196384279136ULL,
+    11443909296283425608ULL, 10786564501857557198ULL, 8381143101840671176ULL,
+    9866489078777251060ULL, 4722596594657634079ULL, 11446797009455902303ULL, 6543416839347456157ULL,
+    12510474835299225392ULL, 11971632638732343801ULL, 2187899065490635701ULL,
+    5896775055864439825ULL, 4421808975439760714ULL, 13094621719382394884ULL, 129385167760259769ULL,
+    11239922476196597971ULL, 17301641114974629156ULL, 3343777160321958333ULL,
+    15622730689125158955ULL, 17840496559836544840ULL, 16748219449100358671ULL,
+    5457558863200549116ULL, 18275512932447690726ULL, 16498619204099979385ULL,
+    3421314836523514635ULL, 2103222944857170860ULL, 913452727993991426ULL, 4855127441272012951ULL,
+    3777154217998168659ULL, 7874165264060428149ULL, 7728719684104250747ULL, 16711997675477971363ULL,
+    11522303760181215409ULL, 12152190508564186947ULL, 3332491085311419091ULL,
+    7195560858679488794ULL, 5768936604421756199ULL, 15013546388764671097ULL, 6327500270739390378ULL,
+    2181609807153281969ULL, 16795852499185701293ULL, 16545068544104814112ULL,
+    6651668407927802764ULL, 378163243810674426ULL, 7162448156323376735ULL, 50007750879368061ULL,
+    7235592998591196293ULL, 3117899060141029169ULL, 2959436609583748787ULL, 8230617569840657806ULL,
+    210902370666991828ULL, 10649509163206572879ULL, 9205934632127296308ULL, 2108814784474315943ULL,
+    6749327341059280836ULL
+  };
+
+static const
+uint64_t
+Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_6144[1536U] =
+  {
+    1ULL, 6625302352714527130ULL, 6621040161784800555ULL, 11338211017857343038ULL,
+    13844827703123173782ULL, 11872770674673352489ULL, 1396933849091986683ULL,
+    8300365191966690300ULL, 1972767720800022248ULL, 12655739279149616245ULL,
+    11373510794623670201ULL, 2942254133011841185ULL, 447816675200511091ULL, 17660624766527701825ULL,
+    5501364918141512061ULL, 1248974689378231305ULL, 7726376929174292077ULL, 9926410442153739326ULL,
+    12070147442344470091ULL, 9245151660988161084ULL, 17672474582601981329ULL,
+    6913323867221716508ULL, 5164166220879806247ULL, 6546982649772545775ULL, 14375129390935853960ULL,
+    7268989850881752032ULL, 3626235149989974926ULL, 5508311142273901509ULL, 7963528091525907123ULL,
+    14144587953330576183ULL, 15872298883050291545ULL, 12797122187272967621ULL,
+    17582786636179870597ULL, 4140496364669904637ULL, 12847177292060720414ULL,
+    8157789849713597332ULL, 17689416073234252336ULL, 15398142846501582131ULL,
+    16564880180854652867ULL, 17786516327095366789ULL, 10536319790460633031ULL,
+    6266934757955653435ULL, 1339224948780144589ULL, 10289097291785293429ULL, 8649906742950245253ULL,
+    9843796635614494715ULL, 6017548786423861991ULL, 9714007226925426761ULL, 10489074009276287748ULL,
+    15716404727373750542ULL, 14115652399417418371ULL, 17673021675528790544ULL,
+    16303142514212976561ULL, 6069407987786716453ULL, 1698653358766278130ULL,
+    11768325102693910881ULL, 11172619105163981824ULL, 793402836563571244ULL, 5471015293666756283ULL,
+    5837207135417298319ULL, 11994017116559320803ULL, 9594605479641221137ULL,
+    11406369043538065144ULL, 4885010457282477511ULL, 2434939712866548900ULL, 8616720652128235555ULL,
+    4110860504540188677ULL, 4211163054503197773ULL, 14144121169518649338ULL, 4323953603796554380ULL,
+    8192309187197107836ULL, 7966024840978791424ULL, 4597044040449118366ULL, 7060803219010100499ULL,
+    17651955733026411151ULL, 5884254285051282662ULL, 16334764051874099723ULL,
+    5086012348022918039ULL, 3384268977381776388ULL, 4896906469902582942ULL, 14939343422031758981ULL,
+    16289140927792027850ULL, 2114851401515407245ULL, 7471739577835287688ULL, 5379809933286454986ULL,
+    8835106627185206540ULL, 15838045949444854063ULL, 3179788908133259934ULL, 684069943791820421ULL,
+    9426065479060130343ULL, 3705444559692808454ULL, 6205619158396947460ULL, 2830013720935188842ULL,
+    5774645926098551566ULL, 5910881771259737445ULL, 0ULL, 2ULL, 13250604705429054260ULL,
+    13242080323569601110ULL, 4229677962005134460ULL, 9242911332536795949ULL, 5298797275637153363ULL,
+    2793867698183973367ULL, 16600730383933380600ULL, 3945535441600044496ULL, 6864734484589680874ULL,
+    4300277515537788787ULL, 5884508266023682371ULL, 895633350401022182ULL, 16874505459345852034ULL,
+    11002729836283024123ULL, 2497949378756462610ULL, 15452753858348584154ULL,
+    1406076810597927036ULL, 5693550810979388567ULL, 43559248266770553ULL, 16898205091494411043ULL,
+    13826647734443433017ULL, 10328332441759612494ULL, 13093965299545091550ULL,
+    10303514708162156304ULL, 14537979701763504065ULL, 7252470299979949852ULL,
+    11016622284547803018ULL, 15927056183051814246ULL, 9842431832951600750ULL,
+    13297853692391031475ULL, 7147500300836383627ULL, 16718829198650189579ULL,
+    8280992729339809275ULL, 7247610510411889212ULL, 16315579699427194665ULL,
+    16932088072758953056ULL, 12349541619293612647ULL, 14683016287999754119ULL,
+    17126288580481181963ULL, 2625895507211714447ULL, 12533869515911306871ULL,
+    2678449897560289178ULL, 2131450509861035242ULL, 17299813485900490507ULL, 1240849197519437814ULL,
+    12035097572847723983ULL, 981270380141301906ULL, 2531403944843023881ULL, 12986065381037949469ULL,
+    9784560725125285127ULL, 16899299277348029473ULL, 14159540954716401507ULL,
+    12138815975573432907ULL, 3397306717532556260ULL, 5089906131678270146ULL, 3898494136618412033ULL,
+    1586805673127142489ULL, 10942030587333512566ULL, 11674414270834596638ULL,
+    5541290159409089990ULL, 742466885572890659ULL, 4365994013366578673ULL, 9770020914564955023ULL,
+    4869879425733097800ULL, 17233441304256471110ULL, 8221721009080377354ULL, 8422326109006395546ULL,
+    9841498265327747060ULL, 8647907207593108761ULL, 16384618374394215672ULL,
+    15932049681957582848ULL, 9194088080898236732ULL, 14121606438020200998ULL,
+    16857167392343270686ULL, 11768508570102565325ULL, 14222784030038647830ULL,
+    10172024696045836079ULL, 6768537954763552776ULL, 9793812939805165884ULL,
+    11431942770353966346ULL, 14131537781874504085ULL, 4229702803030814491ULL,
+    14943479155670575376ULL, 10759619866572909972ULL, 17670213254370413080ULL,
+    13229347825180156510ULL, 6359577816266519869ULL, 1368139887583640842ULL, 405386884410709070ULL,
+    7410889119385616909ULL, 12411238316793894920ULL, 5660027441870377684ULL,
+    11549291852197103132ULL, 11821763542519474890ULL, 0ULL, 10522495876901480092ULL,
+    1437716310442276340ULL, 140362248982049358ULL, 7055150396798466382ULL, 6210794744606582362ULL,
+    403801359444518915ULL, 854615921639054068ULL, 12951925078197459005ULL, 1657622111477778623ULL,
+    14730278569381633261ULL, 9915915497045583132ULL, 6634406010566793440ULL, 1147861606233328842ULL,
+    17303611694634535677ULL, 11692804810607668546ULL, 13957036220086133541ULL,
+    1072298883250542777ULL, 12480518694791443191ULL, 2992207016222620191ULL, 8724977708160300068ULL,
+    1247740938022959700ULL, 7612391298643362275ULL, 11651836962067283840ULL,
+    12023560117893427975ULL, 6612034034991940109ULL, 8097666090291206130ULL,
+    11826810821418826635ULL, 6888953671216050011ULL, 18208440841297466028ULL,
+    5479418590508098804ULL, 6475132685706983669ULL, 8553601914348859772ULL, 14701492392407128077ULL,
+    13075913042468505728ULL, 15296454571234934526ULL, 1665287241700216767ULL,
+    6507883214614870618ULL, 9367406666870319660ULL, 10398206910686725704ULL,
+    15327589930165701057ULL, 9740531259354409061ULL, 4226372156305272370ULL, 7014628537422921243ULL,
+    4876592859883783415ULL, 11405166259959949556ULL, 1134436750045000069ULL,
+    17818236150073429328ULL, 8421165346023704693ULL, 10440086366886035920ULL,
+    16328373486333609118ULL, 11184603881657846570ULL, 17402172364547317861ULL,
+    7064354012582437320ULL, 9396790961780138100ULL, 17941410367775735292ULL, 3528662473683205407ULL,
+    8537051582954987410ULL, 369816842318530225ULL, 16911397797751408192ULL, 5607776560418043544ULL,
+    4504335779509809859ULL, 16926614508260457843ULL, 9374065231286435273ULL, 9976499669466057609ULL,
+    17852773215078518141ULL, 2490771566983206529ULL, 4364626938761987490ULL,
+    15415616477138656175ULL, 3315318527958973117ULL, 16975321591694059183ULL,
+    12996264508835468129ULL, 11327682597781229244ULL, 18135543686702153050ULL,
+    11459053791950797392ULL, 1556349246973593815ULL, 7731373792449820422ULL, 8138696022493543430ULL,
+    14461478510737279319ULL, 1293547858045645803ULL, 12631117396516366153ULL,
+    11048480435843486296ULL, 17391673134047797291ULL, 2525716494890318816ULL,
+    8755680662847028774ULL, 1660989455111254517ULL, 14166238667981259637ULL, 5570721449669538685ULL,
+    2909246471118217409ULL, 15534845128046659383ULL, 10406631912955642327ULL,
+    16678636967840794888ULL, 17397974997537308158ULL, 853748020597651475ULL,
+    17729404681403355018ULL, 12864228078433870500ULL, 3788317426000325801ULL,
+    2598247680093408568ULL, 2875432620884552681ULL, 280724497964098716ULL, 14110300793596932764ULL,
+    12421589489213164724ULL, 807602718889037830ULL, 1709231843278108136ULL, 7457106082685366394ULL,
+    3315244222955557247ULL, 11013813065053714906ULL, 1385086920381614649ULL,
+    13268812021133586881ULL, 2295723212466657684ULL, 16160479315559519738ULL,
+    4938865547505785477ULL, 9467328366462715467ULL, 2144597766501085555ULL, 6514293315873334766ULL,
+    5984414032445240383ULL, 17449955416320600136ULL, 2495481876045919400ULL,
+    15224782597286724550ULL, 4856929850425016064ULL, 5600376162077304335ULL,
+    13224068069983880219ULL, 16195332180582412260ULL, 5206877569128101654ULL,
+    13777907342432100023ULL, 17970137608885380440ULL, 10958837181016197609ULL,
+    12950265371413967338ULL, 17107203828697719544ULL, 10956240711104704538ULL,
+    7705082011227459841ULL, 12146165068760317437ULL, 3330574483400433535ULL,
+    13015766429229741236ULL, 288069260031087704ULL, 2349669747663899793ULL, 12208435786621850499ULL,
+    1034318444999266507ULL, 8452744312610544741ULL, 14029257074845842486ULL, 9753185719767566830ULL,
+    4363588446210347496ULL, 2268873500090000139ULL, 17189728226437307040ULL,
+    16842330692047409387ULL, 2433428660062520224ULL, 14210002898957666621ULL,
+    3922463689606141525ULL, 16357600655385084107ULL, 14128708025164874641ULL, 346837849850724584ULL,
+    17436076661841918969ULL, 7057324947366410815ULL, 17074103165909974820ULL, 739633684637060450ULL,
+    15376051521793264768ULL, 11215553120836087089ULL, 9008671559019619718ULL,
+    15406484942811364070ULL, 301386388863318931ULL, 1506255265222563603ULL, 17258802356447484667ULL,
+    4981543133966413059ULL, 8729253877523974980ULL, 12384488880567760734ULL, 6630637055917946235ULL,
+    15503899109678566750ULL, 7545784943961384643ULL, 4208621121852906873ULL,
+    17824343299694754485ULL, 4471363510192043169ULL, 3112698493947187631ULL,
+    15462747584899640844ULL, 16277392044987086860ULL, 10476212947765007022ULL,
+    2587095716091291607ULL, 6815490719323180690ULL, 3650216797977420977ULL, 16336602194386042967ULL,
+    5051432989780637633ULL, 17511361325694057548ULL, 3321978910222509034ULL, 9885733262252967658ULL,
+    11141442899339077371ULL, 5818492942236434818ULL, 12622946182383767150ULL,
+    2366519752201733039ULL, 14910529861972038161ULL, 16349205921365064701ULL,
+    1707496041195302951ULL, 17012065289097158420ULL, 7281712083158189385ULL, 7576634852000651603ULL,
+    16642327977967427864ULL, 11279788052830852802ULL, 5798725918224528873ULL,
+    13160303882948560881ULL, 1410233136378673599ULL, 5171051029353004604ULL,
+    14247739536412693416ULL, 6645268244646329088ULL, 14195215682699092667ULL,
+    9600848317078311073ULL, 5952026330383750263ULL, 7924318759266456418ULL, 9038323774449410075ULL,
+    4475042587725630778ULL, 17564371145846274601ULL, 12823508329723252367ULL,
+    18273154756141462580ULL, 15810774109997459341ULL, 13314481785418368324ULL,
+    12478839840068806775ULL, 16137351917734369271ULL, 6318252380541426996ULL,
+    12450545687296817849ULL, 16524575101290678606ULL, 9162663029018099173ULL,
+    2079165038740552661ULL, 7887754071060819315ULL, 2714921661456777104ULL, 16751383564633008635ULL,
+    14874435302970959550ULL, 7615043586730131123ULL, 3913870178089242667ULL, 3600015764320049816ULL,
+    7673460203843440331ULL, 9367804087448544138ULL, 7307732539805643753ULL, 10512924610929502376ULL,
+    4347265257677863988ULL, 4370220622386362325ULL, 865717040834554848ULL, 2349867705578261075ULL,
+    10447015899508332204ULL, 17668858330812597780ULL, 11338743266050250152ULL,
+    7863751264179123420ULL, 14442306457757937833ULL, 7631959466420880344ULL, 2635422925454180718ULL,
+    18078094572814940417ULL, 9190854631191820804ULL, 15169528347281958421ULL,
+    7879821498288529960ULL, 5944791881095696235ULL, 16364940483596544166ULL, 1708349440334200567ULL,
+    12045447501393662462ULL, 9723493801251381114ULL, 15736383546925382929ULL,
+    3331203245203826389ULL, 7745810036709855754ULL, 7160428885146871890ULL, 14914957317251589737ULL,
+    17991674586796396175ULL, 15803464797715267600ULL, 7045872529317905600ULL,
+    2527535677337433896ULL, 10075852475107804269ULL, 3874056052514340419ULL, 7686500725438747263ULL,
+    14653427822507296103ULL, 912611324013128173ULL, 4875831254379690488ULL, 2173350652895724156ULL,
+    995897172244858804ULL, 7006647947579706249ULL, 3497353119022369731ULL, 11092200485194055236ULL,
+    18431917027609556935ULL, 8110151259307687115ULL, 1456418441669623175ULL,
+    12120841737994695303ULL, 3219992224342871051ULL, 4943362297472475531ULL, 8711621638183049944ULL,
+    7133771084551682902ULL, 12502441256010052268ULL, 4795253089141821463ULL, 8688745838770753551ULL,
+    15983419499956530931ULL, 2894229418950176220ULL, 1430238032786402076ULL, 4895279159367291044ULL,
+    14824940987802750981ULL, 755693917800223472ULL, 10163023951660177733ULL, 4881707084610250860ULL,
+    14837911882225304112ULL, 4112832031952153989ULL, 11597451836449057747ULL,
+    7873863692187570146ULL, 2820466272757347199ULL, 10342102058706009208ULL,
+    10048734999115835216ULL, 13290536489292658177ULL, 9943687291688633718ULL, 754952560447070531ULL,
+    11904052660767500527ULL, 15848637518532912836ULL, 18076647548898820150ULL,
+    8950085175451261556ULL, 16681998217982997586ULL, 7200272585736953119ULL,
+    18099565438573373545ULL, 13174804146285367067ULL, 8182219497127185033ULL,
+    6510935606428061935ULL, 13827959761759186927ULL, 12636504761082853993ULL,
+    6454347300884084082ULL, 14602406128871805597ULL, 18325326058036198347ULL,
+    4158330077481105322ULL, 15775508142121638630ULL, 5429843322913554208ULL,
+    15056023055556465654ULL, 11302126532232367485ULL, 15230087173460262247ULL,
+    7827740356178485334ULL, 7200031528640099632ULL, 15346920407686880662ULL, 288864101187536660ULL,
+    14615465079611287507ULL, 2579105148149453136ULL, 8694530515355727977ULL, 8740441244772724650ULL,
+    1731434081669109696ULL, 4699735411156522150ULL, 2447287725307112792ULL, 16890972587915643945ULL,
+    4230742458390948689ULL, 15727502528358246841ULL, 10437868841806324050ULL,
+    15263918932841760689ULL, 5270845850908361436ULL, 17709445071920329218ULL,
+    18381709262383641609ULL, 11892312620854365226ULL, 15759642996577059921ULL,
+    11889583762191392470ULL, 14283136893483536716ULL, 3416698880668401135ULL,
+    5644150929077773308ULL, 1000243528793210613ULL, 13026023020141214243ULL, 6662406490407652779ULL,
+    15491620073419711508ULL, 14320857770293743780ULL, 11383170560793627858ULL,
+    17536605099883240735ULL, 13160185521720983585ULL, 14091745058635811201ULL,
+    5055071354674867792ULL, 1704960876506056922ULL, 7748112105028680839ULL, 15373001450877494526ULL,
+    10860111571305040590ULL, 1825222648026256347ULL, 9751662508759380976ULL, 4346701305791448312ULL,
+    1991794344489717608ULL, 14013295895159412498ULL, 6994706238044739462ULL, 3737656896678558856ULL,
+    18417089981509562255ULL, 16220302518615374231ULL, 2912836883339246350ULL,
+    5794939402279838990ULL, 6439984448685742103ULL, 9886724594944951062ULL, 17423243276366099888ULL,
+    14267542169103365804ULL, 6558138438310552920ULL, 9590506178283642927ULL,
+    17377491677541507102ULL, 13520094926203510246ULL, 5788458837900352441ULL,
+    2860476065572804152ULL, 9790558318734582088ULL, 11203137901895950346ULL, 1511387835600446945ULL,
+    1879303829610803850ULL, 9763414169220501721ULL, 4194047425722257774ULL, 1303407957424823370ULL,
+    10220261950429052616ULL, 15240280661947826425ULL, 11425953588588653757ULL,
+    5622964781063982447ULL, 5610163827459099534ULL, 1525186532296957535ULL, 9696593459723441661ULL,
+    17130846211901680813ULL, 18432341216722620996ULL, 12970636281434156837ULL,
+    15928104663411810789ULL, 15072971443732939071ULL, 3294244128611706680ULL,
+    15682894810311862159ULL, 11743638742035348685ULL, 16111147098473542053ULL,
+    1137250594638081280ULL, 2353376448765699733ULL, 91664101026761531ULL, 11625322040075496625ULL,
+    10237246819394489527ULL, 8201421137466485879ULL, 15207148041129439169ULL,
+    11164550733171280762ULL, 17062917284754098404ULL, 5625609120074050575ULL,
+    9548629659957033480ULL, 10185050328545631890ULL, 17116313200502879253ULL,
+    8373838622418913124ULL, 5951291469244974935ULL, 16861931153130568678ULL, 4932083934928410211ULL,
+    17079604683514502613ULL, 7138739742251811211ULL, 9309187755597290261ULL, 1297454527176366709ULL,
+    4735079147060913136ULL, 9549636166507898209ULL, 16227518732753928495ULL,
+    18144849753942120898ULL, 6682194717736096854ULL, 1850966119818035208ULL, 6738450042807990124ULL,
+    17539170566914636148ULL, 2271578552289081854ULL, 10253523649339356369ULL,
+    9692546283414348272ULL, 8045013613637959505ULL, 7875581418332911861ULL, 15919360700469852958ULL,
+    9911172642018969399ULL, 4889985909800837686ULL, 14239969725498139724ULL, 5120432306421606154ULL,
+    5031613868220554563ULL, 2700946438240767250ULL, 12666978940981592512ULL, 1629037724464747200ULL,
+    14883746022718421656ULL, 14727726799917607163ULL, 15633983149026218187ULL,
+    12177691623827763569ULL, 10207147379497182848ULL, 12950912103113188629ULL,
+    5806652794784300242ULL, 11551130739753473855ULL, 17417004542571854881ULL,
+    9601889400807427488ULL, 10852704109229021868ULL, 15648863109145107496ULL,
+    3063531186801973721ULL, 9012237136382971485ULL, 6914349596540264234ULL, 16196555162677082691ULL,
+    2753203755289223462ULL, 5678042218372821739ULL, 5724674903551716334ULL, 3598862184057279925ULL,
+    12462337350053700104ULL, 18387217847641213638ULL, 9815345430684152996ULL,
+    16769745222461186904ULL, 7824771291962317457ULL, 8679454883497139563ULL, 4403933050544230709ULL,
+    13288988432114232223ULL, 4834419834837878216ULL, 9671815933515626017ULL, 6571905789510683670ULL,
+    2936640061635280872ULL, 1918298891012109568ULL, 11398779870045697557ULL, 4565917106747444880ULL,
+    8388094851444515548ULL, 2606815914849646740ULL, 1993779827148553616ULL, 12033817250186101235ULL,
+    4405163103467755899ULL, 11245929562127964895ULL, 11220327654918199068ULL,
+    3050373064593915070ULL, 946442845737331706ULL, 15814948350093810011ULL, 18417938359735690377ULL,
+    7494528489158762059ULL, 13409465253114069963ULL, 11699198813756326527ULL,
+    6588488257223413361ULL, 12919045546914172702ULL, 5040533410361145755ULL,
+    13775550123237532491ULL, 2274501189276162561ULL, 4706752897531399466ULL, 183328202053523062ULL,
+    4803900006441441634ULL, 2027749565079427439ULL, 16402842274932971759ULL,
+    11967552008549326722ULL, 3882357392633009909ULL, 15679090495798645193ULL,
+    11251218240148101151ULL, 650515246204515344ULL, 1923356583381712165ULL, 15785882327296206891ULL,
+    16747677244837826249ULL, 11902582938489949870ULL, 15277118232551585740ULL,
+    9864167869856820423ULL, 15712465293319453610ULL, 14277479484503622423ULL, 171631437485028906ULL,
+    2594909054352733419ULL, 9470158294121826272ULL, 652528259306244802ULL, 14008293391798305375ULL,
+    17842955434174690181ULL, 13364389435472193709ULL, 3701932239636070416ULL,
+    13476900085615980248ULL, 16631597060119720680ULL, 4543157104578163709ULL,
+    2060303224969161122ULL, 938348493119144929ULL, 16090027227275919011ULL, 15751162836665823722ULL,
+    13391977327230154300ULL, 1375601210328387183ULL, 9779971819601675373ULL,
+    10033195377286727832ULL, 10240864612843212309ULL, 10063227736441109126ULL,
+    5401892876481534500ULL, 6887213808253633408ULL, 3258075448929494401ULL, 11320747971727291696ULL,
+    11008709526125662711ULL, 12821222224342884759ULL, 5908639173945975523ULL,
+    1967550685284814081ULL, 7455080132516825643ULL, 11613305589568600485ULL, 4655517405797396094ULL,
+    16387265011434158147ULL, 757034727905303361ULL, 3258664144748492121ULL, 12850982144580663377ULL,
+    6127062373603947443ULL, 18024474272765942970ULL, 13828699193080528468ULL,
+    13946366251644613766ULL, 5506407510578446925ULL, 11356084436745643478ULL,
+    11449349807103432668ULL, 7197724368114559850ULL, 6477930626397848592ULL,
+    18327691621572875661ULL, 1183946787658754377ULL, 15092746371212822193ULL,
+    15649542583924634915ULL, 17358909766994279126ULL, 8807866101088461418ULL,
+    8131232790518912830ULL, 9668839669675756433ULL, 896887793321700418ULL, 13143811579021367341ULL,
+    5873280123270561744ULL, 3836597782024219136ULL, 4350815666381843498ULL, 9131834213494889761ULL,
+    10308343603202120179ULL, 747772697764980576ULL, 12569040889487148934ULL,
+    12683280486838276175ULL, 6085805797118068132ULL, 9624331190602878552ULL, 2896597424463126679ULL,
+    761274804710622456ULL, 12380216776395503431ULL, 4137871214257161261ULL, 4655068096639607950ULL,
+    6253190633022569093ULL, 17125341626826450409ULL, 11737615029842582500ULL,
+    8113225992227728870ULL, 17872902975235922081ULL, 781210509713208929ULL, 12289753573970648195ULL,
+    16152370103022313118ULL, 2293188544630241351ULL, 14059608916755692595ULL,
+    11977108562062664536ULL, 7249439005018545805ULL, 4646355461458799219ULL,
+    13412506677053666015ULL, 11572529216893786264ULL, 1253878885839284561ULL,
+    14490841881308580060ULL, 16297186946279495936ULL, 12412733653355622604ULL,
+    13414549397060332360ULL, 4656993466585831495ULL, 12592859617292862308ULL,
+    4761127290155387385ULL, 12467648270475641896ULL, 3078767632182830721ULL,
+    16870447460045697506ULL, 14428142152533519356ULL, 4821401623825873660ULL,
+    4469366675295902427ULL, 11257924937979177774ULL, 8556699267799468302ULL, 3989173789473139411ULL,
+    4465530494037167359ULL, 4447244185858797295ULL, 8633938316510658154ULL, 8810099810657446228ULL,
+    2442183859850169422ULL, 16769870053609304301ULL, 17561567576250344611ULL,
+    8168279828621736064ULL, 17002250112843584424ULL, 2705760892453624998ULL, 6064299143093337856ULL,
+    13458989553908099356ULL, 11769235693190755959ULL, 10951908469022252670ULL,
+    10450808589768833088ULL, 3347851329941189084ULL, 7109429057951259392ULL, 2815397354014740412ULL,
+    14917314809905058905ULL, 5522654344929911559ULL, 2800953380905901978ULL,
+    16969595551561615432ULL, 4594624367304452679ULL, 9710516256517762694ULL, 5593442525388334864ULL,
+    2653045570900491347ULL, 13589913815420363888ULL, 5646975478130339029ULL,
+    13769954133751687327ULL, 5976400942163104471ULL, 15310923324406005538ULL,
+    14105421220613902740ULL, 4521493203375659898ULL, 9488975106115790810ULL, 4199574759762287159ULL,
+    17053171727902141163ULL, 17932898436471948080ULL, 10207940854101069627ULL,
+    15840741483703567722ULL, 2680358714364980334ULL, 11949879371818024782ULL,
+    17184187818391700476ULL, 18345897031112970085ULL, 9927733997937431640ULL,
+    1786263906298968135ULL, 17072070058160549139ULL, 17243092006098972835ULL,
+    11360609777471656250ULL, 18373221727452434149ULL, 10398114088413634059ULL,
+    11506533719200194909ULL, 14515052522643937630ULL, 14701150288146220031ULL,
+    2169943132694688743ULL, 8120847748244488283ULL, 13312377867049546807ULL,
+    18258027917824343773ULL, 7569695223649758431ULL, 12674688982169557978ULL,
+    7190128698018240042ULL, 9822914801387935212ULL, 8286457199881477494ULL, 2484737633954387152ULL,
+    2236902914193334486ULL, 15448635399056979372ULL, 16251755855143860293ULL,
+    4242366678793763594ULL, 3281072828887418187ULL, 101292492430972236ULL, 9288797948600709937ULL,
+    16059173516385484100ULL, 7481399500969993096ULL, 13831528750248643788ULL,
+    8898204268694263287ULL, 12420796917637493966ULL, 1216300157207346242ULL,
+    15839693572690144214ULL, 4306654597624082758ULL, 11967304210959772946ULL,
+    6133992921668544049ULL, 16043250831181510013ULL, 3664413836665795764ULL, 2076567112622718161ULL,
+    5807909529751853035ULL, 3664365046735078997ULL, 5875017723346491982ULL, 13662750944980679409ULL,
+    888985685592900974ULL, 14315325114079258776ULL, 14536822845906544116ULL, 7360939004149517613ULL,
+    7760939354796848573ULL, 8278505603977620028ULL, 14605425592709436964ULL, 4933589219845038424ULL,
+    9317572527726423412ULL, 773414206150076531ULL, 17544395114667839844ULL, 8664929194926259407ULL,
+    5191004334029202832ULL, 14598374946625765606ULL, 7135325969075793118ULL,
+    13946051732455336534ULL, 12005467982951338885ULL, 14784033753796856161ULL,
+    3267920225410674943ULL, 18198006273973392166ULL, 10169888392872925226ULL,
+    16860052415365871184ULL, 14629691969498935549ULL, 3248275942391685805ULL,
+    12166717953549134452ULL, 1609321177610265487ULL, 17624811824588801628ULL,
+    2535746952032235715ULL, 4004933659688336648ULL, 10486917219094281468ULL,
+    17927386742280228148ULL, 17805969386737140914ULL, 5085148943866162449ULL,
+    15398048105279867502ULL, 1003468237610080416ULL, 13057037160927730541ULL,
+    1039516069748234279ULL, 17059189034772614463ULL, 16549845924775327309ULL, 789161720403008343ULL,
+    8969310026835113401ULL, 14927240691802602460ULL, 16865970190396129727ULL,
+    13485161867547492358ULL, 597124285766955482ULL, 3869215195427375872ULL, 16908481056524346621ULL,
+    11077135747780060063ULL, 7475568830245367915ULL, 12924754247761785636ULL,
+    2854697422650752707ULL, 8633412541992043480ULL, 17246769871610165729ULL, 6752316720731196205ULL,
+    16381465986403367083ULL, 7018761343838972782ULL, 7979920040926569340ULL, 6058574465882712527ULL,
+    5179497824052905346ULL, 10340969290789389769ULL, 16494242742838061090ULL,
+    10955556502582888447ULL, 6207716543924147308ULL, 9050694082435253961ULL, 3440144319959210464ULL,
+    17505678778476476327ULL, 7642500147584803252ULL, 2335909163974467705ULL,
+    18336216371976488606ULL, 3751058954807301821ULL, 17713126023731289099ULL,
+    2607484466320600927ULL, 4875667070637216128ULL, 11173718528163777295ULL, 1623503557285884076ULL,
+    5468513402289621074ULL, 12841417869073617060ULL, 9872671443637758352ULL,
+    17044562165277998469ULL, 9661336680929960516ULL, 10229030633053616677ULL,
+    7199243429734293516ULL, 8339551519513043579ULL, 9562366666329212195ULL, 3669844639768241324ULL,
+    6847353227479018537ULL, 11762925134070034820ULL, 9808790876575461743ULL,
+    18055982075296970051ULL, 16084248810481131237ULL, 5498520198585434485ULL,
+    11911221765326328760ULL, 16933707258161162448ULL, 7392817546988676404ULL,
+    10338989267289416627ULL, 15795359164612290518ULL, 8598612691940759915ULL,
+    18164430193752057719ULL, 15901757049039284952ULL, 17529066505448050931ULL,
+    18229554880529978416ULL, 10052364717482879818ULL, 11286297837742358501ULL,
+    591272785489517633ULL, 16520720770995736869ULL, 311082899824835199ULL, 7676271510626579039ULL,
+    11305137646031707306ULL, 17981843862741546790ULL, 3204598182223212133ULL,
+    15880202059442482283ULL, 16619153436638163095ULL, 5179898093323554514ULL,
+    7180375818714854675ULL, 2616820100041031308ULL, 13584366845833139565ULL, 990134308503732959ULL,
+    15146109539849272666ULL, 182939205100078015ULL, 2004279820809699625ULL, 8752128154908251428ULL,
+    3242626340339326133ULL, 17353167175866501674ULL, 9072474961110077997ULL, 5908893110682364512ULL,
+    3659788009754115310ULL, 16260773118235008524ULL, 10739773623933768349ULL,
+    16179507973303614190ULL, 1836231385454969761ULL, 1194886646871114481ULL,
+    12781893256002281425ULL, 18207485139688097276ULL, 15349398856491142290ULL,
+    11970438572081032826ULL, 5695915320783925224ULL, 14547586806234343245ULL,
+    3242598576571270144ULL, 11449500028462188486ULL, 5099722391818546068ULL,
+    10356937915046774616ULL, 7279374983834952311ULL, 12767310686386727424ULL,
+    5363665269588310728ULL, 15346206799946369119ULL, 5974381919342841223ULL, 245156390996321073ULL,
+    10106802984815499302ULL, 12874701691629612820ULL, 4323781115456317448ULL,
+    8888604582114624744ULL, 4101364811324392647ULL, 16660377655362559642ULL, 3982175324628236739ULL,
+    10739527069285355ULL, 6798535137129303767ULL, 13830701761365581115ULL, 14843099020337389508ULL,
+    12415433087848294617ULL, 6279946443875483436ULL, 13501328801703221484ULL,
+    9456080427391192460ULL, 10683083924583228672ULL, 16544589002622287900ULL,
+    1175878445625860663ULL, 15802483101581293944ULL, 505531620843497214ULL, 17870708211790818101ULL,
+    2678100862188550841ULL, 6842947115629844160ULL, 3694823789772279244ULL, 10150907497397392357ULL,
+    12737456582579194566ULL, 2547573502944196394ULL, 4922013112311185784ULL,
+    10802339730304108744ULL, 14081464634742151830ULL, 5196894446747196501ULL,
+    15904833547918516872ULL, 7591313126170589283ULL, 12503855500416288896ULL,
+    1794945031021031233ULL, 1007491511656820369ULL, 8439827530323123904ULL, 2844711153164811797ULL,
+    783320615817060753ULL, 513824414987224479ULL, 1073543336564130472ULL, 12846225251953513211ULL,
+    9136013207540768815ULL, 1367277023339600620ULL, 17284470620184934059ULL,
+    11597658602232688629ULL, 7593162089798609539ULL, 12599442023893719010ULL,
+    13562787709978580763ULL, 16130501794495506469ULL, 997757614642023195ULL,
+    14662171392235798419ULL, 7449480328934688702ULL, 15933922417062066711ULL,
+    10911263091434963828ULL, 5555705690493851715ULL, 14007327853968357712ULL,
+    5087748364487852340ULL, 16123203591371851029ULL, 5355989980742149082ULL,
+    12061223453230973502ULL, 6028704512354975785ULL, 13587029239248948279ULL,
+    3090038640585487562ULL, 14791397605743443968ULL, 3678921975773744049ULL, 5167056034973352981ULL,
+    11538497515364137856ULL, 4801962478182970494ULL, 4528527529773707523ULL,
+    12322459816095950586ULL, 9806863320873220919ULL, 9292811328151825517ULL, 4777411191193242553ULL,
+    12204586476790708132ULL, 16509741875627014332ULL, 11649523826286220638ULL,
+    18023132377437865442ULL, 7883625825413137296ULL, 16533894463260878300ULL,
+    11440996042091565614ULL, 7713791319154199157ULL, 1771334406541972774ULL,
+    10091177110901632404ULL, 5889786868399332ULL, 9853641198075994410ULL, 12369451438193822952ULL,
+    2340275961379373463ULL, 15285457131660010177ULL, 5651400733765774004ULL, 1008912363862935949ULL,
+    3580476647386110598ULL, 8569727393259097692ULL, 14360520927698593868ULL, 973759342811418519ULL,
+    5870122715279097133ULL, 10601968523106653528ULL, 4693961185284976472ULL,
+    11827351139045894832ULL, 14535034311518293ULL, 17628795101708915638ULL, 132711722998824506ULL,
+    14169969807653420940ULL, 2851492775073759552ULL, 924972126647607484ULL, 15125541220281348060ULL,
+    11239453966965227401ULL, 11645090807715578034ULL, 16542653007948253434ULL,
+    12626407335196086328ULL, 3235040623536649550ULL, 3201692171339828904ULL, 5330210953243220021ULL,
+    13850366000103794169ULL, 2131992623227579134ULL, 26694138087220232ULL, 2637661755491911606ULL,
+    4581629443029607893ULL, 4946905021556185307ULL, 10264511230569918766ULL,
+    14092949118799633743ULL, 3920271265242445543ULL, 5326490873905536747ULL, 5557707453092699507ULL,
+    8901740353206454915ULL, 4538923797124428130ULL, 9020506985380590558ULL, 16510766690203135265ULL,
+    4580823941727692318ULL, 12573790550676403498ULL, 5620683645963758002ULL,
+    15216866635382650081ULL, 14329676463987338724ULL, 4682726677165283298ULL,
+    6984770234301495928ULL, 11110163557110474941ULL, 12785339025987500027ULL,
+    12893452585419686579ULL, 4551641254724701356ULL, 5360906491701750463ULL,
+    10175632852814893732ULL, 1383636726578025539ULL, 6402007003000020569ULL,
+    12062650600863780976ULL, 16572661318299045833ULL, 4297367914879964884ULL,
+    3969385487296079637ULL, 12378269019339570398ULL, 5899470196719496375ULL, 8988950718072259644ULL,
+    14654020176242287174ULL, 9412071442882182926ULL, 4969444719620568603ULL, 5537635730002388392ULL,
+    5649925181248345890ULL, 2970249956211248326ULL, 10572417618986681277ULL,
+    14995479863126790778ULL, 10167545489343653310ULL, 10039958560511789197ULL,
+    10095854353705116065ULL, 15068397416454307573ULL, 6344268979261963569ULL, 633627025638676113ULL,
+    7921296147428226389ULL, 1642209906151225441ULL, 17121816388175657157ULL,
+    11721302008949079626ULL, 767103116745011513ULL, 11557067841946532288ULL,
+    12067945302208304303ULL, 15808703381164633571ULL, 9045071556519868083ULL,
+    9323823142804941960ULL, 8636799584408124340ULL, 17484291242607877058ULL, 5527236242097000203ULL,
+    14764573015646524899ULL, 15513458008144014099ULL, 7483562906163500299ULL,
+    14749970762128330292ULL, 9335361228205720648ULL, 7267956465421149898ULL, 2688391261396335348ULL,
+    16686670847529383197ULL, 12598717112073168979ULL, 5320325488865438432ULL,
+    15856728852981061444ULL, 7808665682092981501ULL, 11880703146260904487ULL,
+    6447858563798343522ULL, 8287683771195392691ULL, 11782869383389939636ULL,
+    12615365747000620684ULL, 3803616892501287445ULL, 9711493157549772275ULL, 6442934220416333345ULL,
+    18349892992202655703ULL, 15153100506292395867ULL, 9528685770437853460ULL,
+    14072304771058377585ULL, 14553016191206614287ULL, 11650014946022170552ULL,
+    4843437541721604453ULL, 2817120221191930767ULL, 13427110758467421597ULL,
+    17808292264930642139ULL, 1801467972093279974ULL, 4086448507450240916ULL,
+    10650921775590023406ULL, 12564350438421848569ULL, 2026155996974462712ULL,
+    17931062790133439457ULL, 2090025606973334371ULL, 12836064176124211800ULL,
+    2530095062630797007ULL, 8953034856707866080ULL, 13341907448626403149ULL,
+    11901956437189304799ULL, 395047761650139475ULL, 9283147074857097541ULL, 2701250962883774736ULL,
+    8839421558039790585ULL, 13800519815589148628ULL, 16074971750677101146ULL,
+    11865003248523061627ULL, 17788349941700061780ULL, 7915374514282050890ULL,
+    17481598705146877866ULL, 12991688504320541523ULL, 1031107537167341749ULL,
+    11737111132037305390ULL, 2821777857886473006ULL, 4765715906470561473ULL, 3453660623012818719ULL,
+    9857855545873819908ULL, 6045017996590140486ULL, 15614450745216771493ULL, 2515059782004086854ULL,
+    4921229127542711057ULL, 11649977335680570567ULL, 6712871936905031021ULL, 7278543227977974448ULL,
+    16846113755430222212ULL, 18065875151394646186ULL, 870382311215112261ULL, 2703649496850764546ULL,
+    9027305555005059491ULL, 1335942001146080306ULL, 17092820246428638776ULL, 2567113515712566925ULL,
+    16429573921698784401ULL, 18414495891637561480ULL, 7213123978251896696ULL,
+    1114624506796993934ULL, 17936315561527003341ULL, 7814372621487396968ULL,
+    13388704117965341661ULL, 6010118987508286404ULL, 12439873156441334051ULL,
+    16635995131420024022ULL, 8755435105969207165ULL, 3187351764349509401ULL,
+    16989877060747928441ULL, 11128811713131244164ULL, 16073760653721578104ULL,
+    10574156987989534502ULL, 15605602401486264427ULL, 8260119691458420106ULL,
+    4311762716440520982ULL, 3038018149609894838ULL, 12219215507315300223ULL,
+    15378426087990554788ULL, 827967071071054402ULL, 2099452709847716392ULL, 1117425779066567350ULL,
+    18114000669557209468ULL, 17875934115728300832ULL, 1973423142184030843ULL,
+    3264802500957218804ULL, 1565865895662581202ULL, 10134959127818562732ULL,
+    15537557447633459807ULL, 9759312980574778637ULL, 13459728218268439238ULL,
+    7429513620327664604ULL, 1920712631722423117ULL, 3508433401967688753ULL, 13954101320255534197ULL,
+    4175289296026992200ULL, 10787022693135834826ULL, 1660312185181813355ULL, 3865189846183245418ULL,
+    3511742396679016629ULL, 18065076097272187580ULL, 3440641188101344147ULL,
+    15472511394505755121ULL, 16570170079963414404ULL, 4853285818334789489ULL,
+    12366911320873863164ULL, 17053641576735654496ULL, 12505037742629310916ULL,
+    17828217672509536639ULL, 2313087693960696622ULL, 6537153890573086720ULL, 7793033350401192948ULL,
+    4464062261821820824ULL, 16074002454064771821ULL, 2014436999042530097ULL, 8504733560800127460ULL,
+    4453784566000887694ULL, 4443230784614388461ULL, 6190500114046985306ULL, 4198766296617458871ULL,
+    17541487326535782026ULL, 15781885331076935448ULL, 11964038777124848575ULL,
+    754279043979981122ULL, 8701388897398591133ULL, 15792582856035569217ULL, 3353119259822868786ULL,
+    5369433644071906928ULL, 11480612224107853812ULL, 10224034822438732399ULL,
+    2055627628751561533ULL, 4175643435564947585ULL, 5597520198176714054ULL, 18379612274214537820ULL,
+    15525082223546239698ULL, 2962289956437480526ULL, 11772275992789793045ULL,
+    4898811613966436115ULL, 2240071473361853802ULL, 11006563112582228238ULL, 8946994200925239906ULL,
+    8389184132473021482ULL, 6950789192430252861ULL, 8437262386756702312ULL, 3049727764214165215ULL,
+    6267480551736271309ULL, 11850503032558839708ULL, 6196202070165888044ULL, 8713280773359150301ULL,
+    869889739226668973ULL, 3940763580594360298ULL, 5967866606216822350ULL, 8266013127423606983ULL,
+    6841583099799771876ULL, 4762429564687947373ULL, 8611688590499177180ULL, 15268861719916251828ULL,
+    17046628607794482942ULL, 15593797906384975303ULL, 17362056738868822250ULL,
+    15516250225470937209ULL, 6009841653968439662ULL, 17308285449063390041ULL,
+    1053096302406065613ULL, 17590789422518514392ULL, 4574379385317255904ULL,
+    15047913480213481399ULL, 3846387554326192704ULL, 14565435911480990549ULL,
+    1831072506142701499ULL, 15503562976143510619ULL, 12057097970461615539ULL,
+    8412618604512779563ULL, 15579124156319043231ULL, 4749584349637538608ULL,
+    17250104712408054082ULL, 11270186445825373072ULL, 16223691073424859117ULL,
+    6005320066898496653ULL, 11904590868609990247ULL, 817844988578672736ULL, 4556070044394915470ULL,
+    3908020683455865622ULL, 7078127141989314475ULL, 9741263571047644753ULL, 7704452309989197785ULL,
+    7407940907871613856ULL, 18287947308146415163ULL, 2506828839974405216ULL,
+    16733165713663684537ULL, 12705121440206580401ULL, 454965607887735751ULL, 7179550571911751272ULL,
+    721220705820278350ULL, 11915785026840793697ULL, 9250116028892088498ULL, 16330450108929129131ULL,
+    10388466331023189270ULL, 15426908766117532019ULL, 859856591261615441ULL, 3848467412969704475ULL,
+    6287078568038174712ULL, 15660539079761757377ULL, 6563331411549070217ULL,
+    17209691271309521663ULL, 4626175387921393245ULL, 13074307781146173440ULL,
+    15586066700802385896ULL, 8928124523643641648ULL, 13701260834419992026ULL,
+    4028873998085060195ULL, 17009467121600254920ULL, 8907569132001775388ULL, 8886461569228776922ULL,
+    12381000228093970612ULL, 8397532593234917742ULL, 16636230579362012436ULL,
+    13117026588444319281ULL, 5481333480540145535ULL, 1508558087959962245ULL,
+    17402777794797182266ULL, 13138421638361586818ULL, 6706238519645737573ULL,
+    10738867288143813856ULL, 4514480374506156008ULL, 2001325571167913183ULL, 4111255257503123067ULL,
+    8351286871129895170ULL, 11195040396353428108ULL, 18312480474719524024ULL,
+    12603420373382927781ULL, 5924579912874961053ULL, 5097807911870034474ULL, 9797623227932872231ULL,
+    4480142946723707604ULL, 3566382151454904860ULL, 17893988401850479813ULL,
+    16778368264946042964ULL, 13901578384860505722ULL, 16874524773513404624ULL,
+    6099455528428330430ULL, 12534961103472542618ULL, 5254261991408127800ULL,
+    12392404140331776089ULL, 17426561546718300602ULL, 1739779478453337946ULL,
+    7881527161188720596ULL, 11935733212433644700ULL, 16532026254847213966ULL,
+    13683166199599543752ULL, 9524859129375894746ULL, 17223377180998354360ULL,
+    12090979366122952040ULL, 15646513141879414269ULL, 12740851739060398991ULL,
+    16277369404028092885ULL, 12585756377232322803ULL, 12019683307936879325ULL,
+    16169826824417228466ULL, 2106192604812131227ULL, 16734834771327477168ULL,
+    9148758770634511809ULL, 11649082886717411182ULL, 7692775108652385409ULL,
+    10684127749252429482ULL, 3662145012285402999ULL, 12560381878577469622ULL,
+    5667451867213679463ULL, 16825237209025559127ULL, 12711504238928534846ULL,
+    9499168699275077217ULL, 16053465351106556548ULL, 4093628817941194529ULL,
+    14000638073140166619ULL, 12010640133796993307ULL, 5362437663510428878ULL,
+    1635689977157345473ULL, 9112140088789830940ULL, 7816041366911731244ULL, 14156254283978628950ULL,
+    1035783068385737890ULL, 15408904619978395571ULL, 14815881815743227712ULL,
+    18129150542583278710ULL, 5013657679948810433ULL, 15019587353617817458ULL,
+    6963498806703609187ULL, 909931215775471503ULL, 14359101143823502544ULL, 1442441411640556700ULL,
+    5384825979972035778ULL, 53487984074625381ULL, 14214156144148706647ULL, 2330188588336826925ULL,
+    12407073458525512423ULL, 1719713182523230883ULL, 7696934825939408950ULL
+  };
+
+static const
+uint64_t
+Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_8192[2048U] =
+  {
+    1ULL, 2986858831440100787ULL, 18366195413019527027ULL, 17860461355414036145ULL,
+    7507186900325088194ULL, 6432268481967194354ULL, 15027352002873096449ULL, 361767791013812097ULL,
+    2390571736096208335ULL, 5294722439476894097ULL, 16213929661610438679ULL, 8937361255791877032ULL,
+    6773923507673243086ULL, 3046683410453380959ULL, 11364808587032750598ULL, 7356098831349374596ULL,
+    12562112632787419907ULL, 16419703763152476883ULL, 12562605132473155601ULL,
+    4940279984342823307ULL, 12384962143021780957ULL, 12027411734882057646ULL,
+    15544525157824241827ULL, 12371305955488071037ULL, 15476470337529510427ULL,
+    3806650968878360829ULL, 12296182180252277146ULL, 8739743864582338518ULL,
+    17614488821904502544ULL, 10916748131528749985ULL, 166000078885970620ULL,
+    16266339733962903963ULL, 14506938494145738695ULL, 6625302352730232149ULL,
+    6621040161784800555ULL, 11338211017857343038ULL, 13844827703123173782ULL,
+    11872770674673352489ULL, 1396933849091986683ULL, 8300365191966690300ULL, 1972767720800022248ULL,
+    12655739279149616245ULL, 11373510794623670201ULL, 2942254133011841185ULL, 447816675200511091ULL,
+    17660624766527701825ULL, 5501364918141512061ULL, 1248974689378231305ULL, 7726376929174292077ULL,
+    9926410442153739326ULL, 12070147442344470091ULL, 9245151660988161084ULL,
+    17672474582601981329ULL, 6913323867221716508ULL, 5164166220879806247ULL, 6546982649772545775ULL,
+    14375129390935853960ULL, 7268989850881752032ULL, 3626235149989974926ULL, 5508311142273901509ULL,
+    7963528091525907123ULL, 14144587953330576183ULL, 15872298883050291545ULL,
+    12797122187272967621ULL, 17582786636179870597ULL, 4140496364669904637ULL,
+    12847177292060720414ULL, 8157789849713597332ULL, 17689416073234252336ULL,
+    15398142846501582131ULL, 16564880180854652867ULL, 17786516327095366789ULL,
+    10536319790460633031ULL, 6266934757955653435ULL, 1339224948780144589ULL,
+    10289097291785293429ULL, 8649906742950245253ULL, 9843796635614494715ULL, 6017548786423861991ULL,
+    9714007226925426761ULL, 10489074009276287748ULL, 15716404727373750542ULL,
+    14115652399417418371ULL, 17673021675528790544ULL, 16303142514212976561ULL,
+    6069407987786716453ULL, 1698653358766278130ULL, 11768325102693910881ULL,
+    11172619105163981824ULL, 793402836563571244ULL, 5471015293666756283ULL, 5837207135417298319ULL,
+    11994017116559320803ULL, 9594605479641221137ULL, 11406369043538065144ULL,
+    4885010457282477511ULL, 2434939712866548900ULL, 8616720652128235555ULL, 4110860504540188677ULL,
+    4211163054503197773ULL, 14144121169518649338ULL, 4323953603796554380ULL, 8192309187197107836ULL,
+    7966024840978791424ULL, 4597044040449118366ULL, 7060803219010100499ULL, 17651955733026411151ULL,
+    5884254285051282662ULL, 16334764051874099723ULL, 5086012348022918039ULL, 3384268977381776388ULL,
+    4896906469902582942ULL, 14939343422031758981ULL, 16289140927792027850ULL,
+    2114851401515407245ULL, 7471739577835287688ULL, 5379809933286454986ULL, 8835106627185206540ULL,
+    15838045949444854063ULL, 3179788908133259934ULL, 684069943791820421ULL, 9426065479060130343ULL,
+    3705444559692808454ULL, 6205619158396947460ULL, 2830013720935188842ULL, 5774645926098551566ULL,
+    5910881771259737445ULL, 0ULL, 2ULL, 5973717662880201574ULL, 18285646752329502438ULL,
+    17274178637118520675ULL, 15014373800650176389ULL, 12864536963934388708ULL,
+    11607959932036641282ULL, 723535582027624195ULL, 4781143472192416670ULL, 10589444878953788194ULL,
+    13981115249511325742ULL, 17874722511583754065ULL, 13547847015346486172ULL,
+    6093366820906761918ULL, 4282873100355949580ULL, 14712197662698749193ULL, 6677481191865288198ULL,
+    14392663452595402151ULL, 6678466191236759587ULL, 9880559968685646615ULL, 6323180212334010298ULL,
+    5608079396054563677ULL, 12642306241938932039ULL, 6295867837266590459ULL,
+    12506196601349469239ULL, 7613301937756721659ULL, 6145620286795002676ULL,
+    17479487729164677037ULL, 16782233570099453472ULL, 3386752189347948355ULL, 332000157771941241ULL,
+    14085935394216256310ULL, 10567132914581925775ULL, 13250604705460464299ULL,
+    13242080323569601110ULL, 4229677962005134460ULL, 9242911332536795949ULL, 5298797275637153363ULL,
+    2793867698183973367ULL, 16600730383933380600ULL, 3945535441600044496ULL, 6864734484589680874ULL,
+    4300277515537788787ULL, 5884508266023682371ULL, 895633350401022182ULL, 16874505459345852034ULL,
+    11002729836283024123ULL, 2497949378756462610ULL, 15452753858348584154ULL,
+    1406076810597927036ULL, 5693550810979388567ULL, 43559248266770553ULL, 16898205091494411043ULL,
+    13826647734443433017ULL, 10328332441759612494ULL, 13093965299545091550ULL,
+    10303514708162156304ULL, 14537979701763504065ULL, 7252470299979949852ULL,
+    11016622284547803018ULL, 15927056183051814246ULL, 9842431832951600750ULL,
+    13297853692391031475ULL, 7147500300836383627ULL, 16718829198650189579ULL,
+    8280992729339809275ULL, 7247610510411889212ULL, 16315579699427194665ULL,
+    16932088072758953056ULL, 12349541619293612647ULL, 14683016287999754119ULL,
+    17126288580481181963ULL, 2625895507211714447ULL, 12533869515911306871ULL,
+    2678449897560289178ULL, 2131450509861035242ULL, 17299813485900490507ULL, 1240849197519437814ULL,
+    12035097572847723983ULL, 981270380141301906ULL, 2531403944843023881ULL, 12986065381037949469ULL,
+    9784560725125285127ULL, 16899299277348029473ULL, 14159540954716401507ULL,
+    12138815975573432907ULL, 3397306717532556260ULL, 5089906131678270146ULL, 3898494136618412033ULL,
+    1586805673127142489ULL, 10942030587333512566ULL, 11674414270834596638ULL,
+    5541290159409089990ULL, 742466885572890659ULL, 4365994013366578673ULL, 9770020914564955023ULL,
+    4869879425733097800ULL, 17233441304256471110ULL, 8221721009080377354ULL, 8422326109006395546ULL,
+    9841498265327747060ULL, 8647907207593108761ULL, 16384618374394215672ULL,
+    15932049681957582848ULL, 9194088080898236732ULL, 14121606438020200998ULL,
+    16857167392343270686ULL, 11768508570102565325ULL, 14222784030038647830ULL,
+    10172024696045836079ULL, 6768537954763552776ULL, 9793812939805165884ULL,
+    11431942770353966346ULL, 14131537781874504085ULL, 4229702803030814491ULL,
+    14943479155670575376ULL, 10759619866572909972ULL, 17670213254370413080ULL,
+    13229347825180156510ULL, 6359577816266519869ULL, 1368139887583640842ULL, 405386884410709070ULL,
+    7410889119385616909ULL, 12411238316793894920ULL, 5660027441870377684ULL,
+    11549291852197103132ULL, 11821763542519474890ULL, 0ULL, 10181291036852022398ULL,
+    15935118825963866026ULL, 17737345621006478935ULL, 2017161994493757015ULL,
+    4435438033919458339ULL, 9489656562549398053ULL, 2088040599202557559ULL, 205235000227957587ULL,
+    1323714499563107824ULL, 9388668601577250993ULL, 2363062518049451044ULL, 4432436482419694957ULL,
+    12302795614650451830ULL, 6465947937271407971ULL, 9053775525271496675ULL,
+    16695964772138580706ULL, 16040378893071746667ULL, 14000598982469959916ULL,
+    7166439266671379370ULL, 10425430692834397541ULL, 7549141680347322863ULL,
+    13694700387392282194ULL, 9695023949102492243ULL, 14674980172147421668ULL,
+    15047311624900412017ULL, 6418605413469766204ULL, 3740468096247674079ULL, 748598652833914326ULL,
+    4921566227413180280ULL, 17747828775674974044ULL, 16387619833408172486ULL,
+    10340019622596383486ULL, 4850600395184229125ULL, 18180478609915851349ULL,
+    12126495548927191522ULL, 11116808231657016739ULL, 14560534399894917902ULL,
+    13149756942435249614ULL, 2066298562775780290ULL, 10488738241889906902ULL,
+    14359214898050904357ULL, 16629823971925646433ULL, 16741481635562457501ULL,
+    977592620509920418ULL, 15171050537091774230ULL, 12920371396054492861ULL, 1223949354088685913ULL,
+    5553955576670880666ULL, 7083261453150268310ULL, 9979882464827370775ULL, 14056461063125959434ULL,
+    8613252955307654214ULL, 3244939504044631919ULL, 6181350030378004457ULL, 1572848072320379693ULL,
+    5871540312135362438ULL, 3810876165148189318ULL, 385468065610339583ULL, 16192968721343547616ULL,
+    15751936178857052436ULL, 8634947224813578578ULL, 9738025774016491687ULL, 5747654372383760354ULL,
+    12974104094480121823ULL, 12344021914855058182ULL, 15200109920854544952ULL,
+    17203595144909538862ULL, 15524557591346903739ULL, 9729760112311452101ULL,
+    1850557489766769966ULL, 7941337834263949464ULL, 3966425580143630930ULL, 12447604922185850908ULL,
+    8446881889729069029ULL, 9736497912434453688ULL, 12603278666117396947ULL, 9434882088303115992ULL,
+    14566151993119308394ULL, 4500122403247687490ULL, 10412927955856383843ULL,
+    7389245121990883194ULL, 18282970581563887716ULL, 4462409800751260333ULL, 3882549607880576891ULL,
+    6664094468215491549ULL, 10217869869427228993ULL, 3623238021813342314ULL,
+    17278009470049111072ULL, 11287791665631507311ULL, 2581263303222408295ULL,
+    7150607369920513463ULL, 17021308271768807734ULL, 9513721446842603524ULL,
+    17572429723302610280ULL, 328647450949780630ULL, 12932561729363319138ULL, 5371756980183969228ULL,
+    11993249008432526965ULL, 8389631610961001156ULL, 14699924118114919851ULL,
+    7471811322302378724ULL, 13306386629720352921ULL, 16291628465855994990ULL,
+    16975835280869584622ULL, 17596117759799425784ULL, 18223149792247219240ULL,
+    12965024173522127098ULL, 3504505090461581940ULL, 12145667370886541172ULL,
+    15577328572759127327ULL, 3143929008034353472ULL, 17875034694236082405ULL,
+    3323977387060211208ULL, 16873927373139965785ULL, 12799304599021870420ULL,
+    9911563390933663476ULL, 13210620154293689795ULL, 16952582294077211224ULL,
+    6123605447274539337ULL, 5277219441019320830ULL, 7428078072552486240ULL, 14578320375295058886ULL,
+    12783888912023026726ULL, 71725504183598820ULL, 3881253114882509600ULL, 2187415285551711157ULL,
+    17925055808367765011ULL, 18221930777767829649ULL, 1915837999994493181ULL,
+    16410352409658281224ULL, 16947398507613381666ULL, 3448041270691998561ULL,
+    16378062968164004873ULL, 6964837533356438844ULL, 756689127568659952ULL, 772237791469727272ULL,
+    5038000735222423983ULL, 5625315568921844467ULL, 2493310623999789152ULL, 17802234220631266947ULL,
+    12932770663264595130ULL, 15978579284996196902ULL, 11025615563866192332ULL,
+    3854540228207432777ULL, 7749382271511810011ULL, 7527413580673293485ULL, 8448739592106362727ULL,
+    7344397296302066774ULL, 9036501430006875068ULL, 2523324362247518803ULL, 16487828982319674699ULL,
+    4827778152363811142ULL, 8677605439911231231ULL, 16643861795817893239ULL, 1330374299038073688ULL,
+    10236941170250167171ULL, 9010877203021311488ULL, 9518917535459594842ULL,
+    14494495671992763978ULL, 52890831736567704ULL, 5761395210804645331ULL, 6092771425142831616ULL,
+    12427287185929631985ULL, 15125083407461824901ULL, 6072408355493906355ULL,
+    1278796412124748487ULL, 5529530974643547265ULL, 10831097602036952488ULL,
+    12244453443192279347ULL, 9021899075581805880ULL, 7962985918329481973ULL, 4897439374031682023ULL,
+    12343173675674507935ULL, 6607879411217584316ULL, 7949263626318883889ULL,
+    12356885842719992637ULL, 3446155761765277081ULL, 11439431298098929261ULL,
+    3289581421177285728ULL, 8024913497893917898ULL, 5715609516981693552ULL, 829279854268173807ULL,
+    8309862365520565634ULL, 18290063274043270651ULL, 3550137647522680980ULL, 8039925982102431199ULL,
+    17565428518967518542ULL, 118695352568903150ULL, 6786678467443512665ULL, 15173895427654007942ULL,
+    8920863554108260638ULL, 1851842228814108036ULL, 5377342318470883731ULL, 16093972132669442927ULL,
+    10360879434460694907ULL, 2313416884988301580ULL, 255448150438053308ULL, 652513752325570449ULL,
+    14000811775673000180ULL, 7272623413673077034ULL, 16984785561122783232ULL,
+    4713954463704239878ULL, 2365476699939500350ULL, 17048910550310535708ULL, 9072926845846925622ULL,
+    2082612474434008272ULL, 15017793592919236973ULL, 12093119064928642831ULL,
+    6820820179548502521ULL, 15388857743082422743ULL, 4593727927210387423ULL, 6991376817580392711ULL,
+    11184587376934408044ULL, 8058403652931622824ULL, 8945129402392962759ULL, 9430855895373029793ULL,
+    15301458362717444832ULL, 5955929443008387835ULL, 1325485959798231593ULL, 2986335531535810556ULL,
+    12574715936534976237ULL, 7845976778827338466ULL, 12063663945437626406ULL,
+    12303389842299564171ULL, 13178453673234487357ULL, 14156474595283737869ULL,
+    2443379652752639374ULL, 15164267217023485860ULL, 10640999740413855171ULL,
+    12489982789527708607ULL, 3882077971489994585ULL, 5024207255298857438ULL, 2895791412628866704ULL,
+    6613614656085435749ULL, 6688515932651562117ULL, 12893264465974446544ULL, 3732610646228078835ULL,
+    17793925419831621079ULL, 9672126993450483333ULL, 3753487710955644520ULL, 3140554122442629783ULL,
+    13143507526652856189ULL, 9266716525849596471ULL, 8848122285993063025ULL,
+    13354306168164282961ULL, 5846783067920525757ULL, 9638512770284381123ULL,
+    13734227790171901595ULL, 15540226088896792901ULL, 1689218082231144883ULL,
+    10826478310029310292ULL, 6349070166764145101ULL, 10592519950700208042ULL,
+    10149476497201973880ULL, 4867505240576164235ULL, 17997117481826107684ULL,
+    1820165319603070642ULL, 7532686307431311458ULL, 9524241337533082674ULL, 17843003920287296064ULL,
+    5051136776082582982ULL, 2326188111383575445ULL, 11531265898714899040ULL, 6116991112068734732ULL,
+    15822608539247876970ULL, 3384715477965325437ULL, 3237788379836597102ULL,
+    17286035437394606231ULL, 10892728746502857234ULL, 3633371241936667315ULL,
+    7734630157104513338ULL, 6715501703883900447ULL, 14671526900374334590ULL,
+    10519331629641430235ULL, 7781427807342819972ULL, 5757826596755353832ULL,
+    12664929793152047077ULL, 12771638081897492890ULL, 13696878516402661211ULL,
+    15876680964240534552ULL, 8705804111985816134ULL, 15063167182621496228ULL,
+    5270929964406331205ULL, 15475633272732921249ULL, 7930518537974316211ULL, 1416080167419788571ULL,
+    4376733359637038481ULL, 10516862302705191919ULL, 17255848515665832920ULL,
+    6208617080979623457ULL, 17554778313028400044ULL, 14012874984641706481ULL,
+    16130396028383956070ULL, 5307652764692084817ULL, 11360150363367344341ULL,
+    17036738974175741960ULL, 14192637783161275889ULL, 10535237277058846165ULL,
+    17626493799779630576ULL, 10209481062706000968ULL, 6655661063512978643ULL,
+    9533942363831949219ULL, 4792034265401052592ULL, 2285968157490662728ULL, 16845987932609991553ULL,
+    13996911195592879045ULL, 5667305977529367714ULL, 14053745956560181582ULL,
+    4213090992409246460ULL, 4414494171361557512ULL, 12241431498375830788ULL, 8624037559859002083ULL,
+    10401710487592411612ULL, 6445163432325940171ULL, 4679016912940125868ULL,
+    11648421082087771272ULL, 12719491703881493219ULL, 3913588028716348043ULL, 470118979117663486ULL,
+    12151197548781073861ULL, 3310823651304317775ULL, 7067083226573732755ULL, 6602282186778668294ULL,
+    10816323508306888363ULL, 13469970179649425766ULL, 9776484814351787605ULL,
+    18385246757150073569ULL, 803721511126385616ULL, 15846889481537145632ULL, 20584726371367270ULL,
+    3995664077244349977ULL, 11295632766367851417ULL, 3381266957004335320ULL, 6377048847764708926ULL,
+    10322923992654247934ULL, 7202016796313879173ULL, 18060460372024934480ULL,
+    14723063478691054250ULL, 16782933372264847249ULL, 2838750229710483411ULL, 781285902030529194ULL,
+    8804057634217469553ULL, 10915080821339123256ULL, 146126113342285303ULL, 7395788725910681904ULL,
+    15530428192065399351ULL, 12412107699908344306ULL, 12262769944061769261ULL,
+    15811225902016386799ULL, 16333172487714519414ULL, 17167358140486043118ULL,
+    11520269152188971806ULL, 10495774513108059196ULL, 10647017729364606027ULL,
+    14972694022005537410ULL, 9435341540485706229ULL, 1531976559109708173ULL, 2832878932386275379ULL,
+    280929502311452431ULL, 7495293752322957249ULL, 2488187569050427270ULL, 7964509431616093287ULL,
+    15168355456542396717ULL, 13450173269898392378ULL, 4983258230716702592ULL,
+    4276368825923844196ULL, 13224605975108668746ULL, 3006155683146084280ULL, 9794265875866852011ULL,
+    17213305849582979959ULL, 10598560064704723937ULL, 3302513802910469984ULL,
+    6508151015921682459ULL, 133936917818220410ULL, 1092472690302229360ULL, 13522243527258380644ULL,
+    6495256797315648088ULL, 8738521672090193811ULL, 7978921292356849405ULL, 17304323641131594021ULL,
+    5500553549373745415ULL, 8005902453275088686ULL, 8437253893076094359ULL, 13665936363807760355ULL,
+    3640330639206141285ULL, 18052231446302723703ULL, 521189940666589143ULL, 16652981048569525043ULL,
+    17609460452490254160ULL, 11084644704734345244ULL, 1196395652883791297ULL,
+    12595750015151281563ULL, 15589044740882410659ULL, 12064153395407544972ULL,
+    4242762347574081267ULL, 6615943983161986263ULL, 10112636926969405940ULL,
+    10313425894326715590ULL, 8387324827532225658ULL, 2340358165407623875ULL, 5011678286116985856ULL,
+    564878875016234123ULL, 9678716673449243931ULL, 16455933177853530972ULL, 821333581906771879ULL,
+    677199751257940196ULL, 6044794043210461019ULL, 7231179736550036911ULL, 14441334487791591081ULL,
+    15486241260411801670ULL, 4391298035355387941ULL, 2797522262629077785ULL,
+    15028781824143583352ULL, 13748908466368327128ULL, 8919466798160047582ULL, 406576191954184569ULL,
+    12125147378058301305ULL, 595792440979927449ULL, 4837108640422497412ULL, 2470472839721652770ULL,
+    9212131612471982692ULL, 4041332130347970509ULL, 5670490502117123750ULL, 5480354992899070989ULL,
+    11911299213413022412ULL, 15279469759557756960ULL, 9733010246763828122ULL,
+    4914472184714291507ULL, 13759138802226468378ULL, 18281765420482048647ULL,
+    15085433448943617246ULL, 5820911004359556761ULL, 4524864646975171951ULL, 1026744685920394186ULL,
+    4958015323693653905ULL, 459155426689421017ULL, 7651912493710922635ULL, 15742312209944831533ULL,
+    11200285143921916207ULL, 5348313695780998326ULL, 16731806292411125569ULL,
+    1712572641824080759ULL, 12984268975870226663ULL, 10358409232739892437ULL,
+    14955767425579341946ULL, 3525019937053720654ULL, 16812536841285618518ULL, 206029137416012111ULL,
+    5757689865078954533ULL, 18274662817817370148ULL, 7604997591908505386ULL,
+    11343692792617822443ULL, 7735868285114000637ULL, 16504368401495605727ULL,
+    16441885547735696774ULL, 947215275638586407ULL, 5336610606115821064ULL, 6308104210698387977ULL,
+    9330553103268844543ULL, 14433618750811444647ULL, 15412440656958915894ULL,
+    4151150257434360951ULL, 8216652698022806244ULL, 5671296745843633492ULL, 9716506605907053477ULL,
+    8269043537336755812ULL, 10788030996528009639ULL, 4903778061240205752ULL,
+    17865714318274034950ULL, 5230779182512103943ULL, 5082070927734973027ULL,
+    12060577329378481488ULL, 7517452483275794016ULL, 13407515146984818331ULL,
+    11848486619773893280ULL, 11916002949831285226ULL, 6722980773172991170ULL,
+    5367462307651156735ULL, 8847597177091048150ULL, 9478804687950869509ULL, 4979744665373115677ULL,
+    11464012037147895994ULL, 15609504474841711882ULL, 4635102061765058616ULL,
+    17208074287738065685ULL, 9989711468569105138ULL, 8754168191820012698ULL, 4509868271915154306ULL,
+    9573419178549972907ULL, 4543078008532735457ULL, 11095178498692101354ULL,
+    14337856751138515804ULL, 7854536439597953292ULL, 13638749999870606432ULL,
+    11386736853889562264ULL, 10909217836194751503ULL, 16081131100055911387ULL,
+    13822264479538884537ULL, 4865227457215303505ULL, 14076767183656227657ULL,
+    18396111965129819904ULL, 9102980462821647360ULL, 18022991330049312783ULL,
+    11777531888940469606ULL, 13674583538423116598ULL, 8456364749530966349ULL,
+    1216543070696955649ULL, 3920778293241032271ULL, 13831120819682679674ULL, 3339706758939177322ULL,
+    4338645483702374548ULL, 8885128653905969095ULL, 3251806890432650498ULL, 18376826561537376024ULL,
+    875072296032561722ULL, 12776283052085884626ULL, 3031092654842693365ULL, 5180615435303779168ULL,
+    17661406494895189374ULL, 5017359913071156189ULL, 5759686682515704611ULL,
+    13834776978303777807ULL, 4417681348418965323ULL, 17466519705308130995ULL,
+    5354459985138373324ULL, 18217987199328078286ULL, 1160883235806106869ULL, 1445810343490283522ULL,
+    11691939342636941658ULL, 14797474673117276535ULL, 1533715040004943521ULL,
+    1502217553971772332ULL, 3528353250096253102ULL, 7856061493168380613ULL, 13188862591200967795ULL,
+    12489651171093705946ULL, 16355272009672364319ULL, 5471229232165241776ULL,
+    2252500628301157512ULL, 15212391887392917267ULL, 11362116312478106889ULL,
+    3856401000053013772ULL, 4631117394360475388ULL, 13811285981912560425ULL, 1323786595300226803ULL,
+    12819255420986717984ULL, 16898814720402928605ULL, 11096876873289513407ULL,
+    13062238422009799090ULL, 15785157825777116542ULL, 4189869843870578758ULL,
+    9454773147152863288ULL, 14944050006866522843ULL, 197673719884190275ULL, 8357151391294825843ULL,
+    18213634074104431996ULL, 1832650110794354761ULL, 17268406221893748723ULL, 335140259830592563ULL,
+    7474956778381261183ULL, 11183109887673407741ULL, 18141820256662699463ULL,
+    9615125678995937814ULL, 93208439446214737ULL, 18041606976912091675ULL, 2232760912850171608ULL,
+    15900580296430875061ULL, 10069057703362290062ULL, 12548501701514083177ULL,
+    2909536321968849439ULL, 6702012153989638886ULL, 11845579514002117813ULL,
+    15585017776261916986ULL, 16731141637243159224ULL, 3425691752749404061ULL,
+    16764192659875680332ULL, 15450262939245632572ULL, 7583004073579415338ULL,
+    12495553090152443460ULL, 18325335669438193878ULL, 12638422638416424717ULL,
+    8569897850885061167ULL, 4366619665057506629ULL, 17200768623970838430ULL, 9554074500253639082ULL,
+    14611251987042409945ULL, 14475749218565491870ULL, 18288719305209541863ULL,
+    12330524035267758302ULL, 10080527208881185923ULL, 14421617899276024929ULL,
+    1198594281406203571ULL, 7158260771949166504ULL, 2576359193271691197ULL, 5435666907919606797ULL,
+    6763603815423591346ULL, 6710732389568982901ULL, 2156427215611956068ULL, 13337376637954309964ULL,
+    12225524012897684470ULL, 9735226290864649270ULL, 3071266852874631093ULL,
+    17592821225536611526ULL, 6109780823869205659ULL, 12615300270902499894ULL,
+    3073926236530589624ULL, 14763238799588077440ULL, 9889300131608757781ULL, 4899405138510480997ULL,
+    6844345789537388777ULL, 672471116330129321ULL, 3358061083465380403ULL, 12209661611715716698ULL,
+    10007019222586914571ULL, 3317946307963679958ULL, 2178297824888622518ULL,
+    10657450355157378359ULL, 14447879404096995827ULL, 15615505250436873790ULL,
+    13490441329923150988ULL, 15937997482118316185ULL, 2198735483498428459ULL,
+    6199745940362057346ULL, 6211376346242972130ULL, 8497073676681014066ULL, 3777993882887927181ULL,
+    9422993589249442857ULL, 13757416155602449340ULL, 12262768563391791182ULL,
+    9982048303039770607ULL, 1839114067648385040ULL, 5543227118964844317ULL, 7497079088396868024ULL,
+    12498189377877568976ULL, 1937614732285904995ULL, 2409741735774366075ULL, 8870900752539334714ULL,
+    14990087962202649368ULL, 2372432359158336007ULL, 17359262889305061731ULL,
+    6503613780865300997ULL, 2847023807095749603ULL, 1669595931375098857ULL, 6519539312166702166ULL,
+    13569372210010474926ULL, 16793499352574752690ULL, 13456676845244371965ULL,
+    10396487617156124477ULL, 13909945101127617557ULL, 14517532322374898095ULL,
+    6602548284738817710ULL, 6976912518989035791ULL, 17482843477949989736ULL, 2589169661690434299ULL,
+    13686575058644964338ULL, 10247719518329941640ULL, 17499247244351751607ULL,
+    9121164961967926722ULL, 15630035212483042645ULL, 7944715092286367971ULL, 994924569504735545ULL,
+    9292790647509267257ULL, 5028762192807074186ULL, 457120150256379699ULL, 11293526209455135835ULL,
+    14749109433208844383ULL, 16801183436854592170ULL, 2271039491949069820ULL,
+    3445233299441613092ULL, 182806057925225915ULL, 9428234867606921397ULL, 6995423550368921581ULL,
+    17154511684746192303ULL, 13817069120994116501ULL, 3525181455171554534ULL,
+    15085220690726818238ULL, 3075816399723668731ULL, 6549598178808482343ULL, 9776673536833144201ULL,
+    8763167412562865260ULL, 13414123660823516319ULL, 13051086718917996796ULL,
+    9641069503503770271ULL, 2476034133801601946ULL, 4113116896789220615ULL, 15303949062896096039ULL,
+    6171645437802697189ULL, 16198888246140753671ULL, 11645852630811555943ULL,
+    9316562808060035021ULL, 12853654726626794105ULL, 9431568539880590559ULL,
+    16862200389007061447ULL, 11378845692922059726ULL, 71838666322453137ULL, 8238353982787574285ULL,
+    2578644646544917083ULL, 13088062494819450912ULL, 17030259457969252698ULL,
+    10752726096568585519ULL, 2240075496630637864ULL, 10713383080397791401ULL,
+    4276938314839548053ULL, 9432019359605225054ULL, 11589824367252032511ULL, 859760438119183699ULL,
+    944795324946504103ULL, 7914973041170881858ULL, 6072773202647998540ULL, 14091194474562152851ULL,
+    6851375437260114510ULL, 15294565427617940418ULL, 11197724717258359581ULL,
+    17042694658330921710ULL, 11843979312201576714ULL, 9973047754785273924ULL,
+    14864210739776210243ULL, 11558106979667314946ULL, 16414040511266360234ULL,
+    12111195789737833904ULL, 6358851479465069140ULL, 2422379040207581321ULL, 6540242141547080350ULL,
+    12753485232666421621ULL, 11277863219641390748ULL, 10382262419010628590ULL,
+    9926662560965346442ULL, 17772629054779728206ULL, 12196327613183728749ULL,
+    6935936542312833431ULL, 3763169597320876103ULL, 18056768783155709639ULL, 331129510945217359ULL,
+    15742457952702400387ULL, 4039358495295116792ULL, 6216866646790441459ULL,
+    12233749989887510895ULL, 3858668157493461493ULL, 5455802737200447320ULL,
+    10927285221433958579ULL, 1669956245530979502ULL, 5891247975260831908ULL,
+    14828201803124467753ULL, 12322620490756036460ULL, 7465200677054323468ULL,
+    17509817953494540538ULL, 11989478086481055500ULL, 14418392871188033024ULL,
+    11317270868691628862ULL, 9483483315019774959ULL, 15783760858105891080ULL,
+    17319659162388527202ULL, 13486746701684235497ULL, 5398384619858330597ULL,
+    2514094506304741344ULL, 16539827815330634753ULL, 11458602986360485735ULL,
+    10352459159555196139ULL, 1069530011032072528ULL, 14266243146062948569ULL,
+    15678228120585556469ULL, 15975700161105716679ULL, 7580674024264618445ULL,
+    11025102629945679610ULL, 2125071152304306654ULL, 17308077776794298687ULL,
+    10655746489576409460ULL, 16271781704900571846ULL, 733315094127148436ULL, 9393376210409769509ULL,
+    9462192763562922614ULL, 7709859033051298777ULL, 7729681141065772757ULL, 14172077030398269548ULL,
+    5175996441312166005ULL, 3466751271027504093ULL, 15005405000915576446ULL, 3634618561104943141ULL,
+    12617369144801251194ULL, 17106236352163403144ULL, 8632575316332204448ULL,
+    9110673551726234861ULL, 1734096451602342165ULL, 3587612022735029692ULL, 15865829504023533769ULL,
+    7961359913018098666ULL, 11912843234755259954ULL, 17699064859133559715ULL,
+    4191931486822078262ULL, 12705455481092395840ULL, 14682467896646550748ULL,
+    11332179783300820129ULL, 10325338140018108278ULL, 9916435175429008216ULL,
+    16238353864673148255ULL, 10878350687440930748ULL, 18377665319168299914ULL,
+    13037268147129934549ULL, 17648241686632219637ULL, 10042859684041268375ULL,
+    17985990450398609157ULL, 4988629001750557849ULL, 5708866579861495750ULL, 5163050909318210985ULL,
+    17315177421409536312ULL, 13421939328662914516ULL, 17917654851838220517ULL,
+    8079021297561583271ULL, 4784614975153103593ULL, 4177318047493263691ULL, 16628396344092195538ULL,
+    8384224642181575090ULL, 2555363252429103088ULL, 15224289691447215044ULL, 7028938791043483513ULL,
+    3137096692393028295ULL, 15127800787449515580ULL, 13587330312324940098ULL,
+    2043163109279600254ULL, 14876129575413077836ULL, 14301936548443998735ULL,
+    6412595831176606752ULL, 11812011746362482953ULL, 5954132506436037846ULL, 115745460288117102ULL,
+    13217989596118963406ULL, 4759840064389456921ULL, 10051937984682116103ULL,
+    9150080985156454667ULL, 14056801298765852532ULL, 6905895024990947161ULL,
+    17298453984441748998ULL, 18151026050341245520ULL, 7623476519233756404ULL,
+    13759630521550263296ULL, 6031120750443530584ULL, 624006705570133439ULL, 10016137398228770373ULL,
+    6139507873103198305ULL, 6914064601657047311ULL, 2353647078771570722ULL, 10343062693740821984ULL,
+    7899592821254233340ULL, 7772343500416193711ULL, 8691737309596024947ULL, 5127018298247371208ULL,
+    6011161858874636694ULL, 7491171640129205633ULL, 4100618769369165862ULL, 10465350592278346029ULL,
+    11686959767895692735ULL, 8038531707057009526ULL, 14048896064591229789ULL,
+    10420718411433174641ULL, 10546474688266967883ULL, 91177415826461166ULL, 8845357752454618896ULL,
+    5199697347965587121ULL, 1940346470197221651ULL, 10071286972043373924ULL,
+    15017575949214817940ULL, 1885715434170516237ULL, 10006359977145713789ULL,
+    16139324533102864768ULL, 10418191741664271224ULL, 17152255378734503086ULL,
+    4356460645377826298ULL, 4346623539062873988ULL, 7538493318336561961ULL, 9635373257170941923ULL,
+    3490726214791483538ULL, 13464237140168310177ULL, 18378037138679909392ULL,
+    15175137724334299627ULL, 2377443179843434946ULL, 5432303917038357517ULL, 1296593342701169560ULL,
+    10933659699161254312ULL, 11003890243975417411ULL, 1469504736230090592ULL,
+    7373178895066276164ULL, 1188735598010808111ULL, 11917769126480317403ULL,
+    13602702035413995176ULL, 7395125364794962502ULL, 8813571612706217414ULL,
+    10295874593347350068ULL, 11891215732256567227ULL, 17601085815347721701ULL,
+    1898356676545654509ULL, 8274895468243592631ULL, 193313239353770496ULL, 8861098757574910143ULL,
+    12027556857574252192ULL, 7331545507511590498ULL, 1618345684778559397ULL, 1466630188254296872ULL,
+    340008347109987402ULL, 477641453416293613ULL, 15419718066102597555ULL, 15459362282131545514ULL,
+    9897409987086987480ULL, 10351992882624332011ULL, 6933502542055008186ULL,
+    11564065928121601276ULL, 7269237122209886283ULL, 6787994215892950772ULL,
+    15765728630617254673ULL, 17265150632664408897ULL, 18221347103452469722ULL,
+    3468192903204684330ULL, 7175224045470059384ULL, 13284914934337515922ULL,
+    15922719826036197333ULL, 5378942395800968292ULL, 16951385644557567815ULL,
+    8383862973644156525ULL, 6964166888475240064ULL, 10918191719583549881ULL, 4217615492892088643ULL,
+    2203932206326664941ULL, 1386126277148464817ULL, 14029963655636744895ULL, 3309957301172309881ULL,
+    18308586564627048213ULL, 7627792220550317483ULL, 16849739299554887659ULL,
+    1638975294372985135ULL, 17525236827087666699ULL, 9977258003501115699ULL,
+    11417733159722991500ULL, 10326101818636421970ULL, 16183610769109521008ULL,
+    8397134583616277417ULL, 17388565629966889419ULL, 16158042595123166543ULL,
+    9569229950306207186ULL, 8354636094986527382ULL, 14810048614474839460ULL,
+    16768449284363150181ULL, 5110726504858206176ULL, 12001835309184878472ULL,
+    14057877582086967027ULL, 6274193384786056590ULL, 11808857501189479544ULL,
+    8727916550940328581ULL, 4086326218559200509ULL, 11305515077116604056ULL,
+    10157129023178445855ULL, 12825191662353213505ULL, 5177279419015414290ULL,
+    11908265012872075693ULL, 231490920576234204ULL, 7989235118528375196ULL, 9519680128778913843ULL,
+    1657131895654680590ULL, 18300161970312909335ULL, 9666858523822153448ULL,
+    13811790049981894323ULL, 16150163895173946380ULL, 17855308026972939425ULL,
+    15246953038467512809ULL, 9072516969390974976ULL, 12062241500887061169ULL,
+    1248013411140266878ULL, 1585530722747989130ULL, 12279015746206396611ULL,
+    13828129203314094622ULL, 4707294157543141444ULL, 2239381313772092352ULL,
+    15799185642508466681ULL, 15544687000832387422ULL, 17383474619192049894ULL,
+    10254036596494742416ULL, 12022323717749273388ULL, 14982343280258411266ULL,
+    8201237538738331724ULL, 2483957110847140442ULL, 4927175462081833855ULL, 16077063414114019053ULL,
+    9651048055472907962ULL, 2394692749156797667ULL, 2646205302824384151ULL, 182354831652922333ULL,
+    17690715504909237792ULL, 10399394695931174242ULL, 3880692940394443302ULL,
+    1695829870377196232ULL, 11588407824720084265ULL, 3771430868341032475ULL, 1565975880581875962ULL,
+    13831904992496177921ULL, 2389639409618990833ULL, 15857766683759454557ULL,
+    8712921290755652597ULL, 8693247078125747976ULL, 15076986636673123922ULL, 824002440632332230ULL,
+    6981452429582967077ULL, 8481730206627068738ULL, 18309330203650267169ULL,
+    11903531374959047639ULL, 4754886359686869893ULL, 10864607834076715034ULL,
+    2593186685402339120ULL, 3420575324612957008ULL, 3561036414241283207ULL, 2939009472460181185ULL,
+    14746357790132552328ULL, 2377471196021616222ULL, 5388794179251083190ULL, 8758659997118438737ULL,
+    14790250729589925005ULL, 17627143225412434828ULL, 2145005112985148520ULL,
+    5335687390803582839ULL, 16755427556985891787ULL, 3796713353091309019ULL,
+    16549790936487185262ULL, 386626478707540992ULL, 17722197515149820286ULL, 5608369641438952768ULL,
+    14663091015023180997ULL, 3236691369557118794ULL, 17046334508460641443ULL,
+    3202185494488465395ULL, 14318930143149526808ULL, 12326724080240113166ULL,
+    12827236151466750750ULL, 3484142512916263960ULL, 3950920893548038356ULL,
+    14988804836052972181ULL, 8851583993743549839ULL, 14308242844359371570ULL, 777369847919574354ULL,
+    15557510965148963465ULL, 9722020382275371109ULL, 17594715206339139549ULL,
+    5277854296596846422ULL, 11082259419882997318ULL, 11385503396047318140ULL,
+    10240984892067160251ULL, 10530748960710409570ULL, 7568157716981360821ULL,
+    12592878489255441043ULL, 10186053846099545791ULL, 6637938909581060058ULL, 111149496074670202ULL,
+    16662643651981502748ULL, 8227775024868032178ULL, 6373929289276046932ULL,
+    10444931971787760845ULL, 6201898463322213135ULL, 629320351208180689ULL, 5515520699364121583ULL,
+    5341005163698833920ULL, 3660603215736176636ULL, 259708515028786631ULL, 17566992178137674842ULL,
+    3372067042379005905ULL, 5096694940076975729ULL, 3736130024162144390ULL, 16875243786698898132ULL,
+    14939008256980873450ULL, 13852611772074309361ULL, 6073494095029119512ULL,
+    9360902011237968335ULL, 14623774926487346098ULL, 2766472610174471236ULL,
+    13731902725826287276ULL, 1504455239830065928ULL, 5278712545623073671ULL, 736332113646891465ULL,
+    17618695867924037619ULL, 11309310284991950713ULL, 4886057558076779571ULL,
+    10763848753953943892ULL, 2505363331546815424ULL, 11352907657323264911ULL,
+    8072988901970953061ULL, 3469914767514405597ULL, 9971565669534866491ULL, 5152095914696790604ULL,
+    10208870723312444132ULL, 16854567857594838599ULL, 6899184895865674428ULL,
+    16965979982310085453ULL, 15732959544372609414ULL, 10281623434068479707ULL,
+    17443737006951238578ULL, 15199445470795177861ULL, 13602449903751240781ULL,
+    5786080300865843824ULL, 9510698464211620197ULL, 9565601609523399347ULL, 1085876727883010849ULL,
+    14173558047652573781ULL, 3915924651239334423ULL, 16826232100452247623ULL,
+    14449290750836800195ULL, 5788850380249567267ULL, 5070977906712828891ULL,
+    10558622809282185657ULL, 11234463366259167196ULL, 16581457517622949343ULL,
+    3077681059937543474ULL, 8800502287627707889ULL, 14794874758849359787ULL, 2910359529580811465ULL,
+    7812800131725881593ULL, 10681466193308838225ULL, 553191551208641334ULL, 16812747745461172587ULL,
+    8822472175890691894ULL, 8092090683172364700ULL, 7089511939984386169ULL, 14716744031541986610ULL,
+    14985665964527744639ULL, 12371039213091171847ULL, 3189748970585343185ULL,
+    15232186353483634399ULL, 3681591734391935979ULL, 18104374066076603292ULL,
+    13284815006551517101ULL, 3227916245737933534ULL, 8720412417008017644ULL,
+    13138694981349120082ULL, 320133058368354762ULL, 8304218334854916887ULL, 16243156957559369612ULL,
+    7371736365710742795ULL, 10491955556511887853ULL, 7976347901737090561ULL,
+    16698519034528608092ULL, 13558176603259174219ULL, 6350150604385284171ULL,
+    13527944843073879482ULL, 7060486289640662410ULL, 16831694251196868747ULL,
+    9013616053203561453ULL, 5311513619942461771ULL, 13714801418146856836ULL, 602808567013548351ULL,
+    16748772432487760717ULL, 4298883229575185793ULL, 7832398172717906720ULL,
+    15886580929081241107ULL, 7567176380784935408ULL, 6355867489427203888ULL,
+    11193540552356342936ULL, 3436700250657032120ULL, 1513211213344495890ULL,
+    15645924943211731270ULL, 6404370988976930791ULL, 10191116212589502000ULL,
+    6206704086770674717ULL, 7207728229223949885ULL, 6968285025832527921ULL, 7901841787096076712ULL,
+    11530865598396392746ULL, 17703167987487099679ULL, 10169741615009191524ULL,
+    1554739695839148709ULL, 12668277856588375314ULL, 997296690841190603ULL, 16742686338968727483ULL,
+    10555708593193692845ULL, 3717774766056443020ULL, 4324262718385084665ULL, 2035225710424768887ULL,
+    2614753847711267525ULL, 15136315433962721643ULL, 6739012904801330470ULL, 1925363618489539967ULL,
+    13275877819162120117ULL, 222298992149340404ULL, 14878543230253453880ULL,
+    16455550049736064357ULL, 12747858578552093864ULL, 2443119869865970074ULL,
+    12403796926644426271ULL, 1258640702416361378ULL, 11031041398728243166ULL,
+    10682010327397667840ULL, 7321206431472353272ULL, 519417030057573262ULL, 16687240282565798068ULL,
+    6744134084758011811ULL, 10193389880153951458ULL, 7472260048324288780ULL,
+    15303743499688244648ULL, 11431272440252195285ULL, 9258479470439067107ULL,
+    12146988190058239025ULL, 275059948766385054ULL, 10800805779265140581ULL, 5532945220348942473ULL,
+    9017061377943022936ULL, 3008910479660131857ULL, 10557425091246147342ULL, 1472664227293782930ULL,
+    16790647662138523622ULL, 4171876496274349811ULL, 9772115116153559143ULL, 3080953434198336168ULL,
+    5010726663093630849ULL, 4259071240936978206ULL, 16145977803941906123ULL, 6939829535028811194ULL,
+    1496387265360181366ULL, 10304191829393581209ULL, 1970997372915336648ULL,
+    15262391641480125583ULL, 13798369791731348857ULL, 15485215890910619290ULL,
+    13019175015035667213ULL, 2116502794427407799ULL, 16440729940192925541ULL,
+    11952146867880804107ULL, 8758155733792929947ULL, 11572160601731687649ULL, 574652854713688778ULL,
+    684459145337247079ULL, 2171753455766021699ULL, 9900372021595595946ULL, 7831849302478668847ULL,
+    15205720127194943630ULL, 10451837427964048775ULL, 11577700760499134535ULL,
+    10141955813425657782ULL, 2670501544854819698ULL, 4022182658808782777ULL,
+    14716170961536347071ULL, 6155362119875086949ULL, 17601004575255415778ULL,
+    11143005443989167958ULL, 5820719059161622931ULL, 15625600263451763186ULL,
+    2916188312908124834ULL, 1106383102417282669ULL, 15178751417212793558ULL,
+    17644944351781383789ULL, 16184181366344729400ULL, 14179023879968772338ULL,
+    10986743989374421604ULL, 11524587855345937663ULL, 6295334352472792079ULL,
+    6379497941170686371ULL, 12017628633257717182ULL, 7363183468783871959ULL,
+    17762004058443654968ULL, 8122885939393482587ULL, 6455832491475867069ULL,
+    17440824834016035288ULL, 7830645888988688548ULL, 640266116736709525ULL, 16608436669709833774ULL,
+    14039569841409187608ULL, 14743472731421485591ULL, 2537167039314224090ULL,
+    15952695803474181123ULL, 14950293995347664568ULL, 8669609132808796823ULL,
+    12700301208770568343ULL, 8609145612438207348ULL, 14120972579281324821ULL,
+    15216644428684185878ULL, 18027232106407122907ULL, 10623027239884923542ULL,
+    8982858762584162056ULL, 1205617134027096703ULL, 15050800791265969818ULL, 8597766459150371587ULL,
+    15664796345435813440ULL, 13326417784452930598ULL, 15134352761569870817ULL,
+    12711734978854407776ULL, 3940337031003134256ULL, 6873400501314064241ULL, 3026422426688991780ULL,
+    11602356497355618734ULL, 17509478409041549654ULL, 3295611402667168832ULL,
+    14495967406755657903ULL, 9803169084140145966ULL, 18334296930671688445ULL,
+    1973351323681585141ULL, 15927092238918339744ULL, 1663696758388346629ULL, 6478190760083997930ULL,
+    15718478812731647879ULL, 6137824446451306501ULL, 14563425695670967764ULL,
+    2505885778459082379ULL, 11670738201281408379ULL, 6592745841075776374ULL,
+    11481601008959196049ULL, 5920891147782712338ULL, 12105154837589520930ULL,
+    12601814080997185413ULL, 13675082474753063510ULL, 18023409646282827268ULL,
+    14968939986099974328ULL, 2449823816005769523ULL, 15866628696465712970ULL,
+    9396928887221117800ULL, 10684554225073980566ULL, 6629286393234346901ULL,
+    18376327363738011048ULL, 15670767633358404512ULL, 14725647751382182780ULL,
+    8363313175454136390ULL, 12631529790181832607ULL, 17335440098886909019ULL,
+    14436032324180039310ULL, 7108550055394851130ULL, 3341559799317669202ULL, 2196680102450416998ULL,
+    18074008925931671368ULL, 17139082835164184775ULL, 3192225532268068507ULL,
+    9147214608122147723ULL, 1668451105707350442ULL, 14752998335721594544ULL, 1480062942387772363ULL,
+    12497602923902612455ULL, 11727821532092566053ULL, 6777258148162421873ULL,
+    17677628499213728444ULL, 4971300116331144527ULL, 17114601791174253772ULL,
+    1564210893026558281ULL, 11260971689808297346ULL, 14454460609992262776ULL,
+    14568961396079516816ULL, 13832589679048515773ULL, 7730617434844590160ULL,
+    12669189024723424791ULL, 14915755287244526467ULL, 10819392730936876088ULL,
+    10014907757087902595ULL, 1507935889881893257ULL, 838794753720610195ULL, 9874280945558257208ULL,
+    16709476340440327299ULL, 5192174605794920091ULL, 13656149978246612563ULL,
+    11788029601539857035ULL, 4939363948588989890ULL, 6401306889968000237ULL, 1643067921785037781ULL,
+    6859811532800027774ULL, 9968865223073906643ULL, 1899313734105550514ULL, 3948577927591390066ULL,
+    3110281755482067497ULL, 440335533834946084ULL, 16103462562220426472ULL, 15974275040617153692ULL,
+    11635097866987115658ULL, 10990082672485598060ULL, 6880772053468161280ULL,
+    11856689693930691892ULL, 13240034510406341449ULL, 4585245493650136985ULL,
+    15549337040971538806ULL, 1888894382863245271ULL, 3037722456146464671ULL,
+    16222914151505111417ULL, 13412886683319313590ULL, 10614511887785219379ULL,
+    5402849316590967595ULL, 14493918064454826613ULL, 17847674480950701006ULL,
+    2090790409711170429ULL, 6285980735269660765ULL, 10719857486264450631ULL,
+    15283143722720317114ULL, 17934306096542052211ULL, 14001880267603039792ULL,
+    13836217228454770821ULL, 10695914260435128153ULL, 17514859804201238874ULL,
+    1585754857150760889ULL, 14781940846429993843ULL, 4931930889252069809ULL, 5844561563552472099ULL,
+    17489608544232260543ULL, 7718010796716832179ULL, 17370517242741125495ULL,
+    12866080903264610776ULL, 7804081660198784045ULL, 1694530190751966941ULL, 2831746913889871266ULL,
+    4947771386415177039ULL, 7100539676004187793ULL, 7928562158039740245ULL, 10725110911708600714ULL,
+    2303930901906996250ULL, 15517629139005077743ULL, 18388163329669204153ULL,
+    11030868556502213166ULL, 1232585192567466763ULL, 6235277182096385333ULL, 8924704780561883241ULL,
+    7575528574042693072ULL, 6184283960229595514ULL, 14035809229808445869ULL, 4757968921001685853ULL,
+    1112327502104096864ULL, 6510674144644313077ULL, 9958908021506248720ULL, 8666780994895828512ULL,
+    6207374195891468013ULL, 527310576526715117ULL, 13769208195140939970ULL, 5717965252872901594ULL,
+    18251103959644889957ULL, 10757399139654631205ULL, 2766266074984938420ULL,
+    17454030825305626999ULL, 8058454967371545718ULL, 16259540915886015740ULL,
+    2094846439791375729ULL, 17078570576996260390ULL, 9814741985008349944ULL,
+    18326170733942645846ULL, 11697164072627642518ULL, 2841638945108804746ULL,
+    11180742880028608952ULL, 8588916982605087253ULL, 17270953587499610085ULL,
+    10316239583041833135ULL, 4153764669611044815ULL, 15218546556690686663ULL,
+    3551572577341480705ULL, 17473655401961421409ULL, 5364795250826455779ULL,
+    11170551507940784566ULL, 14546222011161625128ULL, 2876509927090300678ULL,
+    4402694403084946957ULL, 17046360736435327561ULL, 7108567054937493683ULL, 2081203228048960571ULL,
+    16266130879574186486ULL, 651463553536226187ULL, 5685042714875956620ULL, 8357218785336159264ULL,
+    12503424421684360075ULL, 14710413006038371086ULL, 14001506730745478657ULL,
+    3407942559976055818ULL, 5762342466913823503ULL, 10510263908617092553ULL,
+    14803490985703075052ULL, 6188145780182645733ULL, 1422266601106476766ULL, 9405862877273874404ULL,
+    12373573447041277648ULL, 3300929814799472789ULL, 17375501013496690446ULL,
+    15855344939329288264ULL, 15765417934160025706ULL, 11389620186915482665ULL,
+    14160623826619049999ULL, 15011001650769476245ULL, 8700352530438102070ULL,
+    9546599531992160698ULL, 17160459733094362698ULL, 17549888390491511935ULL,
+    14098940004679930421ULL, 14108251169641421964ULL, 14524845576259744821ULL,
+    3265989101134842308ULL, 13287104979083759788ULL, 9121399896702680501ULL, 9754012552728030990ULL,
+    1404271950715176814ULL, 13059395318985870722ULL, 12027306162898894702ULL,
+    10065562226166754464ULL, 9236380803962924721ULL, 16509660802749428423ULL,
+    9530577810620137421ULL, 5157233612636244427ULL, 1072610720239066145ULL, 14537458887190106463ULL,
+    14022495280537932253ULL, 11031204760600521487ULL, 935543639859698924ULL, 7259602548922370212ULL,
+    7026889427803698917ULL, 274593922310690834ULL, 5476442124492768674ULL, 17843770014986840223ULL,
+    6724959260755101426ULL, 9172432129492646810ULL, 8253294995527643426ULL, 16642905768599233510ULL,
+    4088365098049870797ULL, 8396466294123519919ULL, 15587949862960406004ULL,
+    17456971927821799041ULL, 5427910611685898546ULL, 2289519950149766552ULL, 3085984550205189869ULL,
+    13768179515999725743ULL, 4923067479009087749ULL, 7269038050957259072ULL, 6328540648180482353ULL,
+    11137534555280313204ULL, 15714181659599554436ULL, 16924664997514240118ULL,
+    10894334786421803733ULL, 3969983226096700517ULL, 13324041571598212467ULL,
+    2933558686086065798ULL, 10669686710201446326ULL, 2058325716590599417ULL,
+    18328403803535692864ULL, 3505890681862218766ULL, 12010394174345761324ULL,
+    3226074856134111658ULL, 2790190175656383861ULL, 11838584376892856353ULL, 1999163679549294948ULL,
+    15768303112433863805ULL, 566908455711125496ULL, 13041058518355005061ULL, 6170614944827741981ULL,
+    229429448880166510ULL, 2232679208349403709ULL, 2478959000474386095ULL, 18279449691718928474ULL,
+    9624874385907340122ULL, 5393460359591848797ULL, 4597939200705197035ULL, 10908920522358266355ULL,
+    2314456025934491730ULL, 4477129585104460610ULL, 10432069720525835807ULL,
+    11742603057022860952ULL, 17080481299080152372ULL, 17316138350061459166ULL,
+    4095840150275990601ULL, 7837028927034559054ULL, 5391772605427371763ULL, 10048355703233716481ULL,
+    13357883660017629789ULL, 8095277794962568018ULL, 16487029766002628036ULL,
+    8667078364145180399ULL, 17750042279246789016ULL, 7699493704133709349ULL,
+    11579517522402010190ULL, 8777403528275572475ULL, 17558354751604533970ULL,
+    11238079936669091769ULL, 4238531533218128438ULL, 15571938384142156842ULL,
+    9241002923311920764ULL, 6913555093225106037ULL, 18188201998636196161ULL,
+    12411457032967695022ULL, 10310365946845164170ULL, 5248593916312707032ULL, 831423803877424464ULL,
+    17806163121439291995ULL, 6846206111072371986ULL, 5109945912226656704ULL, 1995026331342651725ULL,
+    13224564033146117740ULL, 7517102752520659684ULL, 16123789243728586601ULL,
+    2316551785658933134ULL, 11068496328775392761ULL, 9846860373475719525ULL,
+    12981707977772171029ULL, 3043020583803040724ULL, 17206978399995513972ULL,
+    3739420375913428517ULL, 6759332647942638818ULL, 8376677298749564841ULL, 5522562080553834986ULL,
+    7053171851498077252ULL, 1607977155195307586ULL, 8436104199593865195ULL, 1927734066312363130ULL,
+    9233870706662230260ULL, 17491503983710062913ULL, 13319486112687973562ULL,
+    10520717413038095977ULL, 1303281391184654392ULL, 5878893185778909613ULL, 3267768789172137915ULL,
+    8950118742834971699ULL, 7396154550471076593ULL, 94074979715867137ULL, 13604148802870129229ULL,
+    824961229845677942ULL, 16096305683186230361ULL, 14295015677743738742ULL,
+    15296627168363928590ULL, 8873499792859554966ULL, 8939995861626837663ULL, 1451024096042752228ULL,
+    12606256378233579450ULL, 14187919780968598709ULL, 3783216003918701466ULL,
+    7664183518848085073ULL, 62460911686431858ULL, 484202304763540024ULL, 5115724719274878613ULL,
+    14319733727752101667ULL, 2838260365664438975ULL, 8869638087614133383ULL, 1973048568271715943ULL,
+    8222034712129092290ULL, 16283114321357154190ULL, 16572573571024236876ULL,
+    2712246332902316406ULL, 1982249424651976666ULL, 3088394988280640547ULL, 15755615587475178905ULL,
+    8579784907573951090ULL, 1065010718143999763ULL, 13419779264007361760ULL, 3719791119406543608ULL,
+    16093099562285622141ULL, 14952958554683967268ULL, 4764697082274379844ULL,
+    5535192007835845678ULL, 7291815854915011638ULL, 5640687007885287953ULL, 13156450830336237738ULL,
+    12482616972578686666ULL, 13539531201749295439ULL, 11655129322506852506ULL,
+    8701299429067331384ULL, 9979312483017205356ULL, 13188002420228194471ULL,
+    15140916158657515472ULL, 13421623296852423045ULL, 495107864683150348ULL, 7654320224819190603ULL,
+    12148837453269567395ULL, 15998773160212196843ULL, 588837785725072295ULL, 8403974212199521322ULL,
+    17169840733544643475ULL, 12462834280710618329ULL, 2451408417273148637ULL,
+    7006976798238910152ULL, 1526320542923956684ULL, 14048187064736480425ULL,
+    12466838243781633128ULL, 8591620316892179268ULL, 15043591315586720692ULL,
+    3204792457083708344ULL, 9471134949251363144ULL, 15256377987962879721ULL,
+    14900547952130300654ULL, 5219448813282198556ULL, 10786920719183697594ULL,
+    9195878401410394070ULL, 3371096971006981094ULL, 4628912051868983461ULL, 8954259170208921220ULL,
+    2417395367342119998ULL, 5038462040336170289ULL, 15714218524450753129ULL,
+    16185532626413366717ULL, 8191680300551981203ULL, 15674057854069118108ULL,
+    10783545210854743526ULL, 1649967332757881346ULL, 8269023246325707963ULL,
+    16190555589925136037ULL, 14527315458295704456ULL, 17334156728290360799ULL,
+    17053340484784026416ULL, 15398987408267418699ULL, 4712290971094468764ULL,
+    17554807056551144951ULL, 16669965429499516324ULL, 4029415799628631923ULL,
+    8477063066436256877ULL, 12697132694574762068ULL, 35261772914289913ULL, 13827110186450212075ULL,
+    17929659923562840706ULL, 6376169992225838429ULL, 2173987819980776725ULL,
+    10497187832625414065ULL, 1662847607754848928ULL, 17165582169169032374ULL,
+    13692412222144743973ULL, 10219891824453313408ULL, 3990052662685303450ULL,
+    8002383992582683864ULL, 15034205505041319369ULL, 13800834413747621586ULL,
+    4633103571317866269ULL, 3690248583841233906ULL, 1246976673241887435ULL, 7516671881834790443ULL,
+    6086041167606081449ULL, 15967212726281476328ULL, 7478840751826857035ULL,
+    13518665295885277636ULL, 16753354597499129682ULL, 11045124161107669972ULL,
+    14106343702996154504ULL, 3215954310390615172ULL, 16872208399187730390ULL,
+    3855468132624726260ULL, 20997339614908904ULL, 16536263893710574211ULL, 8192228151666395509ULL,
+    2594690752366640339ULL, 2606562782369308785ULL, 11757786371557819226ULL, 6535537578344275830ULL,
+    17900237485669943398ULL, 14792309100942153186ULL, 188149959431734274ULL, 8761553532030706842ULL,
+    1649922459691355885ULL, 13745867292662909106ULL, 10143287281777925869ULL,
+    12146510263018305565ULL, 17746999585719109933ULL, 17879991723253675326ULL,
+    2902048192085504456ULL, 6765768682757607284ULL, 9929095488227645803ULL, 7566432007837402933ULL,
+    15328367037696170146ULL, 124921823372863716ULL, 968404609527080048ULL, 10231449438549757226ULL,
+    10192723381794651718ULL, 5676520731328877951ULL, 17739276175228266766ULL,
+    3946097136543431886ULL, 16444069424258184580ULL, 14119484569004756764ULL,
+    14698403068338922137ULL, 5424492665804632813ULL, 3964498849303953332ULL, 6176789976561281094ULL,
+    13064487101240806194ULL, 17159569815147902181ULL, 2130021436287999526ULL,
+    8392814454305171904ULL, 7439582238813087217ULL, 13739455050861692666ULL,
+    11459173035658382921ULL, 9529394164548759689ULL, 11070384015671691356ULL,
+    14583631709830023276ULL, 11281374015770575906ULL, 7866157586962923860ULL,
+    6518489871447821717ULL, 8632318329789039263ULL, 4863514571304153397ULL, 17402598858134662769ULL,
+    1511880892324859096ULL, 7929260766746837327ULL, 11835088243605479329ULL, 8396502519995294475ULL,
+    990215729366300697ULL, 15308640449638381206ULL, 5850930832829583174ULL, 13550802246714842071ULL,
+    1177675571450144591ULL, 16807948424399042644ULL, 15892937393379735334ULL,
+    6478924487711685043ULL, 4902816834546297275ULL, 14013953596477820304ULL, 3052641085847913368ULL,
+    9649630055763409234ULL, 6486932413853714641ULL, 17183240633784358537ULL,
+    11640438557463889768ULL, 6409584914167416689ULL, 495525824793174672ULL, 12066011902216207827ULL,
+    11354351830551049693ULL, 10438897626564397113ULL
+  };
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_FFDHE_PrecompTable_H_DEFINED
+#endif
@@ -41,6 +41,47 @@ extern "C" {
 #include "Hacl_Krmllib.h"
 #include "Hacl_Hash_SHA3.h"
 
+/* The kernels of the fused matrix generation and multiplication and of the
+   AES-128 matrix generator. The library starts with
+   Hacl_Impl_Frodo_Kernels_portable; EverCrypt_Dispatch_init installs the
+   vectorized ones when the CPU supports them. */
+typedef struct Hacl_Impl_Frodo_Kernels_s
+{
+  void
+  (*shake128_4x)(
+    uint32_t input_len,
+    uint8_t *input0,
+    uint8_t *input1,
+    uint8_t *input2,
+    uint8_t *input3,
+    uint32_t output_len,
+    uint8_t *output0,
+    uint8_t *output1,
+    uint8_t *output2,
+    uint8_t *output3
+  );
+  void (*matrix_mul_rows_s)(uint32_t n, uint16_t *rows, uint16_t *s, uint16_t *res);
+  void
+  (*matrix_mul_add_rows)(uint32_t n, uint16_t *s, uint32_t i, uint16_t *rows, uint16_t *res);
+  void (*aes128_key_expansion)(uint8_t *key, uint8_t *rk);
+  void (*aes128_encrypt_blocks)(uint32_t nblocks, uint8_t *r, uint8_t *rk);
+}
+Hacl_Impl_Frodo_Kernels;
+
+extern const Hacl_Impl_Frodo_Kernels Hacl_Impl_Frodo_Kernels_portable;
+
+/* Replaces the table atomically; running operations keep valid kernels. */
+void Hacl_Impl_Frodo_Kernels_set(const Hacl_Impl_Frodo_Kernels *k);
+
+const Hacl_Impl_Frodo_Kernels *Hacl_Impl_Frodo_Kernels_get(void);
+
+/* AES-NI kernels. The key expansion is only defined when HACL_CAN_COMPILE_VALE is
+   set, and the encryption when HACL_CAN_COMPILE_INLINE_ASM is. */
+
+void Hacl_Impl_Frodo_Aesni_aes128_key_expansion(uint8_t *key, uint8_t *rk);
+
+void Hacl_Impl_Frodo_Aesni_aes128_encrypt_blocks(uint32_t nblocks, uint8_t *r, uint8_t *rk);
+
 static inline void
 Hacl_Keccak_shake128_4x(
   uint32_t input_len,
@@ -55,10 +96,16 @@ Hacl_Keccak_shake128_4x(
   uint8_t *output3
 )
 {
-  Hacl_Hash_SHA3_shake128(output0, output_len, input0, input_len);
-  Hacl_Hash_SHA3_shake128(output1, output_len, input1, input_len);
-  Hacl_Hash_SHA3_shake128(output2, output_len, input2, input_len);
-  Hacl_Hash_SHA3_shake128(output3, output_len, input3, input_len);
+  Hacl_Impl_Frodo_Kernels_get()->shake128_4x(input_len,
+    input0,
+    input1,
+    input2,
+    input3,
+    output_len,
+    output0,
+    output1,
+    output2,
+    output3);
 }
 
 static inline void
@@ -155,6 +202,28 @@ Hacl_Impl_Matrix_matrix_mul_s(
   }
 }
 
+/* res (4 x 8) = rows (4 x n) * s^T, where s holds the 8 columns of S one after
+   the other */
+static inline void
+Hacl_Impl_Matrix_matrix_mul_rows_s(uint32_t n, uint16_t *rows, uint16_t *s, uint16_t *res)
+{
+  Hacl_Impl_Frodo_Kernels_get()->matrix_mul_rows_s(n, rows, s, res);
+}
+
+/* res (8 x n) += s[:, 4i .. 4i + 4) * rows (4 x n), where rows are rows 4i .. 4i + 3
+   of the right-hand side */
+static inline void
+Hacl_Impl_Matrix_matrix_mul_add_rows(
+  uint32_t n,
+  uint16_t *s,
+  uint32_t i,
+  uint16_t *rows,
+  uint16_t *res
+)
+{
+  Hacl_Impl_Frodo_Kernels_get()->matrix_mul_add_rows(n, s, i, rows, res);
+}
+
 static inline uint16_t
 Hacl_Impl_Matrix_matrix_eq(uint32_t n1, uint32_t n2, uint16_t *a, uint16_t *b)
 {
@@ -189,73 +258,127 @@ Hacl_Impl_Matrix_matrix_from_lbytes(uint32_t n1, uint32_t n2, uint8_t *b, uint16
   }
 }
 
+/* Rows 4i .. 4i + 3 of the n x n matrix A, i.e. res is 4 * n; r is a scratch
+   buffer of 8 * n bytes */
 static inline void
-Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_t *res)
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x_rows(
+  uint32_t n,
+  uint8_t *seed,
+  uint32_t i,
+  uint8_t *r,
+  uint16_t *res
+)
 {
-  KRML_CHECK_SIZE(sizeof (uint8_t), 8U * n);
-  uint8_t r[8U * n];
-  memset(r, 0U, 8U * n * sizeof (uint8_t));
   uint8_t tmp_seed[72U] = { 0U };
   memcpy(tmp_seed + 2U, seed, 16U * sizeof (uint8_t));
   memcpy(tmp_seed + 20U, seed, 16U * sizeof (uint8_t));
   memcpy(tmp_seed + 38U, seed, 16U * sizeof (uint8_t));
   memcpy(tmp_seed + 56U, seed, 16U * sizeof (uint8_t));
-  memset(res, 0U, n * n * sizeof (uint16_t));
+  uint8_t *r0 = r + 0U * n;
+  uint8_t *r1 = r + 2U * n;
+  uint8_t *r2 = r + 4U * n;
+  uint8_t *r3 = r + 6U * n;
+  uint8_t *tmp_seed0 = tmp_seed;
+  uint8_t *tmp_seed1 = tmp_seed + 18U;
+  uint8_t *tmp_seed2 = tmp_seed + 36U;
+  uint8_t *tmp_seed3 = tmp_seed + 54U;
+  store16_le(tmp_seed0, (uint16_t)(4U * i + 0U));
+  store16_le(tmp_seed1, (uint16_t)(4U * i + 1U));
+  store16_le(tmp_seed2, (uint16_t)(4U * i + 2U));
+  store16_le(tmp_seed3, (uint16_t)(4U * i + 3U));
+  Hacl_Keccak_shake128_4x(18U,
+    tmp_seed0,
+    tmp_seed1,
+    tmp_seed2,
+    tmp_seed3,
+    2U * n,
+    r0,
+    r1,
+    r2,
+    r3);
+  for (uint32_t i0 = 0U; i0 < n; i0++)
+  {
+    res[0U * n + i0] = load16_le(r0 + i0 * 2U);
+    res[1U * n + i0] = load16_le(r1 + i0 * 2U);
+    res[2U * n + i0] = load16_le(r2 + i0 * 2U);
+    res[3U * n + i0] = load16_le(r3 + i0 * 2U);
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(uint32_t n, uint8_t *seed, uint16_t *res)
+{
+  KRML_CHECK_SIZE(sizeof (uint8_t), 8U * n);
+  uint8_t r[8U * n];
+  memset(r, 0U, 8U * n * sizeof (uint8_t));
   for (uint32_t i = 0U; i < n / 4U; i++)
   {
-    uint8_t *r0 = r + 0U * n;
-    uint8_t *r1 = r + 2U * n;
-    uint8_t *r2 = r + 4U * n;
-    uint8_t *r3 = r + 6U * n;
-    uint8_t *tmp_seed0 = tmp_seed;
-    uint8_t *tmp_seed1 = tmp_seed + 18U;
-    uint8_t *tmp_seed2 = tmp_seed + 36U;
-    uint8_t *tmp_seed3 = tmp_seed + 54U;
-    store16_le(tmp_seed0, (uint16_t)(4U * i + 0U));
-    store16_le(tmp_seed1, (uint16_t)(4U * i + 1U));
-    store16_le(tmp_seed2, (uint16_t)(4U * i + 2U));
-    store16_le(tmp_seed3, (uint16_t)(4U * i + 3U));
-    Hacl_Keccak_shake128_4x(18U,
-      tmp_seed0,
-      tmp_seed1,
-      tmp_seed2,
-      tmp_seed3,
-      2U * n,
-      r0,
-      r1,
-      r2,
-      r3);
-    for (uint32_t i0 = 0U; i0 < n; i0++)
-    {
-      uint8_t *resij0 = r0 + i0 * 2U;
-      uint8_t *resij1 = r1 + i0 * 2U;
-      uint8_t *resij2 = r2 + i0 * 2U;
-      uint8_t *resij3 = r3 + i0 * 2U;
-      uint16_t u = load16_le(resij0);
-      res[(4U * i + 0U) * n + i0] = u;
-      uint16_t u0 = load16_le(resij1);
-      res[(4U * i + 1U) * n + i0] = u0;
-      uint16_t u1 = load16_le(resij2);
-      res[(4U * i + 2U) * n + i0] = u1;
-      uint16_t u2 = load16_le(resij3);
-      res[(4U * i + 3U) * n + i0] = u2;
-    }
+    Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x_rows(n, seed, i, r, res + 4U * i * n);
   }
 }
 
+void Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_init(uint8_t *seed, uint8_t *rk);
+
+/* Rows 4i .. 4i + 3 of the n x n matrix A of FrodoKEM-AES, given the AES-128 key
+   schedule rk of seed_A; r is a scratch buffer of 8 * n bytes */
+void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_rows(
+  uint32_t n,
+  uint8_t *rk,
+  uint32_t i,
+  uint8_t *r,
+  uint16_t *res
+);
+
+/* Per-matrix state of the generator: seed_A itself for SHAKE128, its AES-128 key
+   schedule for AES128. gen_key is 176 bytes. */
 static inline void
-Hacl_Impl_Frodo_Params_frodo_gen_matrix(
+Hacl_Impl_Frodo_Params_frodo_gen_matrix_init(
   Spec_Frodo_Params_frodo_gen_a a,
-  uint32_t n,
   uint8_t *seed,
-  uint16_t *a_matrix
+  uint8_t *gen_key
+)
+{
+  switch (a)
+  {
+    case Spec_Frodo_Params_SHAKE128:
+      {
+        memcpy(gen_key, seed, 16U * sizeof (uint8_t));
+        break;
+      }
+    case Spec_Frodo_Params_AES128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_init(seed, gen_key);
+        break;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+static inline void
+Hacl_Impl_Frodo_Params_frodo_gen_matrix_rows(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *gen_key,
+  uint32_t i,
+  uint8_t *r,
+  uint16_t *rows
 )
 {
   switch (a)
   {
     case Spec_Frodo_Params_SHAKE128:
       {
-        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x(n, seed, a_matrix);
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_shake_4x_rows(n, gen_key, i, r, rows);
+        break;
+      }
+    case Spec_Frodo_Params_AES128:
+      {
+        Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_rows(n, gen_key, i, r, rows);
         break;
       }
     default:
@@ -266,6 +389,78 @@ Hacl_Impl_Frodo_Params_frodo_gen_matrix(
   }
 }
 
+static inline void
+Hacl_Impl_Frodo_Params_frodo_gen_matrix(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *a_matrix
+)
+{
+  uint8_t gen_key[176U] = { 0U };
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix_init(a, seed, gen_key);
+  KRML_CHECK_SIZE(sizeof (uint8_t), 8U * n);
+  uint8_t r[8U * n];
+  memset(r, 0U, 8U * n * sizeof (uint8_t));
+  for (uint32_t i = 0U; i < n / 4U; i++)
+  {
+    Hacl_Impl_Frodo_Params_frodo_gen_matrix_rows(a, n, gen_key, i, r, a_matrix + 4U * i * n);
+  }
+}
+
+/* res (n x 8) = A * S, where A is the n x n matrix expanded from seed and s holds
+   the 8 columns of S one after the other. A is generated four rows at a time
+   and never held in memory as a whole; scratch is 8 * n uint16_t. */
+static inline void
+Hacl_Impl_Frodo_Params_frodo_mul_as(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *res,
+  uint16_t *scratch
+)
+{
+  uint8_t gen_key[176U] = { 0U };
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix_init(a, seed, gen_key);
+  uint8_t *r = (uint8_t *)scratch;
+  memset(r, 0U, 8U * n * sizeof (uint8_t));
+  uint16_t *rows = scratch + 4U * n;
+  memset(rows, 0U, 4U * n * sizeof (uint16_t));
+  for (uint32_t i = 0U; i < n / 4U; i++)
+  {
+    Hacl_Impl_Frodo_Params_frodo_gen_matrix_rows(a, n, gen_key, i, r, rows);
+    Hacl_Impl_Matrix_matrix_mul_rows_s(n, rows, s, res + 32U * i);
+  }
+}
+
+/* res (8 x n) = S * A, where A is the n x n matrix expanded from seed. A is
+   generated four rows at a time and never held in memory as a whole; scratch is
+   8 * n uint16_t. */
+static inline void
+Hacl_Impl_Frodo_Params_frodo_mul_sa(
+  Spec_Frodo_Params_frodo_gen_a a,
+  uint32_t n,
+  uint8_t *seed,
+  uint16_t *s,
+  uint16_t *res,
+  uint16_t *scratch
+)
+{
+  uint8_t gen_key[176U] = { 0U };
+  Hacl_Impl_Frodo_Params_frodo_gen_matrix_init(a, seed, gen_key);
+  uint8_t *r = (uint8_t *)scratch;
+  memset(r, 0U, 8U * n * sizeof (uint8_t));
+  uint16_t *rows = scratch + 4U * n;
+  memset(rows, 0U, 4U * n * sizeof (uint16_t));
+  memset(res, 0U, 8U * n * sizeof (uint16_t));
+  for (uint32_t i = 0U; i < n / 4U; i++)
+  {
+    Hacl_Impl_Frodo_Params_frodo_gen_matrix_rows(a, n, gen_key, i, r, rows);
+    Hacl_Impl_Matrix_matrix_mul_add_rows(n, s, i, rows, res);
+  }
+}
+
 static const
 uint16_t
 Hacl_Impl_Frodo_Params_cdf_table640[13U] =
@@ -0,0 +1,78 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_Frodo_KEM_Simd256_H
+#define __internal_Hacl_Frodo_KEM_Simd256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/* AVX2 kernels of the fused FrodoKEM matrix generation and multiplication.
+   EverCrypt_Dispatch_init installs them when the CPU supports AVX2. */
+
+void
+Hacl_Impl_Frodo_Simd256_shake128_4x(
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+void
+Hacl_Impl_Frodo_Simd256_matrix_mul_rows_s(
+  uint32_t n,
+  uint16_t *rows,
+  uint16_t *s,
+  uint16_t *res
+);
+
+void
+Hacl_Impl_Frodo_Simd256_matrix_mul_add_rows(
+  uint32_t n,
+  uint16_t *s,
+  uint32_t i,
+  uint16_t *rows,
+  uint16_t *res
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_Frodo_KEM_Simd256_H_DEFINED
+#endif
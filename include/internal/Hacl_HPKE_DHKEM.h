@@ -0,0 +1,114 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_HPKE_DHKEM_H
+#define __internal_Hacl_HPKE_DHKEM_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_HPKE_Interface_Hacl_Impl_HPKE_Hacl_Meta_HPKE.h"
+#include "internal/Hacl_HPKE_KeySchedule.h"
+
+/* The Encap, Decap, AuthEncap and AuthDecap of RFC 9180, Section 4.1, and the
+   setup of the PSK, Auth and AuthPSK modes on top of them, shared by the
+   Hacl_HPKE_* suites. The curve is given by a Hacl_Impl_HPKE_DHKEM_s. */
+
+/* A public key is pklen bytes in the API, and enclen bytes when serialized, as
+   in enc and in the KEM context. enclen is either pklen or, for the NIST
+   curves, pklen + 1 with a leading 0x04. Both functions return 0 on success
+   and 1 if the key or the shared secret is invalid; dh writes 32 bytes. */
+typedef struct Hacl_Impl_HPKE_DHKEM_s_s
+{
+  uint16_t kem_id;
+  uint32_t pklen;
+  uint32_t enclen;
+  uint32_t (*secret_to_public)(uint8_t *o_enc, uint8_t *sk);
+  uint32_t (*dh)(uint8_t *o_dh, uint8_t *sk, uint8_t *pk);
+}
+Hacl_Impl_HPKE_DHKEM_s;
+
+/* DHKEM(X25519, HKDF-SHA256) with Hacl_Curve25519_51 and DHKEM(P-256,
+   HKDF-SHA256) with Hacl_P256. */
+extern const Hacl_Impl_HPKE_DHKEM_s Hacl_Impl_HPKE_DHKEM_x25519_51;
+
+extern const Hacl_Impl_HPKE_DHKEM_s Hacl_Impl_HPKE_DHKEM_p256;
+
+/* Returns 1 if the 32-byte X25519 output dh is all zero, and 0 otherwise. */
+uint32_t Hacl_Impl_HPKE_DHKEM_x25519_check(uint8_t *dh);
+
+/* SetupPSKS, SetupAuthS or SetupAuthPSKS, depending on mode. skS is NULL in
+   the modes without authentication, and psk and psk_id are empty in the modes
+   without a PSK. */
+uint32_t
+Hacl_Impl_HPKE_DHKEM_setup_s(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint16_t kdf_id,
+  uint8_t mode,
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/* The receiver side of Hacl_Impl_HPKE_DHKEM_setup_s, with pkS NULL in the
+   modes without authentication. */
+uint32_t
+Hacl_Impl_HPKE_DHKEM_setup_r(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint16_t kdf_id,
+  uint8_t mode,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_HPKE_DHKEM_H_DEFINED
+#endif
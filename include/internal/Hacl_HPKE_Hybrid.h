@@ -0,0 +1,88 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_HPKE_Hybrid_H
+#define __internal_Hacl_HPKE_Hybrid_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_HPKE_Interface_Hacl_Impl_HPKE_Hacl_Meta_HPKE.h"
+
+/* Code shared by the hybrid ECDH + ML-KEM-768 HPKE suites. They all use
+   HKDF-SHA256 and ChaCha20-Poly1305, i.e. KDF 0x0001 and AEAD 0x0003. */
+
+/* o_ss = SHA3-256(ss_M || ss_T || ct_T || pk_T || label), where ss_M is the
+   ML-KEM shared secret and ss_T the 32-byte ECDH one. ct_T and pk_T are tlen
+   bytes each. The whole input is absorbed at once, which for X-Wing fits in a
+   single Keccak block. */
+void
+Hacl_Impl_HPKE_Hybrid_combine(
+  uint8_t *o_ss,
+  uint8_t *ss_M,
+  uint8_t *ss_T,
+  uint32_t tlen,
+  uint8_t *ct_T,
+  uint8_t *pk_T,
+  uint32_t labellen,
+  uint8_t *label
+);
+
+/* Seal or open one message with the current nonce of ctx and increment its
+   sequence number. Both return 1 once the sequence number is exhausted and
+   open also returns 1 if the tag does not verify. */
+uint32_t
+Hacl_Impl_HPKE_Hybrid_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+);
+
+uint32_t
+Hacl_Impl_HPKE_Hybrid_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_HPKE_Hybrid_H_DEFINED
+#endif
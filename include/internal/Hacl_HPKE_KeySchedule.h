@@ -0,0 +1,100 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_HPKE_KeySchedule_H
+#define __internal_Hacl_HPKE_KeySchedule_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_HPKE_Interface_Hacl_Impl_HPKE_Hacl_Meta_HPKE.h"
+
+/* The parts of RFC 9180 that do not depend on the curve or the AEAD, shared by
+   the PSK, Auth and AuthPSK modes of the Hacl_HPKE_* suites and by the hybrid
+   suites. kdf_id is 0x0001 for HKDF-SHA256 or 0x0003 for HKDF-SHA512, and the
+   AEAD is always ChaCha20-Poly1305. */
+
+#define Hacl_Impl_HPKE_mode_base (0U)
+#define Hacl_Impl_HPKE_mode_psk (1U)
+#define Hacl_Impl_HPKE_mode_auth (2U)
+#define Hacl_Impl_HPKE_mode_auth_psk (3U)
+
+/* ExtractAndExpand of DHKEM(kem_id, HKDF-SHA256): the 32-byte shared secret for
+   the Diffie-Hellman output dh and the kem_context enc || pkR [|| pkS]. */
+void
+Hacl_Impl_HPKE_extract_and_expand(
+  uint8_t *o_shared,
+  uint16_t kem_id,
+  uint32_t dhlen,
+  uint8_t *dh,
+  uint32_t kem_contextlen,
+  uint8_t *kem_context
+);
+
+/* KeySchedule in the given mode, writing the key, base nonce and exporter
+   secret of o_ctx and resetting its sequence number. Returns 1 without writing
+   o_ctx if psk and psk_id are not both empty in the modes without a PSK, or not
+   both non-empty in the modes with one. */
+uint32_t
+Hacl_Impl_HPKE_key_schedule(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint16_t kem_id,
+  uint16_t kdf_id,
+  uint8_t mode,
+  uint8_t *shared,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+);
+
+/* Secret export: LabeledExpand(exporter_secret, "sec", exp_ctx, l). Returns 1
+   if l exceeds 255 times the hash length. */
+uint32_t
+Hacl_Impl_HPKE_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint16_t kem_id,
+  uint16_t kdf_id,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_HPKE_KeySchedule_H_DEFINED
+#endif
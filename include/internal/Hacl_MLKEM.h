@@ -0,0 +1,166 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_MLKEM_H
+#define __internal_Hacl_MLKEM_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "Hacl_Hash_SHA3.h"
+
+/* Generic ML-KEM (FIPS 203), instantiated by Hacl_MLKEM512, Hacl_MLKEM768 and
+   Hacl_MLKEM1024 with the rank k, the noise parameter eta1 and the compression
+   widths du and dv. eta2 is 2 for all parameter sets.
+
+   Polynomials are int16_t[256]. Coefficients are kept small and signed between
+   operations, and only brought to [0, q) when they are encoded. */
+
+/* zetas[i] = 17 ^ BitRev7(i) * 2 ^ 16 mod q, centered, i.e. the twiddle factors
+   of the NTT in Montgomery form */
+static const
+int16_t
+Hacl_Impl_MLKEM_zetas[128U] =
+  {
+    (int16_t)-1044, (int16_t)-758, (int16_t)-359, (int16_t)-1517, (int16_t)1493, (int16_t)1422, (int16_t)287, (int16_t)202,
+    (int16_t)-171, (int16_t)622, (int16_t)1577, (int16_t)182, (int16_t)962, (int16_t)-1202, (int16_t)-1474, (int16_t)1468,
+    (int16_t)573, (int16_t)-1325, (int16_t)264, (int16_t)383, (int16_t)-829, (int16_t)1458, (int16_t)-1602, (int16_t)-130,
+    (int16_t)-681, (int16_t)1017, (int16_t)732, (int16_t)608, (int16_t)-1542, (int16_t)411, (int16_t)-205, (int16_t)-1571,
+    (int16_t)1223, (int16_t)652, (int16_t)-552, (int16_t)1015, (int16_t)-1293, (int16_t)1491, (int16_t)-282, (int16_t)-1544,
+    (int16_t)516, (int16_t)-8, (int16_t)-320, (int16_t)-666, (int16_t)-1618, (int16_t)-1162, (int16_t)126, (int16_t)1469,
+    (int16_t)-853, (int16_t)-90, (int16_t)-271, (int16_t)830, (int16_t)107, (int16_t)-1421, (int16_t)-247, (int16_t)-951,
+    (int16_t)-398, (int16_t)961, (int16_t)-1508, (int16_t)-725, (int16_t)448, (int16_t)-1065, (int16_t)677, (int16_t)-1275,
+    (int16_t)-1103, (int16_t)430, (int16_t)555, (int16_t)843, (int16_t)-1251, (int16_t)871, (int16_t)1550, (int16_t)105,
+    (int16_t)422, (int16_t)587, (int16_t)177, (int16_t)-235, (int16_t)-291, (int16_t)-460, (int16_t)1574, (int16_t)1653,
+    (int16_t)-246, (int16_t)778, (int16_t)1159, (int16_t)-147, (int16_t)-777, (int16_t)1483, (int16_t)-602, (int16_t)1119,
+    (int16_t)-1590, (int16_t)644, (int16_t)-872, (int16_t)349, (int16_t)418, (int16_t)329, (int16_t)-156, (int16_t)-75,
+    (int16_t)817, (int16_t)1097, (int16_t)603, (int16_t)610, (int16_t)1322, (int16_t)-1285, (int16_t)-1465, (int16_t)384,
+    (int16_t)-1215, (int16_t)-136, (int16_t)1218, (int16_t)-1335, (int16_t)-874, (int16_t)220, (int16_t)-1187, (int16_t)-1659,
+    (int16_t)-1185, (int16_t)-1530, (int16_t)-1278, (int16_t)794, (int16_t)-1510, (int16_t)-854, (int16_t)-870, (int16_t)478,
+    (int16_t)-108, (int16_t)-308, (int16_t)996, (int16_t)991, (int16_t)958, (int16_t)-1460, (int16_t)1522, (int16_t)1628
+  };
+
+/* Parse uniform coefficients out of buf, a multiple of 3 bytes, into r[ctr .. 256).
+   Returns the new number of coefficients of r. */
+uint32_t Hacl_Impl_MLKEM_rej_uniform(int16_t *r, uint32_t ctr, uint8_t *buf, uint32_t buflen);
+
+/* The kernels of the NTT, of the base multiplication and of the sampling. The
+   library starts with Hacl_Impl_MLKEM_Kernels_portable; EverCrypt_Dispatch_init
+   installs the AVX2 ones when the CPU supports them. All of them compute exactly
+   the same values. */
+typedef struct Hacl_Impl_MLKEM_Kernels_s
+{
+  void (*ntt)(int16_t *r);
+  void (*invntt)(int16_t *r);
+  void (*basemul_acc)(uint32_t k, int16_t *a, int16_t *b, int16_t *r);
+  void (*sample_noise)(uint32_t eta, uint8_t *seed, uint32_t nonce, uint32_t cnt, int16_t *r);
+  void (*sample_polys)(uint32_t cnt, uint8_t *seeds, int16_t *r);
+}
+Hacl_Impl_MLKEM_Kernels;
+
+extern const Hacl_Impl_MLKEM_Kernels Hacl_Impl_MLKEM_Kernels_portable;
+
+/* Replaces the table atomically; running operations keep valid kernels. */
+void Hacl_Impl_MLKEM_Kernels_set(const Hacl_Impl_MLKEM_Kernels *k);
+
+const Hacl_Impl_MLKEM_Kernels *Hacl_Impl_MLKEM_Kernels_get(void);
+
+/* The sampling kernels on four AVX2 lanes. They are only defined when
+   HACL_CAN_COMPILE_VEC256 is set. */
+
+void
+Hacl_Impl_MLKEM_Vec256_sample_noise(
+  uint32_t eta,
+  uint8_t *seed,
+  uint32_t nonce,
+  uint32_t cnt,
+  int16_t *r
+);
+
+void Hacl_Impl_MLKEM_Vec256_sample_polys(uint32_t cnt, uint8_t *seeds, int16_t *r);
+
+/* The modulus check of FIPS 203, section 7.2, on n consecutive public keys */
+bool Hacl_Impl_MLKEM_validate_pk(uint32_t k, uint32_t n, uint8_t *pk);
+
+/* The hash check of FIPS 203, section 7.3, on n consecutive secret keys */
+bool Hacl_Impl_MLKEM_validate_sk(uint32_t k, uint32_t n, uint8_t *sk);
+
+/* The three functions below run n independent operations at once, on
+   consecutive keys, ciphertexts and shared secrets. Their matrix expansions are
+   sampled together, four polynomials at a time on AVX2. Keys must have been
+   validated first. */
+
+/* coins holds 64 bytes per key: d, then z */
+void
+Hacl_Impl_MLKEM_keypair(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t n,
+  uint8_t *coins,
+  uint8_t *pk,
+  uint8_t *sk
+);
+
+/* coins holds the 32-byte message m of each encapsulation */
+void
+Hacl_Impl_MLKEM_encaps(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t n,
+  uint8_t *coins,
+  uint8_t *pk,
+  uint8_t *ct,
+  uint8_t *ss
+);
+
+/* A ciphertext that does not re-encrypt to itself yields the implicit rejection
+   key J(z || ct) */
+void
+Hacl_Impl_MLKEM_decaps(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t n,
+  uint8_t *sk,
+  uint8_t *ct,
+  uint8_t *ss
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_MLKEM_H_DEFINED
+#endif
@@ -0,0 +1,81 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_MLKEM_Simd256_H
+#define __internal_Hacl_MLKEM_Simd256_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+/* AVX2 kernels of ML-KEM. EverCrypt_Dispatch_init only installs them on CPUs
+   with AVX2, and they compute exactly the same values as the portable code. */
+
+/* Forward NTT of r, followed by a Barrett reduction */
+void Hacl_Impl_MLKEM_Simd256_ntt(int16_t *r);
+
+/* Inverse NTT of r, with the result multiplied by 2^16 */
+void Hacl_Impl_MLKEM_Simd256_invntt(int16_t *r);
+
+/* r = sum_j a_j * b_j in the NTT domain, divided by 2^16 and Barrett reduced,
+   for the k polynomials a_j and b_j */
+void Hacl_Impl_MLKEM_Simd256_basemul_acc(uint32_t k, int16_t *a, int16_t *b, int16_t *r);
+
+/* r_l = SampleNTT(seeds + 34 l) for l = 0 .. 3 */
+void
+Hacl_Impl_MLKEM_Simd256_sample_ntt_4x(
+  uint8_t *seeds,
+  int16_t *r0,
+  int16_t *r1,
+  int16_t *r2,
+  int16_t *r3
+);
+
+void
+Hacl_Impl_MLKEM_Simd256_shake256_4x(
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_MLKEM_Simd256_H_DEFINED
+#endif
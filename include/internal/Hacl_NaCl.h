@@ -0,0 +1,88 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#ifndef __internal_Hacl_NaCl_H
+#define __internal_Hacl_NaCl_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+#include "../Hacl_NaCl.h"
+
+/* The bulk Salsa20 and Poly1305 passes of secret boxes and boxes. Hacl_NaCl uses
+   Hacl_Impl_NaCl_Kernels_portable; EverCrypt_NaCl uses the ones chosen by
+   EverCrypt_Dispatch_init. */
+typedef struct Hacl_Impl_NaCl_Kernels_s
+{
+  void
+  (*salsa20_xor)(
+    uint32_t len,
+    uint8_t *out,
+    uint8_t *text,
+    uint8_t *key,
+    uint8_t *n,
+    uint32_t ctr
+  );
+  void (*poly1305_mac)(uint8_t *tag, uint8_t *input, uint32_t input_len, uint8_t *key);
+}
+Hacl_Impl_NaCl_Kernels;
+
+extern const Hacl_Impl_NaCl_Kernels Hacl_Impl_NaCl_Kernels_portable;
+
+void
+Hacl_Impl_NaCl_secretbox_detached(
+  const Hacl_Impl_NaCl_Kernels *kn,
+  uint32_t mlen,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *m
+);
+
+uint32_t
+Hacl_Impl_NaCl_secretbox_open_detached(
+  const Hacl_Impl_NaCl_Kernels *kn,
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *c,
+  uint8_t *tag
+);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_NaCl_H_DEFINED
+#endif
@@ -40,6 +40,7 @@ extern "C" {
 #define Spec_Cipher_Expansion_Hacl_CHACHA20 0
 #define Spec_Cipher_Expansion_Vale_AES128 1
 #define Spec_Cipher_Expansion_Vale_AES256 2
+#define Spec_Cipher_Expansion_Hacl_XCHACHA20 3
 
 typedef uint8_t Spec_Cipher_Expansion_impl;
 
@@ -25,8 +25,11 @@
 
 #include "EverCrypt_AEAD.h"
 
+#include "internal/EverCrypt_Dispatch.h"
 #include "internal/Vale.h"
 #include "internal/Hacl_Spec.h"
+#include "Hacl_Chacha20.h"
+#include "lib_memzero0.h"
 #include "config.h"
 
 /**
@@ -67,6 +70,10 @@ Spec_Agile_AEAD_alg EverCrypt_AEAD_alg_of_state(EverCrypt_AEAD_state_s *s)
       {
         return Spec_Agile_AEAD_CHACHA20_POLY1305;
       }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        return Spec_Agile_AEAD_XCHACHA20_POLY1305;
+      }
     case Spec_Cipher_Expansion_Vale_AES128:
       {
         return Spec_Agile_AEAD_AES128_GCM;
@@ -95,18 +102,34 @@ create_in_chacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   return EverCrypt_Error_Success;
 }
 
+static EverCrypt_Error_error_code
+create_in_xchacha20_poly1305(EverCrypt_AEAD_state_s **dst, uint8_t *k)
+{
+  uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(32U, sizeof (uint8_t));
+  EverCrypt_AEAD_state_s
+  *p = (EverCrypt_AEAD_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_AEAD_state_s));
+  p[0U] = ((EverCrypt_AEAD_state_s){ .impl = Spec_Cipher_Expansion_Hacl_XCHACHA20, .ek = ek });
+  memcpy(ek, k, 32U * sizeof (uint8_t));
+  dst[0U] = p;
+  return EverCrypt_Error_Success;
+}
+
+/* XChaCha20-Poly1305 is ChaCha20-Poly1305 under the HChaCha20 subkey of the first 16 bytes
+   of the 24-byte nonce, with four zero bytes and the last 8 bytes as the 12-byte nonce. */
+static void xchacha20_subkey(uint8_t *subkey, uint8_t *cnonce, uint8_t *k, uint8_t *iv)
+{
+  Hacl_Chacha20_hchacha20(subkey, k, iv);
+  memset(cnonce, 0U, 4U * sizeof (uint8_t));
+  memcpy(cnonce + 4U, iv + 16U, 8U * sizeof (uint8_t));
+}
+
 static EverCrypt_Error_error_code
 create_in_aes128_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
 {
   KRML_MAYBE_UNUSED_VAR(dst);
   KRML_MAYBE_UNUSED_VAR(k);
   #if HACL_CAN_COMPILE_VALE
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(480U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
@@ -131,12 +154,7 @@ create_in_aes256_gcm(EverCrypt_AEAD_state_s **dst, uint8_t *k)
   KRML_MAYBE_UNUSED_VAR(dst);
   KRML_MAYBE_UNUSED_VAR(k);
   #if HACL_CAN_COMPILE_VALE
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(544U, sizeof (uint8_t));
     uint8_t *keys_b = ek;
@@ -162,8 +180,9 @@ Note: The caller must free the AEAD state by calling `EverCrypt_AEAD_free`.
 
 @param a The argument `a` must be either of:
   * `Spec_Agile_AEAD_AES128_GCM` (KEY_LEN=16),
-  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32), or
-  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32).
+  * `Spec_Agile_AEAD_AES256_GCM` (KEY_LEN=32),
+  * `Spec_Agile_AEAD_CHACHA20_POLY1305` (KEY_LEN=32), or
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (KEY_LEN=32).
 @param dst Pointer to a pointer where the address of the allocated AEAD state will be written to.
 @param k Pointer to `KEY_LEN` bytes of memory where the key is read from. The size depends on the used algorithm, see above.
 
@@ -188,6 +207,10 @@ EverCrypt_AEAD_create_in(Spec_Agile_AEAD_alg a, EverCrypt_AEAD_state_s **dst, ui
       {
         return create_in_chacha20_poly1305(dst, k);
       }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return create_in_xchacha20_poly1305(dst, k);
+      }
     default:
       {
         return EverCrypt_Error_UnsupportedAlgorithm;
@@ -446,7 +469,8 @@ Encrypt and authenticate a message (`plain`) with associated data (`ad`).
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce and
+  XChaCha20Poly1305 a 24 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param plain Pointer to `plain_len` bytes of memory where the to-be-encrypted plaintext is read from.
@@ -457,6 +481,7 @@ Encrypt and authenticate a message (`plain`) with associated data (`ad`).
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (TAG_LEN=16)
 
 @return `EverCrypt_AEAD_encrypt` may return either `EverCrypt_Error_Success` or `EverCrypt_Error_InvalidKey` (`EverCrypt_error.h`). The latter is returned if and only if the `s` parameter is `NULL`.
 */
@@ -499,6 +524,26 @@ EverCrypt_AEAD_encrypt(
         EverCrypt_Chacha20Poly1305_aead_encrypt(ek, iv, ad_len, ad, plain_len, plain, cipher, tag);
         return EverCrypt_Error_Success;
       }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        if (iv_len != 24U)
+        {
+          return EverCrypt_Error_InvalidIVLength;
+        }
+        uint8_t subkey[32U] = { 0U };
+        uint8_t cnonce[12U] = { 0U };
+        xchacha20_subkey(subkey, cnonce, ek, iv);
+        EverCrypt_Chacha20Poly1305_aead_encrypt(subkey,
+          cnonce,
+          ad_len,
+          ad,
+          plain_len,
+          plain,
+          cipher,
+          tag);
+        Lib_Memzero0_memzero(subkey, 32U, uint8_t, void *);
+        return EverCrypt_Error_Success;
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -814,12 +859,7 @@ EverCrypt_AEAD_encrypt_expand_aes128_gcm(
   KRML_MAYBE_UNUSED_VAR(cipher);
   KRML_MAYBE_UNUSED_VAR(tag);
   #if HACL_CAN_COMPILE_VALE
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -953,12 +993,7 @@ EverCrypt_AEAD_encrypt_expand_aes256_gcm(
   KRML_MAYBE_UNUSED_VAR(cipher);
   KRML_MAYBE_UNUSED_VAR(tag);
   #if HACL_CAN_COMPILE_VALE
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1092,6 +1127,26 @@ EverCrypt_AEAD_encrypt_expand_chacha20_poly1305(
   return EverCrypt_Error_Success;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *plain,
+  uint32_t plain_len,
+  uint8_t *cipher,
+  uint8_t *tag
+)
+{
+  uint8_t ek[32U] = { 0U };
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_XCHACHA20, .ek = ek };
+  memcpy(ek, k, 32U * sizeof (uint8_t));
+  EverCrypt_AEAD_state_s *s = &p;
+  return EverCrypt_AEAD_encrypt(s, iv, iv_len, ad, ad_len, plain, plain_len, cipher, tag);
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_encrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -1147,6 +1202,19 @@ EverCrypt_AEAD_encrypt_expand(
             cipher,
             tag);
       }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_encrypt_expand_xchacha20_poly1305(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            plain,
+            plain_len,
+            cipher,
+            tag);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1456,12 +1524,56 @@ decrypt_chacha20_poly1305(
   return EverCrypt_Error_AuthenticationFailure;
 }
 
+static EverCrypt_Error_error_code
+decrypt_xchacha20_poly1305(
+  EverCrypt_AEAD_state_s *s,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  if (s == NULL)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  if (iv_len != 24U)
+  {
+    return EverCrypt_Error_InvalidIVLength;
+  }
+  uint8_t *ek = (*s).ek;
+  uint8_t subkey[32U] = { 0U };
+  uint8_t cnonce[12U] = { 0U };
+  xchacha20_subkey(subkey, cnonce, ek, iv);
+  uint32_t
+  r =
+    EverCrypt_Chacha20Poly1305_aead_decrypt(subkey,
+      cnonce,
+      ad_len,
+      ad,
+      cipher_len,
+      dst,
+      cipher,
+      tag);
+  Lib_Memzero0_memzero(subkey, 32U, uint8_t, void *);
+  if (r == 0U)
+  {
+    return EverCrypt_Error_Success;
+  }
+  return EverCrypt_Error_AuthenticationFailure;
+}
+
 /**
 Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
 
 @param s Pointer to the The AEAD state created by `EverCrypt_AEAD_create_in`. It already contains the encryption key.
 @param iv Pointer to `iv_len` bytes of memory where the nonce is read from.
-@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce.
+@param iv_len Length of the nonce. Note: ChaCha20Poly1305 requires a 12 byte nonce and
+  XChaCha20Poly1305 a 24 byte nonce.
 @param ad Pointer to `ad_len` bytes of memory where the associated data is read from.
 @param ad_len Length of the associated data.
 @param cipher Pointer to `cipher_len` bytes of memory where the ciphertext is read from.
@@ -1471,6 +1583,7 @@ Verify the authenticity of `ad` || `cipher` and decrypt `cipher` into `dst`.
   * `Spec_Agile_AEAD_AES128_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_AES256_GCM` (TAG_LEN=16)
   * `Spec_Agile_AEAD_CHACHA20_POLY1305` (TAG_LEN=16)
+  * `Spec_Agile_AEAD_XCHACHA20_POLY1305` (TAG_LEN=16)
 @param dst Pointer to `cipher_len` bytes of memory where the decrypted plaintext will be written to.
 
 @return `EverCrypt_AEAD_decrypt` returns ...
@@ -1519,6 +1632,10 @@ EverCrypt_AEAD_decrypt(
       {
         return decrypt_chacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
       }
+    case Spec_Cipher_Expansion_Hacl_XCHACHA20:
+      {
+        return decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -1850,12 +1967,7 @@ EverCrypt_AEAD_decrypt_expand_aes128_gcm(
   KRML_MAYBE_UNUSED_VAR(tag);
   KRML_MAYBE_UNUSED_VAR(dst);
   #if HACL_CAN_COMPILE_VALE
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t ek[480U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -1997,12 +2109,7 @@ EverCrypt_AEAD_decrypt_expand_aes256_gcm(
   KRML_MAYBE_UNUSED_VAR(tag);
   KRML_MAYBE_UNUSED_VAR(dst);
   #if HACL_CAN_COMPILE_VALE
-  bool has_pclmulqdq = EverCrypt_AutoConfig2_has_pclmulqdq();
-  bool has_avx = EverCrypt_AutoConfig2_has_avx();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  bool has_movbe = EverCrypt_AutoConfig2_has_movbe();
-  bool has_aesni = EverCrypt_AutoConfig2_has_aesni();
-  if (has_aesni && has_pclmulqdq && has_avx && has_sse && has_movbe)
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
   {
     uint8_t ek[544U] = { 0U };
     uint8_t *keys_b0 = ek;
@@ -2143,6 +2250,28 @@ EverCrypt_AEAD_decrypt_expand_chacha20_poly1305(
   return r;
 }
 
+EverCrypt_Error_error_code
+EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(
+  uint8_t *k,
+  uint8_t *iv,
+  uint32_t iv_len,
+  uint8_t *ad,
+  uint32_t ad_len,
+  uint8_t *cipher,
+  uint32_t cipher_len,
+  uint8_t *tag,
+  uint8_t *dst
+)
+{
+  uint8_t ek[32U] = { 0U };
+  EverCrypt_AEAD_state_s p = { .impl = Spec_Cipher_Expansion_Hacl_XCHACHA20, .ek = ek };
+  memcpy(ek, k, 32U * sizeof (uint8_t));
+  EverCrypt_AEAD_state_s *s = &p;
+  EverCrypt_Error_error_code
+  r = decrypt_xchacha20_poly1305(s, iv, iv_len, ad, ad_len, cipher, cipher_len, tag, dst);
+  return r;
+}
+
 EverCrypt_Error_error_code
 EverCrypt_AEAD_decrypt_expand(
   Spec_Agile_AEAD_alg a,
@@ -2198,6 +2327,19 @@ EverCrypt_AEAD_decrypt_expand(
             tag,
             dst);
       }
+    case Spec_Agile_AEAD_XCHACHA20_POLY1305:
+      {
+        return
+          EverCrypt_AEAD_decrypt_expand_xchacha20_poly1305(k,
+            iv,
+            iv_len,
+            ad,
+            ad_len,
+            cipher,
+            cipher_len,
+            tag,
+            dst);
+      }
     default:
       {
         KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
@@ -28,6 +28,10 @@
 #include "internal/Vale.h"
 #include "evercrypt_targetconfig.h"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 static bool cpu_has_shaext[1U] = { false };
 
 static bool cpu_has_aesni[1U] = { false };
@@ -50,6 +54,8 @@ static bool cpu_has_rdrand[1U] = { false };
 
 static bool cpu_has_avx512[1U] = { false };
 
+static bool cpu_has_avx512ifma[1U] = { false };
+
 bool EverCrypt_AutoConfig2_has_shaext(void)
 {
   return cpu_has_shaext[0U];
@@ -105,6 +111,36 @@ bool EverCrypt_AutoConfig2_has_avx512(void)
   return cpu_has_avx512[0U];
 }
 
+bool EverCrypt_AutoConfig2_has_avx512ifma(void)
+{
+  return cpu_has_avx512ifma[0U];
+}
+
+/* Vale's CPUID support does not cover AVX512-IFMA (CPUID.(EAX=7,ECX=0):EBX[21]),
+   so we query it here. The OS support for the zmm state is the same as for
+   AVX512 and is checked by the caller. */
+static uint64_t check_avx512ifma(void)
+{
+  #if TARGET_ARCHITECTURE == TARGET_ARCHITECTURE_ID_X64
+  #if defined(_MSC_VER)
+  int regs[4U];
+  __cpuidex(regs, 7, 0);
+  return (uint64_t)((uint32_t)regs[1U] >> 21U & 1U);
+  #elif defined(__GNUC__)
+  uint32_t eax = 7U;
+  uint32_t ebx;
+  uint32_t ecx = 0U;
+  uint32_t edx;
+  __asm__("cpuid" : "+a"(eax), "=b"(ebx), "+c"(ecx), "=d"(edx));
+  return (uint64_t)(ebx >> 21U & 1U);
+  #else
+  return 0ULL;
+  #endif
+  #else
+  return 0ULL;
+  #endif
+}
+
 void EverCrypt_AutoConfig2_recall(void)
 {
 
@@ -168,6 +204,10 @@ void EverCrypt_AutoConfig2_init(void)
         if (check_avx512_xcr0() != 0ULL)
         {
           cpu_has_avx512[0U] = true;
+          if (check_avx512ifma() != 0ULL)
+          {
+            cpu_has_avx512ifma[0U] = true;
+          }
           return;
         }
         return;
@@ -232,6 +272,12 @@ void EverCrypt_AutoConfig2_disable_rdrand(void)
 void EverCrypt_AutoConfig2_disable_avx512(void)
 {
   cpu_has_avx512[0U] = false;
+  cpu_has_avx512ifma[0U] = false;
+}
+
+void EverCrypt_AutoConfig2_disable_avx512ifma(void)
+{
+  cpu_has_avx512ifma[0U] = false;
 }
 
 bool EverCrypt_AutoConfig2_has_vec128(void)
@@ -25,7 +25,7 @@
 
 #include "EverCrypt_Chacha20Poly1305.h"
 
-#include "config.h"
+#include "internal/EverCrypt_Dispatch.h"
 
 void
 EverCrypt_Chacha20Poly1305_aead_encrypt(
@@ -39,27 +39,7 @@ EverCrypt_Chacha20Poly1305_aead_encrypt(
   uint8_t *tag
 )
 {
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec128);
-    Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
-    return;
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec256);
-    Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
-    return;
-  }
-  #endif
-  KRML_MAYBE_UNUSED_VAR(vec128);
-  KRML_MAYBE_UNUSED_VAR(vec256);
-  Hacl_AEAD_Chacha20Poly1305_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
+  EverCrypt_Dispatch_functions.chacha20poly1305_encrypt(cipher, tag, m, mlen, aad, aadlen, k, n);
 }
 
 uint32_t
@@ -74,24 +54,14 @@ EverCrypt_Chacha20Poly1305_aead_decrypt(
   uint8_t *tag
 )
 {
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec128);
-    return Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec256);
-    return Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
-  }
-  #endif
-  KRML_MAYBE_UNUSED_VAR(vec128);
-  KRML_MAYBE_UNUSED_VAR(vec256);
-  return Hacl_AEAD_Chacha20Poly1305_decrypt(m, cipher, mlen, aad, aadlen, k, n, tag);
+  return
+    EverCrypt_Dispatch_functions.chacha20poly1305_decrypt(m,
+      cipher,
+      mlen,
+      aad,
+      aadlen,
+      k,
+      n,
+      tag);
 }
 
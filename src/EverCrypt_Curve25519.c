@@ -25,7 +25,7 @@
 
 #include "EverCrypt_Curve25519.h"
 
-#include "config.h"
+#include "internal/EverCrypt_Dispatch.h"
 
 /**
 Calculate a public point from a secret/private key.
@@ -37,18 +37,7 @@ This computes a scalar multiplication of the secret/private key with the curve's
 */
 void EverCrypt_Curve25519_secret_to_public(uint8_t *pub, uint8_t *priv)
 {
-  #if HACL_CAN_COMPILE_VALE
-  bool has_bmi2 = EverCrypt_AutoConfig2_has_bmi2();
-  bool has_adx = EverCrypt_AutoConfig2_has_adx();
-  if (has_bmi2 && has_adx)
-  {
-    Hacl_Curve25519_64_secret_to_public(pub, priv);
-    return;
-  }
-  Hacl_Curve25519_51_secret_to_public(pub, priv);
-  #else
-  Hacl_Curve25519_51_secret_to_public(pub, priv);
-  #endif
+  EverCrypt_Dispatch_functions.curve25519_secret_to_public(pub, priv);
 }
 
 /**
@@ -60,18 +49,7 @@ Compute the scalar multiple of a point.
 */
 void EverCrypt_Curve25519_scalarmult(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
 {
-  #if HACL_CAN_COMPILE_VALE
-  bool has_bmi2 = EverCrypt_AutoConfig2_has_bmi2();
-  bool has_adx = EverCrypt_AutoConfig2_has_adx();
-  if (has_bmi2 && has_adx)
-  {
-    Hacl_Curve25519_64_scalarmult(shared, my_priv, their_pub);
-    return;
-  }
-  Hacl_Curve25519_51_scalarmult(shared, my_priv, their_pub);
-  #else
-  Hacl_Curve25519_51_scalarmult(shared, my_priv, their_pub);
-  #endif
+  EverCrypt_Dispatch_functions.curve25519_scalarmult(shared, my_priv, their_pub);
 }
 
 /**
@@ -83,16 +61,6 @@ Execute the diffie-hellmann key exchange.
 */
 bool EverCrypt_Curve25519_ecdh(uint8_t *shared, uint8_t *my_priv, uint8_t *their_pub)
 {
-  #if HACL_CAN_COMPILE_VALE
-  bool has_bmi2 = EverCrypt_AutoConfig2_has_bmi2();
-  bool has_adx = EverCrypt_AutoConfig2_has_adx();
-  if (has_bmi2 && has_adx)
-  {
-    return Hacl_Curve25519_64_ecdh(shared, my_priv, their_pub);
-  }
-  return Hacl_Curve25519_51_ecdh(shared, my_priv, their_pub);
-  #else
-  return Hacl_Curve25519_51_ecdh(shared, my_priv, their_pub);
-  #endif
+  return EverCrypt_Dispatch_functions.curve25519_ecdh(shared, my_priv, their_pub);
 }
 
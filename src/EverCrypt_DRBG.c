@@ -23,10 +23,16 @@
  */
 
 
-#include "EverCrypt_DRBG.h"
+#include "internal/EverCrypt_DRBG.h"
 
 #include "internal/EverCrypt_HMAC.h"
+#include "internal/Vale.h"
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "Hacl_Chacha20_Vec256.h"
+#include "internal/EverCrypt_Dispatch.h"
 #include "lib_memzero0.h"
+#include "config.h"
 
 uint32_t EverCrypt_DRBG_reseed_interval = 1024U;
 
@@ -70,9 +76,35 @@ uint32_t EverCrypt_DRBG_min_length(Spec_Hash_Definitions_hash_alg a)
 #define SHA2_256_s 1
 #define SHA2_384_s 2
 #define SHA2_512_s 3
+#define CHACHA20_s 4
+#define AES256_CTR_s 5
 
 typedef uint8_t state_s_tags;
 
+/* Number of bytes of ChaCha20 keystream produced per refill; the first 32 bytes
+   of every batch become the next key (fast key erasure). */
+#define CHACHA20_BATCH_LEN (4096U)
+
+typedef struct chacha20_state_s
+{
+  uint8_t *key;
+  uint8_t *buf;
+  uint32_t *pos;
+  uint32_t *reseed_counter;
+}
+chacha20_state;
+
+/* CTR_DRBG state. `ek` holds the Vale AES-256 key schedule (240 bytes), the
+   GHASH keys (128 bytes) and scratch space (176 bytes), laid out as in
+   EverCrypt_AEAD; `v` is the 16-byte counter block. */
+typedef struct aes256_ctr_state_s
+{
+  uint8_t *ek;
+  uint8_t *v;
+  uint32_t *reseed_counter;
+}
+aes256_ctr_state;
+
 typedef struct EverCrypt_DRBG_state_s_s
 {
   state_s_tags tag;
@@ -81,6 +113,8 @@ typedef struct EverCrypt_DRBG_state_s_s
     Hacl_HMAC_DRBG_state case_SHA2_256_s;
     Hacl_HMAC_DRBG_state case_SHA2_384_s;
     Hacl_HMAC_DRBG_state case_SHA2_512_s;
+    chacha20_state case_CHACHA20_s;
+    aes256_ctr_state case_AES256_CTR_s;
   }
   ;
 }
@@ -235,6 +269,71 @@ EverCrypt_DRBG_state_s *EverCrypt_DRBG_create(Spec_Hash_Definitions_hash_alg a)
   return EverCrypt_DRBG_create_in(a);
 }
 
+/**
+Create a DRBG state that uses a ChaCha20 fast-key-erasure generator instead of
+HMAC-DRBG. It is driven through the same `instantiate`, `reseed`, `generate` and
+`uninstantiate` functions, but is several times faster for bulk output. Note that
+this generator is not an SP 800-90A DRBG.
+
+@return DRBG state. Needs to be freed via `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_chacha20(void)
+{
+  uint8_t *key = (uint8_t *)KRML_HOST_CALLOC(32U, sizeof (uint8_t));
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(CHACHA20_BATCH_LEN, sizeof (uint8_t));
+  uint32_t *pos = (uint32_t *)KRML_HOST_MALLOC(sizeof (uint32_t));
+  uint32_t *ctr = (uint32_t *)KRML_HOST_MALLOC(sizeof (uint32_t));
+  pos[0U] = CHACHA20_BATCH_LEN;
+  ctr[0U] = 1U;
+  EverCrypt_DRBG_state_s
+  *st = (EverCrypt_DRBG_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_state_s));
+  st[0U] =
+    (
+      (EverCrypt_DRBG_state_s){
+        .tag = CHACHA20_s,
+        { .case_CHACHA20_s = { .key = key, .buf = buf, .pos = pos, .reseed_counter = ctr } }
+      }
+    );
+  return st;
+}
+
+/**
+Create a CTR_DRBG (NIST SP 800-90A) state, using AES-256 without a derivation
+function. It is driven through the same `instantiate`, `reseed`, `generate` and
+`uninstantiate` functions. Since no derivation function is used, the
+personalization string and additional input are limited to 48 bytes (the seed
+length); longer inputs make these functions return false.
+
+This relies on the Vale AES-NI kernels.
+
+@return DRBG state, or NULL if AES-NI/PCLMULQDQ/AVX/MOVBE are not available on
+  this machine or the Vale code was not compiled in. Needs to be freed via
+  `EverCrypt_DRBG_uninstantiate`.
+*/
+EverCrypt_DRBG_state_s *EverCrypt_DRBG_create_aes256_ctr(void)
+{
+  #if HACL_CAN_COMPILE_VALE
+  if (EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_AES_GCM] == EverCrypt_Dispatch_Vale)
+  {
+    uint8_t *ek = (uint8_t *)KRML_HOST_CALLOC(544U, sizeof (uint8_t));
+    uint8_t *v = (uint8_t *)KRML_HOST_CALLOC(16U, sizeof (uint8_t));
+    uint32_t *ctr = (uint32_t *)KRML_HOST_MALLOC(sizeof (uint32_t));
+    ctr[0U] = 1U;
+    EverCrypt_DRBG_state_s
+    *st = (EverCrypt_DRBG_state_s *)KRML_HOST_MALLOC(sizeof (EverCrypt_DRBG_state_s));
+    st[0U] =
+      (
+        (EverCrypt_DRBG_state_s){
+          .tag = AES256_CTR_s,
+          { .case_AES256_CTR_s = { .ek = ek, .v = v, .reseed_counter = ctr } }
+        }
+      );
+    return st;
+  }
+  #endif
+  return NULL;
+}
+
 static bool
 instantiate_sha1(
   EverCrypt_DRBG_state_s *st,
@@ -1851,6 +1950,423 @@ static void uninstantiate_sha2_512(EverCrypt_DRBG_state_s *st)
   KRML_HOST_FREE(st);
 }
 
+/* Writes `len` bytes of keystream for `key` (with an all-zero nonce), starting
+   at block `ctr`, into `out`. */
+static void chacha20_keystream(uint8_t *out, uint32_t len, uint8_t *key, uint32_t ctr)
+{
+  uint8_t nonce[12U] = { 0U };
+  memset(out, 0U, len * sizeof (uint8_t));
+  EverCrypt_Dispatch_impl impl = EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_CHACHA20];
+  #if HACL_CAN_COMPILE_VEC256
+  if (impl == EverCrypt_Dispatch_Vec256)
+  {
+    Hacl_Chacha20_Vec256_chacha20_encrypt_256(len, out, out, key, nonce, ctr);
+    return;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC128
+  if (impl == EverCrypt_Dispatch_Vec128)
+  {
+    Hacl_Chacha20_Vec128_chacha20_encrypt_128(len, out, out, key, nonce, ctr);
+    return;
+  }
+  #endif
+  KRML_MAYBE_UNUSED_VAR(impl);
+  Hacl_Chacha20_chacha20_encrypt(len, out, out, key, nonce, ctr);
+}
+
+/* key <- HMAC-SHA2-256(key, entropy || additional_input), discarding any buffered
+   output. With `use_entropy` unset, only the additional input is mixed in. */
+static void
+chacha20_rekey(
+  chacha20_state s,
+  bool use_entropy,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  uint32_t entropy_len = 0U;
+  if (use_entropy)
+  {
+    entropy_len = 32U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), entropy_len + additional_input_len + 1U);
+  uint8_t seed_material[entropy_len + additional_input_len + 1U];
+  memset(seed_material, 0U, (entropy_len + additional_input_len + 1U) * sizeof (uint8_t));
+  if (use_entropy)
+  {
+    Lib_RandomBuffer_System_crypto_random(seed_material, entropy_len);
+  }
+  memcpy(seed_material + entropy_len,
+    additional_input,
+    additional_input_len * sizeof (uint8_t));
+  uint8_t key[32U] = { 0U };
+  EverCrypt_HMAC_compute_sha2_256(key, s.key, 32U, seed_material, entropy_len + additional_input_len);
+  memcpy(s.key, key, 32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(seed_material, entropy_len + additional_input_len + 1U, uint8_t, void *);
+  Lib_Memzero0_memzero(s.buf, CHACHA20_BATCH_LEN, uint8_t, void *);
+  s.pos[0U] = CHACHA20_BATCH_LEN;
+}
+
+static bool
+instantiate_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  if (personalization_string_len > Hacl_HMAC_DRBG_max_personalization_string_length)
+  {
+    return false;
+  }
+  chacha20_state s = st->case_CHACHA20_s;
+  memset(s.key, 0U, 32U * sizeof (uint8_t));
+  s.reseed_counter[0U] = 1U;
+  chacha20_rekey(s, true, personalization_string, personalization_string_len);
+  return true;
+}
+
+static bool
+reseed_chacha20(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > Hacl_HMAC_DRBG_max_additional_input_length)
+  {
+    return false;
+  }
+  chacha20_state s = st->case_CHACHA20_s;
+  s.reseed_counter[0U] = 1U;
+  chacha20_rekey(s, true, additional_input, additional_input_len);
+  return true;
+}
+
+static bool
+generate_chacha20(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if
+  (
+    additional_input_len
+    > Hacl_HMAC_DRBG_max_additional_input_length
+    || n > Hacl_HMAC_DRBG_max_output_length
+  )
+  {
+    return false;
+  }
+  chacha20_state s = st->case_CHACHA20_s;
+  if (s.reseed_counter[0U] > Hacl_HMAC_DRBG_reseed_interval)
+  {
+    if (!reseed_chacha20(st, additional_input, additional_input_len))
+    {
+      return false;
+    }
+  }
+  else if (additional_input_len > 0U)
+  {
+    chacha20_rekey(s, false, additional_input, additional_input_len);
+  }
+  s.reseed_counter[0U] = s.reseed_counter[0U] + 1U;
+  if (n >= CHACHA20_BATCH_LEN)
+  {
+    /* Large requests bypass the buffer: block 0 of the keystream yields the
+       next key, and the output starts at block 1. */
+    uint8_t block0[64U] = { 0U };
+    chacha20_keystream(block0, 64U, s.key, 0U);
+    chacha20_keystream(output, n, s.key, 1U);
+    memcpy(s.key, block0, 32U * sizeof (uint8_t));
+    Lib_Memzero0_memzero(block0, 64U, uint8_t, void *);
+    Lib_Memzero0_memzero(s.buf, CHACHA20_BATCH_LEN, uint8_t, void *);
+    s.pos[0U] = CHACHA20_BATCH_LEN;
+    return true;
+  }
+  uint32_t pos = s.pos[0U];
+  while (n > 0U)
+  {
+    if (pos == CHACHA20_BATCH_LEN)
+    {
+      chacha20_keystream(s.buf, CHACHA20_BATCH_LEN, s.key, 0U);
+      memcpy(s.key, s.buf, 32U * sizeof (uint8_t));
+      Lib_Memzero0_memzero(s.buf, 32U, uint8_t, void *);
+      pos = 32U;
+    }
+    uint32_t len = CHACHA20_BATCH_LEN - pos;
+    if (len > n)
+    {
+      len = n;
+    }
+    memcpy(output, s.buf + pos, len * sizeof (uint8_t));
+    Lib_Memzero0_memzero(s.buf + pos, len, uint8_t, void *);
+    pos = pos + len;
+    output = output + len;
+    n = n - len;
+  }
+  s.pos[0U] = pos;
+  return true;
+}
+
+static void uninstantiate_chacha20(EverCrypt_DRBG_state_s *st)
+{
+  chacha20_state s = st->case_CHACHA20_s;
+  Lib_Memzero0_memzero(s.key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(s.buf, CHACHA20_BATCH_LEN, uint8_t, void *);
+  s.reseed_counter[0U] = 0U;
+  KRML_HOST_FREE(s.key);
+  KRML_HOST_FREE(s.buf);
+  KRML_HOST_FREE(s.pos);
+  KRML_HOST_FREE(s.reseed_counter);
+  KRML_HOST_FREE(st);
+}
+
+#if HACL_CAN_COMPILE_VALE
+
+/* Writes `nblocks` blocks of AES-256-CTR keystream into `out`, starting at
+   counter block v + 1, and advances v by `nblocks`. The counter is the
+   rightmost 32 bits of v (ctr_len = 32 in SP 800-90A), which is exactly the
+   inc32 of GCM: the keystream comes from the pipelined Vale AES-GCM kernel run
+   over zeros, with the (unused) tag discarded. */
+static void aes256_ctr_blocks(aes256_ctr_state s, uint8_t *out, uint32_t nblocks)
+{
+  uint8_t *keys_b = s.ek;
+  uint8_t *hkeys_b = s.ek + 240U;
+  uint8_t *scratch_b = s.ek + 368U;
+  uint8_t *abytes_b = scratch_b + 16U;
+  uint8_t *scratch_b1 = scratch_b + 32U;
+  uint8_t inout_b[16U] = { 0U };
+  uint8_t tag[16U] = { 0U };
+  /* Vale expects the counter block with its bytes reversed. */
+  uint8_t j0[16U] = { 0U };
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    j0[i] = s.v[15U - i];
+  }
+  memset(out, 0U, nblocks * 16U * sizeof (uint8_t));
+  uint64_t len128x6 = (uint64_t)nblocks / 6ULL * 6ULL;
+  if (len128x6 < 18ULL)
+  {
+    len128x6 = 0ULL;
+  }
+  uint8_t *out128_b = out + (uint32_t)len128x6 * 16U;
+  gcm256_encrypt_opt(abytes_b,
+    0ULL,
+    0ULL,
+    keys_b,
+    j0,
+    hkeys_b,
+    abytes_b,
+    out,
+    out,
+    len128x6,
+    out128_b,
+    out128_b,
+    (uint64_t)nblocks - len128x6,
+    inout_b,
+    (uint64_t)nblocks * 16ULL,
+    scratch_b1,
+    tag);
+  uint32_t c = load32_be(s.v + 12U) + nblocks;
+  store32_be(s.v + 12U, c);
+  Lib_Memzero0_memzero(tag, 16U, uint8_t, void *);
+}
+
+/* CTR_DRBG_Update. `provided_data` is `provided_data_len` <= 48 bytes, implicitly
+   padded with zeroes to the seed length. */
+static void
+aes256_ctr_update(aes256_ctr_state s, uint8_t *provided_data, uint32_t provided_data_len)
+{
+  uint8_t temp[48U] = { 0U };
+  aes256_ctr_blocks(s, temp, 3U);
+  for (uint32_t i = 0U; i < provided_data_len; i++)
+  {
+    temp[i] = (uint32_t)temp[i] ^ (uint32_t)provided_data[i];
+  }
+  aes256_key_expansion(temp, s.ek);
+  aes256_keyhash_init(s.ek, s.ek + 240U);
+  memcpy(s.v, temp + 32U, 16U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(temp, 48U, uint8_t, void *);
+}
+
+/* Reseed, or instantiate from K = 0, V = 0 if `reset` is set: the seed material
+   is the 48 bytes of `entropy_input` xor'd with `input`. */
+static bool
+aes256_ctr_seed_with(
+  aes256_ctr_state s,
+  bool reset,
+  uint8_t *entropy_input,
+  uint8_t *input,
+  uint32_t input_len
+)
+{
+  if (input_len > 48U)
+  {
+    return false;
+  }
+  uint8_t seed_material[48U] = { 0U };
+  memcpy(seed_material, entropy_input, 48U * sizeof (uint8_t));
+  for (uint32_t i = 0U; i < input_len; i++)
+  {
+    seed_material[i] = (uint32_t)seed_material[i] ^ (uint32_t)input[i];
+  }
+  if (reset)
+  {
+    uint8_t zero_key[32U] = { 0U };
+    aes256_key_expansion(zero_key, s.ek);
+    aes256_keyhash_init(s.ek, s.ek + 240U);
+    memset(s.v, 0U, 16U * sizeof (uint8_t));
+  }
+  aes256_ctr_update(s, seed_material, 48U);
+  Lib_Memzero0_memzero(seed_material, 48U, uint8_t, void *);
+  s.reseed_counter[0U] = 1U;
+  return true;
+}
+
+/* As above, with 48 bytes of full entropy from the system. */
+static bool
+aes256_ctr_seed(aes256_ctr_state s, bool reset, uint8_t *input, uint32_t input_len)
+{
+  uint8_t entropy_input[48U] = { 0U };
+  Lib_RandomBuffer_System_crypto_random(entropy_input, 48U);
+  bool r = aes256_ctr_seed_with(s, reset, entropy_input, input, input_len);
+  Lib_Memzero0_memzero(entropy_input, 48U, uint8_t, void *);
+  return r;
+}
+
+static bool
+instantiate_aes256_ctr(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  aes256_ctr_state s = st->case_AES256_CTR_s;
+  return aes256_ctr_seed(s, true, personalization_string, personalization_string_len);
+}
+
+static bool
+reseed_aes256_ctr(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  aes256_ctr_state s = st->case_AES256_CTR_s;
+  return aes256_ctr_seed(s, false, additional_input, additional_input_len);
+}
+
+static bool
+generate_aes256_ctr(
+  uint8_t *output,
+  EverCrypt_DRBG_state_s *st,
+  uint32_t n,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  if (additional_input_len > 48U || n > Hacl_HMAC_DRBG_max_output_length)
+  {
+    return false;
+  }
+  aes256_ctr_state s = st->case_AES256_CTR_s;
+  if (s.reseed_counter[0U] > Hacl_HMAC_DRBG_reseed_interval)
+  {
+    if (!aes256_ctr_seed(s, false, additional_input, additional_input_len))
+    {
+      return false;
+    }
+    additional_input_len = 0U;
+  }
+  else if (additional_input_len > 0U)
+  {
+    aes256_ctr_update(s, additional_input, additional_input_len);
+  }
+  uint32_t nblocks = n / 16U;
+  aes256_ctr_blocks(s, output, nblocks);
+  if (n % 16U != 0U)
+  {
+    uint8_t last[16U] = { 0U };
+    aes256_ctr_blocks(s, last, 1U);
+    memcpy(output + nblocks * 16U, last, n % 16U * sizeof (uint8_t));
+    Lib_Memzero0_memzero(last, 16U, uint8_t, void *);
+  }
+  aes256_ctr_update(s, additional_input, additional_input_len);
+  s.reseed_counter[0U] = s.reseed_counter[0U] + 1U;
+  return true;
+}
+
+static void uninstantiate_aes256_ctr(EverCrypt_DRBG_state_s *st)
+{
+  aes256_ctr_state s = st->case_AES256_CTR_s;
+  Lib_Memzero0_memzero(s.ek, 544U, uint8_t, void *);
+  Lib_Memzero0_memzero(s.v, 16U, uint8_t, void *);
+  s.reseed_counter[0U] = 0U;
+  KRML_HOST_FREE(s.ek);
+  KRML_HOST_FREE(s.v);
+  KRML_HOST_FREE(s.reseed_counter);
+  KRML_HOST_FREE(st);
+}
+
+#endif
+
+bool
+EverCrypt_DRBG_instantiate_aes256_ctr_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *personalization_string,
+  uint32_t personalization_string_len
+)
+{
+  KRML_MAYBE_UNUSED_VAR(st);
+  KRML_MAYBE_UNUSED_VAR(entropy_input);
+  KRML_MAYBE_UNUSED_VAR(personalization_string);
+  KRML_MAYBE_UNUSED_VAR(personalization_string_len);
+  #if HACL_CAN_COMPILE_VALE
+  if (st->tag == AES256_CTR_s)
+  {
+    return
+      aes256_ctr_seed_with(st->case_AES256_CTR_s,
+        true,
+        entropy_input,
+        personalization_string,
+        personalization_string_len);
+  }
+  #endif
+  return false;
+}
+
+bool
+EverCrypt_DRBG_reseed_aes256_ctr_with_entropy(
+  EverCrypt_DRBG_state_s *st,
+  uint8_t *entropy_input,
+  uint8_t *additional_input,
+  uint32_t additional_input_len
+)
+{
+  KRML_MAYBE_UNUSED_VAR(st);
+  KRML_MAYBE_UNUSED_VAR(entropy_input);
+  KRML_MAYBE_UNUSED_VAR(additional_input);
+  KRML_MAYBE_UNUSED_VAR(additional_input_len);
+  #if HACL_CAN_COMPILE_VALE
+  if (st->tag == AES256_CTR_s)
+  {
+    return
+      aes256_ctr_seed_with(st->case_AES256_CTR_s,
+        false,
+        entropy_input,
+        additional_input,
+        additional_input_len);
+  }
+  #endif
+  return false;
+}
+
 /**
 Instantiate the DRBG.
 
@@ -1884,6 +2400,16 @@ EverCrypt_DRBG_instantiate(
   {
     return instantiate_sha2_512(st, personalization_string, personalization_string_len);
   }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return instantiate_chacha20(st, personalization_string, personalization_string_len);
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (scrut.tag == AES256_CTR_s)
+  {
+    return instantiate_aes256_ctr(st, personalization_string, personalization_string_len);
+  }
+  #endif
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -1924,6 +2450,16 @@ EverCrypt_DRBG_reseed(
   {
     return reseed_sha2_512(st, additional_input, additional_input_len);
   }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return reseed_chacha20(st, additional_input, additional_input_len);
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (scrut.tag == AES256_CTR_s)
+  {
+    return reseed_aes256_ctr(st, additional_input, additional_input_len);
+  }
+  #endif
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -1968,6 +2504,16 @@ EverCrypt_DRBG_generate(
   {
     return generate_sha2_512(output, st, n, additional_input, additional_input_len);
   }
+  if (scrut.tag == CHACHA20_s)
+  {
+    return generate_chacha20(output, st, n, additional_input, additional_input_len);
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (scrut.tag == AES256_CTR_s)
+  {
+    return generate_aes256_ctr(output, st, n, additional_input, additional_input_len);
+  }
+  #endif
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
@@ -2003,6 +2549,18 @@ void EverCrypt_DRBG_uninstantiate(EverCrypt_DRBG_state_s *st)
     uninstantiate_sha2_512(st);
     return;
   }
+  if (scrut.tag == CHACHA20_s)
+  {
+    uninstantiate_chacha20(st);
+    return;
+  }
+  #if HACL_CAN_COMPILE_VALE
+  if (scrut.tag == AES256_CTR_s)
+  {
+    uninstantiate_aes256_ctr(st);
+    return;
+  }
+  #endif
   KRML_HOST_EPRINTF("KaRaMeL abort at %s:%d\n%s\n",
     __FILE__,
     __LINE__,
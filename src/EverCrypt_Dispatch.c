@@ -0,0 +1,445 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* This is a hand-written file. */
+
+#include "internal/EverCrypt_Dispatch.h"
+
+#include "internal/Hacl_Hash_SHA2.h"
+#include "Hacl_AEAD_Chacha20Poly1305.h"
+#include "Hacl_AEAD_Chacha20Poly1305_Simd128.h"
+#include "Hacl_AEAD_Chacha20Poly1305_Simd256.h"
+#include "Hacl_MAC_Poly1305.h"
+#include "Hacl_MAC_Poly1305_Simd128.h"
+#include "Hacl_MAC_Poly1305_Simd256.h"
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_Curve25519_64.h"
+#include "EverCrypt_AutoConfig2.h"
+#include "config.h"
+#if HACL_CAN_COMPILE_AVX512IFMA
+#include "Hacl_Bignum4096_IFMA.h"
+#endif
+#if HACL_CAN_COMPILE_VEC256
+#include "internal/Hacl_Frodo_KEM_Simd256.h"
+#include "internal/Hacl_MLKEM_Simd256.h"
+#include "Hacl_Salsa20_Vec256.h"
+#endif
+#if HACL_CAN_COMPILE_VEC128
+#include "Hacl_Salsa20_Vec128.h"
+#endif
+
+#if (defined(_WIN32) || defined(_WIN64))
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+/* The slots are written one by one with atomic stores, so that a call running
+   while EverCrypt_Dispatch_refresh replaces them gets either the old or the new
+   implementation of each slot. Aligned pointer and byte stores are atomic on the
+   targets of MSVC. */
+#if defined(__GNUC__)
+#define STORE_SLOT(dst, v) __atomic_store_n(&(dst), (v), __ATOMIC_RELEASE)
+#else
+#define STORE_SLOT(dst, v) ((dst) = (v))
+#endif
+
+static void sha2_256_update_multi_portable(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  Hacl_Hash_SHA2_sha256_update_nblocks(n * 64U, blocks, s);
+}
+
+#if HACL_CAN_COMPILE_AVX512IFMA
+/* The IFMA engine only handles up to 64 limbs. */
+static void
+mod_exp_consttime_precomp_ifma(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  if (len <= 64U)
+  {
+    Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp(len, n, mu, r2, a, bBits, b, res);
+    return;
+  }
+  Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(len, n, mu, r2, a, bBits, b, res);
+}
+#endif
+
+/* Salsa20 inputs shorter than one vector chunk stay on the scalar code. */
+
+#if HACL_CAN_COMPILE_VEC128
+static void
+salsa20_xor_vec128(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  if (len >= 256U)
+  {
+    Hacl_Salsa20_Vec128_salsa20_encrypt_128(len, out, text, key, n, ctr);
+    return;
+  }
+  Hacl_Salsa20_salsa20_encrypt(len, out, text, key, n, ctr);
+}
+
+static const
+Hacl_Impl_NaCl_Kernels
+nacl_kernels_vec128 =
+  { .salsa20_xor = salsa20_xor_vec128, .poly1305_mac = Hacl_MAC_Poly1305_Simd128_mac };
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+static void
+salsa20_xor_vec256(
+  uint32_t len,
+  uint8_t *out,
+  uint8_t *text,
+  uint8_t *key,
+  uint8_t *n,
+  uint32_t ctr
+)
+{
+  if (len >= 512U)
+  {
+    Hacl_Salsa20_Vec256_salsa20_encrypt_256(len, out, text, key, n, ctr);
+    return;
+  }
+  #if HACL_CAN_COMPILE_VEC128
+  salsa20_xor_vec128(len, out, text, key, n, ctr);
+  #else
+  Hacl_Salsa20_salsa20_encrypt(len, out, text, key, n, ctr);
+  #endif
+}
+
+static const
+Hacl_Impl_NaCl_Kernels
+nacl_kernels_vec256 =
+  { .salsa20_xor = salsa20_xor_vec256, .poly1305_mac = Hacl_MAC_Poly1305_Simd256_mac };
+#endif
+
+/* The FrodoKEM kernels are picked one by one, so they are assembled here. */
+static Hacl_Impl_Frodo_Kernels frodo_kernels;
+
+#if HACL_CAN_COMPILE_VEC256
+static const
+Hacl_Impl_MLKEM_Kernels
+mlkem_kernels_vec256 =
+  {
+    .ntt = Hacl_Impl_MLKEM_Simd256_ntt,
+    .invntt = Hacl_Impl_MLKEM_Simd256_invntt,
+    .basemul_acc = Hacl_Impl_MLKEM_Simd256_basemul_acc,
+    .sample_noise = Hacl_Impl_MLKEM_Vec256_sample_noise,
+    .sample_polys = Hacl_Impl_MLKEM_Vec256_sample_polys
+  };
+#endif
+
+static const
+EverCrypt_Dispatch_table
+portable =
+  {
+    .chacha20poly1305_encrypt = Hacl_AEAD_Chacha20Poly1305_encrypt,
+    .chacha20poly1305_decrypt = Hacl_AEAD_Chacha20Poly1305_decrypt,
+    .poly1305_mac = Hacl_MAC_Poly1305_mac,
+    .curve25519_secret_to_public = Hacl_Curve25519_51_secret_to_public,
+    .curve25519_scalarmult = Hacl_Curve25519_51_scalarmult,
+    .curve25519_ecdh = Hacl_Curve25519_51_ecdh,
+    .sha2_256_update_multi = sha2_256_update_multi_portable,
+    .bignum_kernels = &Hacl_Bignum_Kernels_portable_u64,
+    .mod_exp_consttime_precomp = Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64,
+    .frodo_kernels = &Hacl_Impl_Frodo_Kernels_portable,
+    .mlkem_kernels = &Hacl_Impl_MLKEM_Kernels_portable,
+    .nacl_kernels = &Hacl_Impl_NaCl_Kernels_portable,
+    /* EverCrypt_Dispatch_Portable is 0, so every slot starts portable. */
+    .impl = { EverCrypt_Dispatch_Portable }
+  };
+
+EverCrypt_Dispatch_table
+EverCrypt_Dispatch_functions =
+  {
+    .chacha20poly1305_encrypt = Hacl_AEAD_Chacha20Poly1305_encrypt,
+    .chacha20poly1305_decrypt = Hacl_AEAD_Chacha20Poly1305_decrypt,
+    .poly1305_mac = Hacl_MAC_Poly1305_mac,
+    .curve25519_secret_to_public = Hacl_Curve25519_51_secret_to_public,
+    .curve25519_scalarmult = Hacl_Curve25519_51_scalarmult,
+    .curve25519_ecdh = Hacl_Curve25519_51_ecdh,
+    .sha2_256_update_multi = sha2_256_update_multi_portable,
+    .bignum_kernels = &Hacl_Bignum_Kernels_portable_u64,
+    .mod_exp_consttime_precomp = Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64,
+    .frodo_kernels = &Hacl_Impl_Frodo_Kernels_portable,
+    .mlkem_kernels = &Hacl_Impl_MLKEM_Kernels_portable,
+    .nacl_kernels = &Hacl_Impl_NaCl_Kernels_portable,
+    .impl = { EverCrypt_Dispatch_Portable }
+  };
+
+static void publish(EverCrypt_Dispatch_table *t)
+{
+  EverCrypt_Dispatch_table *d = &EverCrypt_Dispatch_functions;
+  STORE_SLOT(d->chacha20poly1305_encrypt, t->chacha20poly1305_encrypt);
+  STORE_SLOT(d->chacha20poly1305_decrypt, t->chacha20poly1305_decrypt);
+  STORE_SLOT(d->poly1305_mac, t->poly1305_mac);
+  STORE_SLOT(d->curve25519_secret_to_public, t->curve25519_secret_to_public);
+  STORE_SLOT(d->curve25519_scalarmult, t->curve25519_scalarmult);
+  STORE_SLOT(d->curve25519_ecdh, t->curve25519_ecdh);
+  STORE_SLOT(d->sha2_256_update_multi, t->sha2_256_update_multi);
+  STORE_SLOT(d->bignum_kernels, t->bignum_kernels);
+  STORE_SLOT(d->mod_exp_consttime_precomp, t->mod_exp_consttime_precomp);
+  STORE_SLOT(d->frodo_kernels, t->frodo_kernels);
+  STORE_SLOT(d->mlkem_kernels, t->mlkem_kernels);
+  STORE_SLOT(d->nacl_kernels, t->nacl_kernels);
+  for (uint32_t i = 0U; i < EverCrypt_Dispatch_COUNT; i++)
+  {
+    STORE_SLOT(d->impl[i], t->impl[i]);
+  }
+  Hacl_Bignum_Kernels_set_u64(t->bignum_kernels);
+  Hacl_Impl_Frodo_Kernels_set(t->frodo_kernels);
+  Hacl_Impl_MLKEM_Kernels_set(t->mlkem_kernels);
+}
+
+void EverCrypt_Dispatch_refresh(void)
+{
+  EverCrypt_Dispatch_table t = portable;
+  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
+  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
+  KRML_MAYBE_UNUSED_VAR(vec256);
+  KRML_MAYBE_UNUSED_VAR(vec128);
+  #if HACL_CAN_COMPILE_VALE
+  /* Vale's Poly1305 is only used when no vectorized one is available; the
+     vector checks below take precedence. */
+  t.poly1305_mac = EverCrypt_Poly1305_mac_vale;
+  t.impl[EverCrypt_Dispatch_POLY1305] = EverCrypt_Dispatch_Vale;
+  if (EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx())
+  {
+    t.curve25519_secret_to_public = Hacl_Curve25519_64_secret_to_public;
+    t.curve25519_scalarmult = Hacl_Curve25519_64_scalarmult;
+    t.curve25519_ecdh = Hacl_Curve25519_64_ecdh;
+    t.impl[EverCrypt_Dispatch_CURVE25519] = EverCrypt_Dispatch_Vale;
+  }
+  if (EverCrypt_AutoConfig2_has_shaext() && EverCrypt_AutoConfig2_has_sse())
+  {
+    t.sha2_256_update_multi = EverCrypt_Hash_update_multi_256_vale;
+    t.impl[EverCrypt_Dispatch_SHA2_256] = EverCrypt_Dispatch_Vale;
+  }
+  if
+  (
+    EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_pclmulqdq()
+    && EverCrypt_AutoConfig2_has_avx()
+    && EverCrypt_AutoConfig2_has_sse()
+    && EverCrypt_AutoConfig2_has_movbe()
+  )
+  {
+    t.impl[EverCrypt_Dispatch_AES_GCM] = EverCrypt_Dispatch_Vale;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  if (EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx())
+  {
+    t.bignum_kernels = &Hacl_Bignum_Kernels_adx_u64;
+    t.impl[EverCrypt_Dispatch_BIGNUM] = EverCrypt_Dispatch_Adx;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_AVX512IFMA
+  if (EverCrypt_AutoConfig2_has_avx512ifma())
+  {
+    t.mod_exp_consttime_precomp = mod_exp_consttime_precomp_ifma;
+    t.impl[EverCrypt_Dispatch_MOD_EXP] = EverCrypt_Dispatch_Avx512ifma;
+  }
+  #endif
+  Hacl_Impl_Frodo_Kernels frodo = Hacl_Impl_Frodo_Kernels_portable;
+  #if HACL_CAN_COMPILE_VALE
+  if
+  (
+    EverCrypt_AutoConfig2_has_aesni() && EverCrypt_AutoConfig2_has_avx()
+    && EverCrypt_AutoConfig2_has_sse()
+  )
+  {
+    frodo.aes128_key_expansion = Hacl_Impl_Frodo_Aesni_aes128_key_expansion;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_INLINE_ASM
+  if (EverCrypt_AutoConfig2_has_aesni())
+  {
+    frodo.aes128_encrypt_blocks = Hacl_Impl_Frodo_Aesni_aes128_encrypt_blocks;
+    t.impl[EverCrypt_Dispatch_FRODO_AES] = EverCrypt_Dispatch_Aesni;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_avx2())
+  {
+    frodo.shake128_4x = Hacl_Impl_Frodo_Simd256_shake128_4x;
+    frodo.matrix_mul_rows_s = Hacl_Impl_Frodo_Simd256_matrix_mul_rows_s;
+    frodo.matrix_mul_add_rows = Hacl_Impl_Frodo_Simd256_matrix_mul_add_rows;
+    t.impl[EverCrypt_Dispatch_FRODO] = EverCrypt_Dispatch_Vec256;
+    t.mlkem_kernels = &mlkem_kernels_vec256;
+    t.impl[EverCrypt_Dispatch_MLKEM] = EverCrypt_Dispatch_Vec256;
+  }
+  #endif
+  STORE_SLOT(frodo_kernels.shake128_4x, frodo.shake128_4x);
+  STORE_SLOT(frodo_kernels.matrix_mul_rows_s, frodo.matrix_mul_rows_s);
+  STORE_SLOT(frodo_kernels.matrix_mul_add_rows, frodo.matrix_mul_add_rows);
+  STORE_SLOT(frodo_kernels.aes128_key_expansion, frodo.aes128_key_expansion);
+  STORE_SLOT(frodo_kernels.aes128_encrypt_blocks, frodo.aes128_encrypt_blocks);
+  t.frodo_kernels = &frodo_kernels;
+  #if HACL_CAN_COMPILE_VEC128
+  if (vec128)
+  {
+    t.chacha20poly1305_encrypt = Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt;
+    t.chacha20poly1305_decrypt = Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt;
+    t.impl[EverCrypt_Dispatch_CHACHA20_POLY1305] = EverCrypt_Dispatch_Vec128;
+    t.poly1305_mac = Hacl_MAC_Poly1305_Simd128_mac;
+    t.impl[EverCrypt_Dispatch_POLY1305] = EverCrypt_Dispatch_Vec128;
+    t.nacl_kernels = &nacl_kernels_vec128;
+    t.impl[EverCrypt_Dispatch_NACL] = EverCrypt_Dispatch_Vec128;
+    t.impl[EverCrypt_Dispatch_HPKE] = EverCrypt_Dispatch_Vec128;
+    t.impl[EverCrypt_Dispatch_CHACHA20] = EverCrypt_Dispatch_Vec128;
+  }
+  #endif
+  #if HACL_CAN_COMPILE_VEC256
+  if (vec256)
+  {
+    t.chacha20poly1305_encrypt = Hacl_AEAD_Chacha20Poly1305_Simd256_encrypt;
+    t.chacha20poly1305_decrypt = Hacl_AEAD_Chacha20Poly1305_Simd256_decrypt;
+    t.impl[EverCrypt_Dispatch_CHACHA20_POLY1305] = EverCrypt_Dispatch_Vec256;
+    t.poly1305_mac = Hacl_MAC_Poly1305_Simd256_mac;
+    t.impl[EverCrypt_Dispatch_POLY1305] = EverCrypt_Dispatch_Vec256;
+    t.nacl_kernels = &nacl_kernels_vec256;
+    t.impl[EverCrypt_Dispatch_NACL] = EverCrypt_Dispatch_Vec256;
+    t.impl[EverCrypt_Dispatch_HPKE] = EverCrypt_Dispatch_Vec256;
+    t.impl[EverCrypt_Dispatch_CHACHA20] = EverCrypt_Dispatch_Vec256;
+    t.impl[EverCrypt_Dispatch_SHA2_256_MB] = EverCrypt_Dispatch_Vec256;
+  }
+  #endif
+  publish(&t);
+}
+
+/* The first resolution also detects the CPU features. Later ones, from
+   EverCrypt_Dispatch_refresh, use the features as they are then. */
+#if (defined(_WIN32) || defined(_WIN64))
+static INIT_ONCE dispatch_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK resolve_once(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+  KRML_MAYBE_UNUSED_VAR(once);
+  KRML_MAYBE_UNUSED_VAR(param);
+  KRML_MAYBE_UNUSED_VAR(ctx);
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  return TRUE;
+}
+
+void EverCrypt_Dispatch_init(void)
+{
+  InitOnceExecuteOnce(&dispatch_once, resolve_once, NULL, NULL);
+}
+#else
+static pthread_once_t dispatch_once = PTHREAD_ONCE_INIT;
+
+static void resolve_once(void)
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+void EverCrypt_Dispatch_init(void)
+{
+  pthread_once(&dispatch_once, resolve_once);
+}
+#endif
+
+EverCrypt_Dispatch_impl EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_primitive p)
+{
+  if (p < EverCrypt_Dispatch_COUNT)
+  {
+    return EverCrypt_Dispatch_functions.impl[p];
+  }
+  return EverCrypt_Dispatch_Portable;
+}
+
+const char *EverCrypt_Dispatch_impl_name(EverCrypt_Dispatch_impl i)
+{
+  switch (i)
+  {
+    case EverCrypt_Dispatch_Portable:
+      {
+        return "portable";
+      }
+    case EverCrypt_Dispatch_Vec128:
+      {
+        return "vec128";
+      }
+    case EverCrypt_Dispatch_Vec256:
+      {
+        return "vec256";
+      }
+    case EverCrypt_Dispatch_Vale:
+      {
+        return "vale";
+      }
+    case EverCrypt_Dispatch_Adx:
+      {
+        return "adx";
+      }
+    case EverCrypt_Dispatch_Avx512ifma:
+      {
+        return "avx512ifma";
+      }
+    case EverCrypt_Dispatch_Aesni:
+      {
+        return "aesni";
+      }
+    default:
+      {
+        return "unknown";
+      }
+  }
+}
+
+/* Fill the table when the library is loaded, so that callers get the best
+   implementations without calling EverCrypt_Dispatch_init. Elsewhere, the table
+   keeps the portable implementations until then. */
+#if defined(__GNUC__)
+__attribute__((constructor)) static void dispatch_load(void)
+{
+  EverCrypt_Dispatch_init();
+}
+#elif defined(_MSC_VER)
+static void __cdecl dispatch_load(void)
+{
+  EverCrypt_Dispatch_init();
+}
+
+#pragma section(".CRT$XCU", read)
+__declspec(allocate(".CRT$XCU")) void (__cdecl *EverCrypt_Dispatch_load)(void) = dispatch_load;
+#endif
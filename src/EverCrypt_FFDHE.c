@@ -0,0 +1,65 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/* This is a hand-written file. */
+
+#include "EverCrypt_FFDHE.h"
+
+#include "internal/Hacl_FFDHE.h"
+#include "internal/EverCrypt_Dispatch.h"
+
+void
+EverCrypt_FFDHE_ffdhe_secret_to_public_precomp(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk
+)
+{
+  /* The fixed-base comb of Hacl_FFDHE is faster than the generic portable
+     exponentiation, but not than the IFMA one. */
+  EverCrypt_Dispatch_impl i = EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_MOD_EXP];
+  if (i == EverCrypt_Dispatch_Avx512ifma && Hacl_FFDHE_ffdhe_len(a) <= 512U)
+  {
+    Hacl_FFDHE_mod_exp exp = EverCrypt_Dispatch_functions.mod_exp_consttime_precomp;
+    Hacl_FFDHE_ffdhe_secret_to_public_precomp_exp(exp, a, p_r2_n, sk, pk);
+    return;
+  }
+  Hacl_FFDHE_ffdhe_secret_to_public_precomp(a, p_r2_n, sk, pk);
+}
+
+uint64_t
+EverCrypt_FFDHE_ffdhe_shared_secret_precomp(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk,
+  uint8_t *ss
+)
+{
+  Hacl_FFDHE_mod_exp exp = EverCrypt_Dispatch_functions.mod_exp_consttime_precomp;
+  return Hacl_FFDHE_ffdhe_shared_secret_precomp_exp(exp, a, p_r2_n, sk, pk, ss);
+}
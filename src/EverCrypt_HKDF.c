@@ -26,6 +26,11 @@
 #include "EverCrypt_HKDF.h"
 
 #include "internal/EverCrypt_HMAC.h"
+#include "Hacl_Hash_Base.h"
+#include "Hacl_SHA2_Vec256.h"
+#include "internal/EverCrypt_Dispatch.h"
+#include "lib_memzero0.h"
+#include "config.h"
 
 static void
 expand_sha1(
@@ -486,3 +491,288 @@ EverCrypt_HKDF_extract(
   }
 }
 
+
+EverCrypt_HKDF_context_t
+*EverCrypt_HKDF_malloc_context(Spec_Hash_Definitions_hash_alg a, uint8_t *prk, uint32_t prklen)
+{
+  EverCrypt_HMAC_key_t *key = EverCrypt_HMAC_malloc_key(a, prk, prklen);
+  if (key == NULL)
+  {
+    return NULL;
+  }
+  uint32_t *sha256_inner = NULL;
+  uint32_t *sha256_outer = NULL;
+  if (a == Spec_Hash_Definitions_SHA2_256)
+  {
+    /* The key only retains key ^ ipad; key ^ opad is recovered from it. */
+    uint8_t opad[64U] = { 0U };
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+      opad[i] = (uint32_t)key->ipad[i] ^ 0x6aU;
+    }
+    sha256_inner = (uint32_t *)KRML_HOST_CALLOC(8U, sizeof (uint32_t));
+    sha256_outer = (uint32_t *)KRML_HOST_CALLOC(8U, sizeof (uint32_t));
+    Hacl_Hash_SHA2_sha256_init(sha256_inner);
+    Hacl_Hash_SHA2_sha256_update_nblocks(64U, key->ipad, sha256_inner);
+    Hacl_Hash_SHA2_sha256_init(sha256_outer);
+    Hacl_Hash_SHA2_sha256_update_nblocks(64U, opad, sha256_outer);
+    Lib_Memzero0_memzero(opad, 64U, uint8_t, void *);
+  }
+  EverCrypt_HKDF_context_t
+  *ctx = (EverCrypt_HKDF_context_t *)KRML_HOST_MALLOC(sizeof (EverCrypt_HKDF_context_t));
+  ctx[0U] =
+    (
+      (EverCrypt_HKDF_context_t){
+        .key = key,
+        .sha256_inner = sha256_inner,
+        .sha256_outer = sha256_outer
+      }
+    );
+  return ctx;
+}
+
+void EverCrypt_HKDF_free_context(EverCrypt_HKDF_context_t *ctx)
+{
+  if (ctx->sha256_inner != NULL)
+  {
+    Lib_Memzero0_memzero(ctx->sha256_inner, 8U, uint32_t, void *);
+    Lib_Memzero0_memzero(ctx->sha256_outer, 8U, uint32_t, void *);
+    KRML_HOST_FREE(ctx->sha256_inner);
+    KRML_HOST_FREE(ctx->sha256_outer);
+  }
+  EverCrypt_HMAC_free_key(ctx->key);
+  KRML_HOST_FREE(ctx);
+}
+
+void
+EverCrypt_HKDF_expand_with_context(
+  EverCrypt_HKDF_context_t *ctx,
+  uint8_t *okm,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  EverCrypt_HMAC_key_t *key = ctx->key;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(key->inner);
+  uint32_t tlen = Hacl_Hash_Definitions_hash_len(a);
+  /* The context may be shared between threads, so the working state is per call. */
+  EverCrypt_Hash_state_s *scratch = EverCrypt_Hash_create_in(a);
+  uint32_t n = len / tlen;
+  uint8_t *output = okm;
+  KRML_CHECK_SIZE(sizeof (uint8_t), tlen + infolen + 1U);
+  uint8_t text[tlen + infolen + 1U];
+  memset(text, 0U, (tlen + infolen + 1U) * sizeof (uint8_t));
+  uint8_t *text0 = text + tlen;
+  uint8_t *tag = text;
+  uint8_t *ctr = text + tlen + infolen;
+  memcpy(text + tlen, info, infolen * sizeof (uint8_t));
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    ctr[0U] = (uint8_t)(i + 1U);
+    if (i == 0U)
+    {
+      EverCrypt_HMAC_compute_with_key_in(key, scratch, tag, text0, infolen + 1U);
+    }
+    else
+    {
+      EverCrypt_HMAC_compute_with_key_in(key, scratch, tag, text, tlen + infolen + 1U);
+    }
+    memcpy(output + i * tlen, tag, tlen * sizeof (uint8_t));
+  }
+  if (n * tlen < len)
+  {
+    ctr[0U] = (uint8_t)(n + 1U);
+    if (n == 0U)
+    {
+      EverCrypt_HMAC_compute_with_key_in(key, scratch, tag, text0, infolen + 1U);
+    }
+    else
+    {
+      EverCrypt_HMAC_compute_with_key_in(key, scratch, tag, text, tlen + infolen + 1U);
+    }
+    uint8_t *block = okm + n * tlen;
+    memcpy(block, tag, (len - n * tlen) * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(tag, tlen, uint8_t, void *);
+  EverCrypt_Hash_init(scratch);
+  EverCrypt_Hash_free(scratch);
+}
+
+/* The largest HkdfLabel: 2 + 1 + 255 + 1 + 255 bytes. */
+#define MAX_LABEL_INFO_LEN (514U)
+
+static uint32_t
+encode_label(
+  uint8_t *dst,
+  uint8_t *label,
+  uint32_t label_len,
+  uint8_t *context,
+  uint32_t context_len,
+  uint32_t len
+)
+{
+  dst[0U] = (uint8_t)(len >> 8U);
+  dst[1U] = (uint8_t)len;
+  dst[2U] = (uint8_t)(6U + label_len);
+  memcpy(dst + 3U, "tls13 ", 6U * sizeof (uint8_t));
+  memcpy(dst + 9U, label, label_len * sizeof (uint8_t));
+  dst[9U + label_len] = (uint8_t)context_len;
+  memcpy(dst + 10U + label_len, context, context_len * sizeof (uint8_t));
+  return 10U + label_len + context_len;
+}
+
+void
+EverCrypt_HKDF_expand_label(
+  EverCrypt_HKDF_context_t *ctx,
+  uint8_t *okm,
+  uint8_t *label,
+  uint32_t label_len,
+  uint8_t *context,
+  uint32_t context_len,
+  uint32_t len
+)
+{
+  uint8_t info[MAX_LABEL_INFO_LEN] = { 0U };
+  uint32_t infolen = encode_label(info, label, label_len, context, context_len, len);
+  EverCrypt_HKDF_expand_with_context(ctx, okm, info, infolen, len);
+}
+
+#if HACL_CAN_COMPILE_VEC256
+
+/* Computes T(1) for up to eight derivations whose HkdfLabel || 0x01 messages
+   all have length `msg_len`; unused lanes recompute lane 0. */
+static void
+expand_label_sha256_8(
+  EverCrypt_HKDF_context_t *ctx,
+  uint8_t **msgs,
+  uint32_t msg_len,
+  uint8_t *tags
+)
+{
+  uint8_t inner[256U] = { 0U };
+  Hacl_SHA2_Vec256_sha256_8_with_state(ctx->sha256_inner,
+    64ULL,
+    inner,
+    inner + 32U,
+    inner + 64U,
+    inner + 96U,
+    inner + 128U,
+    inner + 160U,
+    inner + 192U,
+    inner + 224U,
+    msg_len,
+    msgs[0U],
+    msgs[1U],
+    msgs[2U],
+    msgs[3U],
+    msgs[4U],
+    msgs[5U],
+    msgs[6U],
+    msgs[7U]);
+  Hacl_SHA2_Vec256_sha256_8_with_state(ctx->sha256_outer,
+    64ULL,
+    tags,
+    tags + 32U,
+    tags + 64U,
+    tags + 96U,
+    tags + 128U,
+    tags + 160U,
+    tags + 192U,
+    tags + 224U,
+    32U,
+    inner,
+    inner + 32U,
+    inner + 64U,
+    inner + 96U,
+    inner + 128U,
+    inner + 160U,
+    inner + 192U,
+    inner + 224U);
+  Lib_Memzero0_memzero(inner, 256U, uint8_t, void *);
+}
+
+#endif
+
+void
+EverCrypt_HKDF_expand_label_batch(
+  EverCrypt_HKDF_context_t *ctx,
+  EverCrypt_HKDF_label_t *labels,
+  uint32_t n
+)
+{
+  if (n == 0U)
+  {
+    return;
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), n);
+  uint8_t done[n];
+  memset(done, 0U, n * sizeof (uint8_t));
+  #if HACL_CAN_COMPILE_VEC256
+  EverCrypt_Dispatch_impl mb = EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_SHA2_256_MB];
+  if (ctx->sha256_inner != NULL && mb == EverCrypt_Dispatch_Vec256)
+  {
+    uint8_t msg_buf[8U * (MAX_LABEL_INFO_LEN + 1U)] = { 0U };
+    uint8_t tags[256U] = { 0U };
+    for (uint32_t i = 0U; i < n; i++)
+    {
+      EverCrypt_HKDF_label_t li = labels[i];
+      if (done[i] || li.len > 32U)
+      {
+        continue;
+      }
+      uint32_t lanes[8U] = { 0U };
+      uint8_t *msgs[8U] = { 0U };
+      uint32_t count = 1U;
+      uint32_t info_len =
+        encode_label(msg_buf, li.label, li.label_len, li.context, li.context_len, li.len);
+      msg_buf[info_len] = 1U;
+      lanes[0U] = i;
+      msgs[0U] = msg_buf;
+      for (uint32_t j = i + 1U; j < n && count < 8U; j++)
+      {
+        EverCrypt_HKDF_label_t lj = labels[j];
+        if (!done[j] && lj.len <= 32U && 10U + lj.label_len + lj.context_len == info_len)
+        {
+          uint8_t *m = msg_buf + count * (MAX_LABEL_INFO_LEN + 1U);
+          encode_label(m, lj.label, lj.label_len, lj.context, lj.context_len, lj.len);
+          m[info_len] = 1U;
+          lanes[count] = j;
+          msgs[count] = m;
+          count++;
+        }
+      }
+      if (count == 1U)
+      {
+        continue;
+      }
+      for (uint32_t c = count; c < 8U; c++)
+      {
+        msgs[c] = msgs[0U];
+      }
+      expand_label_sha256_8(ctx, msgs, info_len + 1U, tags);
+      for (uint32_t c = 0U; c < count; c++)
+      {
+        EverCrypt_HKDF_label_t lc = labels[lanes[c]];
+        memcpy(lc.okm, tags + c * 32U, lc.len * sizeof (uint8_t));
+        done[lanes[c]] = 1U;
+      }
+    }
+    Lib_Memzero0_memzero(tags, 256U, uint8_t, void *);
+  }
+  #endif
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    if (!done[i])
+    {
+      EverCrypt_HKDF_label_t li = labels[i];
+      EverCrypt_HKDF_expand_label(ctx,
+        li.okm,
+        li.label,
+        li.label_len,
+        li.context,
+        li.context_len,
+        li.len);
+    }
+  }
+}
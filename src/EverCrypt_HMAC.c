@@ -32,6 +32,8 @@
 #include "internal/Hacl_Hash_Blake2b.h"
 #include "internal/Hacl_HMAC.h"
 #include "internal/EverCrypt_Hash.h"
+#include "Hacl_Hash_Base.h"
+#include "lib_memzero0.h"
 
 bool EverCrypt_HMAC_is_supported_alg(Spec_Hash_Definitions_hash_alg uu___)
 {
@@ -888,3 +890,326 @@ EverCrypt_HMAC_compute(
   }
 }
 
+
+EverCrypt_HMAC_key_t
+*EverCrypt_HMAC_malloc_key(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  if (!EverCrypt_HMAC_is_supported_alg(a))
+  {
+    return NULL;
+  }
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t *ipad = (uint8_t *)KRML_HOST_CALLOC(l, sizeof (uint8_t));
+  uint8_t opad[128U] = { 0U };
+  if (key_len <= l)
+  {
+    memcpy(ipad, key, key_len * sizeof (uint8_t));
+  }
+  else
+  {
+    EverCrypt_Hash_Incremental_hash(a, ipad, key, key_len);
+  }
+  for (uint32_t i = 0U; i < l; i++)
+  {
+    uint8_t xi = ipad[i];
+    ipad[i] = (uint32_t)xi ^ 0x36U;
+    opad[i] = (uint32_t)xi ^ 0x5cU;
+  }
+  EverCrypt_Hash_state_s *inner = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_state_s *outer = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_init(inner);
+  EverCrypt_Hash_update_multi(inner, 0ULL, ipad, l);
+  EverCrypt_Hash_init(outer);
+  EverCrypt_Hash_update_multi(outer, 0ULL, opad, l);
+  Lib_Memzero0_memzero(opad, 128U, uint8_t, void *);
+  EverCrypt_HMAC_key_t
+  *k = (EverCrypt_HMAC_key_t *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_key_t));
+  k[0U] =
+    (
+      (EverCrypt_HMAC_key_t){
+        .inner = inner,
+        .outer = outer,
+        .ipad = ipad
+      }
+    );
+  return k;
+}
+
+EverCrypt_HMAC_key_t *EverCrypt_HMAC_copy_key(EverCrypt_HMAC_key_t *k)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(k->inner);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t *ipad = (uint8_t *)KRML_HOST_CALLOC(l, sizeof (uint8_t));
+  memcpy(ipad, k->ipad, l * sizeof (uint8_t));
+  EverCrypt_Hash_state_s *inner = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_state_s *outer = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_copy(k->inner, inner);
+  EverCrypt_Hash_copy(k->outer, outer);
+  EverCrypt_HMAC_key_t
+  *k1 = (EverCrypt_HMAC_key_t *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_key_t));
+  k1[0U] =
+    (
+      (EverCrypt_HMAC_key_t){
+        .inner = inner,
+        .outer = outer,
+        .ipad = ipad
+      }
+    );
+  return k1;
+}
+
+void EverCrypt_HMAC_free_key(EverCrypt_HMAC_key_t *k)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(k->inner);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  /* Resetting the states overwrites the key-dependent chaining values. */
+  EverCrypt_Hash_init(k->inner);
+  EverCrypt_Hash_init(k->outer);
+  Lib_Memzero0_memzero(k->ipad, l, uint8_t, void *);
+  EverCrypt_Hash_free(k->inner);
+  EverCrypt_Hash_free(k->outer);
+  KRML_HOST_FREE(k->ipad);
+  KRML_HOST_FREE(k);
+}
+
+/* `scratch` holds the inner hash state after the last block; it is overwritten. */
+static void
+finish_with_key(
+  EverCrypt_HMAC_key_t *k,
+  Spec_Hash_Definitions_hash_alg a,
+  EverCrypt_Hash_state_s *scratch,
+  uint8_t *mac
+)
+{
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint32_t hash_len = Hacl_Hash_Definitions_hash_len(a);
+  uint8_t hash1[64U] = { 0U };
+  EverCrypt_Hash_finish(scratch, hash1);
+  EverCrypt_Hash_copy(k->outer, scratch);
+  EverCrypt_Hash_update_last(scratch, (uint64_t)l, hash1, hash_len);
+  EverCrypt_Hash_finish(scratch, mac);
+}
+
+/* Clears the key-dependent chaining values before freeing the state. */
+static void free_scratch(EverCrypt_Hash_state_s *scratch)
+{
+  EverCrypt_Hash_init(scratch);
+  EverCrypt_Hash_free(scratch);
+}
+
+void
+EverCrypt_HMAC_compute_with_key_in(
+  EverCrypt_HMAC_key_t *k,
+  EverCrypt_Hash_state_s *scratch,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(k->inner);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  if (data_len == 0U)
+  {
+    EverCrypt_Hash_init(scratch);
+    EverCrypt_Hash_update_last(scratch, 0ULL, k->ipad, l);
+  }
+  else
+  {
+    uint32_t rem_len;
+    if (data_len % l == 0U)
+    {
+      rem_len = l;
+    }
+    else
+    {
+      rem_len = data_len % l;
+    }
+    uint32_t full_blocks_len = data_len - rem_len;
+    EverCrypt_Hash_copy(k->inner, scratch);
+    EverCrypt_Hash_update_multi(scratch, (uint64_t)l, data, full_blocks_len);
+    EverCrypt_Hash_update_last(scratch,
+      (uint64_t)l + (uint64_t)full_blocks_len,
+      data + full_blocks_len,
+      rem_len);
+  }
+  finish_with_key(k, a, scratch, mac);
+}
+
+void
+EverCrypt_HMAC_compute_with_key(
+  EverCrypt_HMAC_key_t *k,
+  uint8_t *mac,
+  uint8_t *data,
+  uint32_t data_len
+)
+{
+  EverCrypt_Hash_state_s *scratch = EverCrypt_Hash_create_in(EverCrypt_Hash_alg_of_state(k->inner));
+  EverCrypt_HMAC_compute_with_key_in(k, scratch, mac, data, data_len);
+  free_scratch(scratch);
+}
+
+static uint64_t max_input_len64(Spec_Hash_Definitions_hash_alg a)
+{
+  switch (a)
+  {
+    case Spec_Hash_Definitions_SHA1:
+      {
+        return 2305843009213693951ULL;
+      }
+    case Spec_Hash_Definitions_SHA2_224:
+      {
+        return 2305843009213693951ULL;
+      }
+    case Spec_Hash_Definitions_SHA2_256:
+      {
+        return 2305843009213693951ULL;
+      }
+    default:
+      {
+        return 18446744073709551615ULL;
+      }
+  }
+}
+
+static EverCrypt_HMAC_state_t *malloc_with_owned_key(EverCrypt_HMAC_key_t *k)
+{
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(k->inner);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(l, sizeof (uint8_t));
+  EverCrypt_Hash_state_s *block_state = EverCrypt_Hash_create_in(a);
+  EverCrypt_Hash_copy(k->inner, block_state);
+  EverCrypt_HMAC_state_t
+  *p = (EverCrypt_HMAC_state_t *)KRML_HOST_MALLOC(sizeof (EverCrypt_HMAC_state_t));
+  p[0U] =
+    (
+      (EverCrypt_HMAC_state_t){
+        .key = k,
+        .block_state = block_state,
+        .buf = buf,
+        .total_len = 0ULL
+      }
+    );
+  return p;
+}
+
+EverCrypt_HMAC_state_t *EverCrypt_HMAC_malloc_with_key(EverCrypt_HMAC_key_t *k)
+{
+  return malloc_with_owned_key(EverCrypt_HMAC_copy_key(k));
+}
+
+EverCrypt_HMAC_state_t
+*EverCrypt_HMAC_malloc(Spec_Hash_Definitions_hash_alg a, uint8_t *key, uint32_t key_len)
+{
+  EverCrypt_HMAC_key_t *k = EverCrypt_HMAC_malloc_key(a, key, key_len);
+  if (k == NULL)
+  {
+    return NULL;
+  }
+  return malloc_with_owned_key(k);
+}
+
+void EverCrypt_HMAC_reset(EverCrypt_HMAC_state_t *state)
+{
+  EverCrypt_HMAC_state_t scrut = *state;
+  EverCrypt_Hash_copy(scrut.key->inner, scrut.block_state);
+  state->total_len = 0ULL;
+}
+
+Spec_Hash_Definitions_hash_alg EverCrypt_HMAC_alg_of_state(EverCrypt_HMAC_state_t *state)
+{
+  return EverCrypt_Hash_alg_of_state(state->block_state);
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HMAC_update(EverCrypt_HMAC_state_t *state, uint8_t *chunk, uint32_t chunk_len)
+{
+  EverCrypt_HMAC_state_t s = *state;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s.block_state);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint64_t total_len = s.total_len;
+  if ((uint64_t)chunk_len > max_input_len64(a) - (uint64_t)l - total_len)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  /* As in EverCrypt_Hash_Incremental, a full buffer is only processed once more
+     data arrives, so that `digest` always has a non-empty last block. */
+  uint32_t sz;
+  if (total_len % (uint64_t)l == 0ULL && total_len > 0ULL)
+  {
+    sz = l;
+  }
+  else
+  {
+    sz = (uint32_t)(total_len % (uint64_t)l);
+  }
+  if (chunk_len <= l - sz)
+  {
+    memcpy(s.buf + sz, chunk, chunk_len * sizeof (uint8_t));
+    state->total_len = total_len + (uint64_t)chunk_len;
+    return EverCrypt_Error_Success;
+  }
+  uint32_t diff = l - sz;
+  memcpy(s.buf + sz, chunk, diff * sizeof (uint8_t));
+  uint64_t total_len1 = total_len + (uint64_t)diff;
+  EverCrypt_Hash_update_multi(s.block_state, total_len1, s.buf, l);
+  uint8_t *data = chunk + diff;
+  uint32_t data_len = chunk_len - diff;
+  uint32_t ite;
+  if (data_len % l == 0U)
+  {
+    ite = l;
+  }
+  else
+  {
+    ite = data_len % l;
+  }
+  uint32_t full_blocks_len = data_len - ite;
+  EverCrypt_Hash_update_multi(s.block_state, (uint64_t)l + total_len1, data, full_blocks_len);
+  memcpy(s.buf, data + full_blocks_len, ite * sizeof (uint8_t));
+  state->total_len = total_len1 + (uint64_t)data_len;
+  return EverCrypt_Error_Success;
+}
+
+void EverCrypt_HMAC_digest(EverCrypt_HMAC_state_t *state, uint8_t *output)
+{
+  EverCrypt_HMAC_state_t s = *state;
+  EverCrypt_HMAC_key_t *k = s.key;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(s.block_state);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  uint64_t total_len = s.total_len;
+  EverCrypt_Hash_state_s *scratch = EverCrypt_Hash_create_in(a);
+  if (total_len == 0ULL)
+  {
+    EverCrypt_Hash_init(scratch);
+    EverCrypt_Hash_update_last(scratch, 0ULL, k->ipad, l);
+  }
+  else
+  {
+    uint32_t sz;
+    if (total_len % (uint64_t)l == 0ULL)
+    {
+      sz = l;
+    }
+    else
+    {
+      sz = (uint32_t)(total_len % (uint64_t)l);
+    }
+    EverCrypt_Hash_copy(s.block_state, scratch);
+    EverCrypt_Hash_update_last(scratch, (uint64_t)l + total_len - (uint64_t)sz, s.buf, sz);
+  }
+  finish_with_key(k, a, scratch, output);
+  free_scratch(scratch);
+}
+
+void EverCrypt_HMAC_free(EverCrypt_HMAC_state_t *state)
+{
+  EverCrypt_HMAC_state_t scrut = *state;
+  Spec_Hash_Definitions_hash_alg a = EverCrypt_Hash_alg_of_state(scrut.block_state);
+  uint32_t l = Hacl_Hash_Definitions_block_len(a);
+  EverCrypt_Hash_init(scrut.block_state);
+  Lib_Memzero0_memzero(scrut.buf, l, uint8_t, void *);
+  EverCrypt_HMAC_free_key(scrut.key);
+  EverCrypt_Hash_free(scrut.block_state);
+  KRML_HOST_FREE(scrut.buf);
+  KRML_HOST_FREE(state);
+}
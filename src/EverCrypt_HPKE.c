@@ -0,0 +1,1163 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* This is a hand-written file. */
+
+#include "EverCrypt_HPKE.h"
+
+#include "Hacl_HPKE_Curve51_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA512.h"
+#include "Hacl_HPKE_Curve51_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP128_SHA512.h"
+#include "Hacl_HPKE_Curve51_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP256_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP32_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP128_SHA512.h"
+#include "Hacl_HPKE_Curve64_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP256_SHA512.h"
+#include "Hacl_HPKE_P256_CP32_SHA256.h"
+#include "Hacl_HPKE_P256_CP128_SHA256.h"
+#include "Hacl_HPKE_P256_CP256_SHA256.h"
+#include "Hacl_HPKE_X25519MLKEM768_CP32_SHA256.h"
+#include "Hacl_HPKE_P256MLKEM768_CP32_SHA256.h"
+#include "internal/EverCrypt_Dispatch.h"
+#include "config.h"
+
+/* The entry points of one Hacl_HPKE_* instantiation. The hybrid KEMs have no
+   PSK or Auth modes and leave those NULL. */
+typedef struct suite_s_s
+{
+  const char *name;
+  uint32_t
+  (*setupBaseS)(
+    uint8_t *o_enc,
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *skE,
+    uint8_t *pkR,
+    uint32_t infolen,
+    uint8_t *info
+  );
+  uint32_t
+  (*setupBaseR)(
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *enc,
+    uint8_t *skR,
+    uint32_t infolen,
+    uint8_t *info
+  );
+  uint32_t
+  (*sealBase)(
+    uint8_t *skE,
+    uint8_t *pkR,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t aadlen,
+    uint8_t *aad,
+    uint32_t plainlen,
+    uint8_t *plain,
+    uint8_t *o_enc,
+    uint8_t *o_ct
+  );
+  uint32_t
+  (*openBase)(
+    uint8_t *enc,
+    uint8_t *skR,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t aadlen,
+    uint8_t *aad,
+    uint32_t ctlen,
+    uint8_t *ct,
+    uint8_t *o_pt
+  );
+  uint32_t
+  (*context_seal)(
+    Hacl_Impl_HPKE_context_s ctx,
+    uint32_t aadlen,
+    uint8_t *aad,
+    uint32_t plainlen,
+    uint8_t *plain,
+    uint8_t *o_ct
+  );
+  uint32_t
+  (*context_open)(
+    Hacl_Impl_HPKE_context_s ctx,
+    uint32_t aadlen,
+    uint8_t *aad,
+    uint32_t ctlen,
+    uint8_t *ct,
+    uint8_t *o_pt
+  );
+  uint32_t
+  (*context_export)(
+    Hacl_Impl_HPKE_context_s ctx,
+    uint32_t exp_ctxlen,
+    uint8_t *exp_ctx,
+    uint32_t l,
+    uint8_t *o_secret
+  );
+  uint32_t
+  (*setupPSKS)(
+    uint8_t *o_enc,
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *skE,
+    uint8_t *pkR,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t psklen,
+    uint8_t *psk,
+    uint32_t psk_idlen,
+    uint8_t *psk_id
+  );
+  uint32_t
+  (*setupPSKR)(
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *enc,
+    uint8_t *skR,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t psklen,
+    uint8_t *psk,
+    uint32_t psk_idlen,
+    uint8_t *psk_id
+  );
+  uint32_t
+  (*setupAuthS)(
+    uint8_t *o_enc,
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *skE,
+    uint8_t *pkR,
+    uint8_t *skS,
+    uint32_t infolen,
+    uint8_t *info
+  );
+  uint32_t
+  (*setupAuthR)(
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *enc,
+    uint8_t *skR,
+    uint8_t *pkS,
+    uint32_t infolen,
+    uint8_t *info
+  );
+  uint32_t
+  (*setupAuthPSKS)(
+    uint8_t *o_enc,
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *skE,
+    uint8_t *pkR,
+    uint8_t *skS,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t psklen,
+    uint8_t *psk,
+    uint32_t psk_idlen,
+    uint8_t *psk_id
+  );
+  uint32_t
+  (*setupAuthPSKR)(
+    Hacl_Impl_HPKE_context_s o_ctx,
+    uint8_t *enc,
+    uint8_t *skR,
+    uint8_t *pkS,
+    uint32_t infolen,
+    uint8_t *info,
+    uint32_t psklen,
+    uint8_t *psk,
+    uint32_t psk_idlen,
+    uint8_t *psk_id
+  );
+}
+suite_s;
+
+static const suite_s curve51_cp32_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP32_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP32_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP32_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP32_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP32_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP32_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP32_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP32_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKR
+  };
+
+static const suite_s curve51_cp32_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP32_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve51_CP32_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP32_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP32_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP32_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP32_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP32_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP32_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP32_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP32_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP32_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP32_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP32_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP32_SHA512_setupAuthPSKR
+  };
+
+#if HACL_CAN_COMPILE_VEC128
+static const suite_s curve51_cp128_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP128_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve51_CP128_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP128_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP128_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP128_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP128_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP128_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP128_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP128_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP128_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP128_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP128_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VEC128
+static const suite_s curve51_cp128_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP128_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve51_CP128_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP128_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP128_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP128_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP128_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP128_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP128_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP128_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP128_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP128_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP128_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP128_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP128_SHA512_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+static const suite_s curve51_cp256_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP256_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve51_CP256_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP256_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP256_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP256_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP256_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP256_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP256_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP256_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP256_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP256_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP256_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP256_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP256_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+static const suite_s curve51_cp256_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve51_CP256_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve51_CP256_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve51_CP256_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve51_CP256_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve51_CP256_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve51_CP256_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve51_CP256_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve51_CP256_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve51_CP256_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve51_CP256_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve51_CP256_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve51_CP256_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve51_CP256_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve51_CP256_SHA512_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE
+static const suite_s curve64_cp32_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP32_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve64_CP32_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP32_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP32_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP32_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP32_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP32_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP32_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP32_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP32_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP32_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP32_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP32_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP32_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE
+static const suite_s curve64_cp32_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP32_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve64_CP32_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP32_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP32_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP32_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP32_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP32_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP32_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP32_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP32_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP32_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP32_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP32_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP32_SHA512_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC128
+static const suite_s curve64_cp128_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP128_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve64_CP128_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP128_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP128_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP128_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP128_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP128_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP128_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP128_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP128_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP128_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP128_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP128_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP128_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC128
+static const suite_s curve64_cp128_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP128_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve64_CP128_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP128_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP128_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP128_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP128_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP128_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP128_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP128_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP128_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP128_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP128_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP128_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP128_SHA512_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC256
+static const suite_s curve64_cp256_sha256 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP256_SHA256",
+    .setupBaseS = Hacl_HPKE_Curve64_CP256_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP256_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP256_SHA256_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP256_SHA256_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP256_SHA256_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP256_SHA256_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP256_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP256_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP256_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP256_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP256_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP256_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP256_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC256
+static const suite_s curve64_cp256_sha512 =
+  {
+    .name = "Hacl_HPKE_Curve64_CP256_SHA512",
+    .setupBaseS = Hacl_HPKE_Curve64_CP256_SHA512_setupBaseS,
+    .setupBaseR = Hacl_HPKE_Curve64_CP256_SHA512_setupBaseR,
+    .sealBase = Hacl_HPKE_Curve64_CP256_SHA512_sealBase,
+    .openBase = Hacl_HPKE_Curve64_CP256_SHA512_openBase,
+    .context_seal = Hacl_HPKE_Curve64_CP256_SHA512_context_seal,
+    .context_open = Hacl_HPKE_Curve64_CP256_SHA512_context_open,
+    .context_export = Hacl_HPKE_Curve64_CP256_SHA512_context_export,
+    .setupPSKS = Hacl_HPKE_Curve64_CP256_SHA512_setupPSKS,
+    .setupPSKR = Hacl_HPKE_Curve64_CP256_SHA512_setupPSKR,
+    .setupAuthS = Hacl_HPKE_Curve64_CP256_SHA512_setupAuthS,
+    .setupAuthR = Hacl_HPKE_Curve64_CP256_SHA512_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_Curve64_CP256_SHA512_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_Curve64_CP256_SHA512_setupAuthPSKR
+  };
+#endif
+
+static const suite_s p256_cp32_sha256 =
+  {
+    .name = "Hacl_HPKE_P256_CP32_SHA256",
+    .setupBaseS = Hacl_HPKE_P256_CP32_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_P256_CP32_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_P256_CP32_SHA256_sealBase,
+    .openBase = Hacl_HPKE_P256_CP32_SHA256_openBase,
+    .context_seal = Hacl_HPKE_P256_CP32_SHA256_context_seal,
+    .context_open = Hacl_HPKE_P256_CP32_SHA256_context_open,
+    .context_export = Hacl_HPKE_P256_CP32_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_P256_CP32_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_P256_CP32_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_P256_CP32_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_P256_CP32_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_P256_CP32_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_P256_CP32_SHA256_setupAuthPSKR
+  };
+
+#if HACL_CAN_COMPILE_VEC128
+static const suite_s p256_cp128_sha256 =
+  {
+    .name = "Hacl_HPKE_P256_CP128_SHA256",
+    .setupBaseS = Hacl_HPKE_P256_CP128_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_P256_CP128_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_P256_CP128_SHA256_sealBase,
+    .openBase = Hacl_HPKE_P256_CP128_SHA256_openBase,
+    .context_seal = Hacl_HPKE_P256_CP128_SHA256_context_seal,
+    .context_open = Hacl_HPKE_P256_CP128_SHA256_context_open,
+    .context_export = Hacl_HPKE_P256_CP128_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_P256_CP128_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_P256_CP128_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_P256_CP128_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_P256_CP128_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_P256_CP128_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_P256_CP128_SHA256_setupAuthPSKR
+  };
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+static const suite_s p256_cp256_sha256 =
+  {
+    .name = "Hacl_HPKE_P256_CP256_SHA256",
+    .setupBaseS = Hacl_HPKE_P256_CP256_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_P256_CP256_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_P256_CP256_SHA256_sealBase,
+    .openBase = Hacl_HPKE_P256_CP256_SHA256_openBase,
+    .context_seal = Hacl_HPKE_P256_CP256_SHA256_context_seal,
+    .context_open = Hacl_HPKE_P256_CP256_SHA256_context_open,
+    .context_export = Hacl_HPKE_P256_CP256_SHA256_context_export,
+    .setupPSKS = Hacl_HPKE_P256_CP256_SHA256_setupPSKS,
+    .setupPSKR = Hacl_HPKE_P256_CP256_SHA256_setupPSKR,
+    .setupAuthS = Hacl_HPKE_P256_CP256_SHA256_setupAuthS,
+    .setupAuthR = Hacl_HPKE_P256_CP256_SHA256_setupAuthR,
+    .setupAuthPSKS = Hacl_HPKE_P256_CP256_SHA256_setupAuthPSKS,
+    .setupAuthPSKR = Hacl_HPKE_P256_CP256_SHA256_setupAuthPSKR
+  };
+#endif
+
+static const suite_s x25519mlkem768_cp32_sha256 =
+  {
+    .name = "Hacl_HPKE_X25519MLKEM768_CP32_SHA256",
+    .setupBaseS = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_sealBase,
+    .openBase = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_openBase,
+    .context_seal = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_seal,
+    .context_open = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_open,
+    .context_export = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_export,
+    .setupPSKS = NULL,
+    .setupPSKR = NULL,
+    .setupAuthS = NULL,
+    .setupAuthR = NULL,
+    .setupAuthPSKS = NULL,
+    .setupAuthPSKR = NULL
+  };
+
+static const suite_s p256mlkem768_cp32_sha256 =
+  {
+    .name = "Hacl_HPKE_P256MLKEM768_CP32_SHA256",
+    .setupBaseS = Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS,
+    .setupBaseR = Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseR,
+    .sealBase = Hacl_HPKE_P256MLKEM768_CP32_SHA256_sealBase,
+    .openBase = Hacl_HPKE_P256MLKEM768_CP32_SHA256_openBase,
+    .context_seal = Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_seal,
+    .context_open = Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_open,
+    .context_export = Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_export,
+    .setupPSKS = NULL,
+    .setupPSKR = NULL,
+    .setupAuthS = NULL,
+    .setupAuthR = NULL,
+    .setupAuthPSKS = NULL,
+    .setupAuthPSKR = NULL
+  };
+/* The instantiations that this build cannot contain are NULL. */
+
+#if HACL_CAN_COMPILE_VEC128
+#define CP128(s) (&s)
+#else
+#define CP128(s) NULL
+#endif
+
+#if HACL_CAN_COMPILE_VEC256
+#define CP256(s) (&s)
+#else
+#define CP256(s) NULL
+#endif
+
+#if HACL_CAN_COMPILE_VALE
+#define CURVE64(s) (&s)
+#else
+#define CURVE64(s) NULL
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC128
+#define CURVE64_CP128(s) (&s)
+#else
+#define CURVE64_CP128(s) NULL
+#endif
+
+#if HACL_CAN_COMPILE_VALE && HACL_CAN_COMPILE_VEC256
+#define CURVE64_CP256(s) (&s)
+#else
+#define CURVE64_CP256(s) NULL
+#endif
+
+/* The width is resolved by EverCrypt_Dispatch_init: Vec256 implies Vec128. */
+static const suite_s *select_width(const suite_s *cp32, const suite_s *cp128, const suite_s *cp256)
+{
+  EverCrypt_Dispatch_impl w = EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_HPKE];
+  if (cp256 != NULL && w == EverCrypt_Dispatch_Vec256)
+  {
+    return cp256;
+  }
+  if (cp128 != NULL && w != EverCrypt_Dispatch_Portable)
+  {
+    return cp128;
+  }
+  return cp32;
+}
+
+static const suite_s *lookup(uint16_t kem, uint16_t kdf, uint16_t aead)
+{
+  if (aead != EverCrypt_HPKE_aead_chacha20_poly1305)
+  {
+    return NULL;
+  }
+  bool
+  curve64 =
+    EverCrypt_Dispatch_functions.impl[EverCrypt_Dispatch_CURVE25519]
+    == EverCrypt_Dispatch_Vale;
+  if (kem == EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256 && kdf == EverCrypt_HPKE_kdf_hkdf_sha256)
+  {
+    if (curve64)
+    {
+      return
+        select_width(CURVE64(curve64_cp32_sha256),
+          CURVE64_CP128(curve64_cp128_sha256),
+          CURVE64_CP256(curve64_cp256_sha256));
+    }
+    return
+      select_width(&curve51_cp32_sha256,
+        CP128(curve51_cp128_sha256),
+        CP256(curve51_cp256_sha256));
+  }
+  if (kem == EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256 && kdf == EverCrypt_HPKE_kdf_hkdf_sha512)
+  {
+    if (curve64)
+    {
+      return
+        select_width(CURVE64(curve64_cp32_sha512),
+          CURVE64_CP128(curve64_cp128_sha512),
+          CURVE64_CP256(curve64_cp256_sha512));
+    }
+    return
+      select_width(&curve51_cp32_sha512,
+        CP128(curve51_cp128_sha512),
+        CP256(curve51_cp256_sha512));
+  }
+  if (kem == EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256 && kdf == EverCrypt_HPKE_kdf_hkdf_sha256)
+  {
+    return select_width(&p256_cp32_sha256, CP128(p256_cp128_sha256), CP256(p256_cp256_sha256));
+  }
+  if (kem == EverCrypt_HPKE_kem_xwing && kdf == EverCrypt_HPKE_kdf_hkdf_sha256)
+  {
+    return &x25519mlkem768_cp32_sha256;
+  }
+  if (kem == EverCrypt_HPKE_kem_p256_mlkem768 && kdf == EverCrypt_HPKE_kdf_hkdf_sha256)
+  {
+    return &p256mlkem768_cp32_sha256;
+  }
+  return NULL;
+}
+
+const char *EverCrypt_HPKE_implementation(uint16_t kem, uint16_t kdf, uint16_t aead)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return NULL;
+  }
+  return s->name;
+}
+
+uint32_t EverCrypt_HPKE_public_key_len(uint16_t kem)
+{
+  switch (kem)
+  {
+    case EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256:
+      {
+        return 64U;
+      }
+    case EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_p256_mlkem768:
+      {
+        return 1249U;
+      }
+    case EverCrypt_HPKE_kem_xwing:
+      {
+        return 1216U;
+      }
+    default:
+      {
+        return 0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_HPKE_secret_key_len(uint16_t kem)
+{
+  switch (kem)
+  {
+    case EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_p256_mlkem768:
+      {
+        return 2497U;
+      }
+    case EverCrypt_HPKE_kem_xwing:
+      {
+        return 2464U;
+      }
+    default:
+      {
+        return 0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_HPKE_ephemeral_key_len(uint16_t kem)
+{
+  switch (kem)
+  {
+    case EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_p256_mlkem768:
+      {
+        return 64U;
+      }
+    case EverCrypt_HPKE_kem_xwing:
+      {
+        return 64U;
+      }
+    default:
+      {
+        return 0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_HPKE_enc_len(uint16_t kem)
+{
+  switch (kem)
+  {
+    case EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256:
+      {
+        return 65U;
+      }
+    case EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kem_p256_mlkem768:
+      {
+        return 1153U;
+      }
+    case EverCrypt_HPKE_kem_xwing:
+      {
+        return 1120U;
+      }
+    default:
+      {
+        return 0U;
+      }
+  }
+}
+
+uint32_t EverCrypt_HPKE_exporter_len(uint16_t kdf)
+{
+  switch (kdf)
+  {
+    case EverCrypt_HPKE_kdf_hkdf_sha256:
+      {
+        return 32U;
+      }
+    case EverCrypt_HPKE_kdf_hkdf_sha512:
+      {
+        return 64U;
+      }
+    default:
+      {
+        return 0U;
+      }
+  }
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupBaseS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->setupBaseS(o_enc, o_ctx, skE, pkR, infolen, info);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupBaseR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->setupBaseR(o_ctx, enc, skR, infolen, info);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupPSKS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupPSKS == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t
+  res =
+    s->setupPSKS(o_enc,
+      o_ctx,
+      skE,
+      pkR,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupPSKR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupPSKR == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->setupPSKR(o_ctx, enc, skR, infolen, info, psklen, psk, psk_idlen, psk_id);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupAuthS == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->setupAuthS(o_enc, o_ctx, skE, pkR, skS, infolen, info);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupAuthR == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->setupAuthR(o_ctx, enc, skR, pkS, infolen, info);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthPSKS(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupAuthPSKS == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t
+  res =
+    s->setupAuthPSKS(o_enc,
+      o_ctx,
+      skE,
+      pkR,
+      skS,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_setupAuthPSKR(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL || s->setupAuthPSKR == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t
+  res =
+    s->setupAuthPSKR(o_ctx,
+      enc,
+      skR,
+      pkS,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_sealBase(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_enc,
+  uint8_t *o_ct
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->sealBase(skE, pkR, infolen, info, aadlen, aad, plainlen, plain, o_enc, o_ct);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_InvalidKey;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_openBase(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->openBase(enc, skR, infolen, info, aadlen, aad, ctlen, ct, o_pt);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_seal(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  if (ctx.ctx_seq[0U] == 18446744073709551615ULL)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t res = s->context_seal(ctx, aadlen, aad, plainlen, plain, o_ct);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_open(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  if (ctx.ctx_seq[0U] == 18446744073709551615ULL)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  uint32_t res = s->context_open(ctx, aadlen, aad, ctlen, ct, o_pt);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_AuthenticationFailure;
+  }
+  return EverCrypt_Error_Success;
+}
+
+EverCrypt_Error_error_code
+EverCrypt_HPKE_context_export(
+  uint16_t kem,
+  uint16_t kdf,
+  uint16_t aead,
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  const suite_s *s = lookup(kem, kdf, aead);
+  if (s == NULL)
+  {
+    return EverCrypt_Error_UnsupportedAlgorithm;
+  }
+  uint32_t res = s->context_export(ctx, exp_ctxlen, exp_ctx, l, o_secret);
+  if (res != 0U)
+  {
+    return EverCrypt_Error_MaximumLengthExceeded;
+  }
+  return EverCrypt_Error_Success;
+}
@@ -25,6 +25,7 @@
 
 #include "internal/EverCrypt_Hash.h"
 
+#include "internal/EverCrypt_Dispatch.h"
 #include "internal/Vale.h"
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Hash_SHA3.h"
@@ -77,7 +78,7 @@ typedef struct EverCrypt_Hash_state_s_s
 }
 EverCrypt_Hash_state_s;
 
-static Spec_Hash_Definitions_hash_alg alg_of_state(EverCrypt_Hash_state_s *s)
+Spec_Hash_Definitions_hash_alg EverCrypt_Hash_alg_of_state(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -143,7 +144,7 @@ static Spec_Hash_Definitions_hash_alg alg_of_state(EverCrypt_Hash_state_s *s)
   KRML_HOST_EXIT(255U);
 }
 
-static EverCrypt_Hash_state_s *create_in(Spec_Hash_Definitions_hash_alg a)
+EverCrypt_Hash_state_s *EverCrypt_Hash_create_in(Spec_Hash_Definitions_hash_alg a)
 {
   EverCrypt_Hash_state_s s;
   switch (a)
@@ -270,7 +271,7 @@ static EverCrypt_Hash_state_s *create_in(Spec_Hash_Definitions_hash_alg a)
   return buf;
 }
 
-static void init(EverCrypt_Hash_state_s *s)
+void EverCrypt_Hash_init(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -374,6 +375,7 @@ static void init(EverCrypt_Hash_state_s *s)
   KRML_HOST_EXIT(255U);
 }
 
+#if HACL_CAN_COMPILE_VALE
 static uint32_t
 k224_256[64U] =
   {
@@ -389,26 +391,25 @@ k224_256[64U] =
     0xc67178f2U
   };
 
+void EverCrypt_Hash_update_multi_256_vale(uint32_t *s, uint8_t *blocks, uint32_t n)
+{
+  uint64_t n1 = (uint64_t)n;
+  sha256_update(s, blocks, n1, k224_256);
+}
+#endif
+
 void EverCrypt_Hash_update_multi_256(uint32_t *s, uint8_t *blocks, uint32_t n)
 {
-  #if HACL_CAN_COMPILE_VALE
-  bool has_shaext = EverCrypt_AutoConfig2_has_shaext();
-  bool has_sse = EverCrypt_AutoConfig2_has_sse();
-  if (has_shaext && has_sse)
-  {
-    uint64_t n1 = (uint64_t)n;
-    sha256_update(s, blocks, n1, k224_256);
-    return;
-  }
-  Hacl_Hash_SHA2_sha256_update_nblocks(n * 64U, blocks, s);
-  #else
-  KRML_HOST_IGNORE(k224_256);
-  Hacl_Hash_SHA2_sha256_update_nblocks(n * 64U, blocks, s);
-  #endif
+  EverCrypt_Dispatch_functions.sha2_256_update_multi(s, blocks, n);
 }
 
-static void
-update_multi(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *blocks, uint32_t len)
+void
+EverCrypt_Hash_update_multi(
+  EverCrypt_Hash_state_s *s,
+  uint64_t prevlen,
+  uint8_t *blocks,
+  uint32_t len
+)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -540,8 +541,13 @@ update_multi(EverCrypt_Hash_state_s *s, uint64_t prevlen, uint8_t *blocks, uint3
   KRML_HOST_EXIT(255U);
 }
 
-static void
-update_last(EverCrypt_Hash_state_s *s, uint64_t prev_len, uint8_t *last, uint32_t last_len)
+void
+EverCrypt_Hash_update_last(
+  EverCrypt_Hash_state_s *s,
+  uint64_t prev_len,
+  uint8_t *last,
+  uint32_t last_len
+)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -667,7 +673,7 @@ update_last(EverCrypt_Hash_state_s *s, uint64_t prev_len, uint8_t *last, uint32_
   KRML_HOST_EXIT(255U);
 }
 
-static void finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
+void EverCrypt_Hash_finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -803,7 +809,7 @@ static void finish(EverCrypt_Hash_state_s *s, uint8_t *dst)
   KRML_HOST_EXIT(255U);
 }
 
-static void free_(EverCrypt_Hash_state_s *s)
+void EverCrypt_Hash_free(EverCrypt_Hash_state_s *s)
 {
   EverCrypt_Hash_state_s scrut = *s;
   if (scrut.tag == MD5_s)
@@ -887,7 +893,7 @@ static void free_(EverCrypt_Hash_state_s *s)
   KRML_HOST_FREE(s);
 }
 
-static void copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *s_dst)
+void EverCrypt_Hash_copy(EverCrypt_Hash_state_s *s_src, EverCrypt_Hash_state_s *s_dst)
 {
   EverCrypt_Hash_state_s scrut0 = *s_src;
   if (scrut0.tag == MD5_s)
@@ -1304,7 +1310,7 @@ EverCrypt_Hash_Incremental_state_t
 {
   KRML_CHECK_SIZE(sizeof (uint8_t), block_len(a));
   uint8_t *buf = (uint8_t *)KRML_HOST_CALLOC(block_len(a), sizeof (uint8_t));
-  EverCrypt_Hash_state_s *block_state = create_in(a);
+  EverCrypt_Hash_state_s *block_state = EverCrypt_Hash_create_in(a);
   EverCrypt_Hash_Incremental_state_t
   s = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
   EverCrypt_Hash_Incremental_state_t
@@ -1313,7 +1319,7 @@ EverCrypt_Hash_Incremental_state_t
         EverCrypt_Hash_Incremental_state_t
       ));
   p[0U] = s;
-  init(block_state);
+  EverCrypt_Hash_init(block_state);
   return p;
 }
 
@@ -1325,9 +1331,9 @@ void EverCrypt_Hash_Incremental_reset(EverCrypt_Hash_Incremental_state_t *state)
   EverCrypt_Hash_Incremental_state_t scrut = *state;
   uint8_t *buf = scrut.buf;
   EverCrypt_Hash_state_s *block_state = scrut.block_state;
-  Spec_Hash_Definitions_hash_alg i = alg_of_state(block_state);
+  Spec_Hash_Definitions_hash_alg i = EverCrypt_Hash_alg_of_state(block_state);
   KRML_MAYBE_UNUSED_VAR(i);
-  init(block_state);
+  EverCrypt_Hash_init(block_state);
   EverCrypt_Hash_Incremental_state_t
   tmp = { .block_state = block_state, .buf = buf, .total_len = (uint64_t)0U };
   state[0U] = tmp;
@@ -1350,7 +1356,7 @@ EverCrypt_Hash_Incremental_update(
   EverCrypt_Hash_Incremental_state_t s = *state;
   EverCrypt_Hash_state_s *block_state = s.block_state;
   uint64_t total_len = s.total_len;
-  Spec_Hash_Definitions_hash_alg i1 = alg_of_state(block_state);
+  Spec_Hash_Definitions_hash_alg i1 = EverCrypt_Hash_alg_of_state(block_state);
   uint64_t sw;
   switch (i1)
   {
@@ -1492,7 +1498,7 @@ EverCrypt_Hash_Incremental_update(
       if (!(sz1 == 0U))
       {
         uint64_t prevlen = total_len1 - (uint64_t)sz1;
-        update_multi(block_state1, prevlen, buf, block_len(i1));
+        EverCrypt_Hash_update_multi(block_state1, prevlen, buf, block_len(i1));
       }
       uint32_t ite0;
       if ((uint64_t)chunk_len % (uint64_t)block_len(i1) == 0ULL && (uint64_t)chunk_len > 0ULL)
@@ -1508,7 +1514,7 @@ EverCrypt_Hash_Incremental_update(
       uint32_t data2_len = chunk_len - data1_len;
       uint8_t *data1 = chunk;
       uint8_t *data2 = chunk + data1_len;
-      update_multi(block_state1, total_len1, data1, data1_len);
+      EverCrypt_Hash_update_multi(block_state1, total_len1, data1, data1_len);
       uint8_t *dst = buf;
       memcpy(dst, data2, data2_len * sizeof (uint8_t));
       *state
@@ -1567,7 +1573,7 @@ EverCrypt_Hash_Incremental_update(
       if (!(sz1 == 0U))
       {
         uint64_t prevlen = total_len1 - (uint64_t)sz1;
-        update_multi(block_state1, prevlen, buf, block_len(i1));
+        EverCrypt_Hash_update_multi(block_state1, prevlen, buf, block_len(i1));
       }
       uint32_t ite0;
       if
@@ -1589,7 +1595,7 @@ EverCrypt_Hash_Incremental_update(
       uint32_t data2_len = chunk_len - diff - data1_len;
       uint8_t *data1 = chunk2;
       uint8_t *data2 = chunk2 + data1_len;
-      update_multi(block_state1, total_len1, data1, data1_len);
+      EverCrypt_Hash_update_multi(block_state1, total_len1, data1, data1_len);
       uint8_t *dst = buf;
       memcpy(dst, data2, data2_len * sizeof (uint8_t));
       *state
@@ -1641,7 +1647,7 @@ static void digest_md5(EverCrypt_Hash_Incremental_state_t *state, uint8_t *outpu
   uint32_t buf[4U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = MD5_s, { .case_MD5_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_MD5) == 0U && r > 0U)
@@ -1654,10 +1660,10 @@ static void digest_md5(EverCrypt_Hash_Incremental_state_t *state, uint8_t *outpu
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha1(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1679,7 +1685,7 @@ static void digest_sha1(EverCrypt_Hash_Incremental_state_t *state, uint8_t *outp
   uint32_t buf[5U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA1_s, { .case_SHA1_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA1) == 0U && r > 0U)
@@ -1692,10 +1698,10 @@ static void digest_sha1(EverCrypt_Hash_Incremental_state_t *state, uint8_t *outp
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1718,7 +1724,7 @@ static void digest_sha224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   uint32_t buf[8U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA2_224_s, { .case_SHA2_224_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA2_224) == 0U && r > 0U)
@@ -1731,10 +1737,10 @@ static void digest_sha224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1757,7 +1763,7 @@ static void digest_sha256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   uint32_t buf[8U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA2_256_s, { .case_SHA2_256_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA2_256) == 0U && r > 0U)
@@ -1770,10 +1776,10 @@ static void digest_sha256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha3_224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1796,7 +1802,7 @@ static void digest_sha3_224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   uint64_t buf[25U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA3_224_s, { .case_SHA3_224_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA3_224) == 0U && r > 0U)
@@ -1809,10 +1815,10 @@ static void digest_sha3_224(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha3_256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1835,7 +1841,7 @@ static void digest_sha3_256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   uint64_t buf[25U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA3_256_s, { .case_SHA3_256_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA3_256) == 0U && r > 0U)
@@ -1848,10 +1854,10 @@ static void digest_sha3_256(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha3_384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1874,7 +1880,7 @@ static void digest_sha3_384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   uint64_t buf[25U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA3_384_s, { .case_SHA3_384_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA3_384) == 0U && r > 0U)
@@ -1887,10 +1893,10 @@ static void digest_sha3_384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha3_512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1913,7 +1919,7 @@ static void digest_sha3_512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   uint64_t buf[25U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA3_512_s, { .case_SHA3_512_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA3_512) == 0U && r > 0U)
@@ -1926,10 +1932,10 @@ static void digest_sha3_512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1952,7 +1958,7 @@ static void digest_sha384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   uint64_t buf[8U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA2_384_s, { .case_SHA2_384_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA2_384) == 0U && r > 0U)
@@ -1965,10 +1971,10 @@ static void digest_sha384(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_sha512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -1991,7 +1997,7 @@ static void digest_sha512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   uint64_t buf[8U] = { 0U };
   EverCrypt_Hash_state_s s = { .tag = SHA2_512_s, { .case_SHA2_512_s = buf } };
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_SHA2_512) == 0U && r > 0U)
@@ -2004,10 +2010,10 @@ static void digest_sha512(EverCrypt_Hash_Incremental_state_t *state, uint8_t *ou
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_blake2s(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -2044,7 +2050,7 @@ static void digest_blake2s(EverCrypt_Hash_Incremental_state_t *state, uint8_t *o
   s = ((EverCrypt_Hash_state_s){ .tag = Blake2S_s, { .case_Blake2S_s = buf } });
   #endif
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_Blake2S) == 0U && r > 0U)
@@ -2057,10 +2063,10 @@ static void digest_blake2s(EverCrypt_Hash_Incremental_state_t *state, uint8_t *o
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 static void digest_blake2b(EverCrypt_Hash_Incremental_state_t *state, uint8_t *output)
@@ -2097,7 +2103,7 @@ static void digest_blake2b(EverCrypt_Hash_Incremental_state_t *state, uint8_t *o
   s = ((EverCrypt_Hash_state_s){ .tag = Blake2B_s, { .case_Blake2B_s = buf } });
   #endif
   EverCrypt_Hash_state_s tmp_block_state = s;
-  copy(block_state, &tmp_block_state);
+  EverCrypt_Hash_copy(block_state, &tmp_block_state);
   uint64_t prev_len = total_len - (uint64_t)r;
   uint32_t ite;
   if (r % block_len(Spec_Hash_Definitions_Blake2B) == 0U && r > 0U)
@@ -2110,10 +2116,10 @@ static void digest_blake2b(EverCrypt_Hash_Incremental_state_t *state, uint8_t *o
   }
   uint8_t *buf_last = buf_1 + r - ite;
   uint8_t *buf_multi = buf_1;
-  update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
+  EverCrypt_Hash_update_multi(&tmp_block_state, prev_len, buf_multi, 0U);
   uint64_t prev_len_last = total_len - (uint64_t)r;
-  update_last(&tmp_block_state, prev_len_last, buf_last, r);
-  finish(&tmp_block_state, output);
+  EverCrypt_Hash_update_last(&tmp_block_state, prev_len_last, buf_last, r);
+  EverCrypt_Hash_finish(&tmp_block_state, output);
 }
 
 /**
@@ -2123,7 +2129,7 @@ Spec_Hash_Definitions_hash_alg
 EverCrypt_Hash_Incremental_alg_of_state(EverCrypt_Hash_Incremental_state_t *s)
 {
   EverCrypt_Hash_state_s *block_state = (*s).block_state;
-  return alg_of_state(block_state);
+  return EverCrypt_Hash_alg_of_state(block_state);
 }
 
 /**
@@ -2216,7 +2222,7 @@ void EverCrypt_Hash_Incremental_free(EverCrypt_Hash_Incremental_state_t *state)
   EverCrypt_Hash_Incremental_state_t scrut = *state;
   uint8_t *buf = scrut.buf;
   EverCrypt_Hash_state_s *block_state = scrut.block_state;
-  free_(block_state);
+  EverCrypt_Hash_free(block_state);
   KRML_HOST_FREE(buf);
   KRML_HOST_FREE(state);
 }
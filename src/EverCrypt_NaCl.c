@@ -0,0 +1,200 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* This is a hand-written file. */
+
+#include "EverCrypt_NaCl.h"
+
+#include "internal/Hacl_NaCl.h"
+#include "internal/EverCrypt_Dispatch.h"
+#include "lib_memzero0.h"
+
+static const Hacl_Impl_NaCl_Kernels *kernels(void)
+{
+  return EverCrypt_Dispatch_functions.nacl_kernels;
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  Hacl_Impl_NaCl_secretbox_detached(kernels(), mlen, c, tag, k, n, m);
+  return 0U;
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return Hacl_Impl_NaCl_secretbox_open_detached(kernels(), mlen, m, k, n, c, tag);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_easy(uint8_t *c, uint8_t *m, uint32_t mlen, uint8_t *n, uint8_t *k)
+{
+  return EverCrypt_NaCl_crypto_secretbox_detached(c + 16U, c, m, mlen, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_secretbox_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return EverCrypt_NaCl_crypto_secretbox_open_detached(m, c + 16U, c, clen - 16U, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_detached_afternm(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return EverCrypt_NaCl_crypto_secretbox_detached(c, tag, m, mlen, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_detached(
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    r = EverCrypt_NaCl_crypto_box_detached_afternm(c, tag, m, mlen, n, k);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return EverCrypt_NaCl_crypto_secretbox_open_detached(m, c, tag, mlen, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_open_detached(
+  uint8_t *m,
+  uint8_t *c,
+  uint8_t *tag,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint8_t k[32U] = { 0U };
+  uint32_t r = Hacl_NaCl_crypto_box_beforenm(k, pk, sk);
+  if (r == 0U)
+  {
+    r = EverCrypt_NaCl_crypto_box_open_detached_afternm(m, c, tag, mlen, n, k);
+  }
+  Lib_Memzero0_memzero(k, 32U, uint8_t, void *);
+  return r;
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_easy_afternm(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return EverCrypt_NaCl_crypto_box_detached_afternm(c + 16U, c, m, mlen, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_easy(
+  uint8_t *c,
+  uint8_t *m,
+  uint32_t mlen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  return EverCrypt_NaCl_crypto_box_detached(c + 16U, c, m, mlen, n, pk, sk);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy_afternm(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *k
+)
+{
+  return EverCrypt_NaCl_crypto_box_open_detached_afternm(m, c + 16U, c, clen - 16U, n, k);
+}
+
+uint32_t
+EverCrypt_NaCl_crypto_box_open_easy(
+  uint8_t *m,
+  uint8_t *c,
+  uint32_t clen,
+  uint8_t *n,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  return EverCrypt_NaCl_crypto_box_open_detached(m, c + 16U, c, clen - 16U, n, pk, sk);
+}
@@ -25,17 +25,13 @@
 
 #include "EverCrypt_Poly1305.h"
 
+#include "internal/EverCrypt_Dispatch.h"
 #include "internal/Vale.h"
 #include "config.h"
 
-KRML_MAYBE_UNUSED static void
-poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
+#if HACL_CAN_COMPILE_VALE
+void EverCrypt_Poly1305_mac_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
 {
-  KRML_MAYBE_UNUSED_VAR(dst);
-  KRML_MAYBE_UNUSED_VAR(src);
-  KRML_MAYBE_UNUSED_VAR(len);
-  KRML_MAYBE_UNUSED_VAR(key);
-  #if HACL_CAN_COMPILE_VALE
   uint8_t ctx[192U] = { 0U };
   memcpy(ctx + 24U, key, 32U * sizeof (uint8_t));
   uint32_t n_blocks = len / 16U;
@@ -55,36 +51,11 @@ poly1305_vale(uint8_t *dst, uint8_t *src, uint32_t len, uint8_t *key)
     x64_poly1305(ctx, tmp, (uint64_t)n_extra, 1ULL);
   }
   memcpy(dst, ctx, 16U * sizeof (uint8_t));
-  #endif
 }
+#endif
 
 void EverCrypt_Poly1305_mac(uint8_t *output, uint8_t *input, uint32_t input_len, uint8_t *key)
 {
-  bool vec256 = EverCrypt_AutoConfig2_has_vec256();
-  bool vec128 = EverCrypt_AutoConfig2_has_vec128();
-  #if HACL_CAN_COMPILE_VEC256
-  if (vec256)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec128);
-    Hacl_MAC_Poly1305_Simd256_mac(output, input, input_len, key);
-    return;
-  }
-  #endif
-  #if HACL_CAN_COMPILE_VEC128
-  if (vec128)
-  {
-    KRML_MAYBE_UNUSED_VAR(vec256);
-    Hacl_MAC_Poly1305_Simd128_mac(output, input, input_len, key);
-    return;
-  }
-  #endif
-  KRML_MAYBE_UNUSED_VAR(vec256);
-  KRML_MAYBE_UNUSED_VAR(vec128);
-  #if HACL_CAN_COMPILE_VALE
-  poly1305_vale(output, input, input_len, key);
-  #else
-  KRML_HOST_IGNORE(poly1305_vale);
-  Hacl_MAC_Poly1305_mac(output, input, input_len, key);
-  #endif
+  EverCrypt_Dispatch_functions.poly1305_mac(output, input, input_len, key);
 }
 
@@ -0,0 +1,270 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This is a hand-written file. */
+
+#include "EverCrypt_Random.h"
+
+#include "lib_memzero0.h"
+
+#if (defined(_WIN32) || defined(_WIN64))
+
+#include <stdlib.h>
+#define RANDOM_THREAD_LOCAL __declspec(thread)
+
+#else
+
+/* assume POSIX here */
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define RANDOM_THREAD_LOCAL __thread
+
+#endif
+
+/* Size of the per-thread output buffer. Requests of at least half this size
+   bypass the buffer and are generated straight into the caller's memory. */
+#define RANDOM_BUFFER_LEN (4096U)
+
+/* The part of the per-thread state that must not survive a fork. On Linux it
+   lives in its own mapping marked MADV_WIPEONFORK, so that a child process sees
+   `live == 0` and reseeds instead of replaying its parent's output. */
+typedef struct random_page_s
+{
+  uint32_t live;
+  uint32_t pos;
+#if !(defined(_WIN32) || defined(_WIN64))
+  pid_t pid;
+#endif
+  uint8_t buf[RANDOM_BUFFER_LEN];
+}
+random_page;
+
+typedef struct random_thread_s
+{
+  random_page *page;
+  EverCrypt_DRBG_state_s *st;
+  bool wipe_on_fork;
+}
+random_thread;
+
+static RANDOM_THREAD_LOCAL random_thread *random_tls = NULL;
+
+#if !(defined(_WIN32) || defined(_WIN64))
+
+static void random_free_thread(void *p)
+{
+  random_thread *t = (random_thread *)p;
+  if (t->st != NULL)
+  {
+    EverCrypt_DRBG_uninstantiate(t->st);
+  }
+  Lib_Memzero0_memzero(t->page, 1U, random_page, void *);
+  munmap(t->page, sizeof (random_page));
+  free(t);
+  random_tls = NULL;
+}
+
+static pthread_key_t random_key;
+static pthread_once_t random_key_once = PTHREAD_ONCE_INIT;
+
+/* Without a key, the state of a thread could not be reclaimed when it exits, so
+   EverCrypt_Random_bytes then falls back to a fresh DRBG per call. */
+static bool random_key_ok = false;
+
+static void random_make_key(void)
+{
+  random_key_ok = pthread_key_create(&random_key, random_free_thread) == 0;
+}
+
+#endif
+
+static random_thread *random_get_thread(void)
+{
+  if (random_tls != NULL)
+  {
+    return random_tls;
+  }
+#if !(defined(_WIN32) || defined(_WIN64))
+  pthread_once(&random_key_once, random_make_key);
+  if (!random_key_ok)
+  {
+    return NULL;
+  }
+#endif
+  random_thread *t = (random_thread *)calloc(1U, sizeof (random_thread));
+  if (t == NULL)
+  {
+    return NULL;
+  }
+#if (defined(_WIN32) || defined(_WIN64))
+  /* There is no fork, and no portable thread-exit hook for a plain C library:
+     the state of an exiting thread is not reclaimed. */
+  t->page = (random_page *)calloc(1U, sizeof (random_page));
+  if (t->page == NULL)
+  {
+    free(t);
+    return NULL;
+  }
+#else
+  void *page =
+    mmap(NULL, sizeof (random_page), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (page == MAP_FAILED)
+  {
+    free(t);
+    return NULL;
+  }
+  t->page = (random_page *)page;
+#ifdef MADV_WIPEONFORK
+  t->wipe_on_fork = madvise(page, sizeof (random_page), MADV_WIPEONFORK) == 0;
+#endif
+  if (pthread_setspecific(random_key, t) != 0)
+  {
+    munmap(page, sizeof (random_page));
+    free(t);
+    return NULL;
+  }
+#endif
+  random_tls = t;
+  return t;
+}
+
+static bool random_is_live(random_thread *t)
+{
+#if (defined(_WIN32) || defined(_WIN64))
+  return t->page->live != 0U;
+#else
+  if (t->wipe_on_fork)
+  {
+    return t->page->live != 0U;
+  }
+  return t->page->live != 0U && t->page->pid == getpid();
+#endif
+}
+
+/* (Re)instantiates the DRBG of the current thread. After a fork, `t->st` is the
+   child's copy of the parent's state, and is discarded. */
+static bool random_reseed(random_thread *t)
+{
+  random_page *p = t->page;
+  uint8_t personalization[1U] = { 0U };
+  if (t->st != NULL)
+  {
+    EverCrypt_DRBG_uninstantiate(t->st);
+    t->st = NULL;
+  }
+  Lib_Memzero0_memzero(p->buf, RANDOM_BUFFER_LEN, uint8_t, void *);
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  if (!EverCrypt_DRBG_instantiate(st, personalization, 0U))
+  {
+    EverCrypt_DRBG_uninstantiate(st);
+    return false;
+  }
+  t->st = st;
+  p->pos = RANDOM_BUFFER_LEN;
+#if !(defined(_WIN32) || defined(_WIN64))
+  p->pid = getpid();
+#endif
+  p->live = 1U;
+  return true;
+}
+
+/* Generates `len` bytes straight into `output`, in requests the DRBG accepts. */
+static bool random_generate(EverCrypt_DRBG_state_s *st, uint8_t *output, uint32_t len)
+{
+  uint8_t additional_input[1U] = { 0U };
+  while (len > 0U)
+  {
+    uint32_t n = len;
+    if (n > EverCrypt_DRBG_max_output_length)
+    {
+      n = EverCrypt_DRBG_max_output_length;
+    }
+    if (!EverCrypt_DRBG_generate(output, st, n, additional_input, 0U))
+    {
+      return false;
+    }
+    output = output + n;
+    len = len - n;
+  }
+  return true;
+}
+
+/* The unbuffered path, used when no per-thread state can be set up. */
+static bool random_bytes_unbuffered(uint8_t *output, uint32_t len)
+{
+  uint8_t personalization[1U] = { 0U };
+  EverCrypt_DRBG_state_s *st = EverCrypt_DRBG_create(Spec_Hash_Definitions_SHA2_256);
+  if (st == NULL)
+  {
+    return false;
+  }
+  bool ok =
+    EverCrypt_DRBG_instantiate(st, personalization, 0U) && random_generate(st, output, len);
+  EverCrypt_DRBG_uninstantiate(st);
+  return ok;
+}
+
+bool EverCrypt_Random_bytes(uint8_t *output, uint32_t len)
+{
+  uint8_t additional_input[1U] = { 0U };
+  random_thread *t = random_get_thread();
+  if (t == NULL)
+  {
+    return random_bytes_unbuffered(output, len);
+  }
+  if (!random_is_live(t) && !random_reseed(t))
+  {
+    return false;
+  }
+  if (len >= RANDOM_BUFFER_LEN / 2U)
+  {
+    return random_generate(t->st, output, len);
+  }
+  random_page *p = t->page;
+  while (len > 0U)
+  {
+    if (p->pos == RANDOM_BUFFER_LEN)
+    {
+      if (!EverCrypt_DRBG_generate(p->buf, t->st, RANDOM_BUFFER_LEN, additional_input, 0U))
+      {
+        return false;
+      }
+      p->pos = 0U;
+    }
+    uint32_t n = RANDOM_BUFFER_LEN - p->pos;
+    if (n > len)
+    {
+      n = len;
+    }
+    memcpy(output, p->buf + p->pos, n);
+    /* Bytes that have been handed out must not linger in memory. */
+    Lib_Memzero0_memzero(p->buf + p->pos, n, uint8_t, void *);
+    p->pos = p->pos + n;
+    output = output + n;
+    len = len - n;
+  }
+  return true;
+}
@@ -0,0 +1,200 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/* This is a hand-written file. It is compiled with 128-bit vectors enabled and must only
+ * be reached after a runtime check. */
+
+#include "Hacl_AEAD_XChacha20Poly1305_Simd128.h"
+
+#include "Hacl_Chacha20.h"
+#include "Hacl_Chacha20_Vec128.h"
+#include "lib_memzero0.h"
+
+/* The ChaCha20 nonce is four zero bytes followed by the last 8 bytes of the extended nonce. */
+static inline void chacha20_nonce(uint8_t *cnonce, uint8_t *nonce)
+{
+  memset(cnonce, 0U, 4U * sizeof (uint8_t));
+  memcpy(cnonce + 4U, nonce + 16U, 8U * sizeof (uint8_t));
+}
+
+void
+Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt(
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+)
+{
+  uint8_t subkey[32U] = { 0U };
+  uint8_t cnonce[12U] = { 0U };
+  Hacl_Chacha20_hchacha20(subkey, key, nonce);
+  chacha20_nonce(cnonce, nonce);
+  Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(output,
+    tag,
+    input,
+    input_len,
+    data,
+    data_len,
+    subkey,
+    cnonce);
+  Lib_Memzero0_memzero(subkey, 32U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt(
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  uint8_t subkey[32U] = { 0U };
+  uint8_t cnonce[12U] = { 0U };
+  Hacl_Chacha20_hchacha20(subkey, key, nonce);
+  chacha20_nonce(cnonce, nonce);
+  uint32_t
+  res =
+    Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(output,
+      input,
+      input_len,
+      data,
+      data_len,
+      subkey,
+      cnonce,
+      tag);
+  Lib_Memzero0_memzero(subkey, 32U, uint8_t, void *);
+  return res;
+}
+
+/* Derive the subkeys of the m <= 4 objects starting at nonce into subkeys, using
+   one vector lane per object. keys holds 4 copies of the key; unused lanes work
+   on stale nonces and their results are ignored. */
+static inline void
+derive_subkeys(uint32_t m, uint8_t *subkeys, uint8_t *keys, uint8_t *nonces, uint8_t *nonce)
+{
+  for (uint32_t j = 0U; j < m; j++)
+  {
+    memcpy(nonces + j * 16U, nonce + j * 24U, 16U * sizeof (uint8_t));
+  }
+  Hacl_Chacha20_Vec128_hchacha20_128(subkeys, keys, nonces);
+}
+
+void
+Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt_batch(
+  uint32_t n,
+  uint8_t *output,
+  uint8_t *tag,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce
+)
+{
+  uint8_t keys[128U] = { 0U };
+  uint8_t nonces[64U] = { 0U };
+  uint8_t subkeys[128U] = { 0U };
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, memcpy(keys + i * 32U, key, 32U * sizeof (uint8_t)););
+  uint32_t i0 = 0U;
+  while (i0 < n)
+  {
+    uint32_t m = n - i0 < 4U ? n - i0 : 4U;
+    derive_subkeys(m, subkeys, keys, nonces, nonce + (size_t)i0 * 24U);
+    for (uint32_t j = 0U; j < m; j++)
+    {
+      uint32_t i = i0 + j;
+      uint8_t cnonce[12U] = { 0U };
+      chacha20_nonce(cnonce, nonce + (size_t)i * 24U);
+      Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(output + (size_t)i * input_len,
+        tag + (size_t)i * 16U,
+        input + (size_t)i * input_len,
+        input_len,
+        data + (size_t)i * data_len,
+        data_len,
+        subkeys + j * 32U,
+        cnonce);
+    }
+    i0 = i0 + m;
+  }
+  Lib_Memzero0_memzero(keys, 128U, uint8_t, void *);
+  Lib_Memzero0_memzero(subkeys, 128U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt_batch(
+  uint32_t n,
+  uint8_t *output,
+  uint8_t *input,
+  uint32_t input_len,
+  uint8_t *data,
+  uint32_t data_len,
+  uint8_t *key,
+  uint8_t *nonce,
+  uint8_t *tag
+)
+{
+  uint8_t keys[128U] = { 0U };
+  uint8_t nonces[64U] = { 0U };
+  uint8_t subkeys[128U] = { 0U };
+  uint32_t res = 0U;
+  KRML_MAYBE_FOR4(i, 0U, 4U, 1U, memcpy(keys + i * 32U, key, 32U * sizeof (uint8_t)););
+  uint32_t i0 = 0U;
+  while (i0 < n)
+  {
+    uint32_t m = n - i0 < 4U ? n - i0 : 4U;
+    derive_subkeys(m, subkeys, keys, nonces, nonce + (size_t)i0 * 24U);
+    for (uint32_t j = 0U; j < m; j++)
+    {
+      uint32_t i = i0 + j;
+      uint8_t cnonce[12U] = { 0U };
+      chacha20_nonce(cnonce, nonce + (size_t)i * 24U);
+      res =
+        res
+        |
+          Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(output + (size_t)i * input_len,
+            input + (size_t)i * input_len,
+            input_len,
+            data + (size_t)i * data_len,
+            data_len,
+            subkeys + j * 32U,
+            cnonce,
+            tag + (size_t)i * 16U);
+    }
+    i0 = i0 + m;
+  }
+  Lib_Memzero0_memzero(keys, 128U, uint8_t, void *);
+  Lib_Memzero0_memzero(subkeys, 128U, uint8_t, void *);
+  return res;
+}
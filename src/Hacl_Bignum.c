@@ -27,6 +27,153 @@
 
 #include "internal/Hacl_Krmllib.h"
 #include "internal/Hacl_Bignum_Base.h"
+#include "config.h"
+#include "bignum-inline.h"
+
+static const Hacl_Bignum_Kernels_u64 *kernels_u64 = &Hacl_Bignum_Kernels_portable_u64;
+
+void Hacl_Bignum_Kernels_set_u64(const Hacl_Bignum_Kernels_u64 *k)
+{
+#if defined(__GNUC__)
+  __atomic_store_n(&kernels_u64, k, __ATOMIC_RELEASE);
+#else
+  kernels_u64 = k;
+#endif
+}
+
+const Hacl_Bignum_Kernels_u64 *Hacl_Bignum_Kernels_get_u64(void)
+{
+#if defined(__GNUC__)
+  return __atomic_load_n(&kernels_u64, __ATOMIC_ACQUIRE);
+#else
+  return kernels_u64;
+#endif
+}
+
+#if HACL_CAN_COMPILE_INLINE_ASM
+
+static inline uint64_t
+bn_mul_add_row_u64(uint32_t aLen, uint64_t *a, uint64_t b, uint64_t *res)
+{
+  uint64_t c = 0ULL;
+  if (aLen >= 4U)
+  {
+    c = bn_mul_add_row4(res, a, b, (uint64_t)(aLen / 4U));
+  }
+  for (uint32_t i = aLen / 4U * 4U; i < aLen; i++)
+  {
+    uint64_t a_i = a[i];
+    uint64_t *res_i = res + i;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, b, c, res_i);
+  }
+  return c;
+}
+
+void
+Hacl_Bignum_Adx_bn_mul_u64(
+  uint32_t aLen,
+  uint64_t *a,
+  uint32_t bLen,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  memset(res, 0U, (aLen + bLen) * sizeof (uint64_t));
+  for (uint32_t i0 = 0U; i0 < bLen; i0++)
+  {
+    res[aLen + i0] = bn_mul_add_row_u64(aLen, a, b[i0], res + i0);
+  }
+}
+
+void Hacl_Bignum_Adx_bn_sqr_u64(uint32_t aLen, uint64_t *a, uint64_t *res)
+{
+  memset(res, 0U, (aLen + aLen) * sizeof (uint64_t));
+  for (uint32_t i0 = 0U; i0 < aLen; i0++)
+  {
+    res[i0 + i0] = bn_mul_add_row_u64(i0, a, a[i0], res + i0);
+  }
+  uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64(aLen + aLen, res, res, res);
+  KRML_MAYBE_UNUSED_VAR(c0);
+  KRML_CHECK_SIZE(sizeof (uint64_t), aLen + aLen);
+  uint64_t tmp[aLen + aLen];
+  memset(tmp, 0U, (aLen + aLen) * sizeof (uint64_t));
+  for (uint32_t i = 0U; i < aLen; i++)
+  {
+    FStar_UInt128_uint128 res1 = FStar_UInt128_mul_wide(a[i], a[i]);
+    uint64_t hi = FStar_UInt128_uint128_to_uint64(FStar_UInt128_shift_right(res1, 64U));
+    uint64_t lo = FStar_UInt128_uint128_to_uint64(res1);
+    tmp[2U * i] = lo;
+    tmp[2U * i + 1U] = hi;
+  }
+  uint64_t c1 = Hacl_Bignum_Addition_bn_add_eq_len_u64(aLen + aLen, res, tmp, res);
+  KRML_MAYBE_UNUSED_VAR(c1);
+}
+
+static inline uint64_t
+bn_mont_reduction_rows_u64(uint32_t len, uint64_t *n, uint64_t nInv, uint64_t *c)
+{
+  uint64_t c0 = 0ULL;
+  for (uint32_t i0 = 0U; i0 < len; i0++)
+  {
+    uint64_t qj = nInv * c[i0];
+    uint64_t c1 = bn_mul_add_row_u64(len, n, qj, c + i0);
+    uint64_t *resb = c + len + i0;
+    uint64_t res_j = c[len + i0];
+    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, c1, res_j, resb);
+  }
+  return c0;
+}
+
+void
+Hacl_Bignum_Adx_bn_mont_reduction_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+)
+{
+  uint64_t c00 = bn_mont_reduction_rows_u64(len, n, nInv, c);
+  memcpy(res, c + len, len * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint64_t));
+  uint64_t c10 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(len, res, n, tmp);
+  uint64_t c2 = c00 - c10;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *os = res;
+    uint64_t x = (c2 & res[i]) | (~c2 & tmp[i]);
+    os[i] = x;
+  }
+}
+
+void
+Hacl_Bignum_Adx_bn_almost_mont_reduction_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+)
+{
+  uint64_t c00 = bn_mont_reduction_rows_u64(len, n, nInv, c);
+  memcpy(res, c + len, len * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint64_t));
+  uint64_t c1 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(len, res, n, tmp);
+  KRML_MAYBE_UNUSED_VAR(c1);
+  uint64_t m = 0ULL - c00;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *os = res;
+    uint64_t x = (m & tmp[i]) | (~m & res[i]);
+    os[i] = x;
+  }
+}
+
+#endif
 
 void
 Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint32(
@@ -150,6 +297,292 @@ Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint32(
   KRML_MAYBE_UNUSED_VAR(c9);
 }
 
+/* Crossover points, in limbs, of the 64-bit multiplication and squaring.
+   Below the Karatsuba threshold, bn_karatsuba_{mul,sqr}_uint64 use the
+   schoolbook base case; the MULX/ADCX/ADOX rows make that base case much
+   faster, which moves the crossover up. From the Toom-3 threshold on, operands
+   are split in three instead of two. The values were picked by timing
+   Hacl_Bignum64_mul and Hacl_Bignum64_sqr on x86_64. */
+#define BN_KARATSUBA_MUL_THRESHOLD_U64 32U
+#define BN_KARATSUBA_MUL_THRESHOLD_ADX_U64 40U
+#define BN_KARATSUBA_SQR_THRESHOLD_U64 48U
+#define BN_KARATSUBA_SQR_THRESHOLD_ADX_U64 48U
+#define BN_TOOM3_MUL_THRESHOLD_U64 96U
+#define BN_TOOM3_SQR_THRESHOLD_U64 128U
+
+/* res[0..len) += a[0..len) * b, returns the carry limb */
+static uint64_t
+bn_mul1_add_portable_u64(uint32_t len, uint64_t *a, uint64_t b, uint64_t *res)
+{
+  uint64_t c = 0ULL;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t a_i = a[i];
+    uint64_t *res_i = res + i;
+    c = Hacl_Bignum_Base_mul_wide_add2_u64(a_i, b, c, res_i);
+  }
+  return c;
+}
+
+/* res[0..len) += c, returns the carry */
+static inline uint64_t bn_add1_u64(uint32_t len, uint64_t *res, uint64_t c)
+{
+  uint64_t c0 = c;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *res_i = res + i;
+    c0 = Lib_IntTypes_Intrinsics_add_carry_u64(c0, res_i[0U], 0ULL, res_i);
+  }
+  return c0;
+}
+
+/* res[0..len) -= c, returns the borrow */
+static inline uint64_t bn_sub1_u64(uint32_t len, uint64_t *res, uint64_t c)
+{
+  uint64_t c0 = c;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *res_i = res + i;
+    c0 = Lib_IntTypes_Intrinsics_sub_borrow_u64(c0, res_i[0U], 0ULL, res_i);
+  }
+  return c0;
+}
+
+/* res[0..resLen) += a[0..aLen), with aLen <= resLen */
+static inline void bn_add_in_place_u64(uint32_t resLen, uint64_t *res, uint32_t aLen, uint64_t *a)
+{
+  uint64_t c = Hacl_Bignum_Addition_bn_add_eq_len_u64(aLen, res, a, res);
+  uint64_t c1 = bn_add1_u64(resLen - aLen, res + aLen, c);
+  KRML_MAYBE_UNUSED_VAR(c1);
+}
+
+/* res[0..resLen) -= a[0..aLen), with aLen <= resLen */
+static inline void bn_sub_in_place_u64(uint32_t resLen, uint64_t *res, uint32_t aLen, uint64_t *a)
+{
+  uint64_t c = Hacl_Bignum_Addition_bn_sub_eq_len_u64(aLen, res, a, res);
+  uint64_t c1 = bn_sub1_u64(resLen - aLen, res + aLen, c);
+  KRML_MAYBE_UNUSED_VAR(c1);
+}
+
+/* Constant-time select between two candidates, writes a if mask is all ones
+   and b if mask is zero */
+static inline void
+bn_select_u64(uint32_t len, uint64_t mask, uint64_t *a, uint64_t *b, uint64_t *res)
+{
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *os = res;
+    uint64_t x = (mask & a[i]) | (~mask & b[i]);
+    os[i] = x;
+  }
+}
+
+/* a <- a / 2, for an even a */
+static inline void bn_half_u64(uint32_t len, uint64_t *a)
+{
+  for (uint32_t i = 0U; i < len - 1U; i++)
+  {
+    a[i] = a[i] >> 1U | a[i + 1U] << 63U;
+  }
+  a[len - 1U] = a[len - 1U] >> 1U;
+}
+
+/* a <- a / 3, for an a that is a multiple of 3. Each quotient limb is the
+   current limb times 3^(-1) mod 2^64; the borrow into the next limb is the
+   number of times 3 * q exceeds 2^64. */
+static inline void bn_divexact3_u64(uint32_t len, uint64_t *a)
+{
+  uint64_t c = 0ULL;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t s = a[i];
+    uint64_t l = s - c;
+    uint64_t c0 = ~FStar_UInt64_gte_mask(s, c) & 1ULL;
+    uint64_t q = l * 0xAAAAAAAAAAAAAAABULL;
+    a[i] = q;
+    uint64_t c1 = FStar_UInt64_gte_mask(q, 0x5555555555555556ULL) & 1ULL;
+    uint64_t c2 = FStar_UInt64_gte_mask(q, 0xAAAAAAAAAAAAAAABULL) & 1ULL;
+    c = c0 + c1 + c2;
+  }
+}
+
+/* Evaluate a = a0 + a1 x + a2 x^2, with k-limb a0, a1 and h-limb a2, at
+   x = 1, -1 and 2. The results are k + 1 limbs; the value at -1 is returned as
+   its absolute value and the function returns its sign bit. */
+static inline uint64_t
+bn_toom3_eval_u64(
+  uint32_t k,
+  uint32_t h,
+  uint64_t *a,
+  uint64_t *tmp,
+  uint64_t *p1,
+  uint64_t *pm1,
+  uint64_t *p2
+)
+{
+  uint64_t *a0 = a;
+  uint64_t *a1 = a + k;
+  uint64_t *a2 = tmp;
+  uint64_t *e = tmp + k;
+  memset(a2, 0U, k * sizeof (uint64_t));
+  memcpy(a2, a + k + k, h * sizeof (uint64_t));
+  e[k] = Hacl_Bignum_Addition_bn_add_eq_len_u64(k, a0, a2, e);
+  uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64(k, e, a1, p1);
+  p1[k] = e[k] + c0;
+  uint64_t c1 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(k, e, a1, pm1);
+  pm1[k] = e[k] - c1;
+  uint64_t sign = pm1[k] >> 63U;
+  uint64_t mask = 0ULL - sign;
+  for (uint32_t i = 0U; i < k + 1U; i++)
+  {
+    pm1[i] = pm1[i] ^ mask;
+  }
+  uint64_t c2 = bn_add1_u64(k + 1U, pm1, sign);
+  KRML_MAYBE_UNUSED_VAR(c2);
+  uint64_t c3 = Hacl_Bignum_Addition_bn_add_eq_len_u64(k, a2, a2, p2);
+  uint64_t c4 = Hacl_Bignum_Addition_bn_add_eq_len_u64(k, p2, a1, p2);
+  p2[k] = c3 + c4;
+  uint64_t c5 = Hacl_Bignum_Addition_bn_add_eq_len_u64(k + 1U, p2, p2, p2);
+  KRML_MAYBE_UNUSED_VAR(c5);
+  uint64_t c6 = Hacl_Bignum_Addition_bn_add_eq_len_u64(k, p2, a0, p2);
+  p2[k] = p2[k] + c6;
+  return sign;
+}
+
+/* Recover the product from r0 = res[0..2k), rinf = res[4k..2 aLen) and the
+   (2k + 2)-limb values r1, rm1 and r2 at x = 1, -1 and 2, where rm1 is an
+   absolute value with sign bit s. This is the interpolation sequence of
+   Bodrato, in which every intermediate value but r(-1) is non-negative. */
+static inline void
+bn_toom3_interpolate_u64(
+  uint32_t aLen,
+  uint32_t k,
+  uint64_t s,
+  uint64_t *r1,
+  uint64_t *rm1,
+  uint64_t *r2,
+  uint64_t *t,
+  uint64_t *res
+)
+{
+  uint32_t w = k + k + 2U;
+  uint32_t hh = aLen + aLen - 4U * k;
+  uint64_t *r0 = res;
+  uint64_t *rinf = res + 4U * k;
+  uint64_t mask = 0ULL - s;
+  /* r2 <- (r2 - r(-1)) / 3 */
+  uint64_t c0 = Hacl_Bignum_Addition_bn_add_eq_len_u64(w, r2, rm1, t);
+  uint64_t c1 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(w, r2, rm1, r2);
+  KRML_MAYBE_UNUSED_VAR(c0);
+  KRML_MAYBE_UNUSED_VAR(c1);
+  bn_select_u64(w, mask, t, r2, r2);
+  bn_divexact3_u64(w, r2);
+  /* rm1 <- (r1 - r(-1)) / 2 */
+  uint64_t c2 = Hacl_Bignum_Addition_bn_add_eq_len_u64(w, r1, rm1, t);
+  uint64_t c3 = Hacl_Bignum_Addition_bn_sub_eq_len_u64(w, r1, rm1, rm1);
+  KRML_MAYBE_UNUSED_VAR(c2);
+  KRML_MAYBE_UNUSED_VAR(c3);
+  bn_select_u64(w, mask, t, rm1, rm1);
+  bn_half_u64(w, rm1);
+  /* r1 <- r1 - r0 */
+  bn_sub_in_place_u64(w, r1, k + k, r0);
+  /* r2 <- (r2 - r1) / 2 */
+  bn_sub_in_place_u64(w, r2, w, r1);
+  bn_half_u64(w, r2);
+  /* r1 <- r1 - rm1 - rinf */
+  bn_sub_in_place_u64(w, r1, w, rm1);
+  bn_sub_in_place_u64(w, r1, hh, rinf);
+  /* r2 <- r2 - 2 rinf */
+  bn_sub_in_place_u64(w, r2, hh, rinf);
+  bn_sub_in_place_u64(w, r2, hh, rinf);
+  /* rm1 <- rm1 - r2 */
+  bn_sub_in_place_u64(w, rm1, w, r2);
+  /* res <- r0 + rm1 x + r1 x^2 + r2 x^3 + rinf x^4 */
+  uint32_t resLen = aLen + aLen;
+  bn_add_in_place_u64(resLen - k, res + k, w, rm1);
+  bn_add_in_place_u64(resLen - 2U * k, res + 2U * k, w, r1);
+  bn_add_in_place_u64(resLen - 3U * k, res + 3U * k, w, r2);
+}
+
+/* Toom-3 multiplication. Each operand is split into k = ceil(aLen / 3) limb
+   pieces and the five products at 0, 1, -1, 2 and infinity go through
+   bn_karatsuba_mul_uint64, which uses tmp as its scratch space. */
+static void bn_toom3_mul_u64(uint32_t aLen, uint64_t *a, uint64_t *b, uint64_t *tmp, uint64_t *res)
+{
+  uint32_t k = (aLen + 2U) / 3U;
+  uint32_t h = aLen - k - k;
+  uint32_t w = k + k + 2U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), 8U * (k + 1U) + 4U * w);
+  uint64_t scratch[8U * (k + 1U) + 4U * w];
+  memset(scratch, 0U, (8U * (k + 1U) + 4U * w) * sizeof (uint64_t));
+  uint64_t *pa1 = scratch;
+  uint64_t *pam1 = scratch + k + 1U;
+  uint64_t *pa2 = scratch + 2U * (k + 1U);
+  uint64_t *pb1 = scratch + 3U * (k + 1U);
+  uint64_t *pbm1 = scratch + 4U * (k + 1U);
+  uint64_t *pb2 = scratch + 5U * (k + 1U);
+  uint64_t *etmp = scratch + 6U * (k + 1U);
+  uint64_t *r1 = scratch + 8U * (k + 1U);
+  uint64_t *rm1 = r1 + w;
+  uint64_t *r2 = rm1 + w;
+  uint64_t *t = r2 + w;
+  uint64_t sa = bn_toom3_eval_u64(k, h, a, etmp, pa1, pam1, pa2);
+  uint64_t sb = bn_toom3_eval_u64(k, h, b, etmp, pb1, pbm1, pb2);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(k + 1U, pa1, pb1, tmp, r1);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(k + 1U, pam1, pbm1, tmp, rm1);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(k + 1U, pa2, pb2, tmp, r2);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(k, a, b, tmp, res);
+  memset(res + k + k, 0U, (k + k) * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(h, a + k + k, b + k + k, tmp, res + 4U * k);
+  bn_toom3_interpolate_u64(aLen, k, sa ^ sb, r1, rm1, r2, t, res);
+}
+
+static void bn_toom3_sqr_u64(uint32_t aLen, uint64_t *a, uint64_t *tmp, uint64_t *res)
+{
+  uint32_t k = (aLen + 2U) / 3U;
+  uint32_t h = aLen - k - k;
+  uint32_t w = k + k + 2U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), 5U * (k + 1U) + 4U * w);
+  uint64_t scratch[5U * (k + 1U) + 4U * w];
+  memset(scratch, 0U, (5U * (k + 1U) + 4U * w) * sizeof (uint64_t));
+  uint64_t *pa1 = scratch;
+  uint64_t *pam1 = scratch + k + 1U;
+  uint64_t *pa2 = scratch + 2U * (k + 1U);
+  uint64_t *etmp = scratch + 3U * (k + 1U);
+  uint64_t *r1 = scratch + 5U * (k + 1U);
+  uint64_t *rm1 = r1 + w;
+  uint64_t *r2 = rm1 + w;
+  uint64_t *t = r2 + w;
+  uint64_t sa = bn_toom3_eval_u64(k, h, a, etmp, pa1, pam1, pa2);
+  KRML_MAYBE_UNUSED_VAR(sa);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(k + 1U, pa1, tmp, r1);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(k + 1U, pam1, tmp, rm1);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(k + 1U, pa2, tmp, r2);
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(k, a, tmp, res);
+  memset(res + k + k, 0U, (k + k) * sizeof (uint64_t));
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(h, a + k + k, tmp, res + 4U * k);
+  bn_toom3_interpolate_u64(aLen, k, 0ULL, r1, rm1, r2, t, res);
+}
+
+/* Karatsuba needs an even length: for an odd aLen, multiply the low aLen - 1
+   limbs recursively and add the contributions of the top limbs with two rows. */
+static void
+bn_karatsuba_mul_odd_u64(uint32_t aLen, uint64_t *a, uint64_t *b, uint64_t *tmp, uint64_t *res)
+{
+  uint32_t len = aLen - 1U;
+  Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, a, b, tmp, res);
+  res[len + len] = Hacl_Bignum_Kernels_get_u64()->mul1_add(len, b, a[len], res + len);
+  res[len + len + 1U] = Hacl_Bignum_Kernels_get_u64()->mul1_add(aLen, a, b[len], res + len);
+}
+
+static void bn_karatsuba_sqr_odd_u64(uint32_t aLen, uint64_t *a, uint64_t *tmp, uint64_t *res)
+{
+  uint32_t len = aLen - 1U;
+  Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(len, a, tmp, res);
+  res[len + len] = Hacl_Bignum_Kernels_get_u64()->mul1_add(len, a, a[len], res + len);
+  res[len + len + 1U] = Hacl_Bignum_Kernels_get_u64()->mul1_add(aLen, a, a[len], res + len);
+}
+
 void
 Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(
   uint32_t aLen,
@@ -159,9 +592,19 @@ Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(
   uint64_t *res
 )
 {
-  if (aLen < 32U || aLen % 2U == 1U)
+  if (aLen < Hacl_Bignum_Kernels_get_u64()->karatsuba_mul_threshold)
+  {
+    Hacl_Bignum_Kernels_get_u64()->mul(aLen, a, aLen, b, res);
+    return;
+  }
+  if (aLen >= BN_TOOM3_MUL_THRESHOLD_U64)
   {
-    Hacl_Bignum_Multiplication_bn_mul_u64(aLen, a, aLen, b, res);
+    bn_toom3_mul_u64(aLen, a, b, tmp, res);
+    return;
+  }
+  if (aLen % 2U == 1U)
+  {
+    bn_karatsuba_mul_odd_u64(aLen, a, b, tmp, res);
     return;
   }
   uint32_t len2 = aLen / 2U;
@@ -377,9 +820,19 @@ Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(
   uint64_t *res
 )
 {
-  if (aLen < 32U || aLen % 2U == 1U)
+  if (aLen < Hacl_Bignum_Kernels_get_u64()->karatsuba_sqr_threshold)
   {
-    Hacl_Bignum_Multiplication_bn_sqr_u64(aLen, a, res);
+    Hacl_Bignum_Kernels_get_u64()->sqr(aLen, a, res);
+    return;
+  }
+  if (aLen >= BN_TOOM3_SQR_THRESHOLD_U64)
+  {
+    bn_toom3_sqr_u64(aLen, a, tmp, res);
+    return;
+  }
+  if (aLen % 2U == 1U)
+  {
+    bn_karatsuba_sqr_odd_u64(aLen, a, tmp, res);
     return;
   }
   uint32_t len2 = aLen / 2U;
@@ -1048,7 +1501,13 @@ Hacl_Bignum_Montgomery_bn_precomp_r2_mod_n_u64(
 }
 
 static void
-bn_mont_reduction_u64(uint32_t len, uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
+bn_mont_reduction_portable_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+)
 {
   uint64_t c0 = 0ULL;
   for (uint32_t i0 = 0U; i0 < len; i0++)
@@ -1142,7 +1601,7 @@ Hacl_Bignum_Montgomery_bn_to_mont_u64(
   uint64_t tmp[4U * len];
   memset(tmp, 0U, 4U * len * sizeof (uint64_t));
   Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, a, r2, tmp, c);
-  bn_mont_reduction_u64(len, n, nInv, c, aM);
+  Hacl_Bignum_Kernels_get_u64()->mont_reduction(len, n, nInv, c, aM);
 }
 
 void
@@ -1158,7 +1617,7 @@ Hacl_Bignum_Montgomery_bn_from_mont_u64(
   uint64_t tmp[len + len];
   memset(tmp, 0U, (len + len) * sizeof (uint64_t));
   memcpy(tmp, aM, len * sizeof (uint64_t));
-  bn_mont_reduction_u64(len, n, nInv_u64, tmp, a);
+  Hacl_Bignum_Kernels_get_u64()->mont_reduction(len, n, nInv_u64, tmp, a);
 }
 
 void
@@ -1178,7 +1637,7 @@ Hacl_Bignum_Montgomery_bn_mont_mul_u64(
   uint64_t tmp[4U * len];
   memset(tmp, 0U, 4U * len * sizeof (uint64_t));
   Hacl_Bignum_Karatsuba_bn_karatsuba_mul_uint64(len, aM, bM, tmp, c);
-  bn_mont_reduction_u64(len, n, nInv_u64, c, resM);
+  Hacl_Bignum_Kernels_get_u64()->mont_reduction(len, n, nInv_u64, c, resM);
 }
 
 void
@@ -1197,7 +1656,7 @@ Hacl_Bignum_Montgomery_bn_mont_sqr_u64(
   uint64_t tmp[4U * len];
   memset(tmp, 0U, 4U * len * sizeof (uint64_t));
   Hacl_Bignum_Karatsuba_bn_karatsuba_sqr_uint64(len, aM, tmp, c);
-  bn_mont_reduction_u64(len, n, nInv_u64, c, resM);
+  Hacl_Bignum_Kernels_get_u64()->mont_reduction(len, n, nInv_u64, c, resM);
 }
 
 void
@@ -1297,8 +1756,8 @@ bn_almost_mont_sqr_u32(
   Hacl_Bignum_AlmostMontgomery_bn_almost_mont_reduction_u32(len, n, nInv_u64, c, resM);
 }
 
-void
-Hacl_Bignum_AlmostMontgomery_bn_almost_mont_reduction_u64(
+static void
+bn_almost_mont_reduction_portable_u64(
   uint32_t len,
   uint64_t *n,
   uint64_t nInv,
@@ -1355,6 +1814,48 @@ Hacl_Bignum_AlmostMontgomery_bn_almost_mont_reduction_u64(
   }
 }
 
+void
+Hacl_Bignum_AlmostMontgomery_bn_almost_mont_reduction_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t nInv,
+  uint64_t *c,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_Kernels_get_u64()->almost_mont_reduction(len, n, nInv, c, res);
+}
+
+const
+Hacl_Bignum_Kernels_u64
+Hacl_Bignum_Kernels_portable_u64 =
+  {
+    .karatsuba_mul_threshold = BN_KARATSUBA_MUL_THRESHOLD_U64,
+    .karatsuba_sqr_threshold = BN_KARATSUBA_SQR_THRESHOLD_U64,
+    .mul1_add = bn_mul1_add_portable_u64,
+    .mul = Hacl_Bignum_Multiplication_bn_mul_u64,
+    .sqr = Hacl_Bignum_Multiplication_bn_sqr_u64,
+    .mont_reduction = bn_mont_reduction_portable_u64,
+    .almost_mont_reduction = bn_almost_mont_reduction_portable_u64
+  };
+
+#if HACL_CAN_COMPILE_INLINE_ASM
+
+const
+Hacl_Bignum_Kernels_u64
+Hacl_Bignum_Kernels_adx_u64 =
+  {
+    .karatsuba_mul_threshold = BN_KARATSUBA_MUL_THRESHOLD_ADX_U64,
+    .karatsuba_sqr_threshold = BN_KARATSUBA_SQR_THRESHOLD_ADX_U64,
+    .mul1_add = bn_mul_add_row_u64,
+    .mul = Hacl_Bignum_Adx_bn_mul_u64,
+    .sqr = Hacl_Bignum_Adx_bn_sqr_u64,
+    .mont_reduction = Hacl_Bignum_Adx_bn_mont_reduction_u64,
+    .almost_mont_reduction = Hacl_Bignum_Adx_bn_almost_mont_reduction_u64
+  };
+
+#endif
+
 static void
 bn_almost_mont_mul_u64(
   uint32_t len,
@@ -1857,56 +2358,66 @@ Hacl_Bignum_Exponentiation_bn_check_mod_exp_u64(
   return m00 & m;
 }
 
+uint32_t Hacl_Bignum_Exponentiation_bn_exp_vartime_window_bits(uint32_t bBits)
+{
+  if (bBits > 671U)
+  {
+    return 6U;
+  }
+  if (bBits > 239U)
+  {
+    return 5U;
+  }
+  if (bBits > 79U)
+  {
+    return 4U;
+  }
+  if (bBits > 23U)
+  {
+    return 3U;
+  }
+  return 1U;
+}
+
 void
-Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(
+Hacl_Bignum_Exponentiation_bn_precomp_odd_powers_u64(
   uint32_t len,
   uint64_t *n,
   uint64_t mu,
   uint64_t *r2,
   uint64_t *a,
-  uint32_t bBits,
-  uint64_t *b,
-  uint64_t *res
+  uint32_t wBits,
+  uint64_t *table
 )
 {
-  if (bBits < 200U)
+  Hacl_Bignum_Montgomery_bn_to_mont_u64(len, n, mu, r2, a, table);
+  if (wBits == 1U)
   {
-    KRML_CHECK_SIZE(sizeof (uint64_t), len);
-    uint64_t aM[len];
-    memset(aM, 0U, len * sizeof (uint64_t));
-    Hacl_Bignum_Montgomery_bn_to_mont_u64(len, n, mu, r2, a, aM);
-    KRML_CHECK_SIZE(sizeof (uint64_t), len);
-    uint64_t resM[len];
-    memset(resM, 0U, len * sizeof (uint64_t));
-    KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
-    uint64_t ctx[len + len];
-    memset(ctx, 0U, (len + len) * sizeof (uint64_t));
-    memcpy(ctx, n, len * sizeof (uint64_t));
-    memcpy(ctx + len, r2, len * sizeof (uint64_t));
-    uint64_t *ctx_n = ctx;
-    uint64_t *ctx_r2 = ctx + len;
-    Hacl_Bignum_Montgomery_bn_from_mont_u64(len, ctx_n, mu, ctx_r2, resM);
-    for (uint32_t i = 0U; i < bBits; i++)
-    {
-      uint32_t i1 = i / 64U;
-      uint32_t j = i % 64U;
-      uint64_t tmp = b[i1];
-      uint64_t bit = tmp >> j & 1ULL;
-      if (!(bit == 0ULL))
-      {
-        uint64_t *ctx_n0 = ctx;
-        bn_almost_mont_mul_u64(len, ctx_n0, mu, resM, aM, resM);
-      }
-      uint64_t *ctx_n0 = ctx;
-      bn_almost_mont_sqr_u64(len, ctx_n0, mu, aM, aM);
-    }
-    Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, resM, res);
     return;
   }
   KRML_CHECK_SIZE(sizeof (uint64_t), len);
-  uint64_t aM[len];
-  memset(aM, 0U, len * sizeof (uint64_t));
-  Hacl_Bignum_Montgomery_bn_to_mont_u64(len, n, mu, r2, a, aM);
+  uint64_t aM2[len];
+  memset(aM2, 0U, len * sizeof (uint64_t));
+  bn_almost_mont_sqr_u64(len, n, mu, table, aM2);
+  for (uint32_t i = 1U; i < 1U << (wBits - 1U); i++)
+  {
+    bn_almost_mont_mul_u64(len, n, mu, table + (i - 1U) * len, aM2, table + i * len);
+  }
+}
+
+void
+Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_table_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint32_t wBits,
+  uint64_t *table,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
   KRML_CHECK_SIZE(sizeof (uint64_t), len);
   uint64_t resM[len];
   memset(resM, 0U, len * sizeof (uint64_t));
@@ -1919,71 +2430,90 @@ Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(
   {
     bLen = (bBits - 1U) / 64U + 1U;
   }
-  KRML_CHECK_SIZE(sizeof (uint64_t), len + len);
-  uint64_t ctx[len + len];
-  memset(ctx, 0U, (len + len) * sizeof (uint64_t));
-  memcpy(ctx, n, len * sizeof (uint64_t));
-  memcpy(ctx + len, r2, len * sizeof (uint64_t));
-  KRML_CHECK_SIZE(sizeof (uint64_t), 16U * len);
-  uint64_t table[16U * len];
-  memset(table, 0U, 16U * len * sizeof (uint64_t));
-  KRML_CHECK_SIZE(sizeof (uint64_t), len);
-  uint64_t tmp[len];
-  memset(tmp, 0U, len * sizeof (uint64_t));
-  uint64_t *t0 = table;
-  uint64_t *t1 = table + len;
-  uint64_t *ctx_n0 = ctx;
-  uint64_t *ctx_r20 = ctx + len;
-  Hacl_Bignum_Montgomery_bn_from_mont_u64(len, ctx_n0, mu, ctx_r20, t0);
-  memcpy(t1, aM, len * sizeof (uint64_t));
-  KRML_MAYBE_FOR7(i,
-    0U,
-    7U,
-    1U,
-    uint64_t *t11 = table + (i + 1U) * len;
-    uint64_t *ctx_n1 = ctx;
-    bn_almost_mont_sqr_u64(len, ctx_n1, mu, t11, tmp);
-    memcpy(table + (2U * i + 2U) * len, tmp, len * sizeof (uint64_t));
-    uint64_t *t2 = table + (2U * i + 2U) * len;
-    uint64_t *ctx_n = ctx;
-    bn_almost_mont_mul_u64(len, ctx_n, mu, aM, t2, tmp);
-    memcpy(table + (2U * i + 3U) * len, tmp, len * sizeof (uint64_t)););
-  if (bBits % 4U != 0U)
-  {
-    uint32_t i = bBits / 4U * 4U;
-    uint64_t bits_c = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i, 4U);
-    uint32_t bits_l32 = (uint32_t)bits_c;
-    const uint64_t *a_bits_l = table + bits_l32 * len;
-    memcpy(resM, (uint64_t *)a_bits_l, len * sizeof (uint64_t));
-  }
-  else
+  /* Left-to-right sliding window: every window starts and ends with a set bit,
+     so that only the odd powers a^1, a^3, .., a^(2^wBits - 1) are needed. The
+     leading zeros of b are skipped and the first window is copied rather than
+     multiplied into one, e.g. b = 65537 costs 16 squarings and 1 multiplication. */
+  bool started = false;
+  uint32_t i = bBits;
+  while (i > 0U)
   {
-    uint64_t *ctx_n = ctx;
-    uint64_t *ctx_r2 = ctx + len;
-    Hacl_Bignum_Montgomery_bn_from_mont_u64(len, ctx_n, mu, ctx_r2, resM);
+    if (Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i - 1U, 1U) == 0ULL)
+    {
+      if (started)
+      {
+        bn_almost_mont_sqr_u64(len, n, mu, resM, resM);
+      }
+      i = i - 1U;
+    }
+    else
+    {
+      uint32_t j;
+      if (i >= wBits)
+      {
+        j = i - wBits;
+      }
+      else
+      {
+        j = 0U;
+      }
+      while (Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, j, 1U) == 0ULL)
+      {
+        j++;
+      }
+      uint32_t bits_l32 = (uint32_t)Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, j, i - j);
+      uint64_t *a_bits_l = table + (bits_l32 >> 1U) * len;
+      if (started)
+      {
+        for (uint32_t k = 0U; k < i - j; k++)
+        {
+          bn_almost_mont_sqr_u64(len, n, mu, resM, resM);
+        }
+        bn_almost_mont_mul_u64(len, n, mu, resM, a_bits_l, resM);
+      }
+      else
+      {
+        memcpy(resM, a_bits_l, len * sizeof (uint64_t));
+        started = true;
+      }
+      i = j;
+    }
   }
-  KRML_CHECK_SIZE(sizeof (uint64_t), len);
-  uint64_t tmp0[len];
-  memset(tmp0, 0U, len * sizeof (uint64_t));
-  for (uint32_t i = 0U; i < bBits / 4U; i++)
+  if (!started)
   {
-    KRML_MAYBE_FOR4(i0,
-      0U,
-      4U,
-      1U,
-      uint64_t *ctx_n = ctx;
-      bn_almost_mont_sqr_u64(len, ctx_n, mu, resM, resM););
-    uint32_t k = bBits - bBits % 4U - 4U * i - 4U;
-    uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, k, 4U);
-    uint32_t bits_l32 = (uint32_t)bits_l;
-    const uint64_t *a_bits_l = table + bits_l32 * len;
-    memcpy(tmp0, (uint64_t *)a_bits_l, len * sizeof (uint64_t));
-    uint64_t *ctx_n = ctx;
-    bn_almost_mont_mul_u64(len, ctx_n, mu, resM, tmp0, resM);
+    Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, r2, resM);
   }
   Hacl_Bignum_Montgomery_bn_from_mont_u64(len, n, mu, resM, res);
 }
 
+void
+Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_precomp_u64(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  uint32_t wBits = Hacl_Bignum_Exponentiation_bn_exp_vartime_window_bits(bBits);
+  KRML_CHECK_SIZE(sizeof (uint64_t), (1U << (wBits - 1U)) * len);
+  uint64_t table[(1U << (wBits - 1U)) * len];
+  memset(table, 0U, (1U << (wBits - 1U)) * len * sizeof (uint64_t));
+  Hacl_Bignum_Exponentiation_bn_precomp_odd_powers_u64(len, n, mu, r2, a, wBits, table);
+  Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_table_u64(len,
+    n,
+    mu,
+    r2,
+    wBits,
+    table,
+    bBits,
+    b,
+    res);
+}
+
 void
 Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64(
   uint32_t len,
@@ -289,8 +289,16 @@ static inline void precompr2(uint32_t nBits, uint64_t *n, uint64_t *res)
   }
 }
 
+/* The portable kernels are specialized to 64 limbs below; others are only
+   reached through the table installed by EverCrypt_Dispatch_init. */
 static inline void reduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
 {
+  const Hacl_Bignum_Kernels_u64 *k = Hacl_Bignum_Kernels_get_u64();
+  if (k != &Hacl_Bignum_Kernels_portable_u64)
+  {
+    k->mont_reduction(64U, n, nInv, c, res);
+    return;
+  }
   uint64_t c0 = 0ULL;
   for (uint32_t i0 = 0U; i0 < 64U; i0++)
   {
@@ -369,6 +377,12 @@ static inline void from(uint64_t *n, uint64_t nInv_u64, uint64_t *aM, uint64_t *
 
 static inline void areduction(uint64_t *n, uint64_t nInv, uint64_t *c, uint64_t *res)
 {
+  const Hacl_Bignum_Kernels_u64 *k = Hacl_Bignum_Kernels_get_u64();
+  if (k != &Hacl_Bignum_Kernels_portable_u64)
+  {
+    k->almost_mont_reduction(64U, n, nInv, c, res);
+    return;
+  }
   uint64_t c0 = 0ULL;
   for (uint32_t i0 = 0U; i0 < 64U; i0++)
   {
@@ -549,37 +563,7 @@ exp_vartime_precomp(
   uint64_t *res
 )
 {
-  if (bBits < 200U)
-  {
-    uint64_t aM[64U] = { 0U };
-    to(n, mu, r2, a, aM);
-    uint64_t resM[64U] = { 0U };
-    uint64_t ctx[128U] = { 0U };
-    memcpy(ctx, n, 64U * sizeof (uint64_t));
-    memcpy(ctx + 64U, r2, 64U * sizeof (uint64_t));
-    uint64_t *ctx_n = ctx;
-    uint64_t *ctx_r2 = ctx + 64U;
-    from(ctx_n, mu, ctx_r2, resM);
-    for (uint32_t i = 0U; i < bBits; i++)
-    {
-      uint32_t i1 = i / 64U;
-      uint32_t j = i % 64U;
-      uint64_t tmp = b[i1];
-      uint64_t bit = tmp >> j & 1ULL;
-      if (!(bit == 0ULL))
-      {
-        uint64_t *ctx_n0 = ctx;
-        amont_mul(ctx_n0, mu, resM, aM, resM);
-      }
-      uint64_t *ctx_n0 = ctx;
-      amont_sqr(ctx_n0, mu, aM, aM);
-    }
-    from(n, mu, resM, res);
-    return;
-  }
-  uint64_t aM[64U] = { 0U };
-  to(n, mu, r2, a, aM);
-  uint64_t resM[64U] = { 0U };
+  uint32_t wBits = Hacl_Bignum_Exponentiation_bn_exp_vartime_window_bits(bBits);
   uint32_t bLen;
   if (bBits == 0U)
   {
@@ -589,59 +573,72 @@ exp_vartime_precomp(
   {
     bLen = (bBits - 1U) / 64U + 1U;
   }
-  uint64_t ctx[128U] = { 0U };
-  memcpy(ctx, n, 64U * sizeof (uint64_t));
-  memcpy(ctx + 64U, r2, 64U * sizeof (uint64_t));
-  uint64_t table[1024U] = { 0U };
-  uint64_t tmp[64U] = { 0U };
-  uint64_t *t0 = table;
-  uint64_t *t1 = table + 64U;
-  uint64_t *ctx_n0 = ctx;
-  uint64_t *ctx_r20 = ctx + 64U;
-  from(ctx_n0, mu, ctx_r20, t0);
-  memcpy(t1, aM, 64U * sizeof (uint64_t));
-  KRML_MAYBE_FOR7(i,
-    0U,
-    7U,
-    1U,
-    uint64_t *t11 = table + (i + 1U) * 64U;
-    uint64_t *ctx_n1 = ctx;
-    amont_sqr(ctx_n1, mu, t11, tmp);
-    memcpy(table + (2U * i + 2U) * 64U, tmp, 64U * sizeof (uint64_t));
-    uint64_t *t2 = table + (2U * i + 2U) * 64U;
-    uint64_t *ctx_n = ctx;
-    amont_mul(ctx_n, mu, aM, t2, tmp);
-    memcpy(table + (2U * i + 3U) * 64U, tmp, 64U * sizeof (uint64_t)););
-  if (bBits % 4U != 0U)
+  /* Odd powers a^1, a^3, .., a^(2^wBits - 1) */
+  uint32_t tableLen = (1U << (wBits - 1U)) * 64U;
+  KRML_CHECK_SIZE(sizeof (uint64_t), tableLen);
+  uint64_t table[tableLen];
+  memset(table, 0U, tableLen * sizeof (uint64_t));
+  to(n, mu, r2, a, table);
+  if (wBits > 1U)
   {
-    uint32_t i = bBits / 4U * 4U;
-    uint64_t bits_c = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i, 4U);
-    uint32_t bits_l32 = (uint32_t)bits_c;
-    const uint64_t *a_bits_l = table + bits_l32 * 64U;
-    memcpy(resM, (uint64_t *)a_bits_l, 64U * sizeof (uint64_t));
+    uint64_t aM2[64U] = { 0U };
+    amont_sqr(n, mu, table, aM2);
+    for (uint32_t i = 1U; i < 1U << (wBits - 1U); i++)
+    {
+      amont_mul(n, mu, table + (i - 1U) * 64U, aM2, table + i * 64U);
+    }
   }
-  else
+  /* Left-to-right sliding window, see
+     Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_table_u64 */
+  uint64_t resM[64U] = { 0U };
+  bool started = false;
+  uint32_t i = bBits;
+  while (i > 0U)
   {
-    uint64_t *ctx_n = ctx;
-    uint64_t *ctx_r2 = ctx + 64U;
-    from(ctx_n, mu, ctx_r2, resM);
+    if (Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i - 1U, 1U) == 0ULL)
+    {
+      if (started)
+      {
+        amont_sqr(n, mu, resM, resM);
+      }
+      i = i - 1U;
+    }
+    else
+    {
+      uint32_t j;
+      if (i >= wBits)
+      {
+        j = i - wBits;
+      }
+      else
+      {
+        j = 0U;
+      }
+      while (Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, j, 1U) == 0ULL)
+      {
+        j++;
+      }
+      uint32_t bits_l32 = (uint32_t)Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, j, i - j);
+      uint64_t *a_bits_l = table + (bits_l32 >> 1U) * 64U;
+      if (started)
+      {
+        for (uint32_t k = 0U; k < i - j; k++)
+        {
+          amont_sqr(n, mu, resM, resM);
+        }
+        amont_mul(n, mu, resM, a_bits_l, resM);
+      }
+      else
+      {
+        memcpy(resM, a_bits_l, 64U * sizeof (uint64_t));
+        started = true;
+      }
+      i = j;
+    }
   }
-  uint64_t tmp0[64U] = { 0U };
-  for (uint32_t i = 0U; i < bBits / 4U; i++)
+  if (!started)
   {
-    KRML_MAYBE_FOR4(i0,
-      0U,
-      4U,
-      1U,
-      uint64_t *ctx_n = ctx;
-      amont_sqr(ctx_n, mu, resM, resM););
-    uint32_t k = bBits - bBits % 4U - 4U * i - 4U;
-    uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, k, 4U);
-    uint32_t bits_l32 = (uint32_t)bits_l;
-    const uint64_t *a_bits_l = table + bits_l32 * 64U;
-    memcpy(tmp0, (uint64_t *)a_bits_l, 64U * sizeof (uint64_t));
-    uint64_t *ctx_n = ctx;
-    amont_mul(ctx_n, mu, resM, tmp0, resM);
+    from(n, mu, r2, resM);
   }
   from(n, mu, resM, res);
 }
@@ -0,0 +1,495 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/* This is a hand-written file. It is compiled with AVX-512F and AVX-512 IFMA
+ * enabled and must only be reached after a runtime check. */
+
+#include "Hacl_Bignum4096_IFMA.h"
+
+#include "internal/Hacl_Bignum_Base.h"
+#include "internal/Hacl_Bignum.h"
+#include "lib_memzero0.h"
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#define IFMA_INLINE static __forceinline
+#else
+#define IFMA_INLINE static inline __attribute__((always_inline))
+#endif
+
+#define MASK52 0xfffffffffffffULL
+
+/* At most 80 digits of 52 bits, i.e. 10 vectors of 8 digits, cover a 4096-bit
+ * modulus with the 2 bits of headroom the almost Montgomery multiplication
+ * needs. */
+#define MAX_NZ 10U
+
+#define WINDOW_BITS 5U
+
+#define TABLE_LEN 32U
+
+/* Number of 8-digit vectors for a `len`-limb modulus: the smallest `nz` with
+ * 2^(52 * 8 * nz) > 4 * n, so that results < 2n are closed under the almost
+ * Montgomery multiplication. */
+static uint32_t digit_vectors(uint32_t len)
+{
+  uint32_t d = (64U * len + 2U + 51U) / 52U;
+  return (d + 7U) / 8U;
+}
+
+static void to_radix52(uint32_t len, uint32_t d, uint64_t *x, uint64_t *out)
+{
+  for (uint32_t i = 0U; i < d; i++)
+  {
+    uint32_t q = 52U * i / 64U;
+    uint32_t r = 52U * i % 64U;
+    uint64_t lo = 0ULL;
+    uint64_t hi = 0ULL;
+    if (q < len)
+    {
+      lo = x[q] >> r;
+    }
+    if (r > 12U && q + 1U < len)
+    {
+      hi = x[q + 1U] << (64U - r);
+    }
+    out[i] = (lo | hi) & MASK52;
+  }
+}
+
+static void from_radix52(uint32_t len, uint32_t d, uint64_t *x, uint64_t *out)
+{
+  memset(out, 0U, len * sizeof (uint64_t));
+  for (uint32_t i = 0U; i < d; i++)
+  {
+    uint32_t q = 52U * i / 64U;
+    uint32_t r = 52U * i % 64U;
+    if (q < len)
+    {
+      out[q] = out[q] | x[i] << r;
+    }
+    if (r > 12U && q + 1U < len)
+    {
+      out[q + 1U] = out[q + 1U] | x[i] >> (64U - r);
+    }
+  }
+}
+
+/* Propagate the carries of an accumulator whose digits may exceed 52 bits. */
+static void normalize(uint32_t d, uint64_t *x)
+{
+  uint64_t c = 0ULL;
+  for (uint32_t i = 0U; i < d; i++)
+  {
+    uint64_t t = x[i] + c;
+    x[i] = t & MASK52;
+    c = t >> 52U;
+  }
+}
+
+static inline uint64_t lane0(__m512i x)
+{
+  return (uint64_t)_mm_cvtsi128_si64(_mm512_castsi512_si128(x));
+}
+
+/* One step of the almost Montgomery multiplication: R <- (R + a * bi + m * y) / 2^52
+ * where y is chosen so that the division is exact. The digits of R are left
+ * unnormalized; with at most 80 steps they stay below 2^61. */
+IFMA_INLINE void
+amm52_step(uint32_t nz, __m512i *R, __m512i *A, __m512i *M, uint64_t a0, uint64_t bi, uint64_t k0)
+{
+  uint64_t y = ((lane0(R[0U]) + a0 * bi) * k0) & MASK52;
+  __m512i Bi = _mm512_set1_epi64((long long)bi);
+  __m512i Y = _mm512_set1_epi64((long long)y);
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    R[j] = _mm512_madd52lo_epu64(R[j], A[j], Bi);
+    R[j] = _mm512_madd52lo_epu64(R[j], M[j], Y);
+  }
+  uint64_t carry = lane0(R[0U]) >> 52U;
+  for (uint32_t j = 0U; j + 1U < nz; j++)
+  {
+    R[j] = _mm512_alignr_epi64(R[j + 1U], R[j], 1);
+  }
+  R[nz - 1U] = _mm512_alignr_epi64(_mm512_setzero_si512(), R[nz - 1U], 1);
+  R[0U] = _mm512_add_epi64(R[0U], _mm512_zextsi128_si512(_mm_cvtsi64_si128((long long)carry)));
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    R[j] = _mm512_madd52hi_epu64(R[j], A[j], Bi);
+    R[j] = _mm512_madd52hi_epu64(R[j], M[j], Y);
+  }
+}
+
+/* res <- a * b / 2^(52 * 8 * nz) mod m, with res < 2m when a, b < 2m. All
+ * arguments are 8 * nz normalized digits; res may alias a or b. */
+IFMA_INLINE void
+amm52_body(uint32_t nz, uint64_t *res, uint64_t *a, uint64_t *b, uint64_t *m, uint64_t k0)
+{
+  __m512i R[MAX_NZ];
+  __m512i A[MAX_NZ];
+  __m512i M[MAX_NZ];
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    R[j] = _mm512_setzero_si512();
+    A[j] = _mm512_loadu_si512((void *)(a + 8U * j));
+    M[j] = _mm512_loadu_si512((void *)(m + 8U * j));
+  }
+  uint64_t a0 = a[0U];
+  for (uint32_t i = 0U; i < 8U * nz; i++)
+  {
+    amm52_step(nz, R, A, M, a0, b[i], k0);
+  }
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    _mm512_storeu_si512((void *)(res + 8U * j), R[j]);
+  }
+  normalize(8U * nz, res);
+}
+
+/* Two independent multiplications of the same size, interleaved step by step. */
+IFMA_INLINE void
+amm52_body2(
+  uint32_t nz,
+  uint64_t *res0,
+  uint64_t *a0,
+  uint64_t *b0,
+  uint64_t *m0,
+  uint64_t k00,
+  uint64_t *res1,
+  uint64_t *a1,
+  uint64_t *b1,
+  uint64_t *m1,
+  uint64_t k01
+)
+{
+  __m512i R0[MAX_NZ];
+  __m512i A0[MAX_NZ];
+  __m512i M0[MAX_NZ];
+  __m512i R1[MAX_NZ];
+  __m512i A1[MAX_NZ];
+  __m512i M1[MAX_NZ];
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    R0[j] = _mm512_setzero_si512();
+    A0[j] = _mm512_loadu_si512((void *)(a0 + 8U * j));
+    M0[j] = _mm512_loadu_si512((void *)(m0 + 8U * j));
+    R1[j] = _mm512_setzero_si512();
+    A1[j] = _mm512_loadu_si512((void *)(a1 + 8U * j));
+    M1[j] = _mm512_loadu_si512((void *)(m1 + 8U * j));
+  }
+  uint64_t a00 = a0[0U];
+  uint64_t a10 = a1[0U];
+  for (uint32_t i = 0U; i < 8U * nz; i++)
+  {
+    amm52_step(nz, R0, A0, M0, a00, b0[i], k00);
+    amm52_step(nz, R1, A1, M1, a10, b1[i], k01);
+  }
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    _mm512_storeu_si512((void *)(res0 + 8U * j), R0[j]);
+    _mm512_storeu_si512((void *)(res1 + 8U * j), R1[j]);
+  }
+  normalize(8U * nz, res0);
+  normalize(8U * nz, res1);
+}
+
+/* Specialize the common sizes (2048, 3072 and 4096 bits) so that the
+ * accumulators are kept in registers. */
+static void amm52(uint32_t nz, uint64_t *res, uint64_t *a, uint64_t *b, uint64_t *m, uint64_t k0)
+{
+  switch (nz)
+  {
+    case 5U:
+      {
+        amm52_body(5U, res, a, b, m, k0);
+        break;
+      }
+    case 8U:
+      {
+        amm52_body(8U, res, a, b, m, k0);
+        break;
+      }
+    case 10U:
+      {
+        amm52_body(10U, res, a, b, m, k0);
+        break;
+      }
+    default:
+      {
+        amm52_body(nz, res, a, b, m, k0);
+      }
+  }
+}
+
+static void
+amm52x2(
+  uint32_t nz,
+  uint64_t *res0,
+  uint64_t *a0,
+  uint64_t *b0,
+  uint64_t *m0,
+  uint64_t k00,
+  uint64_t *res1,
+  uint64_t *a1,
+  uint64_t *b1,
+  uint64_t *m1,
+  uint64_t k01
+)
+{
+  switch (nz)
+  {
+    case 4U:
+      {
+        amm52_body2(4U, res0, a0, b0, m0, k00, res1, a1, b1, m1, k01);
+        break;
+      }
+    case 5U:
+      {
+        amm52_body2(5U, res0, a0, b0, m0, k00, res1, a1, b1, m1, k01);
+        break;
+      }
+    case 8U:
+      {
+        amm52_body2(8U, res0, a0, b0, m0, k00, res1, a1, b1, m1, k01);
+        break;
+      }
+    default:
+      {
+        amm52_body2(nz, res0, a0, b0, m0, k00, res1, a1, b1, m1, k01);
+      }
+  }
+}
+
+/* Constant-time table lookup: scan the whole table and keep the entry whose
+ * index matches, with the selection done by vector compares. */
+static void table_select(uint32_t nz, uint64_t *table, uint64_t idx, uint64_t *out)
+{
+  __m512i acc[MAX_NZ];
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    acc[j] = _mm512_setzero_si512();
+  }
+  __m512i vidx = _mm512_set1_epi64((long long)idx);
+  for (uint32_t i = 0U; i < TABLE_LEN; i++)
+  {
+    __mmask8 k = _mm512_cmpeq_epi64_mask(_mm512_set1_epi64((long long)i), vidx);
+    uint64_t *entry = table + i * 8U * nz;
+    for (uint32_t j = 0U; j < nz; j++)
+    {
+      acc[j] = _mm512_mask_mov_epi64(acc[j], k, _mm512_loadu_si512((void *)(entry + 8U * j)));
+    }
+  }
+  for (uint32_t j = 0U; j < nz; j++)
+  {
+    _mm512_storeu_si512((void *)(out + 8U * j), acc[j]);
+  }
+}
+
+/* The per-modulus values in radix 2^52: m, k0 = -m^(-1) mod 2^52, and the
+ * Montgomery forms of 1 and a for R = 2^(52 * 8 * nz). */
+typedef struct ifma_ctx_s
+{
+  uint32_t len;
+  uint32_t nz;
+  uint64_t *n;
+  uint64_t m[8U * MAX_NZ];
+  uint64_t k0;
+  uint64_t one[8U * MAX_NZ];
+  uint64_t oneM[8U * MAX_NZ];
+  uint64_t aM[8U * MAX_NZ];
+}
+ifma_ctx;
+
+static void
+ifma_ctx_init(ifma_ctx *ctx, uint32_t len, uint64_t *n, uint64_t mu, uint64_t *r2, uint64_t *a)
+{
+  uint32_t nz = digit_vectors(len);
+  uint32_t d = 8U * nz;
+  ctx->len = len;
+  ctx->nz = nz;
+  ctx->n = n;
+  ctx->k0 = mu & MASK52;
+  to_radix52(len, d, n, ctx->m);
+  memset(ctx->one, 0U, d * sizeof (uint64_t));
+  ctx->one[0U] = 1ULL;
+  /* r2 = 2^(128 * len) mod n; doubling it 2 * (52 * d - 64 * len) times gives R^2 mod n */
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t rr[len];
+  memcpy(rr, r2, len * sizeof (uint64_t));
+  for (uint32_t i = 0U; i < 2U * (52U * d - 64U * len); i++)
+  {
+    Hacl_Bignum_bn_add_mod_n_u64(len, n, rr, rr, rr);
+  }
+  uint64_t rr52[8U * MAX_NZ] = { 0U };
+  to_radix52(len, d, rr, rr52);
+  uint64_t a52[8U * MAX_NZ] = { 0U };
+  to_radix52(len, d, a, a52);
+  amm52(nz, ctx->oneM, rr52, ctx->one, ctx->m, ctx->k0);
+  amm52(nz, ctx->aM, a52, rr52, ctx->m, ctx->k0);
+  Lib_Memzero0_memzero(a52, 8U * MAX_NZ, uint64_t, void *);
+}
+
+/* table[i] = a^i in Montgomery form */
+static void precomp_table(ifma_ctx *ctx, uint64_t *table)
+{
+  uint32_t d = 8U * ctx->nz;
+  memcpy(table, ctx->oneM, d * sizeof (uint64_t));
+  memcpy(table + d, ctx->aM, d * sizeof (uint64_t));
+  for (uint32_t i = 2U; i < TABLE_LEN; i++)
+  {
+    amm52(ctx->nz, table + i * d, table + (i - 1U) * d, ctx->aM, ctx->m, ctx->k0);
+  }
+}
+
+/* Leave Montgomery form and reduce the result, which is at most n, below n. */
+static void finish(ifma_ctx *ctx, uint64_t *accM, uint64_t *res)
+{
+  uint32_t len = ctx->len;
+  uint64_t acc[8U * MAX_NZ] = { 0U };
+  amm52(ctx->nz, acc, accM, ctx->one, ctx->m, ctx->k0);
+  from_radix52(len, 8U * ctx->nz, acc, res);
+  KRML_CHECK_SIZE(sizeof (uint64_t), len);
+  uint64_t tmp[len];
+  memset(tmp, 0U, len * sizeof (uint64_t));
+  uint64_t c = Hacl_Bignum_Addition_bn_sub_eq_len_u64(len, res, ctx->n, tmp);
+  uint64_t m = 0ULL - c;
+  for (uint32_t i = 0U; i < len; i++)
+  {
+    uint64_t *os = res;
+    uint64_t x = (m & res[i]) | (~m & tmp[i]);
+    os[i] = x;
+  }
+  Lib_Memzero0_memzero(acc, 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(tmp, len, uint64_t, void *);
+}
+
+static uint64_t exp_bits(uint32_t bBits, uint64_t *b, uint32_t i, uint32_t l)
+{
+  uint32_t bLen = bBits == 0U ? 1U : (bBits - 1U) / 64U + 1U;
+  return Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b, i, l);
+}
+
+void
+Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp(
+  uint32_t len,
+  uint64_t *n,
+  uint64_t mu,
+  uint64_t *r2,
+  uint64_t *a,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  ifma_ctx ctx;
+  ifma_ctx_init(&ctx, len, n, mu, r2, a);
+  uint32_t nz = ctx.nz;
+  uint32_t d = 8U * nz;
+  uint64_t table[TABLE_LEN * 8U * MAX_NZ];
+  precomp_table(&ctx, table);
+  uint64_t acc[8U * MAX_NZ] = { 0U };
+  uint64_t t[8U * MAX_NZ] = { 0U };
+  memcpy(acc, ctx.oneM, d * sizeof (uint64_t));
+  uint32_t i = bBits / WINDOW_BITS * WINDOW_BITS;
+  if (bBits % WINDOW_BITS != 0U)
+  {
+    table_select(nz, table, exp_bits(bBits, b, i, bBits % WINDOW_BITS), acc);
+  }
+  for (uint32_t k = 0U; k < bBits / WINDOW_BITS; k++)
+  {
+    for (uint32_t s = 0U; s < WINDOW_BITS; s++)
+    {
+      amm52(nz, acc, acc, acc, ctx.m, ctx.k0);
+    }
+    i = i - WINDOW_BITS;
+    table_select(nz, table, exp_bits(bBits, b, i, WINDOW_BITS), t);
+    amm52(nz, acc, acc, t, ctx.m, ctx.k0);
+  }
+  finish(&ctx, acc, res);
+  Lib_Memzero0_memzero(table, TABLE_LEN * 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(t, 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(ctx.aM, 8U * MAX_NZ, uint64_t, void *);
+}
+
+void
+Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp2(
+  uint32_t len,
+  uint64_t *n0,
+  uint64_t mu0,
+  uint64_t *r20,
+  uint64_t *a0,
+  uint64_t *b0,
+  uint64_t *res0,
+  uint64_t *n1,
+  uint64_t mu1,
+  uint64_t *r21,
+  uint64_t *a1,
+  uint64_t *b1,
+  uint64_t *res1,
+  uint32_t bBits
+)
+{
+  ifma_ctx ctx0;
+  ifma_ctx ctx1;
+  ifma_ctx_init(&ctx0, len, n0, mu0, r20, a0);
+  ifma_ctx_init(&ctx1, len, n1, mu1, r21, a1);
+  uint32_t nz = ctx0.nz;
+  uint32_t d = 8U * nz;
+  uint64_t table0[TABLE_LEN * 8U * MAX_NZ];
+  uint64_t table1[TABLE_LEN * 8U * MAX_NZ];
+  precomp_table(&ctx0, table0);
+  precomp_table(&ctx1, table1);
+  uint64_t acc0[8U * MAX_NZ] = { 0U };
+  uint64_t acc1[8U * MAX_NZ] = { 0U };
+  uint64_t t0[8U * MAX_NZ] = { 0U };
+  uint64_t t1[8U * MAX_NZ] = { 0U };
+  memcpy(acc0, ctx0.oneM, d * sizeof (uint64_t));
+  memcpy(acc1, ctx1.oneM, d * sizeof (uint64_t));
+  uint32_t i = bBits / WINDOW_BITS * WINDOW_BITS;
+  if (bBits % WINDOW_BITS != 0U)
+  {
+    table_select(nz, table0, exp_bits(bBits, b0, i, bBits % WINDOW_BITS), acc0);
+    table_select(nz, table1, exp_bits(bBits, b1, i, bBits % WINDOW_BITS), acc1);
+  }
+  for (uint32_t k = 0U; k < bBits / WINDOW_BITS; k++)
+  {
+    for (uint32_t s = 0U; s < WINDOW_BITS; s++)
+    {
+      amm52x2(nz, acc0, acc0, acc0, ctx0.m, ctx0.k0, acc1, acc1, acc1, ctx1.m, ctx1.k0);
+    }
+    i = i - WINDOW_BITS;
+    table_select(nz, table0, exp_bits(bBits, b0, i, WINDOW_BITS), t0);
+    table_select(nz, table1, exp_bits(bBits, b1, i, WINDOW_BITS), t1);
+    amm52x2(nz, acc0, acc0, t0, ctx0.m, ctx0.k0, acc1, acc1, t1, ctx1.m, ctx1.k0);
+  }
+  finish(&ctx0, acc0, res0);
+  finish(&ctx1, acc1, res1);
+  Lib_Memzero0_memzero(table0, TABLE_LEN * 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(table1, TABLE_LEN * 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(t0, 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(t1, 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(ctx0.aM, 8U * MAX_NZ, uint64_t, void *);
+  Lib_Memzero0_memzero(ctx1.aM, 8U * MAX_NZ, uint64_t, void *);
+}
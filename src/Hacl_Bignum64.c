@@ -614,6 +614,104 @@ Hacl_Bignum64_mod_inv_prime_vartime_precomp(
 }
 
 
+/**
+Precompute the powers of `a` used by Hacl_Bignum64_mod_exp_vartime_table.
+
+  The argument a is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_Bignum64_mont_ctx_init.
+
+  The argument bBits is the largest exponent size the table will be used with;
+  it selects the window size, i.e. how many powers are precomputed. The table
+  can be reused for any number of exponentiations of the same base with the
+  same modulus, e.g. when verifying several signatures against one key.
+
+  The caller will need to call Hacl_Bignum64_mont_table_free on the return value
+  to avoid memory leaks.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • a < n
+*/
+Hacl_Bignum_MontArithmetic_bn_mont_table_u64
+*Hacl_Bignum64_mont_table_init(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint64_t *a,
+  uint32_t bBits
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint32_t len1 = k1.len;
+  uint32_t wBits = Hacl_Bignum_Exponentiation_bn_exp_vartime_window_bits(bBits);
+  KRML_CHECK_SIZE(sizeof (uint64_t), (1U << (wBits - 1U)) * len1);
+  uint64_t
+  *table = (uint64_t *)KRML_HOST_CALLOC((1U << (wBits - 1U)) * len1, sizeof (uint64_t));
+  Hacl_Bignum_Exponentiation_bn_precomp_odd_powers_u64(len1,
+    k1.n,
+    k1.mu,
+    k1.r2,
+    a,
+    wBits,
+    table);
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64
+  res = { .len = len1, .wBits = wBits, .table = table };
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64
+  *buf =
+    (Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *)KRML_HOST_MALLOC(sizeof (
+        Hacl_Bignum_MontArithmetic_bn_mont_table_u64
+      ));
+  buf[0U] = res;
+  return buf;
+}
+
+/**
+Deallocate the memory previously allocated by Hacl_Bignum64_mont_table_init.
+
+  The argument t is a table obtained through Hacl_Bignum64_mont_table_init.
+*/
+void Hacl_Bignum64_mont_table_free(Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *t)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64 t1 = *t;
+  KRML_HOST_FREE(t1.table);
+  KRML_HOST_FREE(t);
+}
+
+/**
+Write `a ^ b mod n` in `res`, where `a` is the base of the table t.
+
+  The outparam res is meant to be `len` limbs in size, i.e. uint64_t[len].
+  The argument k is the montgomery context t was obtained with.
+
+  The argument b is a bignum of any size, and bBits is an upper bound on the
+  number of significant bits of b.
+
+  The function is *NOT* constant-time on the argument b.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b < pow2 bBits
+*/
+void
+Hacl_Bignum64_mod_exp_vartime_table(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64 *t,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *res
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  Hacl_Bignum_MontArithmetic_bn_mont_table_u64 t1 = *t;
+  Hacl_Bignum_Exponentiation_bn_mod_exp_vartime_table_u64(k1.len,
+    k1.n,
+    k1.mu,
+    k1.r2,
+    t1.wBits,
+    t1.table,
+    bBits,
+    b,
+    res);
+}
+
 /********************/
 /* Loads and stores */
 /********************/
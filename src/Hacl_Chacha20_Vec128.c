@@ -814,3 +814,71 @@ Hacl_Chacha20_Vec128_chacha20_decrypt_128(
   }
 }
 
+void Hacl_Chacha20_Vec128_hchacha20_128(uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  KRML_PRE_ALIGN(16) Lib_IntVector_Intrinsics_vec128 st[16U] KRML_POST_ALIGN(16) = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 *os = st;
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    Lib_IntVector_Intrinsics_vec128 x0 = Lib_IntVector_Intrinsics_vec128_load32(x);
+    os[i] = x0;);
+  /* Lane j holds the state of the j-th derivation. */
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    uint8_t *kj = key + i * 4U;
+    st[4U + i] =
+      Lib_IntVector_Intrinsics_vec128_load32s(load32_le(kj),
+        load32_le(kj + 32U),
+        load32_le(kj + 64U),
+        load32_le(kj + 96U));
+  }
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    uint8_t *nj = n + i * 4U;
+    st[12U + i] =
+      Lib_IntVector_Intrinsics_vec128_load32s(load32_le(nj),
+        load32_le(nj + 16U),
+        load32_le(nj + 32U),
+        load32_le(nj + 48U));
+  }
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  double_round_128(st);
+  /* Transpose words 0 .. 3 and 12 .. 15 so that lane j becomes the j-th subkey. */
+  KRML_MAYBE_FOR2(i,
+    0U,
+    2U,
+    1U,
+    Lib_IntVector_Intrinsics_vec128 *w = st + i * 12U;
+    Lib_IntVector_Intrinsics_vec128
+    v0_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(w[0U], w[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    v1_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(w[0U], w[1U]);
+    Lib_IntVector_Intrinsics_vec128
+    v2_ = Lib_IntVector_Intrinsics_vec128_interleave_low32(w[2U], w[3U]);
+    Lib_IntVector_Intrinsics_vec128
+    v3_ = Lib_IntVector_Intrinsics_vec128_interleave_high32(w[2U], w[3U]);
+    Lib_IntVector_Intrinsics_vec128
+    v0 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128
+    v1 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v0_, v2_);
+    Lib_IntVector_Intrinsics_vec128
+    v2 = Lib_IntVector_Intrinsics_vec128_interleave_low64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec128
+    v3 = Lib_IntVector_Intrinsics_vec128_interleave_high64(v1_, v3_);
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + i * 16U, v0);
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + 32U + i * 16U, v1);
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + 64U + i * 16U, v2);
+    Lib_IntVector_Intrinsics_vec128_store32_le(out + 96U + i * 16U, v3););
+}
+
@@ -1199,3 +1199,110 @@ Hacl_Chacha20_Vec256_chacha20_decrypt_256(
   }
 }
 
+void Hacl_Chacha20_Vec256_hchacha20_256(uint8_t *out, uint8_t *key, uint8_t *n)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 st[16U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 *os = st;
+    uint32_t x = Hacl_Impl_Chacha20_Vec_chacha20_constants[i];
+    Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_load32(x);
+    os[i] = x0;);
+  /* Lane j holds the state of the j-th derivation. */
+  for (uint32_t i = 0U; i < 8U; i++)
+  {
+    uint8_t *kj = key + i * 4U;
+    st[4U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(kj),
+        load32_le(kj + 32U),
+        load32_le(kj + 64U),
+        load32_le(kj + 96U),
+        load32_le(kj + 128U),
+        load32_le(kj + 160U),
+        load32_le(kj + 192U),
+        load32_le(kj + 224U));
+  }
+  for (uint32_t i = 0U; i < 4U; i++)
+  {
+    uint8_t *nj = n + i * 4U;
+    st[12U + i] =
+      Lib_IntVector_Intrinsics_vec256_load32s(load32_le(nj),
+        load32_le(nj + 16U),
+        load32_le(nj + 32U),
+        load32_le(nj + 48U),
+        load32_le(nj + 64U),
+        load32_le(nj + 80U),
+        load32_le(nj + 96U),
+        load32_le(nj + 112U));
+  }
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  double_round_256(st);
+  /* Transpose words 0 .. 3 and 12 .. 15 so that vector j is the j-th subkey. */
+  Lib_IntVector_Intrinsics_vec256
+  v0_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(st[0U], st[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  v1_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(st[0U], st[1U]);
+  Lib_IntVector_Intrinsics_vec256
+  v2_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(st[2U], st[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  v3_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(st[2U], st[3U]);
+  Lib_IntVector_Intrinsics_vec256
+  v4_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(st[12U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256
+  v5_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(st[12U], st[13U]);
+  Lib_IntVector_Intrinsics_vec256
+  v6_ = Lib_IntVector_Intrinsics_vec256_interleave_low32(st[14U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256
+  v7_ = Lib_IntVector_Intrinsics_vec256_interleave_high32(st[14U], st[15U]);
+  Lib_IntVector_Intrinsics_vec256
+  v0_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v2_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v0_, v2_);
+  Lib_IntVector_Intrinsics_vec256
+  v1_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v3_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v1_, v3_);
+  Lib_IntVector_Intrinsics_vec256
+  v4_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v6_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v4_, v6_);
+  Lib_IntVector_Intrinsics_vec256
+  v5_1 = Lib_IntVector_Intrinsics_vec256_interleave_low64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256
+  v7_1 = Lib_IntVector_Intrinsics_vec256_interleave_high64(v5_, v7_);
+  Lib_IntVector_Intrinsics_vec256
+  v0 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v0_1, v4_1);
+  Lib_IntVector_Intrinsics_vec256
+  v4 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v0_1, v4_1);
+  Lib_IntVector_Intrinsics_vec256
+  v2 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v1_1, v5_1);
+  Lib_IntVector_Intrinsics_vec256
+  v6 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v1_1, v5_1);
+  Lib_IntVector_Intrinsics_vec256
+  v1 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v2_1, v6_1);
+  Lib_IntVector_Intrinsics_vec256
+  v5 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v2_1, v6_1);
+  Lib_IntVector_Intrinsics_vec256
+  v3 = Lib_IntVector_Intrinsics_vec256_interleave_low128(v3_1, v7_1);
+  Lib_IntVector_Intrinsics_vec256
+  v7 = Lib_IntVector_Intrinsics_vec256_interleave_high128(v3_1, v7_1);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out, v0);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 32U, v1);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 64U, v2);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 96U, v3);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 128U, v4);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 160U, v5);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 192U, v6);
+  Lib_IntVector_Intrinsics_vec256_store32_le(out + 224U, v7);
+}
+
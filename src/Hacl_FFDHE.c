@@ -23,9 +23,10 @@
  */
 
 
-#include "Hacl_FFDHE.h"
+#include "internal/Hacl_FFDHE.h"
 
 #include "internal/Hacl_Impl_FFDHE_Constants.h"
+#include "internal/Hacl_FFDHE_PrecompTable.h"
 #include "internal/Hacl_Bignum_Base.h"
 #include "internal/Hacl_Bignum.h"
 
@@ -219,6 +220,7 @@ static inline uint64_t ffdhe_check_pk(Spec_FFDHE_ffdhe_alg a, uint64_t *pk_n, ui
 
 static inline void
 ffdhe_compute_exp(
+  Hacl_FFDHE_mod_exp exp,
   Spec_FFDHE_ffdhe_alg a,
   uint64_t *p_r2_n,
   uint64_t *sk_n,
@@ -233,14 +235,99 @@ ffdhe_compute_exp(
   uint64_t res_n[nLen];
   memset(res_n, 0U, nLen * sizeof (uint64_t));
   uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_n[0U]);
-  Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64((ffdhe_len(a) - 1U) / 8U + 1U,
-    p_n,
-    mu,
-    r2_n,
-    b_n,
-    64U * nLen,
-    sk_n,
-    res_n);
+  exp(nLen, p_n, mu, r2_n, b_n, 64U * nLen, sk_n, res_n);
+  Hacl_Bignum_Convert_bn_to_bytes_be_uint64(ffdhe_len(a), res_n, res);
+}
+
+static inline const uint64_t *ffdhe_g2_comb_table(Spec_FFDHE_ffdhe_alg a)
+{
+  switch (a)
+  {
+    case Spec_FFDHE_FFDHE2048:
+      {
+        return Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_2048;
+      }
+    case Spec_FFDHE_FFDHE3072:
+      {
+        return Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_3072;
+      }
+    case Spec_FFDHE_FFDHE4096:
+      {
+        return Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_4096;
+      }
+    case Spec_FFDHE_FFDHE6144:
+      {
+        return Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_6144;
+      }
+    case Spec_FFDHE_FFDHE8192:
+      {
+        return Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_8192;
+      }
+    default:
+      {
+        KRML_HOST_EPRINTF("KaRaMeL incomplete match at %s:%d\n", __FILE__, __LINE__);
+        KRML_HOST_EXIT(253U);
+      }
+  }
+}
+
+/* Computes g ^ sk_n mod p for the fixed generator g = 2 with a 4-teeth comb.
+
+   The exponent has nBits = 64 * nLen bits and is split into four rows of
+   d = nBits / 4 bits. Entry v of the comb table holds, in Montgomery form,
+   the product of g ^ (2 ^ (d * i)) over the bits i set in v. Column j of the
+   exponent then selects one entry, so the exponentiation costs d squarings and
+   d multiplications instead of nBits squarings and nBits / 4 multiplications,
+   and no per-call table needs to be built. The tables are generated by
+   tools/ffdhe_precomp_table.py. */
+static inline void
+ffdhe_compute_exp_g2(Spec_FFDHE_ffdhe_alg a, uint64_t *p_r2_n, uint64_t *sk_n, uint8_t *res)
+{
+  uint32_t nLen = (ffdhe_len(a) - 1U) / 8U + 1U;
+  uint64_t *p_n = p_r2_n;
+  uint64_t mu = Hacl_Bignum_ModInvLimb_mod_inv_uint64(p_n[0U]);
+  const uint64_t *table = ffdhe_g2_comb_table(a);
+  uint32_t d = 16U * nLen;
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t resM[nLen];
+  memset(resM, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t tmp[nLen];
+  memset(tmp, 0U, nLen * sizeof (uint64_t));
+  for (uint32_t i0 = 0U; i0 < d; i0++)
+  {
+    uint32_t j = d - i0 - 1U;
+    uint64_t bits_j = 0ULL;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+      bits_j = bits_j | Hacl_Bignum_Lib_bn_get_bits_u64(nLen, sk_n, d * i + j, 1U) << i;
+    }
+    memcpy(tmp, (uint64_t *)table, nLen * sizeof (uint64_t));
+    for (uint32_t i1 = 0U; i1 < 15U; i1++)
+    {
+      uint64_t c = FStar_UInt64_eq_mask(bits_j, (uint64_t)(i1 + 1U));
+      const uint64_t *res_j = table + (i1 + 1U) * nLen;
+      for (uint32_t i = 0U; i < nLen; i++)
+      {
+        uint64_t *os = tmp;
+        uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+        os[i] = x;
+      }
+    }
+    if (i0 == 0U)
+    {
+      memcpy(resM, tmp, nLen * sizeof (uint64_t));
+    }
+    else
+    {
+      Hacl_Bignum_Montgomery_bn_mont_sqr_u64(nLen, p_n, mu, resM, resM);
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(nLen, p_n, mu, resM, tmp, resM);
+    }
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t res_n[nLen];
+  memset(res_n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(nLen, p_n, mu, resM, res_n);
   Hacl_Bignum_Convert_bn_to_bytes_be_uint64(ffdhe_len(a), res_n, res);
 }
 
@@ -275,20 +362,33 @@ Hacl_FFDHE_ffdhe_secret_to_public_precomp(
   uint32_t len = ffdhe_len(a);
   uint32_t nLen = (len - 1U) / 8U + 1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
-  uint64_t g_n[nLen];
-  memset(g_n, 0U, nLen * sizeof (uint64_t));
-  uint8_t g = 0U;
-  {
-    uint8_t *os = &g;
-    uint8_t x = Hacl_Impl_FFDHE_Constants_ffdhe_g2[0U];
-    os[0U] = x;
-  }
-  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(1U, &g, g_n);
+  uint64_t sk_n[nLen];
+  memset(sk_n, 0U, nLen * sizeof (uint64_t));
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
+  ffdhe_compute_exp_g2(a, p_r2_n, sk_n, pk);
+}
+
+void
+Hacl_FFDHE_ffdhe_secret_to_public_precomp_exp(
+  Hacl_FFDHE_mod_exp exp,
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk
+)
+{
+  uint32_t len = ffdhe_len(a);
+  uint32_t nLen = (len - 1U) / 8U + 1U;
   KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
   uint64_t sk_n[nLen];
   memset(sk_n, 0U, nLen * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), nLen);
+  uint64_t g_n[nLen];
+  memset(g_n, 0U, nLen * sizeof (uint64_t));
+  uint8_t g = Hacl_Impl_FFDHE_Constants_ffdhe_g2[0U];
+  Hacl_Bignum_Convert_bn_from_bytes_be_uint64(1U, &g, g_n);
   Hacl_Bignum_Convert_bn_from_bytes_be_uint64(len, sk, sk_n);
-  ffdhe_compute_exp(a, p_r2_n, sk_n, g_n, pk);
+  ffdhe_compute_exp(exp, a, p_r2_n, sk_n, g_n, pk);
 }
 
 void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk)
@@ -303,7 +403,8 @@ void Hacl_FFDHE_ffdhe_secret_to_public(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint
 }
 
 uint64_t
-Hacl_FFDHE_ffdhe_shared_secret_precomp(
+Hacl_FFDHE_ffdhe_shared_secret_precomp_exp(
+  Hacl_FFDHE_mod_exp exp,
   Spec_FFDHE_ffdhe_alg a,
   uint64_t *p_r2_n,
   uint8_t *sk,
@@ -325,11 +426,24 @@ Hacl_FFDHE_ffdhe_shared_secret_precomp(
   uint64_t m = ffdhe_check_pk(a, pk_n, p_n);
   if (m == 0xFFFFFFFFFFFFFFFFULL)
   {
-    ffdhe_compute_exp(a, p_r2_n, sk_n, pk_n, ss);
+    ffdhe_compute_exp(exp, a, p_r2_n, sk_n, pk_n, ss);
   }
   return m;
 }
 
+uint64_t
+Hacl_FFDHE_ffdhe_shared_secret_precomp(
+  Spec_FFDHE_ffdhe_alg a,
+  uint64_t *p_r2_n,
+  uint8_t *sk,
+  uint8_t *pk,
+  uint8_t *ss
+)
+{
+  Hacl_FFDHE_mod_exp exp = Hacl_Bignum_Exponentiation_bn_mod_exp_consttime_precomp_u64;
+  return Hacl_FFDHE_ffdhe_shared_secret_precomp_exp(exp, a, p_r2_n, sk, pk, ss);
+}
+
 uint64_t
 Hacl_FFDHE_ffdhe_shared_secret(Spec_FFDHE_ffdhe_alg a, uint8_t *sk, uint8_t *pk, uint8_t *ss)
 {
@@ -37,10 +37,13 @@ uint32_t Hacl_Frodo1344_crypto_secretkeybytes = 43088U;
 
 uint32_t Hacl_Frodo1344_crypto_ciphertextbytes = 21632U;
 
-uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+uint32_t Hacl_Frodo1344_scratch_size(void)
+{
+  return 129152U;
+}
+
+static void keypair_scratch(uint8_t *pk, uint8_t *sk, uint8_t *coins, uint16_t *scratch)
 {
-  uint8_t coins[80U] = { 0U };
-  randombytes_(80U, coins);
   uint8_t *s = coins;
   uint8_t *seed_se = coins + 32U;
   uint8_t *z = coins + 64U;
@@ -48,9 +51,12 @@ uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   Hacl_Hash_SHA3_shake256(seed_a, 16U, z, 16U);
   uint8_t *b_bytes = pk + 16U;
   uint8_t *s_bytes = sk + 21552U;
-  uint16_t s_matrix[10752U] = { 0U };
-  uint16_t e_matrix[10752U] = { 0U };
-  uint8_t r[43008U] = { 0U };
+  uint16_t *s_matrix = scratch + 0U;
+  memset(s_matrix, 0U, 10752U * sizeof (uint16_t));
+  uint16_t *e_matrix = scratch + 10752U;
+  memset(e_matrix, 0U, 10752U * sizeof (uint16_t));
+  uint8_t *r = (uint8_t *)(scratch + 21504U);
+  memset(r, 0U, 43008U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[33U] = { 0U };
   shake_input_seed_se[0U] = 0x5fU;
   memcpy(shake_input_seed_se + 1U, seed_se, 32U * sizeof (uint8_t));
@@ -58,11 +64,14 @@ uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   Lib_Memzero0_memzero(shake_input_seed_se, 33U, uint8_t, void *);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(1344U, 8U, r, s_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(1344U, 8U, r + 21504U, e_matrix);
-  uint16_t b_matrix[10752U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), 1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 1344U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s(1344U, 1344U, 8U, a_matrix, s_matrix, b_matrix);
+  uint16_t *b_matrix = scratch + 21504U;
+  memset(b_matrix, 0U, 10752U * sizeof (uint16_t));
+  Hacl_Impl_Frodo_Params_frodo_mul_as(Spec_Frodo_Params_SHAKE128,
+    1344U,
+    seed_a,
+    s_matrix,
+    b_matrix,
+    scratch + 32256U);
   Hacl_Impl_Matrix_matrix_add(1344U, 8U, b_matrix, e_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack(1344U, 8U, 16U, b_matrix, b_bytes);
   Hacl_Impl_Matrix_matrix_to_lbytes(1344U, 8U, s_matrix, s_bytes);
@@ -73,14 +82,32 @@ uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   memcpy(sk_p, s, 32U * sizeof (uint8_t));
   memcpy(sk_p + 32U, pk, 21520U * sizeof (uint8_t));
   Hacl_Hash_SHA3_shake256(sk + slen1, 32U, pk, 21520U);
+}
+
+uint32_t
+Hacl_Frodo1344_crypto_kem_keypair_scratch(uint8_t *pk, uint8_t *sk, uint16_t *scratch)
+{
+  uint8_t coins[80U] = { 0U };
+  randombytes_(80U, coins);
+  keypair_scratch(pk, sk, coins, scratch);
   Lib_Memzero0_memzero(coins, 80U, uint8_t, void *);
   return 0U;
 }
 
-uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+uint32_t Hacl_Frodo1344_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  uint16_t scratch[43008U] = { 0U };
+  return Hacl_Frodo1344_crypto_kem_keypair_scratch(pk, sk, scratch);
+}
+
+void Hacl_Frodo1344_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins)
+{
+  uint16_t scratch[43008U] = { 0U };
+  keypair_scratch(pk, sk, coins, scratch);
+}
+
+static void enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins, uint16_t *scratch)
 {
-  uint8_t coins[32U] = { 0U };
-  randombytes_(32U, coins);
   uint8_t seed_se_k[64U] = { 0U };
   uint8_t pkh_mu[64U] = { 0U };
   Hacl_Hash_SHA3_shake256(pkh_mu, 32U, pk, 21520U);
@@ -90,10 +117,13 @@ uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *k = seed_se_k + 32U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + 16U;
-  uint16_t sp_matrix[10752U] = { 0U };
-  uint16_t ep_matrix[10752U] = { 0U };
+  uint16_t *sp_matrix = scratch + 0U;
+  memset(sp_matrix, 0U, 10752U * sizeof (uint16_t));
+  uint16_t *ep_matrix = scratch + 10752U;
+  memset(ep_matrix, 0U, 10752U * sizeof (uint16_t));
   uint16_t epp_matrix[64U] = { 0U };
-  uint8_t r[43136U] = { 0U };
+  uint8_t *r = (uint8_t *)(scratch + 21504U);
+  memset(r, 0U, 43136U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[33U] = { 0U };
   shake_input_seed_se[0U] = 0x96U;
   memcpy(shake_input_seed_se + 1U, seed_se, 32U * sizeof (uint8_t));
@@ -102,17 +132,23 @@ uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 1344U, r, sp_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 1344U, r + 21504U, ep_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 8U, r + 43008U, epp_matrix);
+  /* The rest of r is overwritten below, but not the seed of epp. */
+  Lib_Memzero0_memzero(r + 43008U, 128U, uint8_t, void *);
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + 21504U;
-  uint16_t bp_matrix[10752U] = { 0U };
-  KRML_CHECK_SIZE(sizeof (uint16_t), 1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 1344U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul(8U, 1344U, 1344U, sp_matrix, a_matrix, bp_matrix);
+  uint16_t *bp_matrix = scratch + 21504U;
+  memset(bp_matrix, 0U, 10752U * sizeof (uint16_t));
+  Hacl_Impl_Frodo_Params_frodo_mul_sa(Spec_Frodo_Params_SHAKE128,
+    1344U,
+    seed_a,
+    sp_matrix,
+    bp_matrix,
+    scratch + 32256U);
   Hacl_Impl_Matrix_matrix_add(8U, 1344U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack(8U, 1344U, 16U, bp_matrix, c1);
   uint16_t v_matrix[64U] = { 0U };
-  uint16_t b_matrix[10752U] = { 0U };
+  uint16_t *b_matrix = scratch + 32256U;
+  memset(b_matrix, 0U, 10752U * sizeof (uint16_t));
   Hacl_Impl_Frodo_Pack_frodo_unpack(1344U, 8U, 16U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul(8U, 1344U, 8U, sp_matrix, b_matrix, v_matrix);
   Hacl_Impl_Matrix_matrix_add(8U, 8U, v_matrix, epp_matrix);
@@ -126,21 +162,43 @@ uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   Lib_Memzero0_memzero(ep_matrix, 10752U, uint16_t, void *);
   Lib_Memzero0_memzero(epp_matrix, 64U, uint16_t, void *);
   uint32_t ss_init_len = 21664U;
-  KRML_CHECK_SIZE(sizeof (uint8_t), ss_init_len);
-  uint8_t shake_input_ss[ss_init_len];
+  uint8_t *shake_input_ss = (uint8_t *)(scratch + 0U);
   memset(shake_input_ss, 0U, ss_init_len * sizeof (uint8_t));
   memcpy(shake_input_ss, ct, 21632U * sizeof (uint8_t));
   memcpy(shake_input_ss + 21632U, k, 32U * sizeof (uint8_t));
   Hacl_Hash_SHA3_shake256(ss, 32U, shake_input_ss, ss_init_len);
   Lib_Memzero0_memzero(shake_input_ss, ss_init_len, uint8_t, void *);
   Lib_Memzero0_memzero(seed_se_k, 64U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_Frodo1344_crypto_kem_enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint16_t *scratch)
+{
+  uint8_t coins[32U] = { 0U };
+  randombytes_(32U, coins);
+  enc_scratch(ct, ss, pk, coins, scratch);
   Lib_Memzero0_memzero(coins, 32U, uint8_t, void *);
   return 0U;
 }
 
-uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+uint32_t Hacl_Frodo1344_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
 {
-  uint16_t bp_matrix[10752U] = { 0U };
+  uint16_t scratch[43072U] = { 0U };
+  return Hacl_Frodo1344_crypto_kem_enc_scratch(ct, ss, pk, scratch);
+}
+
+uint32_t Hacl_Frodo1344_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins)
+{
+  uint16_t scratch[43072U] = { 0U };
+  enc_scratch(ct, ss, pk, coins, scratch);
+  return 0U;
+}
+
+uint32_t
+Hacl_Frodo1344_crypto_kem_dec_scratch(uint8_t *ss, uint8_t *ct, uint8_t *sk, uint16_t *scratch)
+{
+  uint16_t *bp_matrix = scratch + 0U;
+  memset(bp_matrix, 0U, 10752U * sizeof (uint16_t));
   uint16_t c_matrix[64U] = { 0U };
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + 21504U;
@@ -148,7 +206,8 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   Hacl_Impl_Frodo_Pack_frodo_unpack(8U, 8U, 16U, c2, c_matrix);
   uint8_t mu_decode[32U] = { 0U };
   uint8_t *s_bytes = sk + 21552U;
-  uint16_t s_matrix[10752U] = { 0U };
+  uint16_t *s_matrix = scratch + 10752U;
+  memset(s_matrix, 0U, 10752U * sizeof (uint16_t));
   uint16_t m_matrix[64U] = { 0U };
   Hacl_Impl_Matrix_matrix_from_lbytes(1344U, 8U, s_bytes, s_matrix);
   Hacl_Impl_Matrix_matrix_mul_s(8U, 1344U, 8U, bp_matrix, s_matrix, m_matrix);
@@ -168,12 +227,16 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *seed_se = seed_se_k;
   uint8_t *kp = seed_se_k + 32U;
   uint8_t *s = sk;
-  uint16_t bpp_matrix[10752U] = { 0U };
+  uint16_t *bpp_matrix = scratch + 10752U;
+  memset(bpp_matrix, 0U, 10752U * sizeof (uint16_t));
   uint16_t cp_matrix[64U] = { 0U };
-  uint16_t sp_matrix[10752U] = { 0U };
-  uint16_t ep_matrix[10752U] = { 0U };
+  uint16_t *sp_matrix = scratch + 21504U;
+  memset(sp_matrix, 0U, 10752U * sizeof (uint16_t));
+  uint16_t *ep_matrix = scratch + 32256U;
+  memset(ep_matrix, 0U, 10752U * sizeof (uint16_t));
   uint16_t epp_matrix[64U] = { 0U };
-  uint8_t r[43136U] = { 0U };
+  uint8_t *r = (uint8_t *)(scratch + 43008U);
+  memset(r, 0U, 43136U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[33U] = { 0U };
   shake_input_seed_se[0U] = 0x96U;
   memcpy(shake_input_seed_se + 1U, seed_se, 32U * sizeof (uint8_t));
@@ -182,15 +245,20 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 1344U, r, sp_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 1344U, r + 21504U, ep_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix1344(8U, 8U, r + 43008U, epp_matrix);
+  /* The rest of r is overwritten below, but not the seed of epp. */
+  Lib_Memzero0_memzero(r + 43008U, 128U, uint8_t, void *);
   uint8_t *pk = sk + 32U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + 16U;
-  KRML_CHECK_SIZE(sizeof (uint16_t), 1806336U);
-  uint16_t a_matrix[1806336U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 1344U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul(8U, 1344U, 1344U, sp_matrix, a_matrix, bpp_matrix);
+  Hacl_Impl_Frodo_Params_frodo_mul_sa(Spec_Frodo_Params_SHAKE128,
+    1344U,
+    seed_a,
+    sp_matrix,
+    bpp_matrix,
+    scratch + 43008U);
   Hacl_Impl_Matrix_matrix_add(8U, 1344U, bpp_matrix, ep_matrix);
-  uint16_t b_matrix[10752U] = { 0U };
+  uint16_t *b_matrix = scratch + 53760U;
+  memset(b_matrix, 0U, 10752U * sizeof (uint16_t));
   Hacl_Impl_Frodo_Pack_frodo_unpack(1344U, 8U, 16U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul(8U, 1344U, 8U, sp_matrix, b_matrix, cp_matrix);
   Hacl_Impl_Matrix_matrix_add(8U, 8U, cp_matrix, epp_matrix);
@@ -217,8 +285,7 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
     os[i] = x;
   }
   uint32_t ss_init_len = 21664U;
-  KRML_CHECK_SIZE(sizeof (uint8_t), ss_init_len);
-  uint8_t ss_init[ss_init_len];
+  uint8_t *ss_init = (uint8_t *)(scratch + 21504U);
   memset(ss_init, 0U, ss_init_len * sizeof (uint8_t));
   memcpy(ss_init, ct, 21632U * sizeof (uint8_t));
   memcpy(ss_init + 21632U, kp_s, 32U * sizeof (uint8_t));
@@ -230,3 +297,9 @@ uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return 0U;
 }
 
+uint32_t Hacl_Frodo1344_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  uint16_t scratch[64576U] = { 0U };
+  return Hacl_Frodo1344_crypto_kem_dec_scratch(ss, ct, sk, scratch);
+}
+
@@ -42,10 +42,13 @@ uint32_t Hacl_Frodo64_crypto_secretkeybytes = 2032U;
 
 uint32_t Hacl_Frodo64_crypto_ciphertextbytes = 1080U;
 
-uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+uint32_t Hacl_Frodo64_scratch_size(void)
+{
+  return 6272U;
+}
+
+static void keypair_scratch(uint8_t *pk, uint8_t *sk, uint8_t *coins, uint16_t *scratch)
 {
-  uint8_t coins[48U] = { 0U };
-  randombytes_(48U, coins);
   uint8_t *s = coins;
   uint8_t *seed_se = coins + 16U;
   uint8_t *z = coins + 32U;
@@ -53,9 +56,12 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   Hacl_Hash_SHA3_shake128(seed_a, 16U, z, 16U);
   uint8_t *b_bytes = pk + 16U;
   uint8_t *s_bytes = sk + 992U;
-  uint16_t s_matrix[512U] = { 0U };
-  uint16_t e_matrix[512U] = { 0U };
-  uint8_t r[2048U] = { 0U };
+  uint16_t *s_matrix = scratch + 0U;
+  memset(s_matrix, 0U, 512U * sizeof (uint16_t));
+  uint16_t *e_matrix = scratch + 512U;
+  memset(e_matrix, 0U, 512U * sizeof (uint16_t));
+  uint8_t *r = (uint8_t *)(scratch + 1024U);
+  memset(r, 0U, 2048U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[17U] = { 0U };
   shake_input_seed_se[0U] = 0x5fU;
   memcpy(shake_input_seed_se + 1U, seed_se, 16U * sizeof (uint8_t));
@@ -63,10 +69,14 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   Lib_Memzero0_memzero(shake_input_seed_se, 17U, uint8_t, void *);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(64U, 8U, r, s_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(64U, 8U, r + 1024U, e_matrix);
-  uint16_t b_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 64U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul_s(64U, 64U, 8U, a_matrix, s_matrix, b_matrix);
+  uint16_t *b_matrix = scratch + 1024U;
+  memset(b_matrix, 0U, 512U * sizeof (uint16_t));
+  Hacl_Impl_Frodo_Params_frodo_mul_as(Spec_Frodo_Params_SHAKE128,
+    64U,
+    seed_a,
+    s_matrix,
+    b_matrix,
+    scratch + 1536U);
   Hacl_Impl_Matrix_matrix_add(64U, 8U, b_matrix, e_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack(64U, 8U, 15U, b_matrix, b_bytes);
   Hacl_Impl_Matrix_matrix_to_lbytes(64U, 8U, s_matrix, s_bytes);
@@ -77,14 +87,32 @@ uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
   memcpy(sk_p, s, 16U * sizeof (uint8_t));
   memcpy(sk_p + 16U, pk, 976U * sizeof (uint8_t));
   Hacl_Hash_SHA3_shake128(sk + slen1, 16U, pk, 976U);
+}
+
+uint32_t
+Hacl_Frodo64_crypto_kem_keypair_scratch(uint8_t *pk, uint8_t *sk, uint16_t *scratch)
+{
+  uint8_t coins[48U] = { 0U };
+  randombytes_(48U, coins);
+  keypair_scratch(pk, sk, coins, scratch);
   Lib_Memzero0_memzero(coins, 48U, uint8_t, void *);
   return 0U;
 }
 
-uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+uint32_t Hacl_Frodo64_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  uint16_t scratch[2048U] = { 0U };
+  return Hacl_Frodo64_crypto_kem_keypair_scratch(pk, sk, scratch);
+}
+
+void Hacl_Frodo64_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins)
+{
+  uint16_t scratch[2048U] = { 0U };
+  keypair_scratch(pk, sk, coins, scratch);
+}
+
+static void enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins, uint16_t *scratch)
 {
-  uint8_t coins[16U] = { 0U };
-  randombytes_(16U, coins);
   uint8_t seed_se_k[32U] = { 0U };
   uint8_t pkh_mu[32U] = { 0U };
   Hacl_Hash_SHA3_shake128(pkh_mu, 16U, pk, 976U);
@@ -94,10 +122,13 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   uint8_t *k = seed_se_k + 16U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + 16U;
-  uint16_t sp_matrix[512U] = { 0U };
-  uint16_t ep_matrix[512U] = { 0U };
+  uint16_t *sp_matrix = scratch + 0U;
+  memset(sp_matrix, 0U, 512U * sizeof (uint16_t));
+  uint16_t *ep_matrix = scratch + 512U;
+  memset(ep_matrix, 0U, 512U * sizeof (uint16_t));
   uint16_t epp_matrix[64U] = { 0U };
-  uint8_t r[2176U] = { 0U };
+  uint8_t *r = (uint8_t *)(scratch + 1024U);
+  memset(r, 0U, 2176U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[17U] = { 0U };
   shake_input_seed_se[0U] = 0x96U;
   memcpy(shake_input_seed_se + 1U, seed_se, 16U * sizeof (uint8_t));
@@ -106,16 +137,23 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 64U, r, sp_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 64U, r + 1024U, ep_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 8U, r + 2048U, epp_matrix);
+  /* The rest of r is overwritten below, but not the seed of epp. */
+  Lib_Memzero0_memzero(r + 2048U, 128U, uint8_t, void *);
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + 960U;
-  uint16_t bp_matrix[512U] = { 0U };
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 64U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul(8U, 64U, 64U, sp_matrix, a_matrix, bp_matrix);
+  uint16_t *bp_matrix = scratch + 1024U;
+  memset(bp_matrix, 0U, 512U * sizeof (uint16_t));
+  Hacl_Impl_Frodo_Params_frodo_mul_sa(Spec_Frodo_Params_SHAKE128,
+    64U,
+    seed_a,
+    sp_matrix,
+    bp_matrix,
+    scratch + 1536U);
   Hacl_Impl_Matrix_matrix_add(8U, 64U, bp_matrix, ep_matrix);
   Hacl_Impl_Frodo_Pack_frodo_pack(8U, 64U, 15U, bp_matrix, c1);
   uint16_t v_matrix[64U] = { 0U };
-  uint16_t b_matrix[512U] = { 0U };
+  uint16_t *b_matrix = scratch + 1536U;
+  memset(b_matrix, 0U, 512U * sizeof (uint16_t));
   Hacl_Impl_Frodo_Pack_frodo_unpack(64U, 8U, 15U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul(8U, 64U, 8U, sp_matrix, b_matrix, v_matrix);
   Hacl_Impl_Matrix_matrix_add(8U, 8U, v_matrix, epp_matrix);
@@ -129,21 +167,43 @@ uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
   Lib_Memzero0_memzero(ep_matrix, 512U, uint16_t, void *);
   Lib_Memzero0_memzero(epp_matrix, 64U, uint16_t, void *);
   uint32_t ss_init_len = 1096U;
-  KRML_CHECK_SIZE(sizeof (uint8_t), ss_init_len);
-  uint8_t shake_input_ss[ss_init_len];
+  uint8_t *shake_input_ss = (uint8_t *)(scratch + 0U);
   memset(shake_input_ss, 0U, ss_init_len * sizeof (uint8_t));
   memcpy(shake_input_ss, ct, 1080U * sizeof (uint8_t));
   memcpy(shake_input_ss + 1080U, k, 16U * sizeof (uint8_t));
   Hacl_Hash_SHA3_shake128(ss, 16U, shake_input_ss, ss_init_len);
   Lib_Memzero0_memzero(shake_input_ss, ss_init_len, uint8_t, void *);
   Lib_Memzero0_memzero(seed_se_k, 32U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_Frodo64_crypto_kem_enc_scratch(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint16_t *scratch)
+{
+  uint8_t coins[16U] = { 0U };
+  randombytes_(16U, coins);
+  enc_scratch(ct, ss, pk, coins, scratch);
   Lib_Memzero0_memzero(coins, 16U, uint8_t, void *);
   return 0U;
 }
 
-uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+uint32_t Hacl_Frodo64_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
 {
-  uint16_t bp_matrix[512U] = { 0U };
+  uint16_t scratch[2112U] = { 0U };
+  return Hacl_Frodo64_crypto_kem_enc_scratch(ct, ss, pk, scratch);
+}
+
+uint32_t Hacl_Frodo64_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins)
+{
+  uint16_t scratch[2112U] = { 0U };
+  enc_scratch(ct, ss, pk, coins, scratch);
+  return 0U;
+}
+
+uint32_t
+Hacl_Frodo64_crypto_kem_dec_scratch(uint8_t *ss, uint8_t *ct, uint8_t *sk, uint16_t *scratch)
+{
+  uint16_t *bp_matrix = scratch + 0U;
+  memset(bp_matrix, 0U, 512U * sizeof (uint16_t));
   uint16_t c_matrix[64U] = { 0U };
   uint8_t *c1 = ct;
   uint8_t *c2 = ct + 960U;
@@ -151,7 +211,8 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   Hacl_Impl_Frodo_Pack_frodo_unpack(8U, 8U, 15U, c2, c_matrix);
   uint8_t mu_decode[16U] = { 0U };
   uint8_t *s_bytes = sk + 992U;
-  uint16_t s_matrix[512U] = { 0U };
+  uint16_t *s_matrix = scratch + 512U;
+  memset(s_matrix, 0U, 512U * sizeof (uint16_t));
   uint16_t m_matrix[64U] = { 0U };
   Hacl_Impl_Matrix_matrix_from_lbytes(64U, 8U, s_bytes, s_matrix);
   Hacl_Impl_Matrix_matrix_mul_s(8U, 64U, 8U, bp_matrix, s_matrix, m_matrix);
@@ -171,12 +232,16 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   uint8_t *seed_se = seed_se_k;
   uint8_t *kp = seed_se_k + 16U;
   uint8_t *s = sk;
-  uint16_t bpp_matrix[512U] = { 0U };
+  uint16_t *bpp_matrix = scratch + 512U;
+  memset(bpp_matrix, 0U, 512U * sizeof (uint16_t));
   uint16_t cp_matrix[64U] = { 0U };
-  uint16_t sp_matrix[512U] = { 0U };
-  uint16_t ep_matrix[512U] = { 0U };
+  uint16_t *sp_matrix = scratch + 1024U;
+  memset(sp_matrix, 0U, 512U * sizeof (uint16_t));
+  uint16_t *ep_matrix = scratch + 1536U;
+  memset(ep_matrix, 0U, 512U * sizeof (uint16_t));
   uint16_t epp_matrix[64U] = { 0U };
-  uint8_t r[2176U] = { 0U };
+  uint8_t *r = (uint8_t *)(scratch + 2048U);
+  memset(r, 0U, 2176U * sizeof (uint8_t));
   uint8_t shake_input_seed_se[17U] = { 0U };
   shake_input_seed_se[0U] = 0x96U;
   memcpy(shake_input_seed_se + 1U, seed_se, 16U * sizeof (uint8_t));
@@ -185,14 +250,20 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 64U, r, sp_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 64U, r + 1024U, ep_matrix);
   Hacl_Impl_Frodo_Sample_frodo_sample_matrix64(8U, 8U, r + 2048U, epp_matrix);
+  /* The rest of r is overwritten below, but not the seed of epp. */
+  Lib_Memzero0_memzero(r + 2048U, 128U, uint8_t, void *);
   uint8_t *pk = sk + 16U;
   uint8_t *seed_a = pk;
   uint8_t *b = pk + 16U;
-  uint16_t a_matrix[4096U] = { 0U };
-  Hacl_Impl_Frodo_Params_frodo_gen_matrix(Spec_Frodo_Params_SHAKE128, 64U, seed_a, a_matrix);
-  Hacl_Impl_Matrix_matrix_mul(8U, 64U, 64U, sp_matrix, a_matrix, bpp_matrix);
+  Hacl_Impl_Frodo_Params_frodo_mul_sa(Spec_Frodo_Params_SHAKE128,
+    64U,
+    seed_a,
+    sp_matrix,
+    bpp_matrix,
+    scratch + 2048U);
   Hacl_Impl_Matrix_matrix_add(8U, 64U, bpp_matrix, ep_matrix);
-  uint16_t b_matrix[512U] = { 0U };
+  uint16_t *b_matrix = scratch + 2560U;
+  memset(b_matrix, 0U, 512U * sizeof (uint16_t));
   Hacl_Impl_Frodo_Pack_frodo_unpack(64U, 8U, 15U, b, b_matrix);
   Hacl_Impl_Matrix_matrix_mul(8U, 64U, 8U, sp_matrix, b_matrix, cp_matrix);
   Hacl_Impl_Matrix_matrix_add(8U, 8U, cp_matrix, epp_matrix);
@@ -220,8 +291,7 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
     x = (uint32_t)uu____0 ^ ((uint32_t)(uint8_t)mask0 & ((uint32_t)kp[i] ^ (uint32_t)uu____0));
     os[i] = x;);
   uint32_t ss_init_len = 1096U;
-  KRML_CHECK_SIZE(sizeof (uint8_t), ss_init_len);
-  uint8_t ss_init[ss_init_len];
+  uint8_t *ss_init = (uint8_t *)(scratch + 1024U);
   memset(ss_init, 0U, ss_init_len * sizeof (uint8_t));
   memcpy(ss_init, ct, 1080U * sizeof (uint8_t));
   memcpy(ss_init + 1080U, kp_s, 16U * sizeof (uint8_t));
@@ -233,3 +303,9 @@ uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
   return 0U;
 }
 
+uint32_t Hacl_Frodo64_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  uint16_t scratch[3136U] = { 0U };
+  return Hacl_Frodo64_crypto_kem_dec_scratch(ss, ct, sk, scratch);
+}
+
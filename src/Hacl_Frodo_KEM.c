@@ -27,9 +27,322 @@
 
 #include "internal/Hacl_Spec.h"
 #include "internal/Hacl_Krmllib.h"
+#include "internal/Vale.h"
+#include "config.h"
+#include "aes-inline.h"
 
 void randombytes_(uint32_t len, uint8_t *res)
 {
   Lib_RandomBuffer_System_randombytes(res, len);
 }
 
+/* AES-128 for the matrix generation of FrodoKEM-AES. The key is seed_A, which is
+   part of the public key, so the portable fallback may use table lookups. */
+
+static const
+uint8_t
+aes_sbox[256U] =
+  {
+  0x63U, 0x7cU, 0x77U, 0x7bU, 0xf2U, 0x6bU, 0x6fU, 0xc5U,
+  0x30U, 0x01U, 0x67U, 0x2bU, 0xfeU, 0xd7U, 0xabU, 0x76U,
+  0xcaU, 0x82U, 0xc9U, 0x7dU, 0xfaU, 0x59U, 0x47U, 0xf0U,
+  0xadU, 0xd4U, 0xa2U, 0xafU, 0x9cU, 0xa4U, 0x72U, 0xc0U,
+  0xb7U, 0xfdU, 0x93U, 0x26U, 0x36U, 0x3fU, 0xf7U, 0xccU,
+  0x34U, 0xa5U, 0xe5U, 0xf1U, 0x71U, 0xd8U, 0x31U, 0x15U,
+  0x04U, 0xc7U, 0x23U, 0xc3U, 0x18U, 0x96U, 0x05U, 0x9aU,
+  0x07U, 0x12U, 0x80U, 0xe2U, 0xebU, 0x27U, 0xb2U, 0x75U,
+  0x09U, 0x83U, 0x2cU, 0x1aU, 0x1bU, 0x6eU, 0x5aU, 0xa0U,
+  0x52U, 0x3bU, 0xd6U, 0xb3U, 0x29U, 0xe3U, 0x2fU, 0x84U,
+  0x53U, 0xd1U, 0x00U, 0xedU, 0x20U, 0xfcU, 0xb1U, 0x5bU,
+  0x6aU, 0xcbU, 0xbeU, 0x39U, 0x4aU, 0x4cU, 0x58U, 0xcfU,
+  0xd0U, 0xefU, 0xaaU, 0xfbU, 0x43U, 0x4dU, 0x33U, 0x85U,
+  0x45U, 0xf9U, 0x02U, 0x7fU, 0x50U, 0x3cU, 0x9fU, 0xa8U,
+  0x51U, 0xa3U, 0x40U, 0x8fU, 0x92U, 0x9dU, 0x38U, 0xf5U,
+  0xbcU, 0xb6U, 0xdaU, 0x21U, 0x10U, 0xffU, 0xf3U, 0xd2U,
+  0xcdU, 0x0cU, 0x13U, 0xecU, 0x5fU, 0x97U, 0x44U, 0x17U,
+  0xc4U, 0xa7U, 0x7eU, 0x3dU, 0x64U, 0x5dU, 0x19U, 0x73U,
+  0x60U, 0x81U, 0x4fU, 0xdcU, 0x22U, 0x2aU, 0x90U, 0x88U,
+  0x46U, 0xeeU, 0xb8U, 0x14U, 0xdeU, 0x5eU, 0x0bU, 0xdbU,
+  0xe0U, 0x32U, 0x3aU, 0x0aU, 0x49U, 0x06U, 0x24U, 0x5cU,
+  0xc2U, 0xd3U, 0xacU, 0x62U, 0x91U, 0x95U, 0xe4U, 0x79U,
+  0xe7U, 0xc8U, 0x37U, 0x6dU, 0x8dU, 0xd5U, 0x4eU, 0xa9U,
+  0x6cU, 0x56U, 0xf4U, 0xeaU, 0x65U, 0x7aU, 0xaeU, 0x08U,
+  0xbaU, 0x78U, 0x25U, 0x2eU, 0x1cU, 0xa6U, 0xb4U, 0xc6U,
+  0xe8U, 0xddU, 0x74U, 0x1fU, 0x4bU, 0xbdU, 0x8bU, 0x8aU,
+  0x70U, 0x3eU, 0xb5U, 0x66U, 0x48U, 0x03U, 0xf6U, 0x0eU,
+  0x61U, 0x35U, 0x57U, 0xb9U, 0x86U, 0xc1U, 0x1dU, 0x9eU,
+  0xe1U, 0xf8U, 0x98U, 0x11U, 0x69U, 0xd9U, 0x8eU, 0x94U,
+  0x9bU, 0x1eU, 0x87U, 0xe9U, 0xceU, 0x55U, 0x28U, 0xdfU,
+  0x8cU, 0xa1U, 0x89U, 0x0dU, 0xbfU, 0xe6U, 0x42U, 0x68U,
+  0x41U, 0x99U, 0x2dU, 0x0fU, 0xb0U, 0x54U, 0xbbU, 0x16U
+  };
+
+/* MixColumns o SubBytes on a byte in row 0 of a column, as the little-endian column
+   (2 s(x), s(x), s(x), 3 s(x)); the other rows are rotations of it */
+static const
+uint32_t
+aes_te0[256U] =
+  {
+  0xa56363c6U, 0x847c7cf8U, 0x997777eeU, 0x8d7b7bf6U, 0x0df2f2ffU, 0xbd6b6bd6U,
+  0xb16f6fdeU, 0x54c5c591U, 0x50303060U, 0x03010102U, 0xa96767ceU, 0x7d2b2b56U,
+  0x19fefee7U, 0x62d7d7b5U, 0xe6abab4dU, 0x9a7676ecU, 0x45caca8fU, 0x9d82821fU,
+  0x40c9c989U, 0x877d7dfaU, 0x15fafaefU, 0xeb5959b2U, 0xc947478eU, 0x0bf0f0fbU,
+  0xecadad41U, 0x67d4d4b3U, 0xfda2a25fU, 0xeaafaf45U, 0xbf9c9c23U, 0xf7a4a453U,
+  0x967272e4U, 0x5bc0c09bU, 0xc2b7b775U, 0x1cfdfde1U, 0xae93933dU, 0x6a26264cU,
+  0x5a36366cU, 0x413f3f7eU, 0x02f7f7f5U, 0x4fcccc83U, 0x5c343468U, 0xf4a5a551U,
+  0x34e5e5d1U, 0x08f1f1f9U, 0x937171e2U, 0x73d8d8abU, 0x53313162U, 0x3f15152aU,
+  0x0c040408U, 0x52c7c795U, 0x65232346U, 0x5ec3c39dU, 0x28181830U, 0xa1969637U,
+  0x0f05050aU, 0xb59a9a2fU, 0x0907070eU, 0x36121224U, 0x9b80801bU, 0x3de2e2dfU,
+  0x26ebebcdU, 0x6927274eU, 0xcdb2b27fU, 0x9f7575eaU, 0x1b090912U, 0x9e83831dU,
+  0x742c2c58U, 0x2e1a1a34U, 0x2d1b1b36U, 0xb26e6edcU, 0xee5a5ab4U, 0xfba0a05bU,
+  0xf65252a4U, 0x4d3b3b76U, 0x61d6d6b7U, 0xceb3b37dU, 0x7b292952U, 0x3ee3e3ddU,
+  0x712f2f5eU, 0x97848413U, 0xf55353a6U, 0x68d1d1b9U, 0x00000000U, 0x2cededc1U,
+  0x60202040U, 0x1ffcfce3U, 0xc8b1b179U, 0xed5b5bb6U, 0xbe6a6ad4U, 0x46cbcb8dU,
+  0xd9bebe67U, 0x4b393972U, 0xde4a4a94U, 0xd44c4c98U, 0xe85858b0U, 0x4acfcf85U,
+  0x6bd0d0bbU, 0x2aefefc5U, 0xe5aaaa4fU, 0x16fbfbedU, 0xc5434386U, 0xd74d4d9aU,
+  0x55333366U, 0x94858511U, 0xcf45458aU, 0x10f9f9e9U, 0x06020204U, 0x817f7ffeU,
+  0xf05050a0U, 0x443c3c78U, 0xba9f9f25U, 0xe3a8a84bU, 0xf35151a2U, 0xfea3a35dU,
+  0xc0404080U, 0x8a8f8f05U, 0xad92923fU, 0xbc9d9d21U, 0x48383870U, 0x04f5f5f1U,
+  0xdfbcbc63U, 0xc1b6b677U, 0x75dadaafU, 0x63212142U, 0x30101020U, 0x1affffe5U,
+  0x0ef3f3fdU, 0x6dd2d2bfU, 0x4ccdcd81U, 0x140c0c18U, 0x35131326U, 0x2fececc3U,
+  0xe15f5fbeU, 0xa2979735U, 0xcc444488U, 0x3917172eU, 0x57c4c493U, 0xf2a7a755U,
+  0x827e7efcU, 0x473d3d7aU, 0xac6464c8U, 0xe75d5dbaU, 0x2b191932U, 0x957373e6U,
+  0xa06060c0U, 0x98818119U, 0xd14f4f9eU, 0x7fdcdca3U, 0x66222244U, 0x7e2a2a54U,
+  0xab90903bU, 0x8388880bU, 0xca46468cU, 0x29eeeec7U, 0xd3b8b86bU, 0x3c141428U,
+  0x79dedea7U, 0xe25e5ebcU, 0x1d0b0b16U, 0x76dbdbadU, 0x3be0e0dbU, 0x56323264U,
+  0x4e3a3a74U, 0x1e0a0a14U, 0xdb494992U, 0x0a06060cU, 0x6c242448U, 0xe45c5cb8U,
+  0x5dc2c29fU, 0x6ed3d3bdU, 0xefacac43U, 0xa66262c4U, 0xa8919139U, 0xa4959531U,
+  0x37e4e4d3U, 0x8b7979f2U, 0x32e7e7d5U, 0x43c8c88bU, 0x5937376eU, 0xb76d6ddaU,
+  0x8c8d8d01U, 0x64d5d5b1U, 0xd24e4e9cU, 0xe0a9a949U, 0xb46c6cd8U, 0xfa5656acU,
+  0x07f4f4f3U, 0x25eaeacfU, 0xaf6565caU, 0x8e7a7af4U, 0xe9aeae47U, 0x18080810U,
+  0xd5baba6fU, 0x887878f0U, 0x6f25254aU, 0x722e2e5cU, 0x241c1c38U, 0xf1a6a657U,
+  0xc7b4b473U, 0x51c6c697U, 0x23e8e8cbU, 0x7cdddda1U, 0x9c7474e8U, 0x211f1f3eU,
+  0xdd4b4b96U, 0xdcbdbd61U, 0x868b8b0dU, 0x858a8a0fU, 0x907070e0U, 0x423e3e7cU,
+  0xc4b5b571U, 0xaa6666ccU, 0xd8484890U, 0x05030306U, 0x01f6f6f7U, 0x120e0e1cU,
+  0xa36161c2U, 0x5f35356aU, 0xf95757aeU, 0xd0b9b969U, 0x91868617U, 0x58c1c199U,
+  0x271d1d3aU, 0xb99e9e27U, 0x38e1e1d9U, 0x13f8f8ebU, 0xb398982bU, 0x33111122U,
+  0xbb6969d2U, 0x70d9d9a9U, 0x898e8e07U, 0xa7949433U, 0xb69b9b2dU, 0x221e1e3cU,
+  0x92878715U, 0x20e9e9c9U, 0x49cece87U, 0xff5555aaU, 0x78282850U, 0x7adfdfa5U,
+  0x8f8c8c03U, 0xf8a1a159U, 0x80898909U, 0x170d0d1aU, 0xdabfbf65U, 0x31e6e6d7U,
+  0xc6424284U, 0xb86868d0U, 0xc3414182U, 0xb0999929U, 0x772d2d5aU, 0x110f0f1eU,
+  0xcbb0b07bU, 0xfc5454a8U, 0xd6bbbb6dU, 0x3a16162cU
+  };
+
+static uint8_t aes_xtime(uint8_t x)
+{
+  return (uint32_t)x << 1U ^ (0x1bU & (0U - ((uint32_t)x >> 7U)));
+}
+
+static void aes128_key_expansion_portable(uint8_t *key, uint8_t *rk)
+{
+  uint8_t rcon = 0x01U;
+  memcpy(rk, key, 16U * sizeof (uint8_t));
+  for (uint32_t i = 1U; i < 11U; i++)
+  {
+    uint8_t *prev = rk + 16U * (i - 1U);
+    uint8_t *cur = rk + 16U * i;
+    cur[0U] = (uint32_t)prev[0U] ^ (uint32_t)aes_sbox[prev[13U]] ^ (uint32_t)rcon;
+    cur[1U] = (uint32_t)prev[1U] ^ (uint32_t)aes_sbox[prev[14U]];
+    cur[2U] = (uint32_t)prev[2U] ^ (uint32_t)aes_sbox[prev[15U]];
+    cur[3U] = (uint32_t)prev[3U] ^ (uint32_t)aes_sbox[prev[12U]];
+    for (uint32_t j = 4U; j < 16U; j++)
+    {
+      cur[j] = (uint32_t)prev[j] ^ (uint32_t)cur[j - 4U];
+    }
+    rcon = aes_xtime(rcon);
+  }
+}
+
+static uint32_t aes_rotl(uint32_t x, uint32_t k)
+{
+  return x << k | x >> (32U - k);
+}
+
+static uint32_t aes_sub_word(uint32_t x)
+{
+  return
+    (uint32_t)aes_sbox[x & 0xffU]
+    | (uint32_t)aes_sbox[x >> 8U & 0xffU] << 8U
+    | (uint32_t)aes_sbox[x >> 16U & 0xffU] << 16U
+    | (uint32_t)aes_sbox[x >> 24U] << 24U;
+}
+
+/* The key is seed_A, which is public, so table lookups are fine here */
+static void aes128_encrypt_block_portable(uint8_t *out, uint8_t *in, uint8_t *rk)
+{
+  uint32_t st[4U] = { 0U };
+  for (uint32_t c = 0U; c < 4U; c++)
+  {
+    st[c] = load32_le(in + 4U * c) ^ load32_le(rk + 4U * c);
+  }
+  for (uint32_t i = 1U; i < 10U; i++)
+  {
+    uint32_t t[4U] = { 0U };
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+      t[c] =
+        aes_te0[st[c] & 0xffU]
+        ^ aes_rotl(aes_te0[st[(c + 1U) % 4U] >> 8U & 0xffU], 8U)
+        ^ aes_rotl(aes_te0[st[(c + 2U) % 4U] >> 16U & 0xffU], 16U)
+        ^ aes_rotl(aes_te0[st[(c + 3U) % 4U] >> 24U], 24U)
+        ^ load32_le(rk + 16U * i + 4U * c);
+    }
+    memcpy(st, t, 4U * sizeof (uint32_t));
+  }
+  for (uint32_t c = 0U; c < 4U; c++)
+  {
+    uint32_t
+    x =
+      (st[c] & 0xffU)
+      | (st[(c + 1U) % 4U] & 0xff00U)
+      | (st[(c + 2U) % 4U] & 0xff0000U)
+      | (st[(c + 3U) % 4U] & 0xff000000U);
+    store32_le(out + 4U * c, aes_sub_word(x) ^ load32_le(rk + 160U + 4U * c));
+  }
+}
+
+static void aes128_encrypt_blocks_portable(uint32_t nblocks, uint8_t *r, uint8_t *rk)
+{
+  for (uint32_t j = 0U; j < nblocks; j++)
+  {
+    aes128_encrypt_block_portable(r + 16U * j, r + 16U * j, rk);
+  }
+}
+
+#if HACL_CAN_COMPILE_VALE
+void Hacl_Impl_Frodo_Aesni_aes128_key_expansion(uint8_t *key, uint8_t *rk)
+{
+  uint64_t scrut = aes128_key_expansion(key, rk);
+  KRML_MAYBE_UNUSED_VAR(scrut);
+}
+#endif
+
+#if HACL_CAN_COMPILE_INLINE_ASM
+void Hacl_Impl_Frodo_Aesni_aes128_encrypt_blocks(uint32_t nblocks, uint8_t *r, uint8_t *rk)
+{
+  uint32_t j = 0U;
+  for (; j + 8U <= nblocks; j = j + 8U)
+  {
+    aes128_encrypt8(r + 16U * j, r + 16U * j, rk);
+  }
+  aes128_encrypt_blocks_portable(nblocks - j, r + 16U * j, rk);
+}
+#endif
+
+void Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_init(uint8_t *seed, uint8_t *rk)
+{
+  Hacl_Impl_Frodo_Kernels_get()->aes128_key_expansion(seed, rk);
+}
+
+void
+Hacl_Impl_Frodo_Gen_frodo_gen_matrix_aes_rows(
+  uint32_t n,
+  uint8_t *rk,
+  uint32_t i,
+  uint8_t *r,
+  uint16_t *res
+)
+{
+  /* Block j / 8 of row 4i + k encrypts (4i + k, j, 0, .., 0) into the eight
+     entries A[4i + k][j .. j + 8) */
+  memset(r, 0U, 8U * n * sizeof (uint8_t));
+  for (uint32_t k = 0U; k < 4U; k++)
+  {
+    for (uint32_t j = 0U; j < n / 8U; j++)
+    {
+      uint8_t *b = r + 2U * n * k + 16U * j;
+      store16_le(b, (uint16_t)(4U * i + k));
+      store16_le(b + 2U, (uint16_t)(8U * j));
+    }
+  }
+  Hacl_Impl_Frodo_Kernels_get()->aes128_encrypt_blocks(n / 2U, r, rk);
+  for (uint32_t i0 = 0U; i0 < 4U * n; i0++)
+  {
+    res[i0] = load16_le(r + 2U * i0);
+  }
+}
+
+static void
+shake128_4x_portable(
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Hash_SHA3_shake128(output0, output_len, input0, input_len);
+  Hacl_Hash_SHA3_shake128(output1, output_len, input1, input_len);
+  Hacl_Hash_SHA3_shake128(output2, output_len, input2, input_len);
+  Hacl_Hash_SHA3_shake128(output3, output_len, input3, input_len);
+}
+
+static void matrix_mul_rows_s_portable(uint32_t n, uint16_t *rows, uint16_t *s, uint16_t *res)
+{
+  for (uint32_t i0 = 0U; i0 < 4U; i0++)
+  {
+    for (uint32_t i1 = 0U; i1 < 8U; i1++)
+    {
+      uint16_t res0 = 0U;
+      for (uint32_t i = 0U; i < n; i++)
+      {
+        res0 = (uint32_t)res0 + (uint32_t)rows[i0 * n + i] * (uint32_t)s[i1 * n + i];
+      }
+      res[i0 * 8U + i1] = res0;
+    }
+  }
+}
+
+static void
+matrix_mul_add_rows_portable(uint32_t n, uint16_t *s, uint32_t i, uint16_t *rows, uint16_t *res)
+{
+  for (uint32_t i0 = 0U; i0 < 8U; i0++)
+  {
+    for (uint32_t i1 = 0U; i1 < 4U; i1++)
+    {
+      uint16_t sij = s[i0 * n + 4U * i + i1];
+      uint16_t *row = rows + i1 * n;
+      uint16_t *res_i = res + i0 * n;
+      for (uint32_t i2 = 0U; i2 < n; i2++)
+      {
+        res_i[i2] = (uint32_t)res_i[i2] + (uint32_t)sij * (uint32_t)row[i2];
+      }
+    }
+  }
+}
+
+const
+Hacl_Impl_Frodo_Kernels
+Hacl_Impl_Frodo_Kernels_portable =
+  {
+    .shake128_4x = shake128_4x_portable,
+    .matrix_mul_rows_s = matrix_mul_rows_s_portable,
+    .matrix_mul_add_rows = matrix_mul_add_rows_portable,
+    .aes128_key_expansion = aes128_key_expansion_portable,
+    .aes128_encrypt_blocks = aes128_encrypt_blocks_portable
+  };
+
+static const Hacl_Impl_Frodo_Kernels *kernels = &Hacl_Impl_Frodo_Kernels_portable;
+
+void Hacl_Impl_Frodo_Kernels_set(const Hacl_Impl_Frodo_Kernels *k)
+{
+#if defined(__GNUC__)
+  __atomic_store_n(&kernels, k, __ATOMIC_RELEASE);
+#else
+  kernels = k;
+#endif
+}
+
+const Hacl_Impl_Frodo_Kernels *Hacl_Impl_Frodo_Kernels_get(void)
+{
+#if defined(__GNUC__)
+  return __atomic_load_n(&kernels, __ATOMIC_ACQUIRE);
+#else
+  return kernels;
+#endif
+}
@@ -0,0 +1,150 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+/* This is a hand-written file. It is compiled with AVX2 enabled, and
+ * EverCrypt_Dispatch_init only installs its kernels on CPUs with AVX2. */
+
+#include "internal/Hacl_Frodo_KEM_Simd256.h"
+
+#include "Hacl_Hash_SHA3_Simd256.h"
+
+#include <immintrin.h>
+
+void
+Hacl_Impl_Frodo_Simd256_shake128_4x(
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Hash_SHA3_Simd256_shake128(output0,
+    output1,
+    output2,
+    output3,
+    output_len,
+    input0,
+    input1,
+    input2,
+    input3,
+    input_len);
+}
+
+/* res[r * 8 + k] = sum_j rows[r * n + j] * s[k * n + j] mod 2^16, for the four
+   rows r of a block of A and the eight columns k of S. */
+void
+Hacl_Impl_Frodo_Simd256_matrix_mul_rows_s(
+  uint32_t n,
+  uint16_t *rows,
+  uint16_t *s,
+  uint16_t *res
+)
+{
+  for (uint32_t r = 0U; r < 4U; r++)
+  {
+    uint16_t *row = rows + r * n;
+    __m256i acc[8U];
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+      acc[k] = _mm256_setzero_si256();
+    }
+    uint32_t j = 0U;
+    for (; j + 16U <= n; j = j + 16U)
+    {
+      __m256i x = _mm256_loadu_si256((const __m256i *)(row + j));
+      for (uint32_t k = 0U; k < 8U; k++)
+      {
+        __m256i y = _mm256_loadu_si256((const __m256i *)(s + k * n + j));
+        acc[k] = _mm256_add_epi16(acc[k], _mm256_mullo_epi16(x, y));
+      }
+    }
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+      uint16_t lanes[16U];
+      _mm256_storeu_si256((__m256i *)lanes, acc[k]);
+      uint16_t sum = 0U;
+      for (uint32_t l = 0U; l < 16U; l++)
+      {
+        sum = (uint32_t)sum + (uint32_t)lanes[l];
+      }
+      for (uint32_t j0 = j; j0 < n; j0++)
+      {
+        sum = (uint32_t)sum + (uint32_t)row[j0] * (uint32_t)s[k * n + j0];
+      }
+      res[r * 8U + k] = sum;
+    }
+  }
+}
+
+/* res[k * n + j] += sum_r s[k * n + 4 * i + r] * rows[r * n + j] mod 2^16, i.e.
+   the contribution of rows 4i .. 4i + 3 of A to the 8 x n product S * A. */
+void
+Hacl_Impl_Frodo_Simd256_matrix_mul_add_rows(
+  uint32_t n,
+  uint16_t *s,
+  uint32_t i,
+  uint16_t *rows,
+  uint16_t *res
+)
+{
+  for (uint32_t k = 0U; k < 8U; k++)
+  {
+    uint16_t *s_k = s + k * n + 4U * i;
+    uint16_t *res_k = res + k * n;
+    __m256i c0 = _mm256_set1_epi16((int16_t)s_k[0U]);
+    __m256i c1 = _mm256_set1_epi16((int16_t)s_k[1U]);
+    __m256i c2 = _mm256_set1_epi16((int16_t)s_k[2U]);
+    __m256i c3 = _mm256_set1_epi16((int16_t)s_k[3U]);
+    uint32_t j = 0U;
+    for (; j + 16U <= n; j = j + 16U)
+    {
+      __m256i acc = _mm256_loadu_si256((const __m256i *)(res_k + j));
+      __m256i x0 = _mm256_loadu_si256((const __m256i *)(rows + j));
+      __m256i x1 = _mm256_loadu_si256((const __m256i *)(rows + n + j));
+      __m256i x2 = _mm256_loadu_si256((const __m256i *)(rows + 2U * n + j));
+      __m256i x3 = _mm256_loadu_si256((const __m256i *)(rows + 3U * n + j));
+      acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(c0, x0));
+      acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(c1, x1));
+      acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(c2, x2));
+      acc = _mm256_add_epi16(acc, _mm256_mullo_epi16(c3, x3));
+      _mm256_storeu_si256((__m256i *)(res_k + j), acc);
+    }
+    for (; j < n; j++)
+    {
+      uint32_t t =
+        (uint32_t)s_k[0U] * (uint32_t)rows[j]
+        + (uint32_t)s_k[1U] * (uint32_t)rows[n + j]
+        + (uint32_t)s_k[2U] * (uint32_t)rows[2U * n + j]
+        + (uint32_t)s_k[3U] * (uint32_t)rows[3U * n + j];
+      res_k[j] = (uint32_t)res_k[j] + t;
+    }
+  }
+}
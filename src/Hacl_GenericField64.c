@@ -612,3 +612,282 @@ Hacl_GenericField64_inverse(
   Hacl_GenericField64_exp_vartime(k, aM, k1.len * 64U, n2, aInvM);
 }
 
+
+/**
+Write `aM[i] ^ (-1) mod n` in `aInvM[i]` for each of the `count` elements of aM.
+
+  The arguments aM and aInvM are meant to be `count` consecutive field elements
+  of `len` limbs each, i.e. uint64_t[count * len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  This uses Montgomery's trick, i.e. a single inversion and 3 * (count - 1)
+  multiplications. This function is constant-time over the elements of aM.
+
+  Before calling this function, the caller will need to ensure that the following
+  preconditions are observed.
+  • n is a prime
+  • 0 < count
+  • 0 < aM[i] for all i
+  • aM and aInvM are disjoint
+*/
+void
+Hacl_GenericField64_batch_inverse(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint64_t *aInvM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint32_t len1 = k1.len;
+  memcpy(aInvM, aM, len1 * sizeof (uint64_t));
+  for (uint32_t i = 1U; i < count; i++)
+  {
+    uint64_t *acc_prev = aInvM + (i - 1U) * len1;
+    uint64_t *acc_i = aInvM + i * len1;
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, acc_prev, aM + i * len1, acc_i);
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t inv[len1];
+  memset(inv, 0U, len1 * sizeof (uint64_t));
+  Hacl_GenericField64_inverse(k, aInvM + (count - 1U) * len1, inv);
+  for (uint32_t i0 = 0U; i0 < count - 1U; i0++)
+  {
+    uint32_t i = count - i0 - 1U;
+    uint64_t *res_i = aInvM + i * len1;
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, inv, aInvM + (i - 1U) * len1, res_i);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, inv, aM + i * len1, inv);
+  }
+  memcpy(aInvM, inv, len1 * sizeof (uint64_t));
+}
+
+/* Number of bases that share the squarings of a multi-exponentiation. Each of
+   them needs a 16-entry table on the stack, so larger inputs are processed in
+   chunks of this many bases, each with its own chain of squarings, and the
+   partial products are multiplied together. Sharing one chain across all bases
+   would need a heap-allocated table of count * 16 * len limbs. */
+#define MULTI_EXP_CHUNK 8U
+
+static inline void
+multi_exp_precomp_table(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1,
+  uint32_t count,
+  uint64_t *aM,
+  uint64_t *table
+)
+{
+  uint32_t len1 = k1.len;
+  for (uint32_t j = 0U; j < count; j++)
+  {
+    uint64_t *t = table + 16U * j * len1;
+    Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, k1.r2, t);
+    memcpy(t + len1, aM + j * len1, len1 * sizeof (uint64_t));
+    for (uint32_t i = 2U; i < 16U; i++)
+    {
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1,
+        k1.n,
+        k1.mu,
+        t + (i - 1U) * len1,
+        t + len1,
+        t + i * len1);
+    }
+  }
+}
+
+static inline void
+multi_exp_consttime_chunk(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint32_t bLen,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t len1 = k1.len;
+  KRML_CHECK_SIZE(sizeof (uint64_t), MULTI_EXP_CHUNK * 16U * len1);
+  uint64_t table[MULTI_EXP_CHUNK * 16U * len1];
+  memset(table, 0U, MULTI_EXP_CHUNK * 16U * len1 * sizeof (uint64_t));
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t tmp[len1];
+  memset(tmp, 0U, len1 * sizeof (uint64_t));
+  multi_exp_precomp_table(k1, count, aM, table);
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, k1.r2, resM);
+  uint32_t nWindows = (bBits + 3U) / 4U;
+  for (uint32_t i0 = 0U; i0 < nWindows; i0++)
+  {
+    uint32_t w = nWindows - i0 - 1U;
+    if (i0 != 0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        0U,
+        4U,
+        1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len1, k1.n, k1.mu, resM, resM););
+    }
+    for (uint32_t j = 0U; j < count; j++)
+    {
+      const uint64_t *t = table + 16U * j * len1;
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b + j * bLen, 4U * w, 4U);
+      memcpy(tmp, (uint64_t *)t, len1 * sizeof (uint64_t));
+      for (uint32_t i1 = 0U; i1 < 15U; i1++)
+      {
+        uint64_t c = FStar_UInt64_eq_mask(bits_l, (uint64_t)(i1 + 1U));
+        const uint64_t *res_j = t + (i1 + 1U) * len1;
+        for (uint32_t i = 0U; i < len1; i++)
+        {
+          uint64_t *os = tmp;
+          uint64_t x = (c & res_j[i]) | (~c & tmp[i]);
+          os[i] = x;
+        }
+      }
+      Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, resM, tmp, resM);
+    }
+  }
+}
+
+static inline void
+multi_exp_vartime_chunk(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint32_t bLen,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  uint32_t len1 = k1.len;
+  KRML_CHECK_SIZE(sizeof (uint64_t), MULTI_EXP_CHUNK * 16U * len1);
+  uint64_t table[MULTI_EXP_CHUNK * 16U * len1];
+  memset(table, 0U, MULTI_EXP_CHUNK * 16U * len1 * sizeof (uint64_t));
+  multi_exp_precomp_table(k1, count, aM, table);
+  Hacl_Bignum_Montgomery_bn_from_mont_u64(len1, k1.n, k1.mu, k1.r2, resM);
+  uint32_t nWindows = (bBits + 3U) / 4U;
+  for (uint32_t i0 = 0U; i0 < nWindows; i0++)
+  {
+    uint32_t w = nWindows - i0 - 1U;
+    if (i0 != 0U)
+    {
+      KRML_MAYBE_FOR4(i,
+        0U,
+        4U,
+        1U,
+        Hacl_Bignum_Montgomery_bn_mont_sqr_u64(len1, k1.n, k1.mu, resM, resM););
+    }
+    for (uint32_t j = 0U; j < count; j++)
+    {
+      uint64_t bits_l = Hacl_Bignum_Lib_bn_get_bits_u64(bLen, b + j * bLen, 4U * w, 4U);
+      if (!(bits_l == 0ULL))
+      {
+        uint64_t *a_bits_l = table + (16U * j + (uint32_t)bits_l) * len1;
+        Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, resM, a_bits_l, resM);
+      }
+    }
+  }
+}
+
+/**
+Write `aM[0] ^ b[0] * ... * aM[count - 1] ^ b[count - 1] mod n` in `resM`.
+
+  The argument aM is meant to be `count` consecutive field elements of `len`
+  limbs each, i.e. uint64_t[count * len], and the outparam resM is meant to be
+  `len` limbs in size, i.e. uint64_t[len].
+  The argument k is a montgomery context obtained through Hacl_GenericField64_field_init.
+
+  The argument b is meant to be `count` consecutive bignums of `bLen` limbs each,
+  where bLen = (bBits - 1) / 64 + 1 (or 1 if bBits = 0), and bBits is an upper
+  bound on the number of significant bits of every b[i].
+
+  The bases are processed in chunks of 8 (Straus' method): the exponentiations
+  of a chunk share one chain of about bBits squarings, and each chunk keeps a
+  16-entry table per base on the stack, i.e. 128 * len limbs. The whole call
+  thus costs about ceil(count / 8) * bBits squarings, count * bBits / 4
+  multiplications and 15 * count multiplications for the tables, which is
+  several times faster than `count` calls to exp_consttime. This function is
+  constant-time over its argument b.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for all i
+*/
+void
+Hacl_GenericField64_multi_exp_consttime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint32_t len1 = k1.len;
+  uint32_t bLen;
+  if (bBits == 0U)
+  {
+    bLen = 1U;
+  }
+  else
+  {
+    bLen = (bBits - 1U) / 64U + 1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t chunkM[len1];
+  memset(chunkM, 0U, len1 * sizeof (uint64_t));
+  uint32_t c0 = count < MULTI_EXP_CHUNK ? count : MULTI_EXP_CHUNK;
+  multi_exp_consttime_chunk(k1, c0, aM, bBits, bLen, b, resM);
+  for (uint32_t j = MULTI_EXP_CHUNK; j < count; j = j + MULTI_EXP_CHUNK)
+  {
+    uint32_t c = count - j < MULTI_EXP_CHUNK ? count - j : MULTI_EXP_CHUNK;
+    multi_exp_consttime_chunk(k1, c, aM + j * len1, bBits, bLen, b + j * bLen, chunkM);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, resM, chunkM, resM);
+  }
+}
+
+/**
+Write `aM[0] ^ b[0] * ... * aM[count - 1] ^ b[count - 1] mod n` in `resM`.
+
+  The arguments are as for Hacl_GenericField64_multi_exp_consttime.
+
+  The function is *NOT* constant-time on the argument b. See the
+  multi_exp_consttime function for constant-time variant.
+
+  Before calling this function, the caller will need to ensure that the following
+  precondition is observed.
+  • b[i] < pow2 bBits for all i
+*/
+void
+Hacl_GenericField64_multi_exp_vartime(
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 *k,
+  uint32_t count,
+  uint64_t *aM,
+  uint32_t bBits,
+  uint64_t *b,
+  uint64_t *resM
+)
+{
+  Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64 k1 = *k;
+  uint32_t len1 = k1.len;
+  uint32_t bLen;
+  if (bBits == 0U)
+  {
+    bLen = 1U;
+  }
+  else
+  {
+    bLen = (bBits - 1U) / 64U + 1U;
+  }
+  KRML_CHECK_SIZE(sizeof (uint64_t), len1);
+  uint64_t chunkM[len1];
+  memset(chunkM, 0U, len1 * sizeof (uint64_t));
+  uint32_t c0 = count < MULTI_EXP_CHUNK ? count : MULTI_EXP_CHUNK;
+  multi_exp_vartime_chunk(k1, c0, aM, bBits, bLen, b, resM);
+  for (uint32_t j = MULTI_EXP_CHUNK; j < count; j = j + MULTI_EXP_CHUNK)
+  {
+    uint32_t c = count - j < MULTI_EXP_CHUNK ? count - j : MULTI_EXP_CHUNK;
+    multi_exp_vartime_chunk(k1, c, aM + j * len1, bBits, bLen, b + j * bLen, chunkM);
+    Hacl_Bignum_Montgomery_bn_mont_mul_u64(len1, k1.n, k1.mu, resM, chunkM, resM);
+  }
+}
@@ -26,6 +26,7 @@
 #include "Hacl_HPKE_Curve51_CP128_SHA256.h"
 
 #include "internal/Hacl_Krmllib.h"
+#include "internal/Hacl_HPKE_DHKEM.h"
 
 uint32_t
 Hacl_HPKE_Curve51_CP128_SHA256_setupBaseS(
@@ -525,6 +526,285 @@ Hacl_HPKE_Curve51_CP128_SHA256_setupBaseR(
   return 1U;
 }
 
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_s(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_psk,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      NULL,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_r(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_psk,
+      o_ctx,
+      enc,
+      skR,
+      NULL,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_s(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_auth,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      skS,
+      infolen,
+      info,
+      0U,
+      NULL,
+      0U,
+      NULL);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_r(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_auth,
+      o_ctx,
+      enc,
+      skR,
+      pkS,
+      infolen,
+      info,
+      0U,
+      NULL,
+      0U,
+      NULL);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKS(
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_s(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_auth_psk,
+      o_pkE,
+      o_ctx,
+      skE,
+      pkR,
+      skS,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_setupAuthPSKR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  return
+    Hacl_Impl_HPKE_DHKEM_setup_r(&Hacl_Impl_HPKE_DHKEM_x25519_51,
+      1U,
+      Hacl_Impl_HPKE_mode_auth_psk,
+      o_ctx,
+      enc,
+      skR,
+      pkS,
+      infolen,
+      info,
+      psklen,
+      psk,
+      psk_idlen,
+      psk_id);
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_context_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  uint64_t s = ctx.ctx_seq[0U];
+  if (s == 18446744073709551615ULL)
+  {
+    return 1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  uint8_t enc[12U] = { 0U };
+  store64_be(enc + 4U, s);
+  KRML_MAYBE_FOR12(i,
+    0U,
+    12U,
+    1U,
+    uint8_t xi = enc[i];
+    uint8_t yi = ctx.ctx_nonce[i];
+    nonce[i] = (uint32_t)xi ^ (uint32_t)yi;);
+  uint8_t *cipher = o_ct;
+  uint8_t *tag = o_ct + plainlen;
+  Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(cipher,
+    tag,
+    plain,
+    plainlen,
+    aad,
+    aadlen,
+    ctx.ctx_key,
+    nonce);
+  uint64_t s_ = s + 1ULL;
+  ctx.ctx_seq[0U] = s_;
+  return 0U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_context_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  if (ctlen < 16U)
+  {
+    return 1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  uint64_t s = ctx.ctx_seq[0U];
+  uint8_t enc[12U] = { 0U };
+  store64_be(enc + 4U, s);
+  KRML_MAYBE_FOR12(i,
+    0U,
+    12U,
+    1U,
+    uint8_t xi = enc[i];
+    uint8_t yi = ctx.ctx_nonce[i];
+    nonce[i] = (uint32_t)xi ^ (uint32_t)yi;);
+  uint8_t *cipher = ct;
+  uint8_t *tag = ct + ctlen - 16U;
+  uint32_t
+  res =
+    Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(o_pt,
+      cipher,
+      ctlen - 16U,
+      aad,
+      aadlen,
+      ctx.ctx_key,
+      nonce,
+      tag);
+  if (res == 0U)
+  {
+    uint64_t s1 = ctx.ctx_seq[0U];
+    if (s1 == 18446744073709551615ULL)
+    {
+      return 1U;
+    }
+    uint64_t s_ = s1 + 1ULL;
+    ctx.ctx_seq[0U] = s_;
+    return 0U;
+  }
+  return 1U;
+}
+
+uint32_t
+Hacl_HPKE_Curve51_CP128_SHA256_context_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  return Hacl_Impl_HPKE_export(ctx, (uint16_t)0x0020U, 1U, exp_ctxlen, exp_ctx, l, o_secret);
+}
+
 uint32_t
 Hacl_HPKE_Curve51_CP128_SHA256_sealBase(
   uint8_t *skE,
@@ -555,41 +835,7 @@ Hacl_HPKE_Curve51_CP128_SHA256_sealBase(
   res = Hacl_HPKE_Curve51_CP128_SHA256_setupBaseS(o_enc, o_ctx, skE, pkR, infolen, info);
   if (res == 0U)
   {
-    uint8_t nonce[12U] = { 0U };
-    uint64_t s = o_ctx.ctx_seq[0U];
-    uint8_t enc[12U] = { 0U };
-    store64_be(enc + 4U, s);
-    KRML_MAYBE_FOR12(i,
-      0U,
-      12U,
-      1U,
-      uint8_t xi = enc[i];
-      uint8_t yi = o_ctx.ctx_nonce[i];
-      nonce[i] = (uint32_t)xi ^ (uint32_t)yi;);
-    uint8_t *cipher = o_ct;
-    uint8_t *tag = o_ct + plainlen;
-    Hacl_AEAD_Chacha20Poly1305_Simd128_encrypt(cipher,
-      tag,
-      plain,
-      plainlen,
-      aad,
-      aadlen,
-      o_ctx.ctx_key,
-      nonce);
-    uint64_t s1 = o_ctx.ctx_seq[0U];
-    uint32_t res1;
-    if (s1 == 18446744073709551615ULL)
-    {
-      res1 = 1U;
-    }
-    else
-    {
-      uint64_t s_ = s1 + 1ULL;
-      o_ctx.ctx_seq[0U] = s_;
-      res1 = 0U;
-    }
-    uint32_t res10 = res1;
-    return res10;
+    return Hacl_HPKE_Curve51_CP128_SHA256_context_seal(o_ctx, aadlen, aad, plainlen, plain, o_ct);
   }
   return 1U;
 }
@@ -622,41 +868,7 @@ Hacl_HPKE_Curve51_CP128_SHA256_openBase(
   uint32_t res = Hacl_HPKE_Curve51_CP128_SHA256_setupBaseR(o_ctx, pkE, skR, infolen, info);
   if (res == 0U)
   {
-    uint8_t nonce[12U] = { 0U };
-    uint64_t s = o_ctx.ctx_seq[0U];
-    uint8_t enc[12U] = { 0U };
-    store64_be(enc + 4U, s);
-    KRML_MAYBE_FOR12(i,
-      0U,
-      12U,
-      1U,
-      uint8_t xi = enc[i];
-      uint8_t yi = o_ctx.ctx_nonce[i];
-      nonce[i] = (uint32_t)xi ^ (uint32_t)yi;);
-    uint8_t *cipher = ct;
-    uint8_t *tag = ct + ctlen - 16U;
-    uint32_t
-    res1 =
-      Hacl_AEAD_Chacha20Poly1305_Simd128_decrypt(o_pt,
-        cipher,
-        ctlen - 16U,
-        aad,
-        aadlen,
-        o_ctx.ctx_key,
-        nonce,
-        tag);
-    if (res1 == 0U)
-    {
-      uint64_t s1 = o_ctx.ctx_seq[0U];
-      if (s1 == 18446744073709551615ULL)
-      {
-        return 1U;
-      }
-      uint64_t s_ = s1 + 1ULL;
-      o_ctx.ctx_seq[0U] = s_;
-      return 0U;
-    }
-    return 1U;
+    return Hacl_HPKE_Curve51_CP128_SHA256_context_open(o_ctx, aadlen, aad, ctlen, ct, o_pt);
   }
   return 1U;
 }
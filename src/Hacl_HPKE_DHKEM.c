@@ -0,0 +1,263 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_HPKE_DHKEM.h"
+
+#include "internal/Hacl_Krmllib.h"
+#include "internal/Hacl_P256.h"
+#include "Hacl_Curve25519_51.h"
+#include "lib_memzero0.h"
+
+/* This is a hand-written file. */
+
+/* The largest enclen, for P-256. */
+#define DHKEM_MAX_ENC (65U)
+
+uint32_t Hacl_Impl_HPKE_DHKEM_x25519_check(uint8_t *dh)
+{
+  uint8_t res = 255U;
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    uint8_t uu____0 = FStar_UInt8_eq_mask(dh[i], 0U);
+    res = (uint32_t)uu____0 & (uint32_t)res;
+  }
+  if (res == 255U)
+  {
+    return 1U;
+  }
+  return 0U;
+}
+
+static uint32_t x25519_51_secret_to_public(uint8_t *o_enc, uint8_t *sk)
+{
+  Hacl_Curve25519_51_secret_to_public(o_enc, sk);
+  return 0U;
+}
+
+static uint32_t x25519_51_dh(uint8_t *o_dh, uint8_t *sk, uint8_t *pk)
+{
+  Hacl_Curve25519_51_scalarmult(o_dh, sk, pk);
+  return Hacl_Impl_HPKE_DHKEM_x25519_check(o_dh);
+}
+
+const
+Hacl_Impl_HPKE_DHKEM_s
+Hacl_Impl_HPKE_DHKEM_x25519_51 =
+  { 0x20U, 32U, 32U, x25519_51_secret_to_public, x25519_51_dh };
+
+/* The 65-byte uncompressed public key of sk. */
+static uint32_t p256_secret_to_public(uint8_t *o_enc, uint8_t *sk)
+{
+  o_enc[0U] = 4U;
+  if (Hacl_Impl_P256_DH_ecp256dh_i(o_enc + 1U, sk))
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+/* The x-coordinate of sk * pk, for a 64-byte raw public key pk. */
+static uint32_t p256_dh(uint8_t *o_dh, uint8_t *sk, uint8_t *pk)
+{
+  uint8_t tmp[64U] = { 0U };
+  bool res = Hacl_Impl_P256_DH_ecp256dh_r(tmp, pk, sk);
+  memcpy(o_dh, tmp, 32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(tmp, 64U, uint8_t, void *);
+  if (res)
+  {
+    return 0U;
+  }
+  return 1U;
+}
+
+const
+Hacl_Impl_HPKE_DHKEM_s
+Hacl_Impl_HPKE_DHKEM_p256 = { 0x10U, 64U, 65U, p256_secret_to_public, p256_dh };
+
+static void serialize_public(const Hacl_Impl_HPKE_DHKEM_s *kem, uint8_t *o_enc, uint8_t *pk)
+{
+  uint32_t off = kem->enclen - kem->pklen;
+  if (off != 0U)
+  {
+    o_enc[0U] = 4U;
+  }
+  memcpy(o_enc + off, pk, kem->pklen * sizeof (uint8_t));
+}
+
+/* Encap, or AuthEncap if skS is not NULL. */
+static uint32_t
+encap(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint8_t *o_shared,
+  uint8_t *o_enc,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS
+)
+{
+  uint8_t dh[64U] = { 0U };
+  uint8_t kem_context[3U * DHKEM_MAX_ENC] = { 0U };
+  uint32_t enclen = kem->enclen;
+  uint32_t res = kem->secret_to_public(o_enc, skE);
+  res = res | kem->dh(dh, skE, pkR);
+  memcpy(kem_context, o_enc, enclen * sizeof (uint8_t));
+  serialize_public(kem, kem_context + enclen, pkR);
+  uint32_t dhlen = 32U;
+  uint32_t kem_contextlen = 2U * enclen;
+  if (skS != NULL)
+  {
+    res = res | kem->dh(dh + 32U, skS, pkR);
+    res = res | kem->secret_to_public(kem_context + 2U * enclen, skS);
+    dhlen = 64U;
+    kem_contextlen = 3U * enclen;
+  }
+  if (res == 0U)
+  {
+    Hacl_Impl_HPKE_extract_and_expand(o_shared,
+      kem->kem_id,
+      dhlen,
+      dh,
+      kem_contextlen,
+      kem_context);
+  }
+  Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+  return res;
+}
+
+/* Decap, or AuthDecap if pkS is not NULL. */
+static uint32_t
+decap(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint8_t *o_shared,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS
+)
+{
+  uint8_t dh[64U] = { 0U };
+  uint8_t kem_context[3U * DHKEM_MAX_ENC] = { 0U };
+  uint32_t enclen = kem->enclen;
+  uint32_t res = kem->dh(dh, skR, enc + enclen - kem->pklen);
+  memcpy(kem_context, enc, enclen * sizeof (uint8_t));
+  res = res | kem->secret_to_public(kem_context + enclen, skR);
+  uint32_t dhlen = 32U;
+  uint32_t kem_contextlen = 2U * enclen;
+  if (pkS != NULL)
+  {
+    res = res | kem->dh(dh + 32U, skR, pkS);
+    serialize_public(kem, kem_context + 2U * enclen, pkS);
+    dhlen = 64U;
+    kem_contextlen = 3U * enclen;
+  }
+  if (res == 0U)
+  {
+    Hacl_Impl_HPKE_extract_and_expand(o_shared,
+      kem->kem_id,
+      dhlen,
+      dh,
+      kem_contextlen,
+      kem_context);
+  }
+  Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_Impl_HPKE_DHKEM_setup_s(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint16_t kdf_id,
+  uint8_t mode,
+  uint8_t *o_pkE,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint8_t *skS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  uint8_t shared[32U] = { 0U };
+  uint32_t res = encap(kem, shared, o_pkE, skE, pkR, skS);
+  if (res == 0U)
+  {
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        kem->kem_id,
+        kdf_id,
+        mode,
+        shared,
+        infolen,
+        info,
+        psklen,
+        psk,
+        psk_idlen,
+        psk_id);
+  }
+  Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_Impl_HPKE_DHKEM_setup_r(
+  const Hacl_Impl_HPKE_DHKEM_s *kem,
+  uint16_t kdf_id,
+  uint8_t mode,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint8_t *pkS,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  uint8_t shared[32U] = { 0U };
+  uint32_t res = decap(kem, shared, enc, skR, pkS);
+  if (res == 0U)
+  {
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        kem->kem_id,
+        kdf_id,
+        mode,
+        shared,
+        infolen,
+        info,
+        psklen,
+        psk,
+        psk_idlen,
+        psk_id);
+  }
+  Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  return res;
+}
@@ -0,0 +1,127 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_HPKE_Hybrid.h"
+
+#include "Hacl_AEAD_Chacha20Poly1305.h"
+#include "Hacl_Hash_SHA3.h"
+#include "lib_memzero0.h"
+
+/* This is a hand-written file. */
+
+void
+Hacl_Impl_HPKE_Hybrid_combine(
+  uint8_t *o_ss,
+  uint8_t *ss_M,
+  uint8_t *ss_T,
+  uint32_t tlen,
+  uint8_t *ct_T,
+  uint8_t *pk_T,
+  uint32_t labellen,
+  uint8_t *label
+)
+{
+  uint32_t len = 64U + 2U * tlen + labellen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memcpy(tmp, ss_M, 32U * sizeof (uint8_t));
+  memcpy(tmp + 32U, ss_T, 32U * sizeof (uint8_t));
+  memcpy(tmp + 64U, ct_T, tlen * sizeof (uint8_t));
+  memcpy(tmp + 64U + tlen, pk_T, tlen * sizeof (uint8_t));
+  memcpy(tmp + 64U + 2U * tlen, label, labellen * sizeof (uint8_t));
+  Hacl_Hash_SHA3_sha3_256(o_ss, tmp, len);
+  Lib_Memzero0_memzero(tmp, 64U, uint8_t, void *);
+}
+
+static void
+compute_nonce(uint8_t *o_nonce, Hacl_Impl_HPKE_context_s ctx)
+{
+  uint8_t enc[12U] = { 0U };
+  store64_be(enc + 4U, ctx.ctx_seq[0U]);
+  for (uint32_t i = 0U; i < 12U; i++)
+  {
+    o_nonce[i] = (uint32_t)enc[i] ^ (uint32_t)ctx.ctx_nonce[i];
+  }
+}
+
+uint32_t
+Hacl_Impl_HPKE_Hybrid_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  uint64_t s = ctx.ctx_seq[0U];
+  if (s == 18446744073709551615ULL)
+  {
+    return 1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  compute_nonce(nonce, ctx);
+  Hacl_AEAD_Chacha20Poly1305_encrypt(o_ct, o_ct + plainlen, plain, plainlen, aad, aadlen,
+    ctx.ctx_key,
+    nonce);
+  ctx.ctx_seq[0U] = s + 1ULL;
+  return 0U;
+}
+
+uint32_t
+Hacl_Impl_HPKE_Hybrid_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  uint64_t s = ctx.ctx_seq[0U];
+  if (ctlen < 16U || s == 18446744073709551615ULL)
+  {
+    return 1U;
+  }
+  uint8_t nonce[12U] = { 0U };
+  compute_nonce(nonce, ctx);
+  uint32_t
+  res =
+    Hacl_AEAD_Chacha20Poly1305_decrypt(o_pt,
+      ct,
+      ctlen - 16U,
+      aad,
+      aadlen,
+      ctx.ctx_key,
+      nonce,
+      ct + ctlen - 16U);
+  if (res != 0U)
+  {
+    return 1U;
+  }
+  ctx.ctx_seq[0U] = s + 1ULL;
+  return 0U;
+}
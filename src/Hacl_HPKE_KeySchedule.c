@@ -0,0 +1,316 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "internal/Hacl_HPKE_KeySchedule.h"
+
+#include "Hacl_HKDF.h"
+#include "lib_memzero0.h"
+
+/* This is a hand-written file. */
+
+static const uint8_t label_version[7U] = { 0x48U, 0x50U, 0x4bU, 0x45U, 0x2dU, 0x76U, 0x31U };
+
+static uint32_t
+hash_len(uint16_t kdf_id)
+{
+  if (kdf_id == 3U)
+  {
+    return 64U;
+  }
+  return 32U;
+}
+
+static void
+hkdf_extract(
+  uint16_t kdf_id,
+  uint8_t *prk,
+  uint8_t *salt,
+  uint32_t saltlen,
+  uint8_t *ikm,
+  uint32_t ikmlen
+)
+{
+  if (kdf_id == 3U)
+  {
+    Hacl_HKDF_extract_sha2_512(prk, salt, saltlen, ikm, ikmlen);
+  }
+  else
+  {
+    Hacl_HKDF_extract_sha2_256(prk, salt, saltlen, ikm, ikmlen);
+  }
+}
+
+static void
+hkdf_expand(
+  uint16_t kdf_id,
+  uint8_t *okm,
+  uint8_t *prk,
+  uint32_t prklen,
+  uint8_t *info,
+  uint32_t infolen,
+  uint32_t len
+)
+{
+  if (kdf_id == 3U)
+  {
+    Hacl_HKDF_expand_sha2_512(okm, prk, prklen, info, infolen, len);
+  }
+  else
+  {
+    Hacl_HKDF_expand_sha2_256(okm, prk, prklen, info, infolen, len);
+  }
+}
+
+/* suite_id is "KEM" || kem_id (5 bytes) or "HPKE" || kem_id || kdf_id ||
+   aead_id (10 bytes). */
+static void
+labeled_extract(
+  uint16_t kdf_id,
+  uint8_t *o_prk,
+  uint32_t suite_idlen,
+  uint8_t *suite_id,
+  uint32_t saltlen,
+  uint8_t *salt,
+  uint32_t labellen,
+  const uint8_t *label,
+  uint32_t ikmlen,
+  uint8_t *ikm
+)
+{
+  uint32_t len = 7U + suite_idlen + labellen + ikmlen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  memcpy(tmp, label_version, 7U * sizeof (uint8_t));
+  memcpy(tmp + 7U, suite_id, suite_idlen * sizeof (uint8_t));
+  memcpy(tmp + 7U + suite_idlen, label, labellen * sizeof (uint8_t));
+  if (ikmlen > 0U)
+  {
+    memcpy(tmp + 7U + suite_idlen + labellen, ikm, ikmlen * sizeof (uint8_t));
+  }
+  if (saltlen == 0U)
+  {
+    salt = tmp;
+  }
+  hkdf_extract(kdf_id, o_prk, salt, saltlen, tmp, len);
+  Lib_Memzero0_memzero(tmp, len, uint8_t, void *);
+}
+
+static void
+labeled_expand(
+  uint16_t kdf_id,
+  uint8_t *o_okm,
+  uint32_t l,
+  uint32_t suite_idlen,
+  uint8_t *suite_id,
+  uint8_t *prk,
+  uint32_t labellen,
+  const uint8_t *label,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint32_t len = 9U + suite_idlen + labellen + infolen;
+  KRML_CHECK_SIZE(sizeof (uint8_t), len);
+  uint8_t tmp[len];
+  store16_be(tmp, (uint16_t)l);
+  memcpy(tmp + 2U, label_version, 7U * sizeof (uint8_t));
+  memcpy(tmp + 9U, suite_id, suite_idlen * sizeof (uint8_t));
+  memcpy(tmp + 9U + suite_idlen, label, labellen * sizeof (uint8_t));
+  if (infolen > 0U)
+  {
+    memcpy(tmp + 9U + suite_idlen + labellen, info, infolen * sizeof (uint8_t));
+  }
+  hkdf_expand(kdf_id, o_okm, prk, hash_len(kdf_id), tmp, len, l);
+}
+
+static void
+suite_id_of(uint8_t *suite_id, uint16_t kem_id, uint16_t kdf_id)
+{
+  suite_id[0U] = 0x48U;
+  suite_id[1U] = 0x50U;
+  suite_id[2U] = 0x4bU;
+  suite_id[3U] = 0x45U;
+  store16_be(suite_id + 4U, kem_id);
+  store16_be(suite_id + 6U, kdf_id);
+  store16_be(suite_id + 8U, (uint16_t)3U);
+}
+
+void
+Hacl_Impl_HPKE_extract_and_expand(
+  uint8_t *o_shared,
+  uint16_t kem_id,
+  uint32_t dhlen,
+  uint8_t *dh,
+  uint32_t kem_contextlen,
+  uint8_t *kem_context
+)
+{
+  static const uint8_t label_eae_prk[7U] = { 0x65U, 0x61U, 0x65U, 0x5fU, 0x70U, 0x72U, 0x6bU };
+  static const uint8_t
+  label_shared_secret[13U] =
+    { 0x73U, 0x68U, 0x61U, 0x72U, 0x65U, 0x64U, 0x5fU, 0x73U, 0x65U, 0x63U, 0x72U, 0x65U, 0x74U };
+  uint8_t suite_id_kem[5U] = { 0x4bU, 0x45U, 0x4dU, 0U, 0U };
+  store16_be(suite_id_kem + 3U, kem_id);
+  uint8_t eae_prk[32U] = { 0U };
+  labeled_extract(1U, eae_prk, 5U, suite_id_kem, 0U, NULL, 7U, label_eae_prk, dhlen, dh);
+  labeled_expand(1U,
+    o_shared,
+    32U,
+    5U,
+    suite_id_kem,
+    eae_prk,
+    13U,
+    label_shared_secret,
+    kem_contextlen,
+    kem_context);
+  Lib_Memzero0_memzero(eae_prk, 32U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_Impl_HPKE_key_schedule(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint16_t kem_id,
+  uint16_t kdf_id,
+  uint8_t mode,
+  uint8_t *shared,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t psklen,
+  uint8_t *psk,
+  uint32_t psk_idlen,
+  uint8_t *psk_id
+)
+{
+  static const uint8_t
+  label_psk_id_hash[11U] =
+    { 0x70U, 0x73U, 0x6bU, 0x5fU, 0x69U, 0x64U, 0x5fU, 0x68U, 0x61U, 0x73U, 0x68U };
+  static const uint8_t
+  label_info_hash[9U] = { 0x69U, 0x6eU, 0x66U, 0x6fU, 0x5fU, 0x68U, 0x61U, 0x73U, 0x68U };
+  static const uint8_t label_secret[6U] = { 0x73U, 0x65U, 0x63U, 0x72U, 0x65U, 0x74U };
+  static const uint8_t label_exp[3U] = { 0x65U, 0x78U, 0x70U };
+  static const uint8_t label_key[3U] = { 0x6bU, 0x65U, 0x79U };
+  static const uint8_t
+  label_base_nonce[10U] = { 0x62U, 0x61U, 0x73U, 0x65U, 0x5fU, 0x6eU, 0x6fU, 0x6eU, 0x63U, 0x65U };
+  /* VerifyPSKInputs */
+  bool has_psk = mode == Hacl_Impl_HPKE_mode_psk || mode == Hacl_Impl_HPKE_mode_auth_psk;
+  if (has_psk != (psklen > 0U) || has_psk != (psk_idlen > 0U))
+  {
+    return 1U;
+  }
+  uint32_t nh = hash_len(kdf_id);
+  uint8_t suite_id[10U] = { 0U };
+  suite_id_of(suite_id, kem_id, kdf_id);
+  /* key_schedule_context = mode || psk_id_hash || info_hash */
+  uint8_t o_context[129U] = { 0U };
+  uint32_t contextlen = 1U + 2U * nh;
+  o_context[0U] = mode;
+  labeled_extract(kdf_id,
+    o_context + 1U,
+    10U,
+    suite_id,
+    0U,
+    NULL,
+    11U,
+    label_psk_id_hash,
+    psk_idlen,
+    psk_id);
+  labeled_extract(kdf_id,
+    o_context + 1U + nh,
+    10U,
+    suite_id,
+    0U,
+    NULL,
+    9U,
+    label_info_hash,
+    infolen,
+    info);
+  uint8_t o_secret[64U] = { 0U };
+  labeled_extract(kdf_id, o_secret, 10U, suite_id, 32U, shared, 6U, label_secret, psklen, psk);
+  labeled_expand(kdf_id,
+    o_ctx.ctx_key,
+    32U,
+    10U,
+    suite_id,
+    o_secret,
+    3U,
+    label_key,
+    contextlen,
+    o_context);
+  labeled_expand(kdf_id,
+    o_ctx.ctx_nonce,
+    12U,
+    10U,
+    suite_id,
+    o_secret,
+    10U,
+    label_base_nonce,
+    contextlen,
+    o_context);
+  labeled_expand(kdf_id,
+    o_ctx.ctx_exporter,
+    nh,
+    10U,
+    suite_id,
+    o_secret,
+    3U,
+    label_exp,
+    contextlen,
+    o_context);
+  o_ctx.ctx_seq[0U] = 0ULL;
+  Lib_Memzero0_memzero(o_secret, 64U, uint8_t, void *);
+  return 0U;
+}
+
+uint32_t
+Hacl_Impl_HPKE_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint16_t kem_id,
+  uint16_t kdf_id,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  static const uint8_t label_sec[3U] = { 0x73U, 0x65U, 0x63U };
+  if (l > 255U * hash_len(kdf_id))
+  {
+    return 1U;
+  }
+  uint8_t suite_id[10U] = { 0U };
+  suite_id_of(suite_id, kem_id, kdf_id);
+  labeled_expand(kdf_id,
+    o_secret,
+    l,
+    10U,
+    suite_id,
+    ctx.ctx_exporter,
+    3U,
+    label_sec,
+    exp_ctxlen,
+    exp_ctx);
+  return 0U;
+}
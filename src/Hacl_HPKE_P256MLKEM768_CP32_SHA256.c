@@ -0,0 +1,268 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_HPKE_P256MLKEM768_CP32_SHA256.h"
+
+#include "internal/Hacl_HPKE_Hybrid.h"
+#include "internal/Hacl_HPKE_KeySchedule.h"
+#include "internal/Hacl_P256.h"
+#include "Hacl_Hash_SHA3.h"
+#include "Hacl_MLKEM768.h"
+#include "lib_memzero0.h"
+
+/* This is a hand-written file. */
+
+static uint8_t
+p256_label[12U] =
+  { 0x50U, 0x32U, 0x35U, 0x36U, 0x4dU, 0x4cU, 0x4bU, 0x45U, 0x4dU, 0x37U, 0x36U, 0x38U };
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_keypair(uint8_t *o_pk, uint8_t *o_sk, uint8_t *seed)
+{
+  uint8_t expanded[96U] = { 0U };
+  Hacl_Hash_SHA3_shake256(expanded, 96U, seed, 32U);
+  uint8_t *pk_P = o_pk + 1184U;
+  bool ok = Hacl_Impl_P256_DH_ecp256dh_i(pk_P + 1U, expanded + 64U);
+  uint32_t res = 1U;
+  if (ok)
+  {
+    pk_P[0U] = 4U;
+    Hacl_MLKEM768_crypto_kem_keypair_derand(o_pk, o_sk, expanded);
+    memcpy(o_sk + 2400U, expanded + 64U, 32U * sizeof (uint8_t));
+    memcpy(o_sk + 2432U, pk_P, 65U * sizeof (uint8_t));
+    res = 0U;
+  }
+  Lib_Memzero0_memzero(expanded, 96U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS(
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t *pk_P = pkR + 1184U;
+  uint8_t *ct_P = o_enc + 1088U;
+  uint8_t ss_M[32U] = { 0U };
+  uint8_t dh[64U] = { 0U };
+  if (pk_P[0U] != 4U)
+  {
+    return 1U;
+  }
+  bool ok_i = Hacl_Impl_P256_DH_ecp256dh_i(ct_P + 1U, skE + 32U);
+  bool ok_r = Hacl_Impl_P256_DH_ecp256dh_r(dh, pk_P + 1U, skE + 32U);
+  if (!(ok_i && ok_r))
+  {
+    Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+    return 1U;
+  }
+  ct_P[0U] = 4U;
+  uint32_t res = Hacl_MLKEM768_crypto_kem_enc_derand(o_enc, ss_M, pkR, skE);
+  if (res == 0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    Hacl_Impl_HPKE_Hybrid_combine(shared, ss_M, dh, 65U, ct_P, pk_P, 12U, p256_label);
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        (uint16_t)0x0050U,
+        1U,
+        Hacl_Impl_HPKE_mode_base,
+        shared,
+        infolen,
+        info,
+        0U,
+        NULL,
+        0U,
+        NULL);
+    Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  }
+  Lib_Memzero0_memzero(ss_M, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t *ct_P = enc + 1088U;
+  uint8_t *sk_P = skR + 2400U;
+  uint8_t *pk_P = skR + 2432U;
+  uint8_t ss_M[32U] = { 0U };
+  uint8_t dh[64U] = { 0U };
+  if (ct_P[0U] != 4U)
+  {
+    return 1U;
+  }
+  if (!Hacl_Impl_P256_DH_ecp256dh_r(dh, ct_P + 1U, sk_P))
+  {
+    Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+    return 1U;
+  }
+  uint32_t res = Hacl_MLKEM768_crypto_kem_dec(ss_M, enc, skR);
+  if (res == 0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    Hacl_Impl_HPKE_Hybrid_combine(shared, ss_M, dh, 65U, ct_P, pk_P, 12U, p256_label);
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        (uint16_t)0x0050U,
+        1U,
+        Hacl_Impl_HPKE_mode_base,
+        shared,
+        infolen,
+        info,
+        0U,
+        NULL,
+        0U,
+        NULL);
+    Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  }
+  Lib_Memzero0_memzero(ss_M, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(dh, 64U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  return Hacl_Impl_HPKE_Hybrid_seal(ctx, aadlen, aad, plainlen, plain, o_ct);
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  return Hacl_Impl_HPKE_Hybrid_open(ctx, aadlen, aad, ctlen, ct, o_pt);
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  return Hacl_Impl_HPKE_export(ctx, (uint16_t)0x0050U, 1U, exp_ctxlen, exp_ctx, l, o_secret);
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_sealBase(
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_enc,
+  uint8_t *o_ct
+)
+{
+  uint8_t ctx_key[32U] = { 0U };
+  uint8_t ctx_nonce[12U] = { 0U };
+  uint64_t ctx_seq = 0ULL;
+  uint8_t ctx_exporter[32U] = { 0U };
+  Hacl_Impl_HPKE_context_s
+  o_ctx =
+    {
+      .ctx_key = ctx_key,
+      .ctx_nonce = ctx_nonce,
+      .ctx_seq = &ctx_seq,
+      .ctx_exporter = ctx_exporter
+    };
+  uint32_t
+  res = Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS(o_enc, o_ctx, skE, pkR, infolen, info);
+  if (res == 0U)
+  {
+    res =
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_seal(o_ctx, aadlen, aad, plainlen, plain, o_ct);
+  }
+  Lib_Memzero0_memzero(ctx_key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ctx_exporter, 32U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_P256MLKEM768_CP32_SHA256_openBase(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  uint8_t ctx_key[32U] = { 0U };
+  uint8_t ctx_nonce[12U] = { 0U };
+  uint64_t ctx_seq = 0ULL;
+  uint8_t ctx_exporter[32U] = { 0U };
+  Hacl_Impl_HPKE_context_s
+  o_ctx =
+    {
+      .ctx_key = ctx_key,
+      .ctx_nonce = ctx_nonce,
+      .ctx_seq = &ctx_seq,
+      .ctx_exporter = ctx_exporter
+    };
+  uint32_t res = Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseR(o_ctx, pkE, skR, infolen, info);
+  if (res == 0U)
+  {
+    res = Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_open(o_ctx, aadlen, aad, ctlen, ct, o_pt);
+  }
+  Lib_Memzero0_memzero(ctx_key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ctx_exporter, 32U, uint8_t, void *);
+  return res;
+}
@@ -0,0 +1,243 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_HPKE_X25519MLKEM768_CP32_SHA256.h"
+
+#include "internal/Hacl_HPKE_Hybrid.h"
+#include "internal/Hacl_HPKE_KeySchedule.h"
+#include "internal/Hacl_Krmllib.h"
+#include "EverCrypt_Curve25519.h"
+#include "Hacl_Hash_SHA3.h"
+#include "Hacl_MLKEM768.h"
+#include "lib_memzero0.h"
+
+/* This is a hand-written file. */
+
+static uint8_t xwing_label[6U] = { 0x5cU, 0x2eU, 0x2fU, 0x2fU, 0x5eU, 0x5cU };
+
+void
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_keypair(uint8_t *o_pk, uint8_t *o_sk, uint8_t *seed)
+{
+  uint8_t expanded[96U] = { 0U };
+  Hacl_Hash_SHA3_shake256(expanded, 96U, seed, 32U);
+  Hacl_MLKEM768_crypto_kem_keypair_derand(o_pk, o_sk, expanded);
+  memcpy(o_sk + 2400U, expanded + 64U, 32U * sizeof (uint8_t));
+  EverCrypt_Curve25519_secret_to_public(o_pk + 1184U, expanded + 64U);
+  memcpy(o_sk + 2432U, o_pk + 1184U, 32U * sizeof (uint8_t));
+  Lib_Memzero0_memzero(expanded, 96U, uint8_t, void *);
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS(
+  uint8_t *o_enc,
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t *pk_X = pkR + 1184U;
+  uint8_t *ct_X = o_enc + 1088U;
+  uint8_t ss_M[32U] = { 0U };
+  uint8_t ss_X[32U] = { 0U };
+  /* X-Wing does not reject an all-zero X25519 output: the combiner also hashes
+     ct_X and pk_X, and the ML-KEM secret keeps the result secret. */
+  uint32_t res = Hacl_MLKEM768_crypto_kem_enc_derand(o_enc, ss_M, pkR, skE);
+  EverCrypt_Curve25519_secret_to_public(ct_X, skE + 32U);
+  EverCrypt_Curve25519_scalarmult(ss_X, skE + 32U, pk_X);
+  if (res == 0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    Hacl_Impl_HPKE_Hybrid_combine(shared, ss_M, ss_X, 32U, ct_X, pk_X, 6U, xwing_label);
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        (uint16_t)0x647aU,
+        1U,
+        Hacl_Impl_HPKE_mode_base,
+        shared,
+        infolen,
+        info,
+        0U,
+        NULL,
+        0U,
+        NULL);
+    Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  }
+  Lib_Memzero0_memzero(ss_M, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ss_X, 32U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseR(
+  Hacl_Impl_HPKE_context_s o_ctx,
+  uint8_t *enc,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info
+)
+{
+  uint8_t *ct_X = enc + 1088U;
+  uint8_t *sk_X = skR + 2400U;
+  uint8_t *pk_X = skR + 2432U;
+  uint8_t ss_M[32U] = { 0U };
+  uint8_t ss_X[32U] = { 0U };
+  uint32_t res = Hacl_MLKEM768_crypto_kem_dec(ss_M, enc, skR);
+  EverCrypt_Curve25519_scalarmult(ss_X, sk_X, ct_X);
+  if (res == 0U)
+  {
+    uint8_t shared[32U] = { 0U };
+    Hacl_Impl_HPKE_Hybrid_combine(shared, ss_M, ss_X, 32U, ct_X, pk_X, 6U, xwing_label);
+    res =
+      Hacl_Impl_HPKE_key_schedule(o_ctx,
+        (uint16_t)0x647aU,
+        1U,
+        Hacl_Impl_HPKE_mode_base,
+        shared,
+        infolen,
+        info,
+        0U,
+        NULL,
+        0U,
+        NULL);
+    Lib_Memzero0_memzero(shared, 32U, uint8_t, void *);
+  }
+  Lib_Memzero0_memzero(ss_M, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ss_X, 32U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_seal(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_ct
+)
+{
+  return Hacl_Impl_HPKE_Hybrid_seal(ctx, aadlen, aad, plainlen, plain, o_ct);
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_open(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  return Hacl_Impl_HPKE_Hybrid_open(ctx, aadlen, aad, ctlen, ct, o_pt);
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_export(
+  Hacl_Impl_HPKE_context_s ctx,
+  uint32_t exp_ctxlen,
+  uint8_t *exp_ctx,
+  uint32_t l,
+  uint8_t *o_secret
+)
+{
+  return Hacl_Impl_HPKE_export(ctx, (uint16_t)0x647aU, 1U, exp_ctxlen, exp_ctx, l, o_secret);
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_sealBase(
+  uint8_t *skE,
+  uint8_t *pkR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t plainlen,
+  uint8_t *plain,
+  uint8_t *o_enc,
+  uint8_t *o_ct
+)
+{
+  uint8_t ctx_key[32U] = { 0U };
+  uint8_t ctx_nonce[12U] = { 0U };
+  uint64_t ctx_seq = 0ULL;
+  uint8_t ctx_exporter[32U] = { 0U };
+  Hacl_Impl_HPKE_context_s
+  o_ctx =
+    {
+      .ctx_key = ctx_key,
+      .ctx_nonce = ctx_nonce,
+      .ctx_seq = &ctx_seq,
+      .ctx_exporter = ctx_exporter
+    };
+  uint32_t
+  res = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS(o_enc, o_ctx, skE, pkR, infolen, info);
+  if (res == 0U)
+  {
+    res =
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_seal(o_ctx, aadlen, aad, plainlen, plain, o_ct);
+  }
+  Lib_Memzero0_memzero(ctx_key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ctx_exporter, 32U, uint8_t, void *);
+  return res;
+}
+
+uint32_t
+Hacl_HPKE_X25519MLKEM768_CP32_SHA256_openBase(
+  uint8_t *pkE,
+  uint8_t *skR,
+  uint32_t infolen,
+  uint8_t *info,
+  uint32_t aadlen,
+  uint8_t *aad,
+  uint32_t ctlen,
+  uint8_t *ct,
+  uint8_t *o_pt
+)
+{
+  uint8_t ctx_key[32U] = { 0U };
+  uint8_t ctx_nonce[12U] = { 0U };
+  uint64_t ctx_seq = 0ULL;
+  uint8_t ctx_exporter[32U] = { 0U };
+  Hacl_Impl_HPKE_context_s
+  o_ctx =
+    {
+      .ctx_key = ctx_key,
+      .ctx_nonce = ctx_nonce,
+      .ctx_seq = &ctx_seq,
+      .ctx_exporter = ctx_exporter
+    };
+  uint32_t res = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseR(o_ctx, pkE, skR, infolen, info);
+  if (res == 0U)
+  {
+    res = Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_open(o_ctx, aadlen, aad, ctlen, ct, o_pt);
+  }
+  Lib_Memzero0_memzero(ctx_key, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(ctx_exporter, 32U, uint8_t, void *);
+  return res;
+}
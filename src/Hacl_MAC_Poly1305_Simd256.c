@@ -2058,3 +2058,497 @@ Hacl_MAC_Poly1305_Simd256_mac(
   Hacl_MAC_Poly1305_Simd256_poly1305_finish(output, key, ctx);
 }
 
+static void
+poly1305_init4(
+  Lib_IntVector_Intrinsics_vec256 *ctx,
+  uint8_t *key0,
+  uint8_t *key1,
+  uint8_t *key2,
+  uint8_t *key3
+)
+{
+  Lib_IntVector_Intrinsics_vec256 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec256 *r = ctx + 5U;
+  Lib_IntVector_Intrinsics_vec256 *r5 = ctx + 10U;
+  acc[0U] = Lib_IntVector_Intrinsics_vec256_zero;
+  acc[1U] = Lib_IntVector_Intrinsics_vec256_zero;
+  acc[2U] = Lib_IntVector_Intrinsics_vec256_zero;
+  acc[3U] = Lib_IntVector_Intrinsics_vec256_zero;
+  acc[4U] = Lib_IntVector_Intrinsics_vec256_zero;
+  uint64_t mask0 = 0x0ffffffc0fffffffULL;
+  uint64_t mask1 = 0x0ffffffc0ffffffcULL;
+  uint64_t lo0 = load64_le(key0) & mask0;
+  uint64_t hi0 = load64_le(key0 + 8U) & mask1;
+  uint64_t lo1 = load64_le(key1) & mask0;
+  uint64_t hi1 = load64_le(key1 + 8U) & mask1;
+  uint64_t lo2 = load64_le(key2) & mask0;
+  uint64_t hi2 = load64_le(key2 + 8U) & mask1;
+  uint64_t lo3 = load64_le(key3) & mask0;
+  uint64_t hi3 = load64_le(key3 + 8U) & mask1;
+  Lib_IntVector_Intrinsics_vec256
+  f0 = Lib_IntVector_Intrinsics_vec256_load64s(lo0, lo1, lo2, lo3);
+  Lib_IntVector_Intrinsics_vec256
+  f1 = Lib_IntVector_Intrinsics_vec256_load64s(hi0, hi1, hi2, hi3);
+  Lib_IntVector_Intrinsics_vec256
+  f010 =
+    Lib_IntVector_Intrinsics_vec256_and(f0,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256
+  f110 =
+    Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f0, 26U),
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256
+  f20 =
+    Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f0, 52U),
+      Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(f1,
+          Lib_IntVector_Intrinsics_vec256_load64(0x3fffULL)),
+        12U));
+  Lib_IntVector_Intrinsics_vec256
+  f30 =
+    Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f1, 14U),
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 f40 = Lib_IntVector_Intrinsics_vec256_shift_right64(f1, 40U);
+  Lib_IntVector_Intrinsics_vec256 f01 = f010;
+  Lib_IntVector_Intrinsics_vec256 f111 = f110;
+  Lib_IntVector_Intrinsics_vec256 f2 = f20;
+  Lib_IntVector_Intrinsics_vec256 f3 = f30;
+  Lib_IntVector_Intrinsics_vec256 f41 = f40;
+  r[0U] = f01;
+  r[1U] = f111;
+  r[2U] = f2;
+  r[3U] = f3;
+  r[4U] = f41;
+  r5[0U] = Lib_IntVector_Intrinsics_vec256_smul64(r[0U], 5ULL);
+  r5[1U] = Lib_IntVector_Intrinsics_vec256_smul64(r[1U], 5ULL);
+  r5[2U] = Lib_IntVector_Intrinsics_vec256_smul64(r[2U], 5ULL);
+  r5[3U] = Lib_IntVector_Intrinsics_vec256_smul64(r[3U], 5ULL);
+  r5[4U] = Lib_IntVector_Intrinsics_vec256_smul64(r[4U], 5ULL);
+}
+
+static void
+load_blocks4(
+  Lib_IntVector_Intrinsics_vec256 *e,
+  uint8_t *b0,
+  uint8_t *b1,
+  uint8_t *b2,
+  uint8_t *b3
+)
+{
+  Lib_IntVector_Intrinsics_vec256
+  f0 =
+    Lib_IntVector_Intrinsics_vec256_load64s(load64_le(b0),
+      load64_le(b1),
+      load64_le(b2),
+      load64_le(b3));
+  Lib_IntVector_Intrinsics_vec256
+  f1 =
+    Lib_IntVector_Intrinsics_vec256_load64s(load64_le(b0 + 8U),
+      load64_le(b1 + 8U),
+      load64_le(b2 + 8U),
+      load64_le(b3 + 8U));
+  Lib_IntVector_Intrinsics_vec256
+  f010 =
+    Lib_IntVector_Intrinsics_vec256_and(f0,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256
+  f110 =
+    Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f0, 26U),
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256
+  f20 =
+    Lib_IntVector_Intrinsics_vec256_or(Lib_IntVector_Intrinsics_vec256_shift_right64(f0, 52U),
+      Lib_IntVector_Intrinsics_vec256_shift_left64(Lib_IntVector_Intrinsics_vec256_and(f1,
+          Lib_IntVector_Intrinsics_vec256_load64(0x3fffULL)),
+        12U));
+  Lib_IntVector_Intrinsics_vec256
+  f30 =
+    Lib_IntVector_Intrinsics_vec256_and(Lib_IntVector_Intrinsics_vec256_shift_right64(f1, 14U),
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 f40 = Lib_IntVector_Intrinsics_vec256_shift_right64(f1, 40U);
+  Lib_IntVector_Intrinsics_vec256 f01 = f010;
+  Lib_IntVector_Intrinsics_vec256 f111 = f110;
+  Lib_IntVector_Intrinsics_vec256 f2 = f20;
+  Lib_IntVector_Intrinsics_vec256 f3 = f30;
+  Lib_IntVector_Intrinsics_vec256 f41 = f40;
+  e[0U] = f01;
+  e[1U] = f111;
+  e[2U] = f2;
+  e[3U] = f3;
+  e[4U] = f41;
+}
+
+static void
+fadd_mul4(
+  Lib_IntVector_Intrinsics_vec256 *acc,
+  Lib_IntVector_Intrinsics_vec256 *e,
+  Lib_IntVector_Intrinsics_vec256 *pre
+)
+{
+  Lib_IntVector_Intrinsics_vec256 *r = pre;
+  Lib_IntVector_Intrinsics_vec256 *r5 = pre + 5U;
+  Lib_IntVector_Intrinsics_vec256 r0 = r[0U];
+  Lib_IntVector_Intrinsics_vec256 r1 = r[1U];
+  Lib_IntVector_Intrinsics_vec256 r2 = r[2U];
+  Lib_IntVector_Intrinsics_vec256 r3 = r[3U];
+  Lib_IntVector_Intrinsics_vec256 r4 = r[4U];
+  Lib_IntVector_Intrinsics_vec256 r51 = r5[1U];
+  Lib_IntVector_Intrinsics_vec256 r52 = r5[2U];
+  Lib_IntVector_Intrinsics_vec256 r53 = r5[3U];
+  Lib_IntVector_Intrinsics_vec256 r54 = r5[4U];
+  Lib_IntVector_Intrinsics_vec256 f10 = e[0U];
+  Lib_IntVector_Intrinsics_vec256 f11 = e[1U];
+  Lib_IntVector_Intrinsics_vec256 f12 = e[2U];
+  Lib_IntVector_Intrinsics_vec256 f13 = e[3U];
+  Lib_IntVector_Intrinsics_vec256 f14 = e[4U];
+  Lib_IntVector_Intrinsics_vec256 a0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec256 a1 = acc[1U];
+  Lib_IntVector_Intrinsics_vec256 a2 = acc[2U];
+  Lib_IntVector_Intrinsics_vec256 a3 = acc[3U];
+  Lib_IntVector_Intrinsics_vec256 a4 = acc[4U];
+  Lib_IntVector_Intrinsics_vec256 a01 = Lib_IntVector_Intrinsics_vec256_add64(a0, f10);
+  Lib_IntVector_Intrinsics_vec256 a11 = Lib_IntVector_Intrinsics_vec256_add64(a1, f11);
+  Lib_IntVector_Intrinsics_vec256 a21 = Lib_IntVector_Intrinsics_vec256_add64(a2, f12);
+  Lib_IntVector_Intrinsics_vec256 a31 = Lib_IntVector_Intrinsics_vec256_add64(a3, f13);
+  Lib_IntVector_Intrinsics_vec256 a41 = Lib_IntVector_Intrinsics_vec256_add64(a4, f14);
+  Lib_IntVector_Intrinsics_vec256 a02 = Lib_IntVector_Intrinsics_vec256_mul64(r0, a01);
+  Lib_IntVector_Intrinsics_vec256 a12 = Lib_IntVector_Intrinsics_vec256_mul64(r1, a01);
+  Lib_IntVector_Intrinsics_vec256 a22 = Lib_IntVector_Intrinsics_vec256_mul64(r2, a01);
+  Lib_IntVector_Intrinsics_vec256 a32 = Lib_IntVector_Intrinsics_vec256_mul64(r3, a01);
+  Lib_IntVector_Intrinsics_vec256 a42 = Lib_IntVector_Intrinsics_vec256_mul64(r4, a01);
+  Lib_IntVector_Intrinsics_vec256
+  a03 =
+    Lib_IntVector_Intrinsics_vec256_add64(a02,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, a11));
+  Lib_IntVector_Intrinsics_vec256
+  a13 =
+    Lib_IntVector_Intrinsics_vec256_add64(a12,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, a11));
+  Lib_IntVector_Intrinsics_vec256
+  a23 =
+    Lib_IntVector_Intrinsics_vec256_add64(a22,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, a11));
+  Lib_IntVector_Intrinsics_vec256
+  a33 =
+    Lib_IntVector_Intrinsics_vec256_add64(a32,
+      Lib_IntVector_Intrinsics_vec256_mul64(r2, a11));
+  Lib_IntVector_Intrinsics_vec256
+  a43 =
+    Lib_IntVector_Intrinsics_vec256_add64(a42,
+      Lib_IntVector_Intrinsics_vec256_mul64(r3, a11));
+  Lib_IntVector_Intrinsics_vec256
+  a04 =
+    Lib_IntVector_Intrinsics_vec256_add64(a03,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, a21));
+  Lib_IntVector_Intrinsics_vec256
+  a14 =
+    Lib_IntVector_Intrinsics_vec256_add64(a13,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, a21));
+  Lib_IntVector_Intrinsics_vec256
+  a24 =
+    Lib_IntVector_Intrinsics_vec256_add64(a23,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, a21));
+  Lib_IntVector_Intrinsics_vec256
+  a34 =
+    Lib_IntVector_Intrinsics_vec256_add64(a33,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, a21));
+  Lib_IntVector_Intrinsics_vec256
+  a44 =
+    Lib_IntVector_Intrinsics_vec256_add64(a43,
+      Lib_IntVector_Intrinsics_vec256_mul64(r2, a21));
+  Lib_IntVector_Intrinsics_vec256
+  a05 =
+    Lib_IntVector_Intrinsics_vec256_add64(a04,
+      Lib_IntVector_Intrinsics_vec256_mul64(r52, a31));
+  Lib_IntVector_Intrinsics_vec256
+  a15 =
+    Lib_IntVector_Intrinsics_vec256_add64(a14,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, a31));
+  Lib_IntVector_Intrinsics_vec256
+  a25 =
+    Lib_IntVector_Intrinsics_vec256_add64(a24,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, a31));
+  Lib_IntVector_Intrinsics_vec256
+  a35 =
+    Lib_IntVector_Intrinsics_vec256_add64(a34,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, a31));
+  Lib_IntVector_Intrinsics_vec256
+  a45 =
+    Lib_IntVector_Intrinsics_vec256_add64(a44,
+      Lib_IntVector_Intrinsics_vec256_mul64(r1, a31));
+  Lib_IntVector_Intrinsics_vec256
+  a06 =
+    Lib_IntVector_Intrinsics_vec256_add64(a05,
+      Lib_IntVector_Intrinsics_vec256_mul64(r51, a41));
+  Lib_IntVector_Intrinsics_vec256
+  a16 =
+    Lib_IntVector_Intrinsics_vec256_add64(a15,
+      Lib_IntVector_Intrinsics_vec256_mul64(r52, a41));
+  Lib_IntVector_Intrinsics_vec256
+  a26 =
+    Lib_IntVector_Intrinsics_vec256_add64(a25,
+      Lib_IntVector_Intrinsics_vec256_mul64(r53, a41));
+  Lib_IntVector_Intrinsics_vec256
+  a36 =
+    Lib_IntVector_Intrinsics_vec256_add64(a35,
+      Lib_IntVector_Intrinsics_vec256_mul64(r54, a41));
+  Lib_IntVector_Intrinsics_vec256
+  a46 =
+    Lib_IntVector_Intrinsics_vec256_add64(a45,
+      Lib_IntVector_Intrinsics_vec256_mul64(r0, a41));
+  Lib_IntVector_Intrinsics_vec256 t01 = a06;
+  Lib_IntVector_Intrinsics_vec256 t11 = a16;
+  Lib_IntVector_Intrinsics_vec256 t2 = a26;
+  Lib_IntVector_Intrinsics_vec256 t3 = a36;
+  Lib_IntVector_Intrinsics_vec256 t4 = a46;
+  Lib_IntVector_Intrinsics_vec256 mask26 = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec256 z0 = Lib_IntVector_Intrinsics_vec256_shift_right64(t01, 26U);
+  Lib_IntVector_Intrinsics_vec256 z1 = Lib_IntVector_Intrinsics_vec256_shift_right64(t3, 26U);
+  Lib_IntVector_Intrinsics_vec256 x0 = Lib_IntVector_Intrinsics_vec256_and(t01, mask26);
+  Lib_IntVector_Intrinsics_vec256 x3 = Lib_IntVector_Intrinsics_vec256_and(t3, mask26);
+  Lib_IntVector_Intrinsics_vec256 x1 = Lib_IntVector_Intrinsics_vec256_add64(t11, z0);
+  Lib_IntVector_Intrinsics_vec256 x4 = Lib_IntVector_Intrinsics_vec256_add64(t4, z1);
+  Lib_IntVector_Intrinsics_vec256 z01 = Lib_IntVector_Intrinsics_vec256_shift_right64(x1, 26U);
+  Lib_IntVector_Intrinsics_vec256 z11 = Lib_IntVector_Intrinsics_vec256_shift_right64(x4, 26U);
+  Lib_IntVector_Intrinsics_vec256 t = Lib_IntVector_Intrinsics_vec256_shift_left64(z11, 2U);
+  Lib_IntVector_Intrinsics_vec256 z12 = Lib_IntVector_Intrinsics_vec256_add64(z11, t);
+  Lib_IntVector_Intrinsics_vec256 x11 = Lib_IntVector_Intrinsics_vec256_and(x1, mask26);
+  Lib_IntVector_Intrinsics_vec256 x41 = Lib_IntVector_Intrinsics_vec256_and(x4, mask26);
+  Lib_IntVector_Intrinsics_vec256 x2 = Lib_IntVector_Intrinsics_vec256_add64(t2, z01);
+  Lib_IntVector_Intrinsics_vec256 x01 = Lib_IntVector_Intrinsics_vec256_add64(x0, z12);
+  Lib_IntVector_Intrinsics_vec256 z02 = Lib_IntVector_Intrinsics_vec256_shift_right64(x2, 26U);
+  Lib_IntVector_Intrinsics_vec256 z13 = Lib_IntVector_Intrinsics_vec256_shift_right64(x01, 26U);
+  Lib_IntVector_Intrinsics_vec256 x21 = Lib_IntVector_Intrinsics_vec256_and(x2, mask26);
+  Lib_IntVector_Intrinsics_vec256 x02 = Lib_IntVector_Intrinsics_vec256_and(x01, mask26);
+  Lib_IntVector_Intrinsics_vec256 x31 = Lib_IntVector_Intrinsics_vec256_add64(x3, z02);
+  Lib_IntVector_Intrinsics_vec256 x12 = Lib_IntVector_Intrinsics_vec256_add64(x11, z13);
+  Lib_IntVector_Intrinsics_vec256 z03 = Lib_IntVector_Intrinsics_vec256_shift_right64(x31, 26U);
+  Lib_IntVector_Intrinsics_vec256 x32 = Lib_IntVector_Intrinsics_vec256_and(x31, mask26);
+  Lib_IntVector_Intrinsics_vec256 x42 = Lib_IntVector_Intrinsics_vec256_add64(x41, z03);
+  Lib_IntVector_Intrinsics_vec256 o0 = x02;
+  Lib_IntVector_Intrinsics_vec256 o1 = x12;
+  Lib_IntVector_Intrinsics_vec256 o2 = x21;
+  Lib_IntVector_Intrinsics_vec256 o3 = x32;
+  Lib_IntVector_Intrinsics_vec256 o4 = x42;
+  acc[0U] = o0;
+  acc[1U] = o1;
+  acc[2U] = o2;
+  acc[3U] = o3;
+  acc[4U] = o4;
+}
+
+static void
+poly1305_finish4(
+  uint8_t *tag0,
+  uint8_t *tag1,
+  uint8_t *tag2,
+  uint8_t *tag3,
+  uint8_t *key0,
+  uint8_t *key1,
+  uint8_t *key2,
+  uint8_t *key3,
+  Lib_IntVector_Intrinsics_vec256 *ctx
+)
+{
+  Lib_IntVector_Intrinsics_vec256 *acc = ctx;
+  Lib_IntVector_Intrinsics_vec256 f0 = acc[0U];
+  Lib_IntVector_Intrinsics_vec256 f13 = acc[1U];
+  Lib_IntVector_Intrinsics_vec256 f23 = acc[2U];
+  Lib_IntVector_Intrinsics_vec256 f33 = acc[3U];
+  Lib_IntVector_Intrinsics_vec256 f40 = acc[4U];
+  Lib_IntVector_Intrinsics_vec256
+  l0 = Lib_IntVector_Intrinsics_vec256_add64(f0, Lib_IntVector_Intrinsics_vec256_zero);
+  Lib_IntVector_Intrinsics_vec256
+  tmp00 =
+    Lib_IntVector_Intrinsics_vec256_and(l0,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c00 = Lib_IntVector_Intrinsics_vec256_shift_right64(l0, 26U);
+  Lib_IntVector_Intrinsics_vec256 l1 = Lib_IntVector_Intrinsics_vec256_add64(f13, c00);
+  Lib_IntVector_Intrinsics_vec256
+  tmp10 =
+    Lib_IntVector_Intrinsics_vec256_and(l1,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c10 = Lib_IntVector_Intrinsics_vec256_shift_right64(l1, 26U);
+  Lib_IntVector_Intrinsics_vec256 l2 = Lib_IntVector_Intrinsics_vec256_add64(f23, c10);
+  Lib_IntVector_Intrinsics_vec256
+  tmp20 =
+    Lib_IntVector_Intrinsics_vec256_and(l2,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c20 = Lib_IntVector_Intrinsics_vec256_shift_right64(l2, 26U);
+  Lib_IntVector_Intrinsics_vec256 l3 = Lib_IntVector_Intrinsics_vec256_add64(f33, c20);
+  Lib_IntVector_Intrinsics_vec256
+  tmp30 =
+    Lib_IntVector_Intrinsics_vec256_and(l3,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c30 = Lib_IntVector_Intrinsics_vec256_shift_right64(l3, 26U);
+  Lib_IntVector_Intrinsics_vec256 l4 = Lib_IntVector_Intrinsics_vec256_add64(f40, c30);
+  Lib_IntVector_Intrinsics_vec256
+  tmp40 =
+    Lib_IntVector_Intrinsics_vec256_and(l4,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c40 = Lib_IntVector_Intrinsics_vec256_shift_right64(l4, 26U);
+  Lib_IntVector_Intrinsics_vec256
+  f010 =
+    Lib_IntVector_Intrinsics_vec256_add64(tmp00,
+      Lib_IntVector_Intrinsics_vec256_smul64(c40, 5ULL));
+  Lib_IntVector_Intrinsics_vec256 f110 = tmp10;
+  Lib_IntVector_Intrinsics_vec256 f210 = tmp20;
+  Lib_IntVector_Intrinsics_vec256 f310 = tmp30;
+  Lib_IntVector_Intrinsics_vec256 f410 = tmp40;
+  Lib_IntVector_Intrinsics_vec256
+  l = Lib_IntVector_Intrinsics_vec256_add64(f010, Lib_IntVector_Intrinsics_vec256_zero);
+  Lib_IntVector_Intrinsics_vec256
+  tmp0 =
+    Lib_IntVector_Intrinsics_vec256_and(l,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c0 = Lib_IntVector_Intrinsics_vec256_shift_right64(l, 26U);
+  Lib_IntVector_Intrinsics_vec256 l5 = Lib_IntVector_Intrinsics_vec256_add64(f110, c0);
+  Lib_IntVector_Intrinsics_vec256
+  tmp1 =
+    Lib_IntVector_Intrinsics_vec256_and(l5,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c1 = Lib_IntVector_Intrinsics_vec256_shift_right64(l5, 26U);
+  Lib_IntVector_Intrinsics_vec256 l6 = Lib_IntVector_Intrinsics_vec256_add64(f210, c1);
+  Lib_IntVector_Intrinsics_vec256
+  tmp2 =
+    Lib_IntVector_Intrinsics_vec256_and(l6,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c2 = Lib_IntVector_Intrinsics_vec256_shift_right64(l6, 26U);
+  Lib_IntVector_Intrinsics_vec256 l7 = Lib_IntVector_Intrinsics_vec256_add64(f310, c2);
+  Lib_IntVector_Intrinsics_vec256
+  tmp3 =
+    Lib_IntVector_Intrinsics_vec256_and(l7,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c3 = Lib_IntVector_Intrinsics_vec256_shift_right64(l7, 26U);
+  Lib_IntVector_Intrinsics_vec256 l8 = Lib_IntVector_Intrinsics_vec256_add64(f410, c3);
+  Lib_IntVector_Intrinsics_vec256
+  tmp4 =
+    Lib_IntVector_Intrinsics_vec256_and(l8,
+      Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL));
+  Lib_IntVector_Intrinsics_vec256 c4 = Lib_IntVector_Intrinsics_vec256_shift_right64(l8, 26U);
+  Lib_IntVector_Intrinsics_vec256
+  f02 =
+    Lib_IntVector_Intrinsics_vec256_add64(tmp0,
+      Lib_IntVector_Intrinsics_vec256_smul64(c4, 5ULL));
+  Lib_IntVector_Intrinsics_vec256 f12 = tmp1;
+  Lib_IntVector_Intrinsics_vec256 f22 = tmp2;
+  Lib_IntVector_Intrinsics_vec256 f32 = tmp3;
+  Lib_IntVector_Intrinsics_vec256 f42 = tmp4;
+  Lib_IntVector_Intrinsics_vec256 mh = Lib_IntVector_Intrinsics_vec256_load64(0x3ffffffULL);
+  Lib_IntVector_Intrinsics_vec256 ml = Lib_IntVector_Intrinsics_vec256_load64(0x3fffffbULL);
+  Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_eq64(f42, mh);
+  Lib_IntVector_Intrinsics_vec256
+  mask1 =
+    Lib_IntVector_Intrinsics_vec256_and(mask,
+      Lib_IntVector_Intrinsics_vec256_eq64(f32, mh));
+  Lib_IntVector_Intrinsics_vec256
+  mask2 =
+    Lib_IntVector_Intrinsics_vec256_and(mask1,
+      Lib_IntVector_Intrinsics_vec256_eq64(f22, mh));
+  Lib_IntVector_Intrinsics_vec256
+  mask3 =
+    Lib_IntVector_Intrinsics_vec256_and(mask2,
+      Lib_IntVector_Intrinsics_vec256_eq64(f12, mh));
+  Lib_IntVector_Intrinsics_vec256
+  mask4 =
+    Lib_IntVector_Intrinsics_vec256_and(mask3,
+      Lib_IntVector_Intrinsics_vec256_lognot(Lib_IntVector_Intrinsics_vec256_gt64(ml, f02)));
+  Lib_IntVector_Intrinsics_vec256 ph = Lib_IntVector_Intrinsics_vec256_and(mask4, mh);
+  Lib_IntVector_Intrinsics_vec256 pl = Lib_IntVector_Intrinsics_vec256_and(mask4, ml);
+  Lib_IntVector_Intrinsics_vec256 o0 = Lib_IntVector_Intrinsics_vec256_sub64(f02, pl);
+  Lib_IntVector_Intrinsics_vec256 o1 = Lib_IntVector_Intrinsics_vec256_sub64(f12, ph);
+  Lib_IntVector_Intrinsics_vec256 o2 = Lib_IntVector_Intrinsics_vec256_sub64(f22, ph);
+  Lib_IntVector_Intrinsics_vec256 o3 = Lib_IntVector_Intrinsics_vec256_sub64(f32, ph);
+  Lib_IntVector_Intrinsics_vec256 o4 = Lib_IntVector_Intrinsics_vec256_sub64(f42, ph);
+  Lib_IntVector_Intrinsics_vec256 f011 = o0;
+  Lib_IntVector_Intrinsics_vec256 f111 = o1;
+  Lib_IntVector_Intrinsics_vec256 f211 = o2;
+  Lib_IntVector_Intrinsics_vec256 f311 = o3;
+  Lib_IntVector_Intrinsics_vec256 f411 = o4;
+  acc[0U] = f011;
+  acc[1U] = f111;
+  acc[2U] = f211;
+  acc[3U] = f311;
+  acc[4U] = f411;
+  uint8_t limbs[160U] = { 0U };
+  KRML_MAYBE_FOR5(i,
+    0U,
+    5U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256_store64_le(limbs + i * 32U, acc[i]););
+  uint8_t *tags[4U] = { tag0, tag1, tag2, tag3 };
+  uint8_t *keys[4U] = { key0, key1, key2, key3 };
+  KRML_MAYBE_FOR4(i,
+    0U,
+    4U,
+    1U,
+    uint64_t f00 = load64_le(limbs + i * 8U);
+    uint64_t f10 = load64_le(limbs + 32U + i * 8U);
+    uint64_t f20 = load64_le(limbs + 64U + i * 8U);
+    uint64_t f30 = load64_le(limbs + 96U + i * 8U);
+    uint64_t f40 = load64_le(limbs + 128U + i * 8U);
+    uint64_t lo = (f00 | f10 << 26U) | f20 << 52U;
+    uint64_t hi = (f20 >> 12U | f30 << 14U) | f40 << 40U;
+    uint8_t *ks = keys[i] + 16U;
+    uint64_t s0 = load64_le(ks);
+    uint64_t s1 = load64_le(ks + 8U);
+    uint64_t r0 = lo + s0;
+    uint64_t r1 = hi + s1;
+    uint64_t c = (r0 ^ ((r0 ^ s0) | ((r0 - s0) ^ s0))) >> 63U;
+    uint64_t r11 = r1 + c;
+    store64_le(tags[i], r0);
+    store64_le(tags[i] + 8U, r11););
+}
+
+void
+Hacl_MAC_Poly1305_Simd256_mac4(
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *key0,
+  uint8_t *key1,
+  uint8_t *key2,
+  uint8_t *key3
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 ctx[15U] KRML_POST_ALIGN(32) = { 0U };
+  poly1305_init4(ctx, key0, key1, key2, key3);
+  uint32_t nb = input_len / 16U;
+  uint32_t rem = input_len % 16U;
+  for (uint32_t i = 0U; i < nb; i++)
+  {
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 e[5U] KRML_POST_ALIGN(32) = { 0U };
+    load_blocks4(e,
+      input0 + i * 16U,
+      input1 + i * 16U,
+      input2 + i * 16U,
+      input3 + i * 16U);
+    uint64_t b = 0x1000000ULL;
+    Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+    Lib_IntVector_Intrinsics_vec256 f4 = e[4U];
+    e[4U] = Lib_IntVector_Intrinsics_vec256_or(f4, mask);
+    fadd_mul4(ctx, e, ctx + 5U);
+  }
+  if (rem > 0U)
+  {
+    KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 e[5U] KRML_POST_ALIGN(32) = { 0U };
+    uint8_t tmp[64U] = { 0U };
+    memcpy(tmp, input0 + nb * 16U, rem * sizeof (uint8_t));
+    memcpy(tmp + 16U, input1 + nb * 16U, rem * sizeof (uint8_t));
+    memcpy(tmp + 32U, input2 + nb * 16U, rem * sizeof (uint8_t));
+    memcpy(tmp + 48U, input3 + nb * 16U, rem * sizeof (uint8_t));
+    load_blocks4(e, tmp, tmp + 16U, tmp + 32U, tmp + 48U);
+    uint64_t b = 1ULL << rem * 8U % 26U;
+    Lib_IntVector_Intrinsics_vec256 mask = Lib_IntVector_Intrinsics_vec256_load64(b);
+    Lib_IntVector_Intrinsics_vec256 fi = e[rem * 8U / 26U];
+    e[rem * 8U / 26U] = Lib_IntVector_Intrinsics_vec256_or(fi, mask);
+    fadd_mul4(ctx, e, ctx + 5U);
+  }
+  poly1305_finish4(output0, output1, output2, output3, key0, key1, key2, key3, ctx);
+}
+
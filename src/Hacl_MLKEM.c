@@ -0,0 +1,894 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/* This is a hand-written file. */
+
+#include "internal/Hacl_MLKEM.h"
+
+#include "lib_memzero0.h"
+#include "config.h"
+
+#if HACL_CAN_COMPILE_VEC256
+#include "internal/Hacl_MLKEM_Simd256.h"
+#endif
+
+/* Arithmetic modulo q = 3329, on signed 16-bit representatives */
+
+static int16_t montgomery_reduce(int32_t a)
+{
+  /* -3327 = q^-1 mod 2^16; returns a * 2^-16 mod q, in (-q, q) for |a| < q 2^15 */
+  int16_t t = (int16_t)((int32_t)(int16_t)a * -3327);
+  return (int16_t)((a - (int32_t)t * 3329) >> 16);
+}
+
+static int16_t barrett_reduce(int16_t a)
+{
+  /* 20159 = round(2^26 / q); returns the centered representative of a */
+  int16_t t = (int16_t)(((int32_t)20159 * (int32_t)a + (1 << 25)) >> 26);
+  return (int16_t)(a - t * 3329);
+}
+
+static int16_t fqmul(int16_t a, int16_t b)
+{
+  return montgomery_reduce((int32_t)a * (int32_t)b);
+}
+
+static uint16_t to_unsigned(int16_t a)
+{
+  return (uint16_t)(a + ((a >> 15) & 3329));
+}
+
+static void poly_reduce(int16_t *r)
+{
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    r[i] = barrett_reduce(r[i]);
+  }
+}
+
+static void poly_tomont(int16_t *r)
+{
+  /* 1353 = 2^32 mod q */
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    r[i] = montgomery_reduce((int32_t)r[i] * 1353);
+  }
+}
+
+static void poly_add(int16_t *r, int16_t *a)
+{
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    r[i] = (int16_t)(r[i] + a[i]);
+  }
+}
+
+/* Number-theoretic transform, with the output in bit-reversed order */
+
+static void ntt(int16_t *r)
+{
+  uint32_t k = 1U;
+  for (uint32_t len = 128U; len >= 2U; len = len >> 1U)
+  {
+    for (uint32_t start = 0U; start < 256U; start = start + 2U * len)
+    {
+      int16_t zeta = Hacl_Impl_MLKEM_zetas[k];
+      k++;
+      for (uint32_t j = start; j < start + len; j++)
+      {
+        int16_t t = fqmul(zeta, r[j + len]);
+        r[j + len] = (int16_t)(r[j] - t);
+        r[j] = (int16_t)(r[j] + t);
+      }
+    }
+  }
+}
+
+static void invntt(int16_t *r)
+{
+  uint32_t k = 127U;
+  for (uint32_t len = 2U; len <= 128U; len = len << 1U)
+  {
+    for (uint32_t start = 0U; start < 256U; start = start + 2U * len)
+    {
+      int16_t zeta = Hacl_Impl_MLKEM_zetas[k];
+      k--;
+      for (uint32_t j = start; j < start + len; j++)
+      {
+        int16_t t = r[j];
+        r[j] = barrett_reduce((int16_t)(t + r[j + len]));
+        r[j + len] = fqmul(zeta, (int16_t)(r[j + len] - t));
+      }
+    }
+  }
+  /* 1441 = 2^32 / 128 mod q */
+  for (uint32_t j = 0U; j < 256U; j++)
+  {
+    r[j] = fqmul(r[j], 1441);
+  }
+}
+
+static void basemul(int16_t *r, int16_t *a, int16_t *b, int16_t zeta)
+{
+  r[0U] = (int16_t)(fqmul(fqmul(a[1U], b[1U]), zeta) + fqmul(a[0U], b[0U]));
+  r[1U] = (int16_t)(fqmul(a[0U], b[1U]) + fqmul(a[1U], b[0U]));
+}
+
+static void poly_basemul(int16_t *r, int16_t *a, int16_t *b)
+{
+  for (uint32_t i = 0U; i < 64U; i++)
+  {
+    int16_t zeta = Hacl_Impl_MLKEM_zetas[64U + i];
+    basemul(r + 4U * i, a + 4U * i, b + 4U * i, zeta);
+    basemul(r + 4U * i + 2U, a + 4U * i + 2U, b + 4U * i + 2U, (int16_t)-zeta);
+  }
+}
+
+static void ntt_reduce(int16_t *r)
+{
+  ntt(r);
+  poly_reduce(r);
+}
+
+static void basemul_acc(uint32_t k, int16_t *a, int16_t *b, int16_t *r)
+{
+  int16_t t[256U] = { 0U };
+  poly_basemul(r, a, b);
+  for (uint32_t j = 1U; j < k; j++)
+  {
+    poly_basemul(t, a + 256U * j, b + 256U * j);
+    poly_add(r, t);
+  }
+  poly_reduce(r);
+}
+
+/* r = NTT(r), reduced */
+static void poly_ntt(int16_t *r)
+{
+  Hacl_Impl_MLKEM_Kernels_get()->ntt(r);
+}
+
+/* r = NTT^-1(r) * 2^16 */
+static void poly_invntt(int16_t *r)
+{
+  Hacl_Impl_MLKEM_Kernels_get()->invntt(r);
+}
+
+/* r = sum_j a_j * b_j * 2^-16, reduced, for the k polynomials a_j and b_j */
+static void poly_basemul_acc(uint32_t k, int16_t *a, int16_t *b, int16_t *r)
+{
+  Hacl_Impl_MLKEM_Kernels_get()->basemul_acc(k, a, b, r);
+}
+
+/* Serialization and compression */
+
+static void poly_encode12(uint8_t *r, int16_t *a)
+{
+  for (uint32_t i = 0U; i < 128U; i++)
+  {
+    uint16_t t0 = to_unsigned(a[2U * i]);
+    uint16_t t1 = to_unsigned(a[2U * i + 1U]);
+    r[3U * i] = (uint8_t)t0;
+    r[3U * i + 1U] = (uint8_t)((uint32_t)t0 >> 8U | (uint32_t)t1 << 4U);
+    r[3U * i + 2U] = (uint8_t)((uint32_t)t1 >> 4U);
+  }
+}
+
+/* ByteDecode_12, i.e. also reduces the coefficients modulo q */
+static void poly_decode12(int16_t *r, uint8_t *a)
+{
+  for (uint32_t i = 0U; i < 128U; i++)
+  {
+    uint32_t b0 = (uint32_t)a[3U * i];
+    uint32_t b1 = (uint32_t)a[3U * i + 1U];
+    uint32_t b2 = (uint32_t)a[3U * i + 2U];
+    int16_t t0 = (int16_t)((int32_t)((b0 | b1 << 8U) & 0xfffU) - 3329);
+    int16_t t1 = (int16_t)((int32_t)(b1 >> 4U | b2 << 4U) - 3329);
+    r[2U * i] = (int16_t)(t0 + ((t0 >> 15) & 3329));
+    r[2U * i + 1U] = (int16_t)(t1 + ((t1 >> 15) & 3329));
+  }
+}
+
+/* The modulus check of FIPS 203, section 7.2: every encoded coefficient of t is
+   below q */
+static bool check_pk(uint32_t k, uint8_t *pk)
+{
+  bool ok = true;
+  for (uint32_t i = 0U; i < 128U * k; i++)
+  {
+    uint32_t b0 = (uint32_t)pk[3U * i];
+    uint32_t b1 = (uint32_t)pk[3U * i + 1U];
+    uint32_t b2 = (uint32_t)pk[3U * i + 2U];
+    ok = ok && ((b0 | b1 << 8U) & 0xfffU) < 3329U && (b1 >> 4U | b2 << 4U) < 3329U;
+  }
+  return ok;
+}
+
+static uint32_t compress(uint32_t d, uint16_t x)
+{
+  /* round(2^d x / q) mod 2^d, with the division by q done by multiplying with
+     ceil(2^35 / q), which is exact for all (x << d) + 1664 < 2^23 */
+  uint64_t a = (uint64_t)(((uint32_t)x << d) + 1664U);
+  return (uint32_t)(a * 10321340ULL >> 35U) & ((1U << d) - 1U);
+}
+
+static void poly_compress(uint32_t d, uint8_t *r, int16_t *a)
+{
+  uint32_t acc = 0U;
+  uint32_t bits = 0U;
+  uint32_t pos = 0U;
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    acc = acc | compress(d, to_unsigned(a[i])) << bits;
+    bits = bits + d;
+    while (bits >= 8U)
+    {
+      r[pos] = (uint8_t)acc;
+      pos++;
+      acc = acc >> 8U;
+      bits = bits - 8U;
+    }
+  }
+}
+
+static void poly_decompress(uint32_t d, int16_t *r, uint8_t *a)
+{
+  uint32_t acc = 0U;
+  uint32_t bits = 0U;
+  uint32_t pos = 0U;
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    while (bits < d)
+    {
+      acc = acc | (uint32_t)a[pos] << bits;
+      pos++;
+      bits = bits + 8U;
+    }
+    uint32_t y = acc & ((1U << d) - 1U);
+    acc = acc >> d;
+    bits = bits - d;
+    r[i] = (int16_t)((y * 3329U + (1U << (d - 1U))) >> d);
+  }
+}
+
+static void poly_frommsg(int16_t *r, uint8_t *msg)
+{
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    for (uint32_t j = 0U; j < 8U; j++)
+    {
+      uint16_t mask = (uint16_t)0U - (uint16_t)((uint32_t)msg[i] >> j & 1U);
+      r[8U * i + j] = (int16_t)(mask & 1665U);
+    }
+  }
+}
+
+static void poly_tomsg(uint8_t *msg, int16_t *a)
+{
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    uint32_t m = 0U;
+    for (uint32_t j = 0U; j < 8U; j++)
+    {
+      m = m | compress(1U, to_unsigned(a[8U * i + j])) << j;
+    }
+    msg[i] = (uint8_t)m;
+  }
+}
+
+/* Sampling */
+
+static void cbd2(int16_t *r, uint8_t *buf)
+{
+  for (uint32_t i = 0U; i < 32U; i++)
+  {
+    uint32_t t = load32_le(buf + 4U * i);
+    uint32_t d = (t & 0x55555555U) + (t >> 1U & 0x55555555U);
+    for (uint32_t j = 0U; j < 8U; j++)
+    {
+      uint32_t a = d >> 4U * j & 3U;
+      uint32_t b = d >> (4U * j + 2U) & 3U;
+      r[8U * i + j] = (int16_t)((int16_t)a - (int16_t)b);
+    }
+  }
+}
+
+static void cbd3(int16_t *r, uint8_t *buf)
+{
+  for (uint32_t i = 0U; i < 64U; i++)
+  {
+    uint8_t *b3 = buf + 3U * i;
+    uint32_t t = (uint32_t)b3[0U] | (uint32_t)b3[1U] << 8U | (uint32_t)b3[2U] << 16U;
+    uint32_t d = (t & 0x249249U) + (t >> 1U & 0x249249U) + (t >> 2U & 0x249249U);
+    for (uint32_t j = 0U; j < 4U; j++)
+    {
+      uint32_t a = d >> 6U * j & 7U;
+      uint32_t b = d >> (6U * j + 3U) & 7U;
+      r[4U * i + j] = (int16_t)((int16_t)a - (int16_t)b);
+    }
+  }
+}
+
+static void cbd(uint32_t eta, int16_t *r, uint8_t *buf)
+{
+  if (eta == 2U)
+  {
+    cbd2(r, buf);
+  }
+  else
+  {
+    cbd3(r, buf);
+  }
+}
+
+static void
+sample_noise_portable(uint32_t eta, uint8_t *seed, uint32_t nonce, uint32_t cnt, int16_t *r)
+{
+  uint32_t len = 64U * eta;
+  uint8_t in[33U] = { 0U };
+  uint8_t out[192U] = { 0U };
+  memcpy(in, seed, 32U * sizeof (uint8_t));
+  for (uint32_t i = 0U; i < cnt; i++)
+  {
+    in[32U] = (uint8_t)(nonce + i);
+    Hacl_Hash_SHA3_shake256(out, len, in, 33U);
+    cbd(eta, r + 256U * i, out);
+  }
+  Lib_Memzero0_memzero(in, 33U, uint8_t, void *);
+  Lib_Memzero0_memzero(out, 192U, uint8_t, void *);
+}
+
+#if HACL_CAN_COMPILE_VEC256
+void
+Hacl_Impl_MLKEM_Vec256_sample_noise(
+  uint32_t eta,
+  uint8_t *seed,
+  uint32_t nonce,
+  uint32_t cnt,
+  int16_t *r
+)
+{
+  uint32_t len = 64U * eta;
+  uint8_t in[132U] = { 0U };
+  uint8_t out[768U] = { 0U };
+  for (uint32_t l = 0U; l < 4U; l++)
+  {
+    memcpy(in + 33U * l, seed, 32U * sizeof (uint8_t));
+  }
+  for (uint32_t i = 0U; i < cnt; i = i + 4U)
+  {
+    for (uint32_t l = 0U; l < 4U; l++)
+    {
+      in[33U * l + 32U] = (uint8_t)(nonce + i + l);
+    }
+    Hacl_Impl_MLKEM_Simd256_shake256_4x(33U,
+      in,
+      in + 33U,
+      in + 66U,
+      in + 99U,
+      len,
+      out,
+      out + len,
+      out + 2U * len,
+      out + 3U * len);
+    for (uint32_t l = 0U; l < 4U && i + l < cnt; l++)
+    {
+      cbd(eta, r + 256U * (i + l), out + l * len);
+    }
+  }
+  Lib_Memzero0_memzero(in, 132U, uint8_t, void *);
+  Lib_Memzero0_memzero(out, 768U, uint8_t, void *);
+}
+#endif
+
+/* r + 256 i = SamplePolyCBD_eta(PRF_eta(seed, nonce + i)), for i < cnt */
+static void sample_noise(uint32_t eta, uint8_t *seed, uint32_t nonce, uint32_t cnt, int16_t *r)
+{
+  Hacl_Impl_MLKEM_Kernels_get()->sample_noise(eta, seed, nonce, cnt, r);
+}
+
+uint32_t Hacl_Impl_MLKEM_rej_uniform(int16_t *r, uint32_t ctr, uint8_t *buf, uint32_t buflen)
+{
+  uint32_t pos = 0U;
+  while (ctr < 256U && pos + 3U <= buflen)
+  {
+    uint32_t b0 = (uint32_t)buf[pos];
+    uint32_t b1 = (uint32_t)buf[pos + 1U];
+    uint32_t b2 = (uint32_t)buf[pos + 2U];
+    uint32_t d1 = (b0 | b1 << 8U) & 0xfffU;
+    uint32_t d2 = b1 >> 4U | b2 << 4U;
+    pos = pos + 3U;
+    if (d1 < 3329U)
+    {
+      r[ctr] = (int16_t)d1;
+      ctr++;
+    }
+    if (ctr < 256U && d2 < 3329U)
+    {
+      r[ctr] = (int16_t)d2;
+      ctr++;
+    }
+  }
+  return ctr;
+}
+
+/* r = SampleNTT(seed), for a 34-byte seed rho || j || i */
+static void sample_ntt(uint8_t *seed, int16_t *r)
+{
+  uint64_t st[25U] = { 0U };
+  uint8_t buf[504U] = { 0U };
+  Hacl_Hash_SHA3_shake128_absorb_final(st, seed, 34U);
+  Hacl_Hash_SHA3_shake128_squeeze_nblocks(st, buf, 504U);
+  uint32_t ctr = Hacl_Impl_MLKEM_rej_uniform(r, 0U, buf, 504U);
+  while (ctr < 256U)
+  {
+    Hacl_Hash_SHA3_shake128_squeeze_nblocks(st, buf, 168U);
+    ctr = Hacl_Impl_MLKEM_rej_uniform(r, ctr, buf, 168U);
+  }
+}
+
+static void sample_polys_portable(uint32_t cnt, uint8_t *seeds, int16_t *r)
+{
+  for (uint32_t i = 0U; i < cnt; i++)
+  {
+    sample_ntt(seeds + 34U * i, r + 256U * i);
+  }
+}
+
+#if HACL_CAN_COMPILE_VEC256
+void Hacl_Impl_MLKEM_Vec256_sample_polys(uint32_t cnt, uint8_t *seeds, int16_t *r)
+{
+  uint32_t i = 0U;
+  for (; i + 4U <= cnt; i = i + 4U)
+  {
+    Hacl_Impl_MLKEM_Simd256_sample_ntt_4x(seeds + 34U * i,
+      r + 256U * i,
+      r + 256U * (i + 1U),
+      r + 256U * (i + 2U),
+      r + 256U * (i + 3U));
+  }
+  if (i + 1U < cnt)
+  {
+    /* Two or three polynomials left: still cheaper on four lanes */
+    uint8_t s[136U] = { 0U };
+    int16_t t[1024U] = { 0U };
+    memcpy(s, seeds + 34U * i, 34U * (cnt - i) * sizeof (uint8_t));
+    Hacl_Impl_MLKEM_Simd256_sample_ntt_4x(s, t, t + 256U, t + 512U, t + 768U);
+    memcpy(r + 256U * i, t, 256U * (cnt - i) * sizeof (int16_t));
+    i = cnt;
+  }
+  sample_polys_portable(cnt - i, seeds + 34U * i, r + 256U * i);
+}
+#endif
+
+/* r + 256 i = SampleNTT(seeds + 34 i), for i < cnt. The matrices of all the
+   operations of a batch go through here together, so that the AVX2 SHAKE128
+   lanes are kept busy. */
+static void sample_polys(uint32_t cnt, uint8_t *seeds, int16_t *r)
+{
+  Hacl_Impl_MLKEM_Kernels_get()->sample_polys(cnt, seeds, r);
+}
+
+/* The seeds of the matrix A of rank k, or of its transpose, for m public seeds rho
+   spaced by stride bytes */
+static void
+matrix_seeds(uint32_t k, bool transposed, uint32_t m, uint8_t *rho, uint32_t stride, uint8_t *seeds)
+{
+  for (uint32_t o = 0U; o < m; o++)
+  {
+    for (uint32_t i = 0U; i < k; i++)
+    {
+      for (uint32_t j = 0U; j < k; j++)
+      {
+        uint8_t *s = seeds + 34U * ((o * k + i) * k + j);
+        memcpy(s, rho + o * stride, 32U * sizeof (uint8_t));
+        if (transposed)
+        {
+          s[32U] = (uint8_t)i;
+          s[33U] = (uint8_t)j;
+        }
+        else
+        {
+          s[32U] = (uint8_t)j;
+          s[33U] = (uint8_t)i;
+        }
+      }
+    }
+  }
+}
+
+/* K-PKE */
+
+/* K-PKE.Encrypt with the transposed matrix at, the decoded public vector t, the
+   message msg and the coins r */
+static void
+indcpa_enc(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  int16_t *at,
+  int16_t *t,
+  uint8_t *msg,
+  uint8_t *r,
+  uint8_t *ct
+)
+{
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k);
+  int16_t y[256U * k];
+  memset(y, 0U, 256U * k * sizeof (int16_t));
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * (k + 1U));
+  int16_t e[256U * (k + 1U)];
+  memset(e, 0U, 256U * (k + 1U) * sizeof (int16_t));
+  int16_t u[256U] = { 0U };
+  int16_t m[256U] = { 0U };
+  sample_noise(eta1, r, 0U, k, y);
+  sample_noise(2U, r, k, k + 1U, e);
+  for (uint32_t i = 0U; i < k; i++)
+  {
+    poly_ntt(y + 256U * i);
+  }
+  for (uint32_t i = 0U; i < k; i++)
+  {
+    poly_basemul_acc(k, at + 256U * k * i, y, u);
+    poly_invntt(u);
+    poly_add(u, e + 256U * i);
+    poly_reduce(u);
+    poly_compress(du, ct + 32U * du * i, u);
+  }
+  poly_basemul_acc(k, t, y, u);
+  poly_invntt(u);
+  poly_add(u, e + 256U * k);
+  poly_frommsg(m, msg);
+  poly_add(u, m);
+  poly_reduce(u);
+  poly_compress(dv, ct + 32U * du * k, u);
+  Lib_Memzero0_memzero(y, 256U * k, int16_t, void *);
+  Lib_Memzero0_memzero(e, 256U * (k + 1U), int16_t, void *);
+  Lib_Memzero0_memzero(m, 256U, int16_t, void *);
+}
+
+static void
+indcpa_dec(uint32_t k, uint32_t du, uint32_t dv, uint8_t *sk, uint8_t *ct, uint8_t *msg)
+{
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k);
+  int16_t u[256U * k];
+  memset(u, 0U, 256U * k * sizeof (int16_t));
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k);
+  int16_t s[256U * k];
+  memset(s, 0U, 256U * k * sizeof (int16_t));
+  int16_t v[256U] = { 0U };
+  int16_t w[256U] = { 0U };
+  for (uint32_t i = 0U; i < k; i++)
+  {
+    poly_decompress(du, u + 256U * i, ct + 32U * du * i);
+    poly_ntt(u + 256U * i);
+    poly_decode12(s + 256U * i, sk + 384U * i);
+  }
+  poly_basemul_acc(k, s, u, w);
+  poly_invntt(w);
+  poly_decompress(dv, v, ct + 32U * du * k);
+  for (uint32_t i = 0U; i < 256U; i++)
+  {
+    w[i] = (int16_t)(v[i] - w[i]);
+  }
+  poly_reduce(w);
+  poly_tomsg(msg, w);
+  Lib_Memzero0_memzero(s, 256U * k, int16_t, void *);
+  Lib_Memzero0_memzero(w, 256U, int16_t, void *);
+}
+
+/* ML-KEM, on chunks of at most four operations */
+
+static void
+keypair_chunk(uint32_t k, uint32_t eta1, uint32_t m, uint8_t *coins, uint8_t *pk, uint8_t *sk)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t sklen = 768U * k + 96U;
+  uint8_t rho_sigma[256U] = { 0U };
+  uint8_t g_in[33U] = { 0U };
+  for (uint32_t o = 0U; o < m; o++)
+  {
+    memcpy(g_in, coins + 64U * o, 32U * sizeof (uint8_t));
+    g_in[32U] = (uint8_t)k;
+    Hacl_Hash_SHA3_sha3_512(rho_sigma + 64U * o, g_in, 33U);
+  }
+  KRML_CHECK_SIZE(sizeof (uint8_t), 34U * k * k * m);
+  uint8_t seeds[34U * k * k * m];
+  memset(seeds, 0U, 34U * k * k * m * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k * k * m);
+  int16_t a[256U * k * k * m];
+  memset(a, 0U, 256U * k * k * m * sizeof (int16_t));
+  matrix_seeds(k, false, m, rho_sigma, 64U, seeds);
+  sample_polys(k * k * m, seeds, a);
+  KRML_CHECK_SIZE(sizeof (int16_t), 512U * k);
+  int16_t se[512U * k];
+  memset(se, 0U, 512U * k * sizeof (int16_t));
+  int16_t t[256U] = { 0U };
+  for (uint32_t o = 0U; o < m; o++)
+  {
+    uint8_t *rho = rho_sigma + 64U * o;
+    uint8_t *pk1 = pk + pklen * o;
+    uint8_t *sk1 = sk + sklen * o;
+    /* s = se[0 .. k), e = se[k .. 2k) */
+    sample_noise(eta1, rho + 32U, 0U, 2U * k, se);
+    for (uint32_t i = 0U; i < 2U * k; i++)
+    {
+      poly_ntt(se + 256U * i);
+    }
+    for (uint32_t i = 0U; i < k; i++)
+    {
+      poly_basemul_acc(k, a + 256U * k * (k * o + i), se, t);
+      poly_tomont(t);
+      poly_add(t, se + 256U * (k + i));
+      poly_reduce(t);
+      poly_encode12(pk1 + 384U * i, t);
+      poly_encode12(sk1 + 384U * i, se + 256U * i);
+    }
+    memcpy(pk1 + 384U * k, rho, 32U * sizeof (uint8_t));
+    memcpy(sk1 + 384U * k, pk1, pklen * sizeof (uint8_t));
+    Hacl_Hash_SHA3_sha3_256(sk1 + 384U * k + pklen, pk1, pklen);
+    memcpy(sk1 + 384U * k + pklen + 32U, coins + 64U * o + 32U, 32U * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(rho_sigma, 256U, uint8_t, void *);
+  Lib_Memzero0_memzero(g_in, 33U, uint8_t, void *);
+  Lib_Memzero0_memzero(se, 512U * k, int16_t, void *);
+}
+
+static void
+encaps_chunk(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t m,
+  uint8_t *coins,
+  uint8_t *pk,
+  uint8_t *ct,
+  uint8_t *ss
+)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t ctlen = 32U * (du * k + dv);
+  KRML_CHECK_SIZE(sizeof (uint8_t), 34U * k * k * m);
+  uint8_t seeds[34U * k * k * m];
+  memset(seeds, 0U, 34U * k * k * m * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k * k * m);
+  int16_t at[256U * k * k * m];
+  memset(at, 0U, 256U * k * k * m * sizeof (int16_t));
+  matrix_seeds(k, true, m, pk + 384U * k, pklen, seeds);
+  sample_polys(k * k * m, seeds, at);
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k);
+  int16_t t[256U * k];
+  memset(t, 0U, 256U * k * sizeof (int16_t));
+  uint8_t g_in[64U] = { 0U };
+  uint8_t kr[64U] = { 0U };
+  for (uint32_t o = 0U; o < m; o++)
+  {
+    uint8_t *pk1 = pk + pklen * o;
+    for (uint32_t i = 0U; i < k; i++)
+    {
+      poly_decode12(t + 256U * i, pk1 + 384U * i);
+    }
+    memcpy(g_in, coins + 32U * o, 32U * sizeof (uint8_t));
+    Hacl_Hash_SHA3_sha3_256(g_in + 32U, pk1, pklen);
+    Hacl_Hash_SHA3_sha3_512(kr, g_in, 64U);
+    indcpa_enc(k, eta1, du, dv, at + 256U * k * k * o, t, g_in, kr + 32U, ct + ctlen * o);
+    memcpy(ss + 32U * o, kr, 32U * sizeof (uint8_t));
+  }
+  Lib_Memzero0_memzero(g_in, 64U, uint8_t, void *);
+  Lib_Memzero0_memzero(kr, 64U, uint8_t, void *);
+}
+
+static void
+decaps_chunk(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t m,
+  uint8_t *sk,
+  uint8_t *ct,
+  uint8_t *ss
+)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t sklen = 768U * k + 96U;
+  uint32_t ctlen = 32U * (du * k + dv);
+  KRML_CHECK_SIZE(sizeof (uint8_t), 34U * k * k * m);
+  uint8_t seeds[34U * k * k * m];
+  memset(seeds, 0U, 34U * k * k * m * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k * k * m);
+  int16_t at[256U * k * k * m];
+  memset(at, 0U, 256U * k * k * m * sizeof (int16_t));
+  matrix_seeds(k, true, m, sk + 768U * k, sklen, seeds);
+  sample_polys(k * k * m, seeds, at);
+  KRML_CHECK_SIZE(sizeof (int16_t), 256U * k);
+  int16_t t[256U * k];
+  memset(t, 0U, 256U * k * sizeof (int16_t));
+  KRML_CHECK_SIZE(sizeof (uint8_t), ctlen + 32U);
+  uint8_t j_in[ctlen + 32U];
+  memset(j_in, 0U, (ctlen + 32U) * sizeof (uint8_t));
+  KRML_CHECK_SIZE(sizeof (uint8_t), ctlen);
+  uint8_t ct1[ctlen];
+  memset(ct1, 0U, ctlen * sizeof (uint8_t));
+  uint8_t g_in[64U] = { 0U };
+  uint8_t kr[64U] = { 0U };
+  uint8_t kbar[32U] = { 0U };
+  for (uint32_t o = 0U; o < m; o++)
+  {
+    uint8_t *sk1 = sk + sklen * o;
+    uint8_t *pk1 = sk1 + 384U * k;
+    uint8_t *h = pk1 + pklen;
+    uint8_t *z = h + 32U;
+    uint8_t *ct0 = ct + ctlen * o;
+    indcpa_dec(k, du, dv, sk1, ct0, g_in);
+    memcpy(g_in + 32U, h, 32U * sizeof (uint8_t));
+    Hacl_Hash_SHA3_sha3_512(kr, g_in, 64U);
+    memcpy(j_in, z, 32U * sizeof (uint8_t));
+    memcpy(j_in + 32U, ct0, ctlen * sizeof (uint8_t));
+    Hacl_Hash_SHA3_shake256(kbar, 32U, j_in, ctlen + 32U);
+    for (uint32_t i = 0U; i < k; i++)
+    {
+      poly_decode12(t + 256U * i, pk1 + 384U * i);
+    }
+    indcpa_enc(k, eta1, du, dv, at + 256U * k * k * o, t, g_in, kr + 32U, ct1);
+    uint8_t mask = 255U;
+    for (uint32_t i = 0U; i < ctlen; i++)
+    {
+      uint8_t uu____0 = FStar_UInt8_eq_mask(ct0[i], ct1[i]);
+      mask = (uint32_t)uu____0 & (uint32_t)mask;
+    }
+    for (uint32_t i = 0U; i < 32U; i++)
+    {
+      uint8_t *os = ss + 32U * o;
+      os[i] = (uint8_t)(((uint32_t)kr[i] & (uint32_t)mask) | ((uint32_t)kbar[i] & (uint32_t)~mask));
+    }
+  }
+  Lib_Memzero0_memzero(g_in, 64U, uint8_t, void *);
+  Lib_Memzero0_memzero(kr, 64U, uint8_t, void *);
+  Lib_Memzero0_memzero(kbar, 32U, uint8_t, void *);
+  Lib_Memzero0_memzero(j_in, 32U, uint8_t, void *);
+}
+
+void
+Hacl_Impl_MLKEM_keypair(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t n,
+  uint8_t *coins,
+  uint8_t *pk,
+  uint8_t *sk
+)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t sklen = 768U * k + 96U;
+  for (uint32_t i = 0U; i < n; i = i + 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    keypair_chunk(k, eta1, m, coins + 64U * i, pk + pklen * i, sk + sklen * i);
+  }
+}
+
+bool Hacl_Impl_MLKEM_validate_pk(uint32_t k, uint32_t n, uint8_t *pk)
+{
+  uint32_t pklen = 384U * k + 32U;
+  bool ok = true;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    ok = ok && check_pk(k, pk + pklen * i);
+  }
+  return ok;
+}
+
+bool Hacl_Impl_MLKEM_validate_sk(uint32_t k, uint32_t n, uint8_t *sk)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t sklen = 768U * k + 96U;
+  uint8_t h[32U] = { 0U };
+  bool ok = true;
+  for (uint32_t i = 0U; i < n; i++)
+  {
+    uint8_t *pk1 = sk + sklen * i + 384U * k;
+    Hacl_Hash_SHA3_sha3_256(h, pk1, pklen);
+    ok = ok && memcmp(h, pk1 + pklen, 32U) == 0;
+  }
+  return ok;
+}
+
+void
+Hacl_Impl_MLKEM_encaps(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t n,
+  uint8_t *coins,
+  uint8_t *pk,
+  uint8_t *ct,
+  uint8_t *ss
+)
+{
+  uint32_t pklen = 384U * k + 32U;
+  uint32_t ctlen = 32U * (du * k + dv);
+  for (uint32_t i = 0U; i < n; i = i + 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    encaps_chunk(k, eta1, du, dv, m, coins + 32U * i, pk + pklen * i, ct + ctlen * i, ss + 32U * i);
+  }
+}
+
+void
+Hacl_Impl_MLKEM_decaps(
+  uint32_t k,
+  uint32_t eta1,
+  uint32_t du,
+  uint32_t dv,
+  uint32_t n,
+  uint8_t *sk,
+  uint8_t *ct,
+  uint8_t *ss
+)
+{
+  uint32_t sklen = 768U * k + 96U;
+  uint32_t ctlen = 32U * (du * k + dv);
+  for (uint32_t i = 0U; i < n; i = i + 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    decaps_chunk(k, eta1, du, dv, m, sk + sklen * i, ct + ctlen * i, ss + 32U * i);
+  }
+}
+
+const
+Hacl_Impl_MLKEM_Kernels
+Hacl_Impl_MLKEM_Kernels_portable =
+  {
+    .ntt = ntt_reduce,
+    .invntt = invntt,
+    .basemul_acc = basemul_acc,
+    .sample_noise = sample_noise_portable,
+    .sample_polys = sample_polys_portable
+  };
+
+static const Hacl_Impl_MLKEM_Kernels *kernels = &Hacl_Impl_MLKEM_Kernels_portable;
+
+void Hacl_Impl_MLKEM_Kernels_set(const Hacl_Impl_MLKEM_Kernels *k)
+{
+#if defined(__GNUC__)
+  __atomic_store_n(&kernels, k, __ATOMIC_RELEASE);
+#else
+  kernels = k;
+#endif
+}
+
+const Hacl_Impl_MLKEM_Kernels *Hacl_Impl_MLKEM_Kernels_get(void)
+{
+#if defined(__GNUC__)
+  return __atomic_load_n(&kernels, __ATOMIC_ACQUIRE);
+#else
+  return kernels;
+#endif
+}
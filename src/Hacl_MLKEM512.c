@@ -0,0 +1,117 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+#include "Hacl_MLKEM512.h"
+
+#include "internal/Hacl_MLKEM.h"
+#include "Lib_RandomBuffer_System.h"
+#include "lib_memzero0.h"
+
+uint32_t Hacl_MLKEM512_crypto_bytes = 32U;
+
+uint32_t Hacl_MLKEM512_crypto_publickeybytes = 800U;
+
+uint32_t Hacl_MLKEM512_crypto_secretkeybytes = 1632U;
+
+uint32_t Hacl_MLKEM512_crypto_ciphertextbytes = 768U;
+
+uint32_t Hacl_MLKEM512_crypto_kem_keypair(uint8_t *pk, uint8_t *sk)
+{
+  return Hacl_MLKEM512_crypto_kem_keypair_batch(1U, pk, sk);
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_enc(uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  return Hacl_MLKEM512_crypto_kem_enc_batch(1U, ct, ss, pk);
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_dec(uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  return Hacl_MLKEM512_crypto_kem_dec_batch(1U, ss, ct, sk);
+}
+
+void Hacl_MLKEM512_crypto_kem_keypair_derand(uint8_t *pk, uint8_t *sk, uint8_t *coins)
+{
+  Hacl_Impl_MLKEM_keypair(2U, 3U, 1U, coins, pk, sk);
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_enc_derand(uint8_t *ct, uint8_t *ss, uint8_t *pk, uint8_t *coins)
+{
+  if (!Hacl_Impl_MLKEM_validate_pk(2U, 1U, pk))
+  {
+    return 1U;
+  }
+  Hacl_Impl_MLKEM_encaps(2U, 3U, 10U, 4U, 1U, coins, pk, ct, ss);
+  return 0U;
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_keypair_batch(uint32_t n, uint8_t *pk, uint8_t *sk)
+{
+  uint8_t coins[256U] = { 0U };
+  for (uint32_t i = 0U; i < n; i = i + 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    Lib_RandomBuffer_System_crypto_random(coins, 64U * m);
+    Hacl_Impl_MLKEM_keypair(2U, 3U, m, coins, pk + 800U * i, sk + 1632U * i);
+  }
+  Lib_Memzero0_memzero(coins, 256U, uint8_t, void *);
+  return 0U;
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_enc_batch(uint32_t n, uint8_t *ct, uint8_t *ss, uint8_t *pk)
+{
+  if (!Hacl_Impl_MLKEM_validate_pk(2U, n, pk))
+  {
+    return 1U;
+  }
+  uint8_t coins[128U] = { 0U };
+  for (uint32_t i = 0U; i < n; i = i + 4U)
+  {
+    uint32_t m = n - i < 4U ? n - i : 4U;
+    Lib_RandomBuffer_System_crypto_random(coins, 32U * m);
+    Hacl_Impl_MLKEM_encaps(2U,
+      3U,
+      10U,
+      4U,
+      m,
+      coins,
+      pk + 800U * i,
+      ct + 768U * i,
+      ss + 32U * i);
+  }
+  Lib_Memzero0_memzero(coins, 128U, uint8_t, void *);
+  return 0U;
+}
+
+uint32_t Hacl_MLKEM512_crypto_kem_dec_batch(uint32_t n, uint8_t *ss, uint8_t *ct, uint8_t *sk)
+{
+  if (!Hacl_Impl_MLKEM_validate_sk(2U, n, sk))
+  {
+    return 1U;
+  }
+  Hacl_Impl_MLKEM_decaps(2U, 3U, 10U, 4U, n, sk, ct, ss);
+  return 0U;
+}
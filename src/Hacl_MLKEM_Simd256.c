@@ -0,0 +1,406 @@
+/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+
+/* This is a hand-written file. It is compiled with AVX2 enabled, and
+ * EverCrypt_Dispatch_init only installs its kernels on CPUs with AVX2. */
+
+#include "internal/Hacl_MLKEM_Simd256.h"
+
+#include "internal/Hacl_MLKEM.h"
+#include "Hacl_Hash_SHA3_Simd256.h"
+
+#include <immintrin.h>
+
+/* The last three layers of the NTT run on the transposed polynomial, where lane b
+   of vector e holds coefficient 16 b + e. Each row of 16 factors holds, for every
+   lane b, the twiddle factor of one butterfly group of block b: one row for
+   len = 8, two for len = 4 and four for len = 2. invntt_zetas_t holds those of
+   the inverse layers, len = 2, 4 then 8. */
+static const
+int16_t
+ntt_zetas_t[112U] =
+  {
+    (int16_t)573, (int16_t)-1325, (int16_t)264, (int16_t)383, (int16_t)-829, (int16_t)1458,
+    (int16_t)-1602, (int16_t)-130, (int16_t)-681, (int16_t)1017, (int16_t)732, (int16_t)608,
+    (int16_t)-1542, (int16_t)411, (int16_t)-205, (int16_t)-1571, (int16_t)1223, (int16_t)-552,
+    (int16_t)-1293, (int16_t)-282, (int16_t)516, (int16_t)-320, (int16_t)-1618, (int16_t)126,
+    (int16_t)-853, (int16_t)-271, (int16_t)107, (int16_t)-247, (int16_t)-398, (int16_t)-1508,
+    (int16_t)448, (int16_t)677, (int16_t)652, (int16_t)1015, (int16_t)1491, (int16_t)-1544,
+    (int16_t)-8, (int16_t)-666, (int16_t)-1162, (int16_t)1469, (int16_t)-90, (int16_t)830,
+    (int16_t)-1421, (int16_t)-951, (int16_t)961, (int16_t)-725, (int16_t)-1065, (int16_t)-1275,
+    (int16_t)-1103, (int16_t)-1251, (int16_t)422, (int16_t)-291, (int16_t)-246, (int16_t)-777,
+    (int16_t)-1590, (int16_t)418, (int16_t)817, (int16_t)1322, (int16_t)-1215, (int16_t)-874,
+    (int16_t)-1185, (int16_t)-1510, (int16_t)-108, (int16_t)958, (int16_t)430, (int16_t)871,
+    (int16_t)587, (int16_t)-460, (int16_t)778, (int16_t)1483, (int16_t)644, (int16_t)329,
+    (int16_t)1097, (int16_t)-1285, (int16_t)-136, (int16_t)220, (int16_t)-1530, (int16_t)-854,
+    (int16_t)-308, (int16_t)-1460, (int16_t)555, (int16_t)1550, (int16_t)177, (int16_t)1574,
+    (int16_t)1159, (int16_t)-602, (int16_t)-872, (int16_t)-156, (int16_t)603, (int16_t)-1465,
+    (int16_t)1218, (int16_t)-1187, (int16_t)-1278, (int16_t)-870, (int16_t)996, (int16_t)1522,
+    (int16_t)843, (int16_t)105, (int16_t)-235, (int16_t)1653, (int16_t)-147, (int16_t)1119,
+    (int16_t)349, (int16_t)-75, (int16_t)610, (int16_t)384, (int16_t)-1335, (int16_t)-1659,
+    (int16_t)794, (int16_t)478, (int16_t)991, (int16_t)1628
+  };
+
+static const
+int16_t
+invntt_zetas_t[112U] =
+  {
+    (int16_t)1628, (int16_t)991, (int16_t)478, (int16_t)794, (int16_t)-1659, (int16_t)-1335,
+    (int16_t)384, (int16_t)610, (int16_t)-75, (int16_t)349, (int16_t)1119, (int16_t)-147,
+    (int16_t)1653, (int16_t)-235, (int16_t)105, (int16_t)843, (int16_t)1522, (int16_t)996,
+    (int16_t)-870, (int16_t)-1278, (int16_t)-1187, (int16_t)1218, (int16_t)-1465, (int16_t)603,
+    (int16_t)-156, (int16_t)-872, (int16_t)-602, (int16_t)1159, (int16_t)1574, (int16_t)177,
+    (int16_t)1550, (int16_t)555, (int16_t)-1460, (int16_t)-308, (int16_t)-854, (int16_t)-1530,
+    (int16_t)220, (int16_t)-136, (int16_t)-1285, (int16_t)1097, (int16_t)329, (int16_t)644,
+    (int16_t)1483, (int16_t)778, (int16_t)-460, (int16_t)587, (int16_t)871, (int16_t)430,
+    (int16_t)958, (int16_t)-108, (int16_t)-1510, (int16_t)-1185, (int16_t)-874, (int16_t)-1215,
+    (int16_t)1322, (int16_t)817, (int16_t)418, (int16_t)-1590, (int16_t)-777, (int16_t)-246,
+    (int16_t)-291, (int16_t)422, (int16_t)-1251, (int16_t)-1103, (int16_t)-1275, (int16_t)-1065,
+    (int16_t)-725, (int16_t)961, (int16_t)-951, (int16_t)-1421, (int16_t)830, (int16_t)-90,
+    (int16_t)1469, (int16_t)-1162, (int16_t)-666, (int16_t)-8, (int16_t)-1544, (int16_t)1491,
+    (int16_t)1015, (int16_t)652, (int16_t)677, (int16_t)448, (int16_t)-1508, (int16_t)-398,
+    (int16_t)-247, (int16_t)107, (int16_t)-271, (int16_t)-853, (int16_t)126, (int16_t)-1618,
+    (int16_t)-320, (int16_t)516, (int16_t)-282, (int16_t)-1293, (int16_t)-552, (int16_t)1223,
+    (int16_t)-1571, (int16_t)-205, (int16_t)411, (int16_t)-1542, (int16_t)608, (int16_t)732,
+    (int16_t)1017, (int16_t)-681, (int16_t)-130, (int16_t)-1602, (int16_t)1458, (int16_t)-829,
+    (int16_t)383, (int16_t)264, (int16_t)-1325, (int16_t)573
+  };
+
+/* The factor of a1 b1 in the odd lane of each pair of coefficients, in NTT order */
+static const
+int16_t
+basemul_zetas[256U] =
+  {
+    (int16_t)0, (int16_t)-1103, (int16_t)0, (int16_t)1103, (int16_t)0, (int16_t)430,
+    (int16_t)0, (int16_t)-430, (int16_t)0, (int16_t)555, (int16_t)0, (int16_t)-555,
+    (int16_t)0, (int16_t)843, (int16_t)0, (int16_t)-843, (int16_t)0, (int16_t)-1251,
+    (int16_t)0, (int16_t)1251, (int16_t)0, (int16_t)871, (int16_t)0, (int16_t)-871,
+    (int16_t)0, (int16_t)1550, (int16_t)0, (int16_t)-1550, (int16_t)0, (int16_t)105,
+    (int16_t)0, (int16_t)-105, (int16_t)0, (int16_t)422, (int16_t)0, (int16_t)-422,
+    (int16_t)0, (int16_t)587, (int16_t)0, (int16_t)-587, (int16_t)0, (int16_t)177,
+    (int16_t)0, (int16_t)-177, (int16_t)0, (int16_t)-235, (int16_t)0, (int16_t)235,
+    (int16_t)0, (int16_t)-291, (int16_t)0, (int16_t)291, (int16_t)0, (int16_t)-460,
+    (int16_t)0, (int16_t)460, (int16_t)0, (int16_t)1574, (int16_t)0, (int16_t)-1574,
+    (int16_t)0, (int16_t)1653, (int16_t)0, (int16_t)-1653, (int16_t)0, (int16_t)-246,
+    (int16_t)0, (int16_t)246, (int16_t)0, (int16_t)778, (int16_t)0, (int16_t)-778,
+    (int16_t)0, (int16_t)1159, (int16_t)0, (int16_t)-1159, (int16_t)0, (int16_t)-147,
+    (int16_t)0, (int16_t)147, (int16_t)0, (int16_t)-777, (int16_t)0, (int16_t)777,
+    (int16_t)0, (int16_t)1483, (int16_t)0, (int16_t)-1483, (int16_t)0, (int16_t)-602,
+    (int16_t)0, (int16_t)602, (int16_t)0, (int16_t)1119, (int16_t)0, (int16_t)-1119,
+    (int16_t)0, (int16_t)-1590, (int16_t)0, (int16_t)1590, (int16_t)0, (int16_t)644,
+    (int16_t)0, (int16_t)-644, (int16_t)0, (int16_t)-872, (int16_t)0, (int16_t)872,
+    (int16_t)0, (int16_t)349, (int16_t)0, (int16_t)-349, (int16_t)0, (int16_t)418,
+    (int16_t)0, (int16_t)-418, (int16_t)0, (int16_t)329, (int16_t)0, (int16_t)-329,
+    (int16_t)0, (int16_t)-156, (int16_t)0, (int16_t)156, (int16_t)0, (int16_t)-75,
+    (int16_t)0, (int16_t)75, (int16_t)0, (int16_t)817, (int16_t)0, (int16_t)-817,
+    (int16_t)0, (int16_t)1097, (int16_t)0, (int16_t)-1097, (int16_t)0, (int16_t)603,
+    (int16_t)0, (int16_t)-603, (int16_t)0, (int16_t)610, (int16_t)0, (int16_t)-610,
+    (int16_t)0, (int16_t)1322, (int16_t)0, (int16_t)-1322, (int16_t)0, (int16_t)-1285,
+    (int16_t)0, (int16_t)1285, (int16_t)0, (int16_t)-1465, (int16_t)0, (int16_t)1465,
+    (int16_t)0, (int16_t)384, (int16_t)0, (int16_t)-384, (int16_t)0, (int16_t)-1215,
+    (int16_t)0, (int16_t)1215, (int16_t)0, (int16_t)-136, (int16_t)0, (int16_t)136,
+    (int16_t)0, (int16_t)1218, (int16_t)0, (int16_t)-1218, (int16_t)0, (int16_t)-1335,
+    (int16_t)0, (int16_t)1335, (int16_t)0, (int16_t)-874, (int16_t)0, (int16_t)874,
+    (int16_t)0, (int16_t)220, (int16_t)0, (int16_t)-220, (int16_t)0, (int16_t)-1187,
+    (int16_t)0, (int16_t)1187, (int16_t)0, (int16_t)-1659, (int16_t)0, (int16_t)1659,
+    (int16_t)0, (int16_t)-1185, (int16_t)0, (int16_t)1185, (int16_t)0, (int16_t)-1530,
+    (int16_t)0, (int16_t)1530, (int16_t)0, (int16_t)-1278, (int16_t)0, (int16_t)1278,
+    (int16_t)0, (int16_t)794, (int16_t)0, (int16_t)-794, (int16_t)0, (int16_t)-1510,
+    (int16_t)0, (int16_t)1510, (int16_t)0, (int16_t)-854, (int16_t)0, (int16_t)854,
+    (int16_t)0, (int16_t)-870, (int16_t)0, (int16_t)870, (int16_t)0, (int16_t)478,
+    (int16_t)0, (int16_t)-478, (int16_t)0, (int16_t)-108, (int16_t)0, (int16_t)108,
+    (int16_t)0, (int16_t)-308, (int16_t)0, (int16_t)308, (int16_t)0, (int16_t)996,
+    (int16_t)0, (int16_t)-996, (int16_t)0, (int16_t)991, (int16_t)0, (int16_t)-991,
+    (int16_t)0, (int16_t)958, (int16_t)0, (int16_t)-958, (int16_t)0, (int16_t)-1460,
+    (int16_t)0, (int16_t)1460, (int16_t)0, (int16_t)1522, (int16_t)0, (int16_t)-1522,
+    (int16_t)0, (int16_t)1628, (int16_t)0, (int16_t)-1628
+  };
+
+/* The vector versions of montgomery_reduce, barrett_reduce and fqmul in
+   Hacl_MLKEM.c, lane by lane. bqinv is b * q^-1 mod 2^16. */
+
+static inline __m256i fqmul(__m256i a, __m256i b, __m256i bqinv)
+{
+  __m256i t = _mm256_mullo_epi16(a, bqinv);
+  __m256i hi = _mm256_mulhi_epi16(a, b);
+  return _mm256_sub_epi16(hi, _mm256_mulhi_epi16(t, _mm256_set1_epi16(3329)));
+}
+
+static inline __m256i qinv_times(__m256i b)
+{
+  return _mm256_mullo_epi16(b, _mm256_set1_epi16(-3327));
+}
+
+static inline __m256i barrett_reduce(__m256i a)
+{
+  __m256i t = _mm256_mulhi_epi16(a, _mm256_set1_epi16(20159));
+  t = _mm256_srai_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(512)), 10);
+  return _mm256_sub_epi16(a, _mm256_mullo_epi16(t, _mm256_set1_epi16(3329)));
+}
+
+static inline void butterfly(__m256i *a, __m256i *b, __m256i z, __m256i zq)
+{
+  __m256i t = fqmul(*b, z, zq);
+  *b = _mm256_sub_epi16(*a, t);
+  *a = _mm256_add_epi16(*a, t);
+}
+
+static inline void inv_butterfly(__m256i *a, __m256i *b, __m256i z, __m256i zq)
+{
+  __m256i t = *a;
+  *a = barrett_reduce(_mm256_add_epi16(t, *b));
+  *b = fqmul(_mm256_sub_epi16(*b, t), z, zq);
+}
+
+/* In-place transposition of the 16 x 16 matrix of 16-bit lanes v: 8 x 8
+   transpositions inside each 128-bit half, then an exchange of the halves */
+static inline void transpose(__m256i *v)
+{
+  __m256i c[16U];
+  for (uint32_t h = 0U; h < 2U; h++)
+  {
+    __m256i *r = v + 8U * h;
+    __m256i a[8U];
+    __m256i b[8U];
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+      a[2U * i] = _mm256_unpacklo_epi16(r[2U * i], r[2U * i + 1U]);
+      a[2U * i + 1U] = _mm256_unpackhi_epi16(r[2U * i], r[2U * i + 1U]);
+    }
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+      b[4U * i] = _mm256_unpacklo_epi32(a[4U * i], a[4U * i + 2U]);
+      b[4U * i + 1U] = _mm256_unpackhi_epi32(a[4U * i], a[4U * i + 2U]);
+      b[4U * i + 2U] = _mm256_unpacklo_epi32(a[4U * i + 1U], a[4U * i + 3U]);
+      b[4U * i + 3U] = _mm256_unpackhi_epi32(a[4U * i + 1U], a[4U * i + 3U]);
+    }
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+      c[8U * h + 2U * i] = _mm256_unpacklo_epi64(b[i], b[i + 4U]);
+      c[8U * h + 2U * i + 1U] = _mm256_unpackhi_epi64(b[i], b[i + 4U]);
+    }
+  }
+  for (uint32_t j = 0U; j < 8U; j++)
+  {
+    v[j] = _mm256_permute2x128_si256(c[j], c[8U + j], 0x20);
+    v[j + 8U] = _mm256_permute2x128_si256(c[j], c[8U + j], 0x31);
+  }
+}
+
+void Hacl_Impl_MLKEM_Simd256_ntt(int16_t *r)
+{
+  __m256i v[16U];
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    v[i] = _mm256_loadu_si256((__m256i *)(r + 16U * i));
+  }
+  /* len = 128 .. 16: butterflies between whole vectors */
+  uint32_t k = 1U;
+  for (uint32_t lv = 8U; lv >= 1U; lv = lv >> 1U)
+  {
+    for (uint32_t start = 0U; start < 16U; start = start + 2U * lv)
+    {
+      __m256i z = _mm256_set1_epi16(Hacl_Impl_MLKEM_zetas[k]);
+      __m256i zq = qinv_times(z);
+      k++;
+      for (uint32_t j = start; j < start + lv; j++)
+      {
+        butterfly(v + j, v + j + lv, z, zq);
+      }
+    }
+  }
+  /* len = 8 .. 2: butterflies inside each block of 16 coefficients */
+  transpose(v);
+  for (uint32_t l = 0U; l < 7U; l++)
+  {
+    __m256i z = _mm256_loadu_si256((__m256i *)(ntt_zetas_t + 16U * l));
+    __m256i zq = qinv_times(z);
+    /* row l is group m of layer len */
+    uint32_t len = l == 0U ? 8U : l < 3U ? 4U : 2U;
+    uint32_t m = l == 0U ? 0U : l < 3U ? l - 1U : l - 3U;
+    for (uint32_t e = 2U * len * m; e < 2U * len * m + len; e++)
+    {
+      butterfly(v + e, v + e + len, z, zq);
+    }
+  }
+  transpose(v);
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    _mm256_storeu_si256((__m256i *)(r + 16U * i), barrett_reduce(v[i]));
+  }
+}
+
+void Hacl_Impl_MLKEM_Simd256_invntt(int16_t *r)
+{
+  __m256i v[16U];
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    v[i] = _mm256_loadu_si256((__m256i *)(r + 16U * i));
+  }
+  transpose(v);
+  for (uint32_t l = 0U; l < 7U; l++)
+  {
+    __m256i z = _mm256_loadu_si256((__m256i *)(invntt_zetas_t + 16U * l));
+    __m256i zq = qinv_times(z);
+    uint32_t len = l < 4U ? 2U : l < 6U ? 4U : 8U;
+    uint32_t m = l < 4U ? l : l < 6U ? l - 4U : 0U;
+    for (uint32_t e = 2U * len * m; e < 2U * len * m + len; e++)
+    {
+      inv_butterfly(v + e, v + e + len, z, zq);
+    }
+  }
+  transpose(v);
+  for (uint32_t lv = 1U; lv <= 8U; lv = lv << 1U)
+  {
+    uint32_t g = 0U;
+    for (uint32_t start = 0U; start < 16U; start = start + 2U * lv)
+    {
+      __m256i z = _mm256_set1_epi16(Hacl_Impl_MLKEM_zetas[16U / lv - 1U - g]);
+      __m256i zq = qinv_times(z);
+      g++;
+      for (uint32_t j = start; j < start + lv; j++)
+      {
+        inv_butterfly(v + j, v + j + lv, z, zq);
+      }
+    }
+  }
+  __m256i f = _mm256_set1_epi16(1441);
+  __m256i fq = qinv_times(f);
+  for (uint32_t i = 0U; i < 16U; i++)
+  {
+    _mm256_storeu_si256((__m256i *)(r + 16U * i), fqmul(v[i], f, fq));
+  }
+}
+
+/* Products of eight pairs of degree-one polynomials (a0 + a1 X) (b0 + b1 X) mod
+   X^2 - zeta, with a0 b0 + a1 b1 zeta in the even lanes and a0 b1 + a1 b0 in the
+   odd ones, as basemul in Hacl_MLKEM.c */
+static inline __m256i basemul(__m256i a, __m256i b, __m256i z, __m256i zq)
+{
+  __m256i q = fqmul(a, b, qinv_times(b));
+  __m256i qz = fqmul(q, z, zq);
+  __m256i bs = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(b, 0xB1), 0xB1);
+  __m256i p = fqmul(a, bs, qinv_times(bs));
+  __m256i even = _mm256_add_epi16(q, _mm256_srli_epi32(qz, 16));
+  __m256i odd = _mm256_add_epi16(p, _mm256_slli_epi32(p, 16));
+  return _mm256_blend_epi16(even, odd, 0xAA);
+}
+
+void Hacl_Impl_MLKEM_Simd256_basemul_acc(uint32_t k, int16_t *a, int16_t *b, int16_t *r)
+{
+  for (uint32_t c = 0U; c < 16U; c++)
+  {
+    __m256i z = _mm256_loadu_si256((__m256i *)(basemul_zetas + 16U * c));
+    __m256i zq = qinv_times(z);
+    __m256i
+    acc =
+      basemul(_mm256_loadu_si256((__m256i *)(a + 16U * c)),
+        _mm256_loadu_si256((__m256i *)(b + 16U * c)),
+        z,
+        zq);
+    for (uint32_t j = 1U; j < k; j++)
+    {
+      __m256i
+      t =
+        basemul(_mm256_loadu_si256((__m256i *)(a + 256U * j + 16U * c)),
+          _mm256_loadu_si256((__m256i *)(b + 256U * j + 16U * c)),
+          z,
+          zq);
+      acc = _mm256_add_epi16(acc, t);
+    }
+    _mm256_storeu_si256((__m256i *)(r + 16U * c), barrett_reduce(acc));
+  }
+}
+
+void
+Hacl_Impl_MLKEM_Simd256_sample_ntt_4x(
+  uint8_t *seeds,
+  int16_t *r0,
+  int16_t *r1,
+  int16_t *r2,
+  int16_t *r3
+)
+{
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 st[25U] KRML_POST_ALIGN(32) = { 0U };
+  uint8_t buf[2016U] = { 0U };
+  int16_t *r[4U] = { r0, r1, r2, r3 };
+  uint32_t ctr[4U] = { 0U };
+  Hacl_Hash_SHA3_Simd256_shake128_absorb_final(st,
+    seeds,
+    seeds + 34U,
+    seeds + 68U,
+    seeds + 102U,
+    34U);
+  Hacl_Hash_SHA3_Simd256_shake128_squeeze_nblocks(st,
+    buf,
+    buf + 504U,
+    buf + 1008U,
+    buf + 1512U,
+    504U);
+  for (uint32_t l = 0U; l < 4U; l++)
+  {
+    ctr[l] = Hacl_Impl_MLKEM_rej_uniform(r[l], 0U, buf + 504U * l, 504U);
+  }
+  while (ctr[0U] < 256U || ctr[1U] < 256U || ctr[2U] < 256U || ctr[3U] < 256U)
+  {
+    Hacl_Hash_SHA3_Simd256_shake128_squeeze_nblocks(st,
+      buf,
+      buf + 168U,
+      buf + 336U,
+      buf + 504U,
+      168U);
+    for (uint32_t l = 0U; l < 4U; l++)
+    {
+      ctr[l] = Hacl_Impl_MLKEM_rej_uniform(r[l], ctr[l], buf + 168U * l, 168U);
+    }
+  }
+}
+
+void
+Hacl_Impl_MLKEM_Simd256_shake256_4x(
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint32_t output_len,
+  uint8_t *output0,
+  uint8_t *output1,
+  uint8_t *output2,
+  uint8_t *output3
+)
+{
+  Hacl_Hash_SHA3_Simd256_shake256(output0,
+    output1,
+    output2,
+    output3,
+    output_len,
+    input0,
+    input1,
+    input2,
+    input3,
+    input_len);
+}
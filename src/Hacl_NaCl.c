@@ -23,7 +23,7 @@
  */
 
 
-#include "Hacl_NaCl.h"
+#include "internal/Hacl_NaCl.h"
 
 #include "internal/Hacl_Krmllib.h"
 
@@ -37,8 +37,16 @@ static void secretbox_init(uint8_t *xkeys, uint8_t *k, uint8_t *n)
   Hacl_Salsa20_salsa20_key_block0(aekey, subkey, n1);
 }
 
-static void
-secretbox_detached(uint32_t mlen, uint8_t *c, uint8_t *tag, uint8_t *k, uint8_t *n, uint8_t *m)
+void
+Hacl_Impl_NaCl_secretbox_detached(
+  const Hacl_Impl_NaCl_Kernels *kn,
+  uint32_t mlen,
+  uint8_t *c,
+  uint8_t *tag,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *m
+)
 {
   uint8_t xkeys[96U] = { 0U };
   secretbox_init(xkeys, k, n);
@@ -69,12 +77,13 @@ secretbox_detached(uint32_t mlen, uint8_t *c, uint8_t *tag, uint8_t *k, uint8_t
   uint8_t *c0 = c;
   uint8_t *c1 = c + mlen0;
   memcpy(c0, block0, mlen0 * sizeof (uint8_t));
-  Hacl_Salsa20_salsa20_encrypt(mlen1, c1, m1, subkey, n1, 1U);
-  Hacl_MAC_Poly1305_mac(tag, c, mlen, mkey);
+  kn->salsa20_xor(mlen1, c1, m1, subkey, n1, 1U);
+  kn->poly1305_mac(tag, c, mlen, mkey);
 }
 
-static uint32_t
-secretbox_open_detached(
+uint32_t
+Hacl_Impl_NaCl_secretbox_open_detached(
+  const Hacl_Impl_NaCl_Kernels *kn,
   uint32_t mlen,
   uint8_t *m,
   uint8_t *k,
@@ -87,7 +96,7 @@ secretbox_open_detached(
   secretbox_init(xkeys, k, n);
   uint8_t *mkey = xkeys + 32U;
   uint8_t tag_[16U] = { 0U };
-  Hacl_MAC_Poly1305_mac(tag_, c, mlen, mkey);
+  kn->poly1305_mac(tag_, c, mlen, mkey);
   uint8_t res = 255U;
   KRML_MAYBE_FOR16(i,
     0U,
@@ -124,12 +133,43 @@ secretbox_open_detached(
     uint8_t *m0 = m;
     uint8_t *m1 = m + mlen0;
     memcpy(m0, block0, mlen0 * sizeof (uint8_t));
-    Hacl_Salsa20_salsa20_decrypt(mlen1, m1, c1, subkey, n1, 1U);
+    kn->salsa20_xor(mlen1, m1, c1, subkey, n1, 1U);
     return 0U;
   }
   return 0xffffffffU;
 }
 
+const
+Hacl_Impl_NaCl_Kernels
+Hacl_Impl_NaCl_Kernels_portable =
+  { .salsa20_xor = Hacl_Salsa20_salsa20_encrypt, .poly1305_mac = Hacl_MAC_Poly1305_mac };
+
+static void
+secretbox_detached(uint32_t mlen, uint8_t *c, uint8_t *tag, uint8_t *k, uint8_t *n, uint8_t *m)
+{
+  Hacl_Impl_NaCl_secretbox_detached(&Hacl_Impl_NaCl_Kernels_portable, mlen, c, tag, k, n, m);
+}
+
+static uint32_t
+secretbox_open_detached(
+  uint32_t mlen,
+  uint8_t *m,
+  uint8_t *k,
+  uint8_t *n,
+  uint8_t *c,
+  uint8_t *tag
+)
+{
+  return
+    Hacl_Impl_NaCl_secretbox_open_detached(&Hacl_Impl_NaCl_Kernels_portable,
+      mlen,
+      m,
+      k,
+      n,
+      c,
+      tag);
+}
+
 static void secretbox_easy(uint32_t mlen, uint8_t *c, uint8_t *k, uint8_t *n, uint8_t *m)
 {
   uint8_t *tag = c;
@@ -1528,6 +1528,110 @@ Hacl_SHA2_Vec256_sha256_8(
   sha256_finish8(st, rb);
 }
 
+void
+Hacl_SHA2_Vec256_sha256_8_with_state(
+  uint32_t *st0,
+  uint64_t prev_len,
+  uint8_t *dst0,
+  uint8_t *dst1,
+  uint8_t *dst2,
+  uint8_t *dst3,
+  uint8_t *dst4,
+  uint8_t *dst5,
+  uint8_t *dst6,
+  uint8_t *dst7,
+  uint32_t input_len,
+  uint8_t *input0,
+  uint8_t *input1,
+  uint8_t *input2,
+  uint8_t *input3,
+  uint8_t *input4,
+  uint8_t *input5,
+  uint8_t *input6,
+  uint8_t *input7
+)
+{
+  Hacl_Hash_SHA2_uint8_8p
+  ib =
+    {
+      .fst = input0,
+      .snd = {
+        .fst = input1,
+        .snd = {
+          .fst = input2,
+          .snd = {
+            .fst = input3,
+            .snd = {
+              .fst = input4,
+              .snd = { .fst = input5, .snd = { .fst = input6, .snd = input7 } }
+            }
+          }
+        }
+      }
+    };
+  Hacl_Hash_SHA2_uint8_8p
+  rb =
+    {
+      .fst = dst0,
+      .snd = {
+        .fst = dst1,
+        .snd = {
+          .fst = dst2,
+          .snd = {
+            .fst = dst3,
+            .snd = { .fst = dst4, .snd = { .fst = dst5, .snd = { .fst = dst6, .snd = dst7 } } }
+          }
+        }
+      }
+    };
+  KRML_PRE_ALIGN(32) Lib_IntVector_Intrinsics_vec256 st[8U] KRML_POST_ALIGN(32) = { 0U };
+  KRML_MAYBE_FOR8(i,
+    0U,
+    8U,
+    1U,
+    Lib_IntVector_Intrinsics_vec256 *os = st;
+    uint32_t hi = st0[i];
+    Lib_IntVector_Intrinsics_vec256 x = Lib_IntVector_Intrinsics_vec256_load32(hi);
+    os[i] = x;);
+  uint32_t rem = input_len % 64U;
+  uint64_t len_ = prev_len + (uint64_t)input_len;
+  sha256_update_nblocks8(input_len, ib, st);
+  uint32_t rem1 = input_len % 64U;
+  uint8_t *b7 = ib.snd.snd.snd.snd.snd.snd.snd;
+  uint8_t *b6 = ib.snd.snd.snd.snd.snd.snd.fst;
+  uint8_t *b5 = ib.snd.snd.snd.snd.snd.fst;
+  uint8_t *b4 = ib.snd.snd.snd.snd.fst;
+  uint8_t *b3 = ib.snd.snd.snd.fst;
+  uint8_t *b2 = ib.snd.snd.fst;
+  uint8_t *b1 = ib.snd.fst;
+  uint8_t *b0 = ib.fst;
+  uint8_t *bl0 = b0 + input_len - rem1;
+  uint8_t *bl1 = b1 + input_len - rem1;
+  uint8_t *bl2 = b2 + input_len - rem1;
+  uint8_t *bl3 = b3 + input_len - rem1;
+  uint8_t *bl4 = b4 + input_len - rem1;
+  uint8_t *bl5 = b5 + input_len - rem1;
+  uint8_t *bl6 = b6 + input_len - rem1;
+  uint8_t *bl7 = b7 + input_len - rem1;
+  Hacl_Hash_SHA2_uint8_8p
+  lb =
+    {
+      .fst = bl0,
+      .snd = {
+        .fst = bl1,
+        .snd = {
+          .fst = bl2,
+          .snd = {
+            .fst = bl3,
+            .snd = { .fst = bl4, .snd = { .fst = bl5, .snd = { .fst = bl6, .snd = bl7 } } }
+          }
+        }
+      }
+    };
+  sha256_update_last8(len_, rem, lb, st);
+  sha256_finish8(st, rb);
+}
+
 static inline void sha384_init4(Lib_IntVector_Intrinsics_vec256 *hash)
 {
   KRML_MAYBE_FOR8(i,
@@ -27,19 +27,45 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
 #else
 
 /* assume POSIX here */
+#include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 
-bool read_random_bytes(uint32_t len, uint8_t *buf) {
-#ifdef SYS_getrandom
-  ssize_t res = syscall(SYS_getrandom, buf, (size_t)len, 0);
-  if (res == -1) {
-    return false;
+#include "lib_memzero0.h"
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/random.h>)
+#include <sys/random.h>
+#define HAVE_LIBC_GETRANDOM 1
+#endif
+#endif
+
+static bool read_kernel_random(uint32_t len, uint8_t *buf) {
+#if defined(HAVE_LIBC_GETRANDOM) || defined(SYS_getrandom)
+  while (len > 0) {
+#ifdef HAVE_LIBC_GETRANDOM
+    // Recent C libraries (glibc 2.41+) serve this from the vDSO (vgetrandom)
+    // without entering the kernel, where the kernel supports it.
+    ssize_t res = getrandom(buf, (size_t)len, 0);
+#else
+    ssize_t res = syscall(SYS_getrandom, buf, (size_t)len, 0);
+#endif
+    if (res == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return false;
+    }
+    buf += res;
+    len -= (uint32_t)res;
   }
+  return true;
 #else // !defined(SYS_getrandom)
   int fd = open("/dev/urandom", O_RDONLY);
   if (fd == -1) {
@@ -47,8 +73,66 @@ bool read_random_bytes(uint32_t len, uint8_t *buf) {
   }
   ssize_t res = read(fd, buf, (uint64_t)len);
   close(fd);
-#endif // defined(SYS_getrandom)
   return ((size_t)res == (size_t)len);
+#endif // defined(SYS_getrandom)
+}
+
+// Small requests (seeds, nonces, ephemeral keys) are served from a per-thread
+// slice of kernel randomness that is refilled RANDOM_SLICE_LEN bytes at a
+// time, so that they do not cost one system call each. Bytes are erased from
+// the slice as they are handed out. Larger requests go straight to the kernel.
+#define RANDOM_SLICE_LEN 4096U
+
+typedef struct {
+  uint32_t pos;
+  unsigned long generation;
+  uint8_t buf[RANDOM_SLICE_LEN];
+} random_slice;
+
+static __thread random_slice slice = { RANDOM_SLICE_LEN, 0, { 0 } };
+
+// Bumped in the child after every fork, so that a child never hands out bytes
+// that its parent may also hand out.
+static unsigned long fork_generation = 0;
+static pthread_once_t atfork_once = PTHREAD_ONCE_INIT;
+
+static void on_fork_child(void) {
+  fork_generation++;
+}
+
+static void register_atfork(void) {
+  pthread_atfork(NULL, NULL, on_fork_child);
+}
+
+bool read_random_bytes(uint32_t len, uint8_t *buf) {
+  if (len >= RANDOM_SLICE_LEN / 2U) {
+    return read_kernel_random(len, buf);
+  }
+  pthread_once(&atfork_once, register_atfork);
+  random_slice *s = &slice;
+  if (s->generation != fork_generation) {
+    Lib_Memzero0_memzero(s->buf, RANDOM_SLICE_LEN, uint8_t, void *);
+    s->pos = RANDOM_SLICE_LEN;
+    s->generation = fork_generation;
+  }
+  while (len > 0) {
+    if (s->pos == RANDOM_SLICE_LEN) {
+      if (!read_kernel_random(RANDOM_SLICE_LEN, s->buf)) {
+        return false;
+      }
+      s->pos = 0;
+    }
+    uint32_t n = RANDOM_SLICE_LEN - s->pos;
+    if (n > len) {
+      n = len;
+    }
+    memcpy(buf, s->buf + s->pos, n);
+    Lib_Memzero0_memzero(s->buf + s->pos, n, uint8_t, void *);
+    s->pos += n;
+    buf += n;
+    len -= n;
+  }
+  return true;
 }
 
 #endif
@@ -10,6 +10,7 @@
 
 #include "EverCrypt_AEAD.h"
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
 #include "evercrypt.h"
 #include "util.h"
 #include "wycheproof.h"
@@ -92,6 +93,87 @@ TEST_P(ChaCha20Suite, KAT)
   EverCrypt_AEAD_free(state);
 }
 
+// ----- XChaCha20Poly1305 -----------------------------------------------------
+
+// draft-irtf-cfrg-xchacha-03, section A.3.1.
+TEST(XChaCha20Suite, KAT)
+{
+  string plaintext = "Ladies and Gentlemen of the class of '99: If I could "
+                     "offer you only one tip for the future, sunscreen would "
+                     "be it.";
+  bytes msg(plaintext.begin(), plaintext.end());
+  bytes aad = from_hex("50515253c0c1c2c3c4c5c6c7");
+  bytes key = from_hex(
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+  bytes iv = from_hex("404142434445464748494a4b4c4d4e4f5051525354555657");
+  bytes cipher = from_hex(
+    "bd6d179d3e83d43b9576579493c0e939572a1700252bfaccbed2902c21396cbb"
+    "731c7f1b0b4aa6440bf3a82f4eda7e39ae64c6708c54c216cb96b72e1213b452"
+    "2f8c9ba40db5d945b11b69b982c1bb9e3f3fac2bc369488f76b2383565d3fff9"
+    "21f9664c97637da9768812f615c68b13b52e");
+  bytes tag = from_hex("c0875924c1c7987947deafd8780acf49");
+
+  for (int vec = 0; vec < 2; vec++) {
+    EverCrypt_AutoConfig2_init();
+    if (vec == 0) {
+      EverCrypt_AutoConfig2_disable_avx2();
+      EverCrypt_AutoConfig2_disable_avx();
+    }
+    EverCrypt_Dispatch_refresh();
+    EverCrypt_AEAD_state_s* state;
+    ASSERT_EQ(EverCrypt_AEAD_create_in(
+                Spec_Agile_AEAD_XCHACHA20_POLY1305, &state, key.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(EverCrypt_AEAD_alg_of_state(state),
+              Spec_Agile_AEAD_XCHACHA20_POLY1305);
+    encrypt_decrypt(state, iv, aad, msg, cipher, tag, true);
+
+    bytes got_cipher(msg.size()), got_tag(16);
+    EXPECT_EQ(EverCrypt_AEAD_encrypt(state,
+                                     iv.data(),
+                                     12,
+                                     aad.data(),
+                                     aad.size(),
+                                     msg.data(),
+                                     msg.size(),
+                                     got_cipher.data(),
+                                     got_tag.data()),
+              EverCrypt_Error_InvalidIVLength);
+    EverCrypt_AEAD_free(state);
+
+    EXPECT_EQ(EverCrypt_AEAD_encrypt_expand(Spec_Agile_AEAD_XCHACHA20_POLY1305,
+                                            key.data(),
+                                            iv.data(),
+                                            iv.size(),
+                                            aad.data(),
+                                            aad.size(),
+                                            msg.data(),
+                                            msg.size(),
+                                            got_cipher.data(),
+                                            got_tag.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(got_cipher, cipher);
+    EXPECT_EQ(got_tag, tag);
+
+    bytes got_msg(msg.size());
+    tag[0] ^= 1;
+    EXPECT_EQ(EverCrypt_AEAD_decrypt_expand(Spec_Agile_AEAD_XCHACHA20_POLY1305,
+                                            key.data(),
+                                            iv.data(),
+                                            iv.size(),
+                                            aad.data(),
+                                            aad.size(),
+                                            cipher.data(),
+                                            cipher.size(),
+                                            tag.data(),
+                                            got_msg.data()),
+              EverCrypt_Error_AuthenticationFailure);
+    tag[0] ^= 1;
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
 // ----- AES GCM -------------------------------------------------------------
 
 typedef EverCryptSuite<WycheproofAeadTest> AesGcmSuite;
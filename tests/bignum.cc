@@ -9,6 +9,8 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include "EverCrypt_Bignum4096.h"
+#include "EverCrypt_Dispatch.h"
 #include "Hacl_Bignum256_32.h"
 #include "Hacl_Bignum32.h"
 #include "Hacl_Bignum4096_32.h"
@@ -21,6 +23,9 @@
 #include "Hacl_Bignum256.h"
 #include "Hacl_Bignum4096.h"
 #include "Hacl_Bignum64.h"
+#ifdef HACL_CAN_COMPILE_AVX512IFMA
+#include "Hacl_Bignum4096_IFMA.h"
+#endif
 #endif
 
 using namespace std;
@@ -746,6 +751,303 @@ TEST_P(BignumReduced, ModExpKAT)
   }
 }
 
+#ifdef HACL_CAN_COMPILE_INLINE_ASM
+// The MULX/ADCX/ADOX code paths must agree with the portable ones for all the
+// limb counts they handle, including lengths that are not a multiple of four.
+TEST(BignumAdx, MatchesPortable)
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  if (!(EverCrypt_AutoConfig2_has_adx() && EverCrypt_AutoConfig2_has_bmi2())) {
+    cout << "Skipping. No ADX/BMI2 support." << endl;
+    return;
+  }
+
+  for (uint32_t len : { 1, 4, 5, 7, 32, 33, 48, 64 }) {
+    bytes n_bytes(len * 8), a_bytes(len * 16), b_bytes(len * 8);
+    generate_random(n_bytes.data(), n_bytes.size());
+    generate_random(a_bytes.data(), a_bytes.size());
+    generate_random(b_bytes.data(), b_bytes.size());
+    n_bytes[0] |= 0x80;
+    n_bytes[n_bytes.size() - 1] |= 0x01;
+
+    uint64_t* n =
+      Hacl_Bignum64_new_bn_from_bytes_be(n_bytes.size(), n_bytes.data());
+    uint64_t* a_wide =
+      Hacl_Bignum64_new_bn_from_bytes_be(a_bytes.size(), a_bytes.data());
+    uint64_t* b =
+      Hacl_Bignum64_new_bn_from_bytes_be(b_bytes.size(), b_bytes.data());
+    ASSERT_NE(n, (uint64_t*)nullptr);
+    ASSERT_NE(a_wide, (uint64_t*)nullptr);
+    ASSERT_NE(b, (uint64_t*)nullptr);
+
+    vector<uint64_t> results[2];
+    for (int portable = 0; portable < 2; portable++) {
+      if (portable) {
+        EverCrypt_AutoConfig2_disable_adx();
+        EverCrypt_Dispatch_refresh();
+      }
+      ASSERT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_BIGNUM),
+                portable ? EverCrypt_Dispatch_Portable : EverCrypt_Dispatch_Adx);
+
+      vector<uint64_t> a(len), mul(2 * len), sqr(2 * len), exp(len), vexp(len);
+      ASSERT_TRUE(Hacl_Bignum64_mod(len, n, a_wide, a.data()));
+      Hacl_Bignum64_mul(len, a.data(), b, mul.data());
+      Hacl_Bignum64_sqr(len, a.data(), sqr.data());
+      ASSERT_TRUE(Hacl_Bignum64_mod_exp_consttime(
+        len, n, a.data(), len * 64, b, exp.data()));
+      ASSERT_TRUE(Hacl_Bignum64_mod_exp_vartime(
+        len, n, a.data(), len * 64, b, vexp.data()));
+      EXPECT_EQ(exp, vexp);
+
+      results[portable] = a;
+      results[portable].insert(results[portable].end(), mul.begin(), mul.end());
+      results[portable].insert(results[portable].end(), sqr.begin(), sqr.end());
+      results[portable].insert(results[portable].end(), exp.begin(), exp.end());
+
+      if (len == 4 || len == 64) {
+        auto mod_exp = len == 4 ? Hacl_Bignum256_mod_exp_consttime
+                                : Hacl_Bignum4096_mod_exp_consttime;
+        vector<uint64_t> fixed(len);
+        ASSERT_TRUE(mod_exp(n, a.data(), len * 64, b, fixed.data()));
+        EXPECT_EQ(exp, fixed);
+      }
+    }
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+
+    EXPECT_EQ(results[0], results[1]) << "len = " << len;
+
+    free(n);
+    free(a_wide);
+    free(b);
+  }
+}
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC128
+// The variable-time exponentiation picks its window from the exponent size;
+// check every window against the constant-time ladder, with and without a
+// reused table.
+TEST(BignumVartime, WindowsMatchConsttime)
+{
+  for (uint32_t len : { 4, 33, 64 }) {
+    bytes n_bytes(len * 8), a_bytes(len * 8);
+    generate_random(n_bytes.data(), n_bytes.size());
+    generate_random(a_bytes.data(), a_bytes.size());
+    n_bytes[0] |= 0x80;
+    a_bytes[0] &= 0x7f;
+    n_bytes[n_bytes.size() - 1] |= 0x01;
+
+    uint64_t* n =
+      Hacl_Bignum64_new_bn_from_bytes_be(n_bytes.size(), n_bytes.data());
+    uint64_t* a =
+      Hacl_Bignum64_new_bn_from_bytes_be(a_bytes.size(), a_bytes.data());
+    ASSERT_NE(n, (uint64_t*)nullptr);
+    ASSERT_NE(a, (uint64_t*)nullptr);
+    Hacl_Bignum64_pbn_mont_ctx_u64 k = Hacl_Bignum64_mont_ctx_init(len, n);
+    Hacl_Bignum64_pbn_mont_table_u64 t =
+      Hacl_Bignum64_mont_table_init(k, a, len * 64);
+
+    for (uint32_t bBits : { 0, 1, 2, 17, 24, 80, 240, 672, 2048 }) {
+      if (bBits > len * 64) {
+        continue;
+      }
+      vector<uint64_t> b(len);
+      generate_random((uint8_t*)b.data(), len * 8);
+      if (bBits == 17) {
+        fill(b.begin(), b.end(), 0);
+        b[0] = 65537;
+      }
+      for (uint32_t i = 0; i < len; i++) {
+        b[i] = i * 64 >= bBits ? 0 : b[i];
+      }
+      if (bBits % 64 != 0) {
+        b[bBits / 64] &= (1ULL << (bBits % 64)) - 1;
+      }
+
+      vector<uint64_t> expected(len), res(len), res_table(len);
+      Hacl_Bignum64_mod_exp_consttime_precomp(
+        k, a, bBits, b.data(), expected.data());
+      Hacl_Bignum64_mod_exp_vartime_precomp(k, a, bBits, b.data(), res.data());
+      Hacl_Bignum64_mod_exp_vartime_table(
+        k, t, bBits, b.data(), res_table.data());
+      EXPECT_EQ(res, expected) << "len = " << len << ", bBits = " << bBits;
+      EXPECT_EQ(res_table, expected)
+        << "len = " << len << ", bBits = " << bBits;
+
+      if (len == 64) {
+        vector<uint64_t> fixed(len);
+        Hacl_Bignum4096_mod_exp_vartime_precomp(
+          k, a, bBits, b.data(), fixed.data());
+        EXPECT_EQ(fixed, expected) << "bBits = " << bBits;
+      }
+    }
+
+    Hacl_Bignum64_mont_table_free(t);
+    Hacl_Bignum64_mont_ctx_free(k);
+    free(n);
+    free(a);
+  }
+}
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC128
+// Odd lengths and lengths past the Toom-3 threshold take different paths
+// through the 64-bit multiplication; the 32-bit one serves as reference.
+TEST(BignumToom3, MatchesBignum32)
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  for (uint32_t len : { 33, 41, 95, 97, 128, 129, 192, 257 }) {
+    for (int portable = 0; portable < 2; portable++) {
+      if (portable) {
+        EverCrypt_AutoConfig2_disable_adx();
+        EverCrypt_Dispatch_refresh();
+      }
+
+      vector<uint64_t> a(len), b(len), mul(2 * len), sqr(2 * len);
+      generate_random((uint8_t*)a.data(), len * 8);
+      generate_random((uint8_t*)b.data(), len * 8);
+      // Saturated limbs maximise the carries in the evaluation points.
+      a[len - 1] = ~0ULL;
+      b[0] = ~0ULL;
+      Hacl_Bignum64_mul(len, a.data(), b.data(), mul.data());
+      Hacl_Bignum64_sqr(len, a.data(), sqr.data());
+
+      vector<uint32_t> a32(2 * len), b32(2 * len), mul32(4 * len),
+        sqr32(4 * len);
+      memcpy(a32.data(), a.data(), len * 8);
+      memcpy(b32.data(), b.data(), len * 8);
+      Hacl_Bignum32_mul(2 * len, a32.data(), b32.data(), mul32.data());
+      Hacl_Bignum32_sqr(2 * len, a32.data(), sqr32.data());
+
+      EXPECT_EQ(memcmp(mul.data(), mul32.data(), len * 16), 0)
+        << "len = " << len << ", portable = " << portable;
+      EXPECT_EQ(memcmp(sqr.data(), sqr32.data(), len * 16), 0)
+        << "len = " << len << ", portable = " << portable;
+    }
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+  }
+}
+#endif
+
+#ifdef HACL_CAN_COMPILE_AVX512IFMA
+TEST(BignumIfma, MatchesPortable)
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  if (!EverCrypt_AutoConfig2_has_avx512ifma()) {
+    cout << "Skipping. No AVX512-IFMA support." << endl;
+    return;
+  }
+  ASSERT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_MOD_EXP),
+            EverCrypt_Dispatch_Avx512ifma);
+
+  // Lengths cover every radix 2^52 digit count, with and without top padding.
+  for (uint32_t len : { 1, 4, 7, 8, 16, 24, 31, 32, 40, 48, 56, 64 }) {
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64* k[2];
+    vector<uint64_t> a[2], b[2], expected[2];
+    for (int i = 0; i < 2; i++) {
+      bytes n_bytes(len * 8), a_bytes(len * 8), b_bytes(len * 8);
+      generate_random(n_bytes.data(), n_bytes.size());
+      generate_random(a_bytes.data(), a_bytes.size());
+      generate_random(b_bytes.data(), b_bytes.size());
+      n_bytes[0] |= 0x80;
+      n_bytes[n_bytes.size() - 1] |= 0x01;
+      a_bytes[0] &= 0x7f;
+
+      uint64_t* n =
+        Hacl_Bignum64_new_bn_from_bytes_be(n_bytes.size(), n_bytes.data());
+      ASSERT_NE(n, (uint64_t*)nullptr);
+      k[i] = Hacl_Bignum64_mont_ctx_init(len, n);
+      free(n);
+
+      uint64_t* a_bn =
+        Hacl_Bignum64_new_bn_from_bytes_be(a_bytes.size(), a_bytes.data());
+      uint64_t* b_bn =
+        Hacl_Bignum64_new_bn_from_bytes_be(b_bytes.size(), b_bytes.data());
+      ASSERT_NE(a_bn, (uint64_t*)nullptr);
+      ASSERT_NE(b_bn, (uint64_t*)nullptr);
+      a[i].assign(a_bn, a_bn + len);
+      b[i].assign(b_bn, b_bn + len);
+      free(a_bn);
+      free(b_bn);
+
+      expected[i].resize(len);
+      Hacl_Bignum64_mod_exp_consttime_precomp(
+        k[i], a[i].data(), len * 64, b[i].data(), expected[i].data());
+    }
+
+    vector<uint64_t> res(len), res0(len), res1(len);
+    Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp(len,
+                                                   k[0]->n,
+                                                   k[0]->mu,
+                                                   k[0]->r2,
+                                                   a[0].data(),
+                                                   len * 64,
+                                                   b[0].data(),
+                                                   res.data());
+    EXPECT_EQ(res, expected[0]) << "len = " << len;
+
+    Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp2(len,
+                                                    k[0]->n,
+                                                    k[0]->mu,
+                                                    k[0]->r2,
+                                                    a[0].data(),
+                                                    b[0].data(),
+                                                    res0.data(),
+                                                    k[1]->n,
+                                                    k[1]->mu,
+                                                    k[1]->r2,
+                                                    a[1].data(),
+                                                    b[1].data(),
+                                                    res1.data(),
+                                                    len * 64);
+    EXPECT_EQ(res0, expected[0]) << "len = " << len;
+    EXPECT_EQ(res1, expected[1]) << "len = " << len;
+
+    // Short exponents, including a zero-bit one, take the same path.
+    for (uint32_t bBits : { 0, 1, 17 }) {
+      vector<uint64_t> short_b(b[0]), short_expected(len);
+      for (uint32_t i = 0; i < len; i++) {
+        short_b[i] = i * 64 >= bBits ? 0 : short_b[i];
+      }
+      if (bBits % 64 != 0) {
+        short_b[bBits / 64] &= (1ULL << (bBits % 64)) - 1;
+      }
+      Hacl_Bignum64_mod_exp_consttime_precomp(
+        k[0], a[0].data(), bBits, short_b.data(), short_expected.data());
+      Hacl_Bignum4096_IFMA_mod_exp_consttime_precomp(len,
+                                                     k[0]->n,
+                                                     k[0]->mu,
+                                                     k[0]->r2,
+                                                     a[0].data(),
+                                                     bBits,
+                                                     short_b.data(),
+                                                     res.data());
+      EXPECT_EQ(res, short_expected) << "len = " << len << ", bBits = " << bBits;
+    }
+
+    if (len == 64) {
+      // Hacl_Bignum4096 stays portable; EverCrypt_Bignum4096 takes IFMA.
+      vector<uint64_t> fixed(len), dispatched(len);
+      Hacl_Bignum4096_mod_exp_consttime_precomp(
+        k[0], a[0].data(), len * 64, b[0].data(), fixed.data());
+      EverCrypt_Bignum4096_mod_exp_consttime_precomp(
+        k[0], a[0].data(), len * 64, b[0].data(), dispatched.data());
+      EXPECT_EQ(fixed, expected[0]);
+      EXPECT_EQ(dispatched, expected[0]);
+    }
+
+    Hacl_Bignum64_mont_ctx_free(k[0]);
+    Hacl_Bignum64_mont_ctx_free(k[1]);
+  }
+}
+#endif
+
 // -----------------------------------------------------------------------------
 
 vector<TestCase>
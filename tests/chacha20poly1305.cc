@@ -9,6 +9,8 @@
 #include <gtest/gtest.h>
 
 #include "Hacl_AEAD_Chacha20Poly1305.h"
+#include "Hacl_AEAD_XChacha20Poly1305.h"
+#include "Hacl_Chacha20.h"
 #include "Hacl_Chacha20_Vec32.h"
 #include "chacha20poly1305_vectors.h"
 #include "hacl-cpu-features.h"
@@ -17,10 +19,14 @@
 
 #ifdef HACL_CAN_COMPILE_VEC128
 #include "Hacl_AEAD_Chacha20Poly1305_Simd128.h"
+#include "Hacl_AEAD_XChacha20Poly1305_Simd128.h"
+#include "Hacl_Chacha20_Vec128.h"
 #endif
 
 #ifdef HACL_CAN_COMPILE_VEC256
 #include "Hacl_AEAD_Chacha20Poly1305_Simd256.h"
+#include "Hacl_AEAD_XChacha20Poly1305_Simd256.h"
+#include "Hacl_Chacha20_Vec256.h"
 #endif
 
 #define VALE                                                                   \
@@ -313,3 +319,230 @@ INSTANTIATE_TEST_SUITE_P(Wycheproof,
                          Chacha20Poly1305Wycheproof,
                          ::testing::ValuesIn(read_wycheproof_aead_json(
                            "chacha20_poly1305_test.json")));
+
+// === XChaCha20-Poly1305 === //
+
+// Test vectors from draft-irtf-cfrg-xchacha-03, sections 2.2.1 and A.3.1.
+TEST(XChacha20Poly1305, HChaCha20)
+{
+  hacl_init_cpu_features();
+
+  bytes key = from_hex(
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f");
+  bytes nonce = from_hex("000000090000004a0000000031415927");
+  bytes subkey(32);
+  Hacl_Chacha20_hchacha20(subkey.data(), key.data(), nonce.data());
+  EXPECT_EQ(
+    subkey,
+    from_hex(
+      "82413b4227b27bfed30e42508a877d73a0f9e4d58a74a853c12ec41326d3ecdc"));
+
+  // Every lane of the vectorized derivation matches the portable one.
+  bytes keys(8 * 32), nonces(8 * 16), expected(8 * 32);
+  for (size_t i = 0; i < keys.size(); i++) {
+    keys[i] = (uint8_t)(7 * i + 1);
+  }
+  for (size_t i = 0; i < nonces.size(); i++) {
+    nonces[i] = (uint8_t)(13 * i + 5);
+  }
+  for (size_t j = 0; j < 8; j++) {
+    Hacl_Chacha20_hchacha20(
+      expected.data() + 32 * j, keys.data() + 32 * j, nonces.data() + 16 * j);
+  }
+
+#ifdef HACL_CAN_COMPILE_VEC128
+  if (hacl_vec128_support()) {
+    bytes got(4 * 32);
+    Hacl_Chacha20_Vec128_hchacha20_128(got.data(), keys.data(), nonces.data());
+    EXPECT_TRUE(equal(got.begin(), got.end(), expected.begin()));
+  }
+#endif // HACL_CAN_COMPILE_VEC128
+
+#ifdef HACL_CAN_COMPILE_VEC256
+  if (hacl_vec256_support()) {
+    bytes got(8 * 32);
+    Hacl_Chacha20_Vec256_hchacha20_256(got.data(), keys.data(), nonces.data());
+    EXPECT_EQ(got, expected);
+  }
+#endif // HACL_CAN_COMPILE_VEC256
+}
+
+TEST(XChacha20Poly1305, KAT)
+{
+  hacl_init_cpu_features();
+
+  string plaintext = "Ladies and Gentlemen of the class of '99: If I could "
+                     "offer you only one tip for the future, sunscreen would "
+                     "be it.";
+  bytes msg(plaintext.begin(), plaintext.end());
+  bytes aad = from_hex("50515253c0c1c2c3c4c5c6c7");
+  bytes key = from_hex(
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f");
+  bytes nonce =
+    from_hex("404142434445464748494a4b4c4d4e4f5051525354555657");
+  bytes cipher = from_hex(
+    "bd6d179d3e83d43b9576579493c0e939572a1700252bfaccbed2902c21396cbb"
+    "731c7f1b0b4aa6440bf3a82f4eda7e39ae64c6708c54c216cb96b72e1213b452"
+    "2f8c9ba40db5d945b11b69b982c1bb9e3f3fac2bc369488f76b2383565d3fff9"
+    "21f9664c97637da9768812f615c68b13b52e");
+  bytes tag = from_hex("c0875924c1c7987947deafd8780acf49");
+
+  EXPECT_TRUE(print_test(&Hacl_AEAD_XChacha20Poly1305_encrypt,
+                         &Hacl_AEAD_XChacha20Poly1305_decrypt,
+                         msg.size(),
+                         msg.data(),
+                         key.data(),
+                         nonce.data(),
+                         aad.size(),
+                         aad.data(),
+                         tag.data(),
+                         cipher.data()));
+
+#ifdef HACL_CAN_COMPILE_VEC128
+  if (hacl_vec128_support()) {
+    EXPECT_TRUE(print_test(&Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt,
+                           &Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt,
+                           msg.size(),
+                           msg.data(),
+                           key.data(),
+                           nonce.data(),
+                           aad.size(),
+                           aad.data(),
+                           tag.data(),
+                           cipher.data()));
+  }
+#endif // HACL_CAN_COMPILE_VEC128
+
+#ifdef HACL_CAN_COMPILE_VEC256
+  if (hacl_vec256_support()) {
+    EXPECT_TRUE(print_test(&Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt,
+                           &Hacl_AEAD_XChacha20Poly1305_Simd256_decrypt,
+                           msg.size(),
+                           msg.data(),
+                           key.data(),
+                           nonce.data(),
+                           aad.size(),
+                           aad.data(),
+                           tag.data(),
+                           cipher.data()));
+  }
+#endif // HACL_CAN_COMPILE_VEC256
+}
+
+typedef void (*test_encrypt_batch)(uint32_t,
+                                   uint8_t*,
+                                   uint8_t*,
+                                   uint8_t*,
+                                   uint32_t,
+                                   uint8_t*,
+                                   uint32_t,
+                                   uint8_t*,
+                                   uint8_t*);
+
+typedef uint32_t (*test_decrypt_batch)(uint32_t,
+                                       uint8_t*,
+                                       uint8_t*,
+                                       uint32_t,
+                                       uint8_t*,
+                                       uint32_t,
+                                       uint8_t*,
+                                       uint8_t*,
+                                       uint8_t*);
+
+// A batch, including a partial chunk of lanes, gives the same ciphertexts as
+// single calls; a forged tag only affects its own message.
+static void
+test_batch(test_encrypt_batch encrypt_batch, test_decrypt_batch decrypt_batch)
+{
+  const uint32_t n = 11, len = 100, aad_len = 7;
+  bytes key(32), msg(n * len), aad(n * aad_len), nonce(n * 24);
+  for (size_t i = 0; i < key.size(); i++) {
+    key[i] = (uint8_t)(3 * i);
+  }
+  for (size_t i = 0; i < msg.size(); i++) {
+    msg[i] = (uint8_t)i;
+  }
+  for (size_t i = 0; i < aad.size(); i++) {
+    aad[i] = (uint8_t)(5 * i);
+  }
+  for (size_t i = 0; i < nonce.size(); i++) {
+    nonce[i] = (uint8_t)(11 * i + 2);
+  }
+
+  bytes cipher(n * len), tag(n * 16);
+  encrypt_batch(n,
+                cipher.data(),
+                tag.data(),
+                msg.data(),
+                len,
+                aad.data(),
+                aad_len,
+                key.data(),
+                nonce.data());
+  for (uint32_t i = 0; i < n; i++) {
+    bytes c(len), t(16);
+    Hacl_AEAD_XChacha20Poly1305_encrypt(c.data(),
+                                        t.data(),
+                                        msg.data() + i * len,
+                                        len,
+                                        aad.data() + i * aad_len,
+                                        aad_len,
+                                        key.data(),
+                                        nonce.data() + i * 24);
+    EXPECT_TRUE(equal(c.begin(), c.end(), cipher.begin() + i * len));
+    EXPECT_TRUE(equal(t.begin(), t.end(), tag.begin() + i * 16));
+  }
+
+  bytes plain(n * len);
+  EXPECT_EQ(decrypt_batch(n,
+                          plain.data(),
+                          cipher.data(),
+                          len,
+                          aad.data(),
+                          aad_len,
+                          key.data(),
+                          nonce.data(),
+                          tag.data()),
+            0);
+  EXPECT_EQ(plain, msg);
+
+  bytes forged(n * len);
+  tag[16 * 9] ^= 1;
+  EXPECT_EQ(decrypt_batch(n,
+                          forged.data(),
+                          cipher.data(),
+                          len,
+                          aad.data(),
+                          aad_len,
+                          key.data(),
+                          nonce.data(),
+                          tag.data()),
+            1);
+  EXPECT_TRUE(equal(forged.begin(), forged.begin() + 9 * len, msg.begin()));
+  EXPECT_TRUE(all_of(forged.begin() + 9 * len,
+                     forged.begin() + 10 * len,
+                     [](uint8_t b) { return b == 0; }));
+  EXPECT_TRUE(equal(forged.begin() + 10 * len, forged.end(), msg.begin() + 10 * len));
+}
+
+TEST(XChacha20Poly1305, Batch)
+{
+  hacl_init_cpu_features();
+
+  test_batch(&Hacl_AEAD_XChacha20Poly1305_encrypt_batch,
+             &Hacl_AEAD_XChacha20Poly1305_decrypt_batch);
+
+#ifdef HACL_CAN_COMPILE_VEC128
+  if (hacl_vec128_support()) {
+    test_batch(&Hacl_AEAD_XChacha20Poly1305_Simd128_encrypt_batch,
+               &Hacl_AEAD_XChacha20Poly1305_Simd128_decrypt_batch);
+  }
+#endif // HACL_CAN_COMPILE_VEC128
+
+#ifdef HACL_CAN_COMPILE_VEC256
+  if (hacl_vec256_support()) {
+    test_batch(&Hacl_AEAD_XChacha20Poly1305_Simd256_encrypt_batch,
+               &Hacl_AEAD_XChacha20Poly1305_Simd256_decrypt_batch);
+  }
+#endif // HACL_CAN_COMPILE_VEC256
+}
@@ -10,6 +10,7 @@
 #include <gtest/gtest.h>
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
 #include "hacl-cpu-features.h"
 #include "util.h"
 
@@ -59,4 +60,21 @@ TEST(DetectionSuite, PrintFeatures)
     cout << "shaext: " << EverCrypt_AutoConfig2_has_shaext() << endl;
     cout << "sse: " << EverCrypt_AutoConfig2_has_sse() << endl;
   }
+
+  cout << endl;
+
+  // Dispatch
+  {
+    cout << "# Dispatch" << endl;
+    const char* names[] = { "chacha20poly1305", "poly1305", "curve25519",
+                            "sha2_256",         "bignum",   "mod_exp",
+                            "frodo",            "frodo_aes", "mlkem",
+                            "nacl",             "hpke",     "aes_gcm",
+                            "chacha20",         "sha2_256_mb" };
+    for (uint8_t p = 0; p < EverCrypt_Dispatch_COUNT; p++) {
+      cout << names[p] << ": "
+           << EverCrypt_Dispatch_impl_name(EverCrypt_Dispatch_implementation(p))
+           << endl;
+    }
+  }
 }
@@ -7,15 +7,24 @@
  */
 
 #include <fstream>
+#include <thread>
 #include <tuple>
 
+#if !(defined(_WIN32) || defined(_WIN64))
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_DRBG.h"
+#include "EverCrypt_Random.h"
 #include "Hacl_HMAC_DRBG.h"
 #include "Hacl_Spec.h"
 #include "hacl-cpu-features.h"
+#include "internal/EverCrypt_DRBG.h"
 
 #include "util.h"
 
@@ -71,6 +80,175 @@ TEST(ApiSuite, ApiTest)
   EXPECT_TRUE(res);
 }
 
+TEST(DrbgChacha20Suite, Generate)
+{
+  EverCrypt_AutoConfig2_init();
+
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_chacha20();
+  uint8_t personalization[] = "chacha20 drbg test";
+  ASSERT_TRUE(
+    EverCrypt_DRBG_instantiate(st, personalization, sizeof(personalization)));
+
+  bytes seen;
+  uint8_t additional_input[16] = { 1 };
+  for (uint32_t len : { 1, 31, 32, 100, 4064, 4096, 10000, 65536 }) {
+    bytes a(len, 0);
+    bytes b(len, 0);
+    ASSERT_TRUE(EverCrypt_DRBG_generate(a.data(), st, len, NULL, 0));
+    ASSERT_TRUE(EverCrypt_DRBG_generate(
+      b.data(), st, len, additional_input, sizeof(additional_input)));
+    if (len >= 32) {
+      EXPECT_NE(a, b);
+      EXPECT_NE(a, bytes(len, 0));
+      EXPECT_NE(b, bytes(len, 0));
+    }
+  }
+  ASSERT_TRUE(EverCrypt_DRBG_reseed(st, NULL, 0));
+
+  // Same limits as the HMAC-DRBG instantiations.
+  bytes too_long(EverCrypt_DRBG_max_output_length + 1);
+  EXPECT_FALSE(
+    EverCrypt_DRBG_generate(too_long.data(), st, too_long.size(), NULL, 0));
+
+  // More than reseed_interval calls must keep working.
+  uint8_t out[8];
+  for (uint32_t i = 0; i < EverCrypt_DRBG_reseed_interval + 10; i++) {
+    ASSERT_TRUE(EverCrypt_DRBG_generate(out, st, sizeof(out), NULL, 0));
+  }
+
+  EverCrypt_DRBG_uninstantiate(st);
+}
+
+TEST(DrbgAes256CtrSuite, Generate)
+{
+  EverCrypt_AutoConfig2_init();
+
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_aes256_ctr();
+  if (st == NULL) {
+    std::cout << "AES-NI is not available. Skipping." << std::endl;
+    return;
+  }
+  // Without a derivation function, inputs are limited to the seed length.
+  uint8_t long_input[49] = { 0 };
+  EXPECT_FALSE(EverCrypt_DRBG_instantiate(st, long_input, sizeof(long_input)));
+  uint8_t personalization[] = "ctr drbg test";
+  ASSERT_TRUE(
+    EverCrypt_DRBG_instantiate(st, personalization, sizeof(personalization)));
+
+  uint8_t additional_input[48] = { 7 };
+  for (uint32_t len : { 1, 15, 16, 17, 100, 288, 4096, 65536 }) {
+    bytes a(len, 0);
+    bytes b(len, 0);
+    ASSERT_TRUE(EverCrypt_DRBG_generate(a.data(), st, len, NULL, 0));
+    ASSERT_TRUE(EverCrypt_DRBG_generate(
+      b.data(), st, len, additional_input, sizeof(additional_input)));
+    if (len >= 16) {
+      EXPECT_NE(a, b);
+      EXPECT_NE(a, bytes(len, 0));
+    }
+  }
+  EXPECT_FALSE(EverCrypt_DRBG_generate(
+    long_input, st, 1, long_input, sizeof(long_input)));
+  ASSERT_TRUE(EverCrypt_DRBG_reseed(st, additional_input, 20));
+
+  uint8_t out[8];
+  for (uint32_t i = 0; i < EverCrypt_DRBG_reseed_interval + 10; i++) {
+    ASSERT_TRUE(EverCrypt_DRBG_generate(out, st, sizeof(out), NULL, 0));
+  }
+
+  EverCrypt_DRBG_uninstantiate(st);
+}
+
+TEST(RandomSuite, Bytes)
+{
+  // Small requests are served from the buffer, large ones bypass it.
+  for (uint32_t len : { 0, 1, 7, 32, 2047, 2048, 5000, 70000 }) {
+    bytes a(len, 0);
+    bytes b(len, 0);
+    ASSERT_TRUE(EverCrypt_Random_bytes(a.data(), len));
+    ASSERT_TRUE(EverCrypt_Random_bytes(b.data(), len));
+    if (len >= 32) {
+      EXPECT_NE(a, b);
+      EXPECT_NE(a, bytes(len, 0));
+    }
+  }
+}
+
+TEST(RandomSuite, Threads)
+{
+  const size_t n_threads = 8;
+  std::vector<bytes> out(n_threads, bytes(64 * 100));
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < n_threads; t++) {
+    threads.emplace_back([&out, t]() {
+      for (size_t i = 0; i < 100; i++) {
+        ASSERT_TRUE(EverCrypt_Random_bytes(out[t].data() + 64 * i, 64));
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  for (size_t t = 0; t < n_threads; t++) {
+    for (size_t u = t + 1; u < n_threads; u++) {
+      EXPECT_NE(out[t], out[u]);
+    }
+  }
+}
+
+TEST(RandomSuite, SystemRandom)
+{
+  // Small requests come from the per-thread slice, large ones from the kernel.
+  for (uint32_t len : { 1, 16, 32, 48, 2047, 2048, 4096, 100000 }) {
+    bytes a(len, 0);
+    bytes b(len, 0);
+    Lib_RandomBuffer_System_crypto_random(a.data(), len);
+    Lib_RandomBuffer_System_crypto_random(b.data(), len);
+    if (len >= 16) {
+      EXPECT_NE(a, bytes(len, 0));
+      EXPECT_NE(a, b);
+    }
+  }
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+TEST(RandomSuite, Fork)
+{
+  // Make sure the buffer of this thread is partially consumed.
+  uint8_t warmup[16];
+  ASSERT_TRUE(EverCrypt_Random_bytes(warmup, sizeof(warmup)));
+
+  uint8_t system_warmup[16];
+  Lib_RandomBuffer_System_crypto_random(system_warmup, sizeof(system_warmup));
+
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    uint8_t child[64] = { 0 };
+    bool ok = EverCrypt_Random_bytes(child, 32);
+    Lib_RandomBuffer_System_crypto_random(child + 32, 32);
+    ssize_t written = write(fds[1], child, sizeof(child));
+    _exit(ok && written == (ssize_t)sizeof(child) ? 0 : 1);
+  }
+  close(fds[1]);
+  bytes parent(64);
+  ASSERT_TRUE(EverCrypt_Random_bytes(parent.data(), 32));
+  Lib_RandomBuffer_System_crypto_random(parent.data() + 32, 32);
+  bytes child(64);
+  ASSERT_EQ(read(fds[0], child.data(), child.size()), (ssize_t)child.size());
+  close(fds[0]);
+  int status = 0;
+  waitpid(pid, &status, 0);
+  EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+  EXPECT_NE(bytes(parent.begin(), parent.begin() + 32),
+            bytes(child.begin(), child.begin() + 32));
+  EXPECT_NE(bytes(parent.begin() + 32, parent.end()),
+            bytes(child.begin() + 32, child.end()));
+}
+#endif
+
 typedef struct
 {
   string hash;
@@ -332,6 +510,59 @@ TEST_P(DrbgPRTrueSuite, KAT)
   // TODO: Does it provide predictive resistance?
 }
 
+// The AES-256 CTR_DRBG (no derivation function) is checked with vectors in
+// the CAVP layout. COUNT 0 of the no-reseed file is the first CAVP vector for
+// [AES-256 no df]; the others were generated with OpenSSL's CTR-DRBG to cover
+// the personalization string, additional input and reseed paths.
+class DrbgAes256CtrSuite : public ::testing::TestWithParam<CAVPTestCase>
+{
+  void SetUp() override
+  {
+    hacl_init_cpu_features();
+    EverCrypt_AutoConfig2_init();
+  }
+};
+
+TEST_P(DrbgAes256CtrSuite, KAT)
+{
+  auto test = GetParam();
+
+  EverCrypt_DRBG_state_s* st = EverCrypt_DRBG_create_aes256_ctr();
+  if (st == NULL) {
+    cout << "AES-NI is not available. Skipping." << endl;
+    return;
+  }
+
+  // Init
+  ASSERT_TRUE(EverCrypt_DRBG_instantiate_aes256_ctr_with_entropy(
+    st,
+    test.EntropyInput.data(),
+    test.PersonalizationString.data(),
+    test.PersonalizationString.size()));
+
+  // Reseed
+  if (!test.EntropyInputReseed.empty()) {
+    ASSERT_TRUE(EverCrypt_DRBG_reseed_aes256_ctr_with_entropy(
+      st,
+      test.EntropyInputReseed.data(),
+      test.AdditionalInputReseed.data(),
+      test.AdditionalInputReseed.size()));
+  }
+
+  // Generate
+  bytes got_ReturnedBits = bytes(test.ReturnedBits.size());
+  for (auto additional : test.AdditionalInput) {
+    EXPECT_TRUE(EverCrypt_DRBG_generate(got_ReturnedBits.data(),
+                                        st,
+                                        got_ReturnedBits.size(),
+                                        additional.data(),
+                                        additional.size()));
+  }
+  EverCrypt_DRBG_uninstantiate(st);
+
+  ASSERT_EQ(test.ReturnedBits, got_ReturnedBits);
+}
+
 vector<CAVPTestCase>
 read_json_cavp(char* path)
 {
@@ -344,7 +575,10 @@ read_json_cavp(char* path)
   for (auto& test_raw : tests_raw.items()) {
     auto test = test_raw.value();
 
-    string hash = test["hash"];
+    string hash;
+    if (test.contains("hash")) {
+      hash = test["hash"];
+    }
     vector<bytes> AdditionalInput = vector<bytes>();
     for (auto ai_raw : test["AdditionalInput"].items()) {
       string ai = ai_raw.value();
@@ -409,3 +643,15 @@ INSTANTIATE_TEST_SUITE_P(CAVPPrTrue,
                          DrbgPRTrueSuite,
                          ::testing::ValuesIn(read_json_cavp(
                            const_cast<char*>("DRBG_CAVP_pr_true.json"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  Aes256CtrNoReseed,
+  DrbgAes256CtrSuite,
+  ::testing::ValuesIn(
+    read_json_cavp(const_cast<char*>("CTR_DRBG_AES256_no_reseed.json"))));
+
+INSTANTIATE_TEST_SUITE_P(
+  Aes256CtrPrFalse,
+  DrbgAes256CtrSuite,
+  ::testing::ValuesIn(
+    read_json_cavp(const_cast<char*>("CTR_DRBG_AES256_pr_false.json"))));
@@ -8,6 +8,9 @@
 
 #include <gtest/gtest.h>
 
+#include "EverCrypt_Dispatch.h"
+#include "EverCrypt_Poly1305.h"
+#include "Hacl_MAC_Poly1305.h"
 #include "evercrypt.h"
 #include "util.h"
 
@@ -58,6 +61,54 @@ TEST_P(EverCryptSuiteDummy, CheckDisabledFeatures)
   }
 }
 
+TEST_P(EverCryptSuiteDummy, DispatchFollowsFeatures)
+{
+  // Changing the features in SetUp() must have re-resolved the dispatch table.
+  EverCryptConfig config;
+  string name;
+  tie(config, name) = this->GetParam();
+
+  EverCrypt_Dispatch_impl chachapoly =
+    EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_CHACHA20_POLY1305);
+  EverCrypt_Dispatch_impl poly =
+    EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_POLY1305);
+  EverCrypt_Dispatch_impl curve =
+    EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_CURVE25519);
+  EverCrypt_Dispatch_impl sha256 =
+    EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_SHA2_256);
+  EverCrypt_Dispatch_impl bignum =
+    EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_BIGNUM);
+
+  if (!EverCrypt_AutoConfig2_has_vec256()) {
+    EXPECT_NE(chachapoly, EverCrypt_Dispatch_Vec256);
+    EXPECT_NE(poly, EverCrypt_Dispatch_Vec256);
+  }
+  if (!EverCrypt_AutoConfig2_has_vec128()) {
+    EXPECT_NE(chachapoly, EverCrypt_Dispatch_Vec128);
+    EXPECT_NE(poly, EverCrypt_Dispatch_Vec128);
+  }
+  if (config.disable_adx || config.disable_bmi2) {
+    EXPECT_EQ(curve, EverCrypt_Dispatch_Portable);
+    EXPECT_EQ(bignum, EverCrypt_Dispatch_Portable);
+  }
+  if (config.disable_shaext || config.disable_sse) {
+    EXPECT_EQ(sha256, EverCrypt_Dispatch_Portable);
+  }
+  EXPECT_STRNE(EverCrypt_Dispatch_impl_name(chachapoly), "unknown");
+
+  // Whatever was chosen computes the same MAC.
+  bytes key(32), msg(1000), expected(16), got(16);
+  for (size_t i = 0; i < msg.size(); i++) {
+    msg[i] = i & 0xff;
+  }
+  for (size_t i = 0; i < key.size(); i++) {
+    key[i] = (uint8_t)(i * 7);
+  }
+  Hacl_MAC_Poly1305_mac(expected.data(), msg.data(), msg.size(), key.data());
+  EverCrypt_Poly1305_mac(got.data(), msg.data(), msg.size(), key.data());
+  EXPECT_EQ(got, expected);
+}
+
 INSTANTIATE_TEST_SUITE_P(
   Exhaustive,
   EverCryptSuiteDummy,
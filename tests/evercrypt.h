@@ -10,6 +10,7 @@
 #include <ostream>
 
 #include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
 
 using namespace std;
 
@@ -99,6 +100,7 @@ private:
     if (config.disable_sse) {
       EverCrypt_AutoConfig2_disable_sse();
     }
+    EverCrypt_Dispatch_refresh();
   }
 };
 
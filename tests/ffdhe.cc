@@ -0,0 +1,117 @@
+/*
+ *    Copyright 2023 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
+#include "EverCrypt_FFDHE.h"
+#include "Hacl_FFDHE.h"
+#include "util.h"
+
+using namespace std;
+
+class FFDHE : public ::testing::TestWithParam<Spec_FFDHE_ffdhe_alg>
+{};
+
+// The public key uses a fixed-base comb for the generator, while the shared
+// secret goes through the generic exponentiation. Raising 2 to the secret key
+// with the latter must give back the public key.
+TEST_P(FFDHE, FixedBaseMatchesGeneric)
+{
+  Spec_FFDHE_ffdhe_alg alg = GetParam();
+  uint32_t len = Hacl_FFDHE_ffdhe_len(alg);
+
+  for (int i = 0; i < 4; i++) {
+    bytes sk(len), pk(len), g(len, 0), expected(len);
+    generate_random(sk.data(), len);
+    sk[0] &= 0x7f;
+    g[len - 1] = 2;
+
+    Hacl_FFDHE_ffdhe_secret_to_public(alg, sk.data(), pk.data());
+    EXPECT_EQ(
+      Hacl_FFDHE_ffdhe_shared_secret(alg, sk.data(), g.data(), expected.data()),
+      0xFFFFFFFFFFFFFFFFULL);
+    EXPECT_EQ(pk, expected);
+  }
+}
+
+// EverCrypt_FFDHE may take the IFMA exponentiation; it must agree with the
+// portable Hacl_FFDHE whichever implementation is dispatched.
+TEST_P(FFDHE, EverCryptMatchesHacl)
+{
+  Spec_FFDHE_ffdhe_alg alg = GetParam();
+  uint32_t len = Hacl_FFDHE_ffdhe_len(alg);
+  uint64_t* p_r2_n = Hacl_FFDHE_new_ffdhe_precomp_p(alg);
+  ASSERT_NE(p_r2_n, (uint64_t*)nullptr);
+
+  for (int portable = 0; portable < 2; portable++) {
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (portable) {
+      EverCrypt_AutoConfig2_disable_avx512ifma();
+      EverCrypt_Dispatch_refresh();
+      EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_MOD_EXP),
+                EverCrypt_Dispatch_Portable);
+    }
+
+    bytes sk1(len), sk2(len), pk1(len), pk2(len), ss(len);
+    bytes expected_pk(len), expected_ss(len);
+    generate_random(sk1.data(), len);
+    generate_random(sk2.data(), len);
+    sk1[0] &= 0x7f;
+    sk2[0] &= 0x7f;
+
+    EverCrypt_FFDHE_ffdhe_secret_to_public_precomp(
+      alg, p_r2_n, sk1.data(), pk1.data());
+    Hacl_FFDHE_ffdhe_secret_to_public(alg, sk1.data(), expected_pk.data());
+    EXPECT_EQ(pk1, expected_pk);
+
+    Hacl_FFDHE_ffdhe_secret_to_public(alg, sk2.data(), pk2.data());
+    EXPECT_EQ(EverCrypt_FFDHE_ffdhe_shared_secret_precomp(
+                alg, p_r2_n, sk1.data(), pk2.data(), ss.data()),
+              0xFFFFFFFFFFFFFFFFULL);
+    EXPECT_EQ(Hacl_FFDHE_ffdhe_shared_secret(
+                alg, sk1.data(), pk2.data(), expected_ss.data()),
+              0xFFFFFFFFFFFFFFFFULL);
+    EXPECT_EQ(ss, expected_ss);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  free(p_r2_n);
+}
+
+TEST_P(FFDHE, SharedSecret)
+{
+  Spec_FFDHE_ffdhe_alg alg = GetParam();
+  uint32_t len = Hacl_FFDHE_ffdhe_len(alg);
+
+  bytes sk1(len), sk2(len), pk1(len), pk2(len), ss1(len), ss2(len);
+  generate_random(sk1.data(), len);
+  generate_random(sk2.data(), len);
+  sk1[0] &= 0x7f;
+  sk2[0] &= 0x7f;
+
+  Hacl_FFDHE_ffdhe_secret_to_public(alg, sk1.data(), pk1.data());
+  Hacl_FFDHE_ffdhe_secret_to_public(alg, sk2.data(), pk2.data());
+  EXPECT_EQ(
+    Hacl_FFDHE_ffdhe_shared_secret(alg, sk1.data(), pk2.data(), ss1.data()),
+    0xFFFFFFFFFFFFFFFFULL);
+  EXPECT_EQ(
+    Hacl_FFDHE_ffdhe_shared_secret(alg, sk2.data(), pk1.data(), ss2.data()),
+    0xFFFFFFFFFFFFFFFFULL);
+  EXPECT_EQ(ss1, ss2);
+}
+
+INSTANTIATE_TEST_SUITE_P(Groups,
+                         FFDHE,
+                         ::testing::Values(Spec_FFDHE_FFDHE2048,
+                                           Spec_FFDHE_FFDHE3072,
+                                           Spec_FFDHE_FFDHE4096,
+                                           Spec_FFDHE_FFDHE6144,
+                                           Spec_FFDHE_FFDHE8192));
@@ -0,0 +1,363 @@
+/*
+ *    Copyright 2023 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
+#include "Hacl_Frodo1344.h"
+#include "Hacl_Frodo1344_AES.h"
+#include "Hacl_Frodo640.h"
+#include "Hacl_Frodo640_AES.h"
+#include "Hacl_Frodo64.h"
+#include "Hacl_Frodo976.h"
+#include "Hacl_Frodo976_AES.h"
+#include "Hacl_Hash_SHA3.h"
+#include "util.h"
+
+using namespace std;
+
+// Falls back to the portable FrodoKEM kernels.
+static void
+disable_simd()
+{
+  EverCrypt_AutoConfig2_disable_avx2();
+  EverCrypt_AutoConfig2_disable_aesni();
+  EverCrypt_Dispatch_refresh();
+  EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_FRODO),
+            EverCrypt_Dispatch_Portable);
+  EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_FRODO_AES),
+            EverCrypt_Dispatch_Portable);
+}
+
+struct FrodoKem
+{
+  const char* name;
+  uint32_t* publickeybytes;
+  uint32_t* secretkeybytes;
+  uint32_t* ciphertextbytes;
+  uint32_t (*keypair)(uint8_t* pk, uint8_t* sk);
+  uint32_t (*enc)(uint8_t* ct, uint8_t* ss, uint8_t* pk);
+  uint32_t (*dec)(uint8_t* ss, uint8_t* ct, uint8_t* sk);
+  uint32_t (*scratch_size)(void);
+  uint32_t (*keypair_scratch)(uint8_t* pk, uint8_t* sk, uint16_t* scratch);
+  uint32_t (*enc_scratch)(uint8_t* ct,
+                          uint8_t* ss,
+                          uint8_t* pk,
+                          uint16_t* scratch);
+  uint32_t (*dec_scratch)(uint8_t* ss,
+                          uint8_t* ct,
+                          uint8_t* sk,
+                          uint16_t* scratch);
+};
+
+ostream&
+operator<<(ostream& os, const FrodoKem& kem)
+{
+  return os << kem.name;
+}
+
+class Frodo : public ::testing::TestWithParam<FrodoKem>
+{};
+
+// The matrix A is generated and multiplied in row blocks, with AVX2 and AES-NI
+// kernels when available. Every combination of the vectorized and portable code for
+// key generation, encapsulation and decapsulation must agree.
+TEST_P(Frodo, Roundtrip)
+{
+  FrodoKem kem = GetParam();
+
+  for (int mask = 0; mask < 8; mask++) {
+    bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+      ct(*kem.ciphertextbytes), ss1(32), ss2(32);
+
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (mask & 1) {
+      disable_simd();
+    }
+    EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (mask & 2) {
+      disable_simd();
+    }
+    EXPECT_EQ(kem.enc(ct.data(), ss1.data(), pk.data()), 0);
+
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (mask & 4) {
+      disable_simd();
+    }
+    EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss1, ss2) << "mask = " << mask;
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+// A modified ciphertext decapsulates to an unrelated, pseudorandom key.
+TEST_P(Frodo, ImplicitRejection)
+{
+  FrodoKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+    ct(*kem.ciphertextbytes), ss1(32), ss2(32), ss3(32);
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+  EXPECT_EQ(kem.enc(ct.data(), ss1.data(), pk.data()), 0);
+
+  ct[0] ^= 1;
+  EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_EQ(kem.dec(ss3.data(), ct.data(), sk.data()), 0);
+  EXPECT_NE(ss1, ss2);
+  EXPECT_EQ(ss2, ss3);
+}
+
+// The scratch variants work in a single caller-provided arena and interoperate
+// with the stack-allocating functions.
+TEST_P(Frodo, Scratch)
+{
+  FrodoKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  uint32_t size = kem.scratch_size();
+  EXPECT_EQ(size % 2, 0);
+  vector<uint16_t> scratch(size / 2);
+  bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+    ct(*kem.ciphertextbytes), ss1(32), ss2(32);
+
+  EXPECT_EQ(kem.keypair_scratch(pk.data(), sk.data(), scratch.data()), 0);
+  EXPECT_EQ(kem.enc(ct.data(), ss1.data(), pk.data()), 0);
+  EXPECT_EQ(kem.dec_scratch(ss2.data(), ct.data(), sk.data(), scratch.data()),
+            0);
+  EXPECT_EQ(ss1, ss2);
+
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+  EXPECT_EQ(
+    kem.enc_scratch(ct.data(), ss1.data(), pk.data(), scratch.data()), 0);
+  EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_EQ(ss1, ss2);
+
+  ct[0] ^= 1;
+  bytes ss3(32);
+  EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+  EXPECT_EQ(kem.dec_scratch(ss3.data(), ct.data(), sk.data(), scratch.data()),
+            0);
+  EXPECT_EQ(ss2, ss3);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  FrodoKEM,
+  Frodo,
+  ::testing::Values(FrodoKem{ "Frodo64",
+                              &Hacl_Frodo64_crypto_publickeybytes,
+                              &Hacl_Frodo64_crypto_secretkeybytes,
+                              &Hacl_Frodo64_crypto_ciphertextbytes,
+                              Hacl_Frodo64_crypto_kem_keypair,
+                              Hacl_Frodo64_crypto_kem_enc,
+                              Hacl_Frodo64_crypto_kem_dec,
+                              Hacl_Frodo64_scratch_size,
+                              Hacl_Frodo64_crypto_kem_keypair_scratch,
+                              Hacl_Frodo64_crypto_kem_enc_scratch,
+                              Hacl_Frodo64_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo640",
+                              &Hacl_Frodo640_crypto_publickeybytes,
+                              &Hacl_Frodo640_crypto_secretkeybytes,
+                              &Hacl_Frodo640_crypto_ciphertextbytes,
+                              Hacl_Frodo640_crypto_kem_keypair,
+                              Hacl_Frodo640_crypto_kem_enc,
+                              Hacl_Frodo640_crypto_kem_dec,
+                              Hacl_Frodo640_scratch_size,
+                              Hacl_Frodo640_crypto_kem_keypair_scratch,
+                              Hacl_Frodo640_crypto_kem_enc_scratch,
+                              Hacl_Frodo640_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo976",
+                              &Hacl_Frodo976_crypto_publickeybytes,
+                              &Hacl_Frodo976_crypto_secretkeybytes,
+                              &Hacl_Frodo976_crypto_ciphertextbytes,
+                              Hacl_Frodo976_crypto_kem_keypair,
+                              Hacl_Frodo976_crypto_kem_enc,
+                              Hacl_Frodo976_crypto_kem_dec,
+                              Hacl_Frodo976_scratch_size,
+                              Hacl_Frodo976_crypto_kem_keypair_scratch,
+                              Hacl_Frodo976_crypto_kem_enc_scratch,
+                              Hacl_Frodo976_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo1344",
+                              &Hacl_Frodo1344_crypto_publickeybytes,
+                              &Hacl_Frodo1344_crypto_secretkeybytes,
+                              &Hacl_Frodo1344_crypto_ciphertextbytes,
+                              Hacl_Frodo1344_crypto_kem_keypair,
+                              Hacl_Frodo1344_crypto_kem_enc,
+                              Hacl_Frodo1344_crypto_kem_dec,
+                              Hacl_Frodo1344_scratch_size,
+                              Hacl_Frodo1344_crypto_kem_keypair_scratch,
+                              Hacl_Frodo1344_crypto_kem_enc_scratch,
+                              Hacl_Frodo1344_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo640_AES",
+                              &Hacl_Frodo640_AES_crypto_publickeybytes,
+                              &Hacl_Frodo640_AES_crypto_secretkeybytes,
+                              &Hacl_Frodo640_AES_crypto_ciphertextbytes,
+                              Hacl_Frodo640_AES_crypto_kem_keypair,
+                              Hacl_Frodo640_AES_crypto_kem_enc,
+                              Hacl_Frodo640_AES_crypto_kem_dec,
+                              Hacl_Frodo640_AES_scratch_size,
+                              Hacl_Frodo640_AES_crypto_kem_keypair_scratch,
+                              Hacl_Frodo640_AES_crypto_kem_enc_scratch,
+                              Hacl_Frodo640_AES_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo976_AES",
+                              &Hacl_Frodo976_AES_crypto_publickeybytes,
+                              &Hacl_Frodo976_AES_crypto_secretkeybytes,
+                              &Hacl_Frodo976_AES_crypto_ciphertextbytes,
+                              Hacl_Frodo976_AES_crypto_kem_keypair,
+                              Hacl_Frodo976_AES_crypto_kem_enc,
+                              Hacl_Frodo976_AES_crypto_kem_dec,
+                              Hacl_Frodo976_AES_scratch_size,
+                              Hacl_Frodo976_AES_crypto_kem_keypair_scratch,
+                              Hacl_Frodo976_AES_crypto_kem_enc_scratch,
+                              Hacl_Frodo976_AES_crypto_kem_dec_scratch },
+                    FrodoKem{ "Frodo1344_AES",
+                              &Hacl_Frodo1344_AES_crypto_publickeybytes,
+                              &Hacl_Frodo1344_AES_crypto_secretkeybytes,
+                              &Hacl_Frodo1344_AES_crypto_ciphertextbytes,
+                              Hacl_Frodo1344_AES_crypto_kem_keypair,
+                              Hacl_Frodo1344_AES_crypto_kem_enc,
+                              Hacl_Frodo1344_AES_crypto_kem_dec,
+                              Hacl_Frodo1344_AES_scratch_size,
+                              Hacl_Frodo1344_AES_crypto_kem_keypair_scratch,
+                              Hacl_Frodo1344_AES_crypto_kem_enc_scratch,
+                              Hacl_Frodo1344_AES_crypto_kem_dec_scratch }));
+
+// The first entry of the reference KAT files (PQCkemKAT_*.rsp), for
+// count = 0: the NIST randombytes generator, seeded with
+// 061550234d158c5ec95595fe04ef7a25767f2e24cc2bc479d09d86dc9abcfde7
+// 056a8c266f9ef97ed08541dbd2e1ffa1, outputs the key pair coins and then mu.
+struct FrodoKat
+{
+  const char* name;
+  uint32_t* publickeybytes;
+  uint32_t* secretkeybytes;
+  uint32_t* ciphertextbytes;
+  uint32_t (*dec)(uint8_t* ss, uint8_t* ct, uint8_t* sk);
+  void (*keypair_derand)(uint8_t* pk, uint8_t* sk, uint8_t* coins);
+  uint32_t (*enc_derand)(uint8_t* ct, uint8_t* ss, uint8_t* pk, uint8_t* coins);
+  const char* coins;
+  const char* mu;
+  // SHA3-256(pk || sk || ct || ss), and ss itself.
+  const char* digest;
+  const char* ss;
+};
+
+ostream&
+operator<<(ostream& os, const FrodoKat& kat)
+{
+  return os << kat.name;
+}
+
+class FrodoKnownAnswer : public ::testing::TestWithParam<FrodoKat>
+{};
+
+TEST_P(FrodoKnownAnswer, Kat)
+{
+  FrodoKat kat = GetParam();
+
+  // Portable and vectorized code compute exactly the same values.
+  for (int simd = 0; simd < 2; simd++) {
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (!simd) {
+      disable_simd();
+    }
+    bytes pk(*kat.publickeybytes), sk(*kat.secretkeybytes),
+      ct(*kat.ciphertextbytes), ss(strlen(kat.ss) / 2), digest(32);
+    bytes coins = from_hex(kat.coins), mu = from_hex(kat.mu);
+    kat.keypair_derand(pk.data(), sk.data(), coins.data());
+    EXPECT_EQ(kat.enc_derand(ct.data(), ss.data(), pk.data(), mu.data()), 0);
+
+    bytes all;
+    all.insert(all.end(), pk.begin(), pk.end());
+    all.insert(all.end(), sk.begin(), sk.end());
+    all.insert(all.end(), ct.begin(), ct.end());
+    all.insert(all.end(), ss.begin(), ss.end());
+    Hacl_Hash_SHA3_sha3_256(digest.data(), all.data(), all.size());
+    EXPECT_EQ(bytes_to_hex(digest), kat.digest) << "simd = " << simd;
+    EXPECT_EQ(bytes_to_hex(ss), kat.ss) << "simd = " << simd;
+
+    bytes ss2(ss.size());
+    EXPECT_EQ(kat.dec(ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss, ss2);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+#define FRODO_KAT_PARAMS(N)                                                    \
+  &Hacl_Frodo##N##_crypto_publickeybytes,                                      \
+    &Hacl_Frodo##N##_crypto_secretkeybytes,                                    \
+    &Hacl_Frodo##N##_crypto_ciphertextbytes, Hacl_Frodo##N##_crypto_kem_dec,   \
+    Hacl_Frodo##N##_crypto_kem_keypair_derand,                                 \
+    Hacl_Frodo##N##_crypto_kem_enc_derand
+
+#define FRODO640_COINS                                                         \
+  "7c9935a0b07694aa0c6d10e4db6b1add2fd81a25ccb148032dcd739936737f2db505d7cfad" \
+  "1b497499323c8686325e47"
+#define FRODO640_MU "33b3c07507e4201748494d832b6ee2a6"
+#define FRODO976_COINS                                                         \
+  "7c9935a0b07694aa0c6d10e4db6b1add2fd81a25ccb148032dcd739936737f2db505d7cfad" \
+  "1b497499323c8686325e4792f267aafa3f87ca60d01cb54f29202a"
+#define FRODO976_MU "eb4a7c66ef4eba2ddb38c88d8bc706b1d639002198172a7b"
+#define FRODO1344_COINS                                                        \
+  "7c9935a0b07694aa0c6d10e4db6b1add2fd81a25ccb148032dcd739936737f2db505d7cfad" \
+  "1b497499323c8686325e4792f267aafa3f87ca60d01cb54f29202a3e784ccb7ebcdcfd4554" \
+  "2b7f6af77874"
+#define FRODO1344_MU                                                           \
+  "8bf0f459f0fb3ea8d32764c259ae631178976baf3683d33383188a65a4c2449b"
+
+INSTANTIATE_TEST_SUITE_P(
+  FrodoKEM,
+  FrodoKnownAnswer,
+  ::testing::Values(
+    FrodoKat{ "Frodo640",
+              FRODO_KAT_PARAMS(640),
+              FRODO640_COINS,
+              FRODO640_MU,
+              "e378bf8c87fc01d2ce0900a2996dbe8a56ca2b12f056e8e1dda3d3c117ba8707",
+              "729780fc51657e21357f03a338116569" },
+    FrodoKat{ "Frodo640_AES",
+              FRODO_KAT_PARAMS(640_AES),
+              FRODO640_COINS,
+              FRODO640_MU,
+              "3374c609ca6d0b5c822a21496e27fff9b7c2dce368bab5e92c1a15db097fd2bf",
+              "9f54377d452090f3631e45b9399a2892" },
+    FrodoKat{ "Frodo976",
+              FRODO_KAT_PARAMS(976),
+              FRODO976_COINS,
+              FRODO976_MU,
+              "ecd8dd305de0dd4347617c0c239728c9f3a4a8660532a3793d74f2babc5e7320",
+              "a98165539a4aad979023d67b435d316f007c86eeafdb63c7" },
+    FrodoKat{ "Frodo976_AES",
+              FRODO_KAT_PARAMS(976_AES),
+              FRODO976_COINS,
+              FRODO976_MU,
+              "99e9a498893da8d6e1bbfcaf199091a25908785a00c9e04332ee5c5698079abe",
+              "594de84473b3408e35f6c4d1f2f2ec3b56d2dda96fa23496" },
+    FrodoKat{ "Frodo1344",
+              FRODO_KAT_PARAMS(1344),
+              FRODO1344_COINS,
+              FRODO1344_MU,
+              "7b01597ec2d264a70bc99ac3e0232c75bd4f913da61c7eb5ad8e0adfb84ec810",
+              "6d69df1a90968eabada69cd30ec6813a4406309dac174429a0120852bf826460" },
+    FrodoKat{ "Frodo1344_AES",
+              FRODO_KAT_PARAMS(1344_AES),
+              FRODO1344_COINS,
+              FRODO1344_MU,
+              "5554785b122418ff68e55c4deb9ead207a007b824aa292d3509a562efc0edddb",
+              "b243fe6d7c9b3829252d5aec090a4709f5e396fdefe4ef1aa4ae6c9498cbce15" }));
@@ -351,6 +351,89 @@ TEST_P(GenericFieldSuite, Toy64)
 #endif
 }
 
+TEST_P(GenericFieldSuite, BatchInverseMultiExp64)
+{
+  hacl_init_cpu_features();
+
+  TestCase test = GetParam();
+
+#ifdef HACL_CAN_COMPILE_VEC128
+  if (hacl_vec128_support()) {
+    uint32_t len = test.limbs64;
+    uint64_t* n = new_bn_64(test.n);
+    Hacl_Bignum_MontArithmetic_bn_mont_ctx_u64* ctx =
+      Hacl_GenericField64_field_init(len, n);
+
+    uint64_t* aM = new_M_64(ctx, test.a, len);
+    uint64_t* b = new_bn_64(test.b);
+    uint32_t bLen = test.bBits == 0 ? 1 : (test.bBits - 1) / 64 + 1;
+
+    // More elements than fit in one multi-exponentiation chunk:
+    // xM[i] = a ^ (i + 1), with exponents b + i.
+    const uint32_t count = 11;
+    vector<uint64_t> xM(count * len), invM(count * len), e(count * bLen);
+    vector<uint64_t> oneM(len), rM(len), expected(len), tM(len);
+    Hacl_GenericField64_one(ctx, oneM.data());
+    memcpy(xM.data(), aM, len * 8);
+    for (uint32_t i = 1; i < count; i++) {
+      Hacl_GenericField64_mul(
+        ctx, xM.data() + (i - 1) * len, aM, xM.data() + i * len);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      memcpy(e.data() + i * bLen, b, bLen * 8);
+      e[i * bLen] ^= i;
+    }
+
+    // batch inverse
+    {
+      Hacl_GenericField64_batch_inverse(ctx, count, xM.data(), invM.data());
+
+      vector<uint64_t> r(len);
+      Hacl_GenericField64_from_field(ctx, invM.data(), r.data());
+      uint64_t* inv = new_bn_64(test.inv);
+      EXPECT_EQ(memcmp(r.data(), inv, len * 8), 0);
+      free(inv);
+
+      for (uint32_t i = 0; i < count; i++) {
+        Hacl_GenericField64_mul(
+          ctx, xM.data() + i * len, invM.data() + i * len, rM.data());
+        EXPECT_EQ(rM, oneM) << "i = " << i;
+      }
+    }
+
+    // multi exp, checked against the product of single exponentiations
+    uint32_t eBits = test.bBits < 4 ? 4 : test.bBits;
+    uint32_t eLen = (eBits - 1) / 64 + 1;
+    ASSERT_EQ(eLen, bLen);
+    for (uint32_t c : { 1u, count }) {
+      memcpy(expected.data(), oneM.data(), len * 8);
+      for (uint32_t i = 0; i < c; i++) {
+        Hacl_GenericField64_exp_vartime(
+          ctx, xM.data() + i * len, eBits, e.data() + i * bLen, tM.data());
+        Hacl_GenericField64_mul(ctx, expected.data(), tM.data(), expected.data());
+      }
+
+      Hacl_GenericField64_multi_exp_consttime(
+        ctx, c, xM.data(), eBits, e.data(), rM.data());
+      EXPECT_EQ(rM, expected) << "count = " << c;
+
+      Hacl_GenericField64_multi_exp_vartime(
+        ctx, c, xM.data(), eBits, e.data(), rM.data());
+      EXPECT_EQ(rM, expected) << "count = " << c;
+    }
+
+    free(b);
+    free(aM);
+    Hacl_GenericField64_field_free(ctx);
+    free(n);
+  } else {
+    cout << "CPU does not support VEC128." << endl;
+  }
+#else
+  cout << "VEC128 not compiled." << endl;
+#endif
+}
+
 // -----------------------------------------------------------------------------
 
 vector<TestCase>
@@ -372,6 +372,116 @@ read_json_wycheproof(string path)
   return tests;
 }
 
+// ----- Keyed contexts and Expand-Label ---------------------------------------
+
+static bytes
+hkdf_label(const char* label, bytes context, uint32_t len)
+{
+  std::string full = std::string("tls13 ") + label;
+  bytes info = { (uint8_t)(len >> 8), (uint8_t)len, (uint8_t)full.size() };
+  info.insert(info.end(), full.begin(), full.end());
+  info.push_back((uint8_t)context.size());
+  info.insert(info.end(), context.begin(), context.end());
+  return info;
+}
+
+TEST(HKDFContextSuite, Rfc8448HandshakeKeys)
+{
+  EverCrypt_AutoConfig2_init();
+
+  // RFC 8448, Section 3: {server} derive write traffic keys for handshake data.
+  bytes secret = from_hex(
+    "b67b7d690cc16c4e75e54213cb2d37b4e9c912bcded9105d42befd59d391ad38");
+  EverCrypt_HKDF_context_t* ctx = EverCrypt_HKDF_malloc_context(
+    Spec_Hash_Definitions_SHA2_256, secret.data(), secret.size());
+  ASSERT_NE(ctx, nullptr);
+
+  bytes key(16);
+  bytes iv(12);
+  EverCrypt_HKDF_label_t labels[2] = {
+    { key.data(), (uint8_t*)"key", 3, NULL, 0, 16 },
+    { iv.data(), (uint8_t*)"iv", 2, NULL, 0, 12 },
+  };
+  EverCrypt_HKDF_expand_label_batch(ctx, labels, 2);
+  EXPECT_EQ(key, from_hex("3fce516009c21727d0f2e4e86ee403bc"));
+  EXPECT_EQ(iv, from_hex("5d313eb2671276ee13000b30"));
+
+  EverCrypt_HKDF_free_context(ctx);
+}
+
+TEST(HKDFContextSuite, ExpandLabelBatch)
+{
+  EverCrypt_AutoConfig2_init();
+
+  const Spec_Hash_Definitions_hash_alg algs[] = {
+    Spec_Hash_Definitions_SHA1,     Spec_Hash_Definitions_SHA2_256,
+    Spec_Hash_Definitions_SHA2_384, Spec_Hash_Definitions_SHA2_512,
+    Spec_Hash_Definitions_Blake2S,  Spec_Hash_Definitions_Blake2B,
+  };
+  // A QUIC-like schedule: equal-length labels share SIMD lanes, the rest
+  // (and anything longer than one hash block) takes the scalar path.
+  const char* names[] = { "key",      "iv",       "hp",       "ku",
+                          "quic key", "quic iv",  "quic hp",  "c hs traffic",
+                          "s hs traffic", "finished", "derived", "res binder" };
+  const uint32_t lens[] = { 16, 12, 16, 32, 32, 12, 16, 32, 32, 32, 48, 100 };
+  const size_t n = sizeof(lens) / sizeof(lens[0]);
+  bytes context = from_hex(
+    "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+  for (auto alg : algs) {
+    bytes prk(Hacl_Hash_Definitions_hash_len(alg));
+    for (size_t i = 0; i < prk.size(); i++) {
+      prk[i] = (uint8_t)(i * 3 + 1);
+    }
+    EverCrypt_HKDF_context_t* ctx =
+      EverCrypt_HKDF_malloc_context(alg, prk.data(), prk.size());
+    ASSERT_NE(ctx, nullptr);
+
+    std::vector<bytes> got(n);
+    std::vector<EverCrypt_HKDF_label_t> labels(n);
+    for (size_t i = 0; i < n; i++) {
+      got[i] = bytes(lens[i]);
+      // Alternate between an empty and a transcript-hash context.
+      uint32_t context_len = (i % 2 == 0) ? 0 : context.size();
+      labels[i] = { got[i].data(),     (uint8_t*)names[i],
+                    (uint32_t)strlen(names[i]), context.data(),
+                    context_len,       lens[i] };
+    }
+    EverCrypt_HKDF_expand_label_batch(ctx, labels.data(), n);
+
+    for (size_t i = 0; i < n; i++) {
+      bytes info = hkdf_label(
+        names[i],
+        bytes(context.begin(), context.begin() + labels[i].context_len),
+        lens[i]);
+      bytes expected(lens[i]);
+      EverCrypt_HKDF_expand(alg,
+                            expected.data(),
+                            prk.data(),
+                            prk.size(),
+                            info.data(),
+                            info.size(),
+                            lens[i]);
+      EXPECT_EQ(got[i], expected) << "alg " << alg << " label " << names[i];
+
+      bytes single(lens[i]);
+      EverCrypt_HKDF_expand_label(ctx,
+                                  single.data(),
+                                  (uint8_t*)names[i],
+                                  strlen(names[i]),
+                                  context.data(),
+                                  labels[i].context_len,
+                                  lens[i]);
+      EXPECT_EQ(single, expected);
+    }
+
+    EverCrypt_HKDF_free_context(ctx);
+  }
+
+  EXPECT_EQ(EverCrypt_HKDF_malloc_context(Spec_Hash_Definitions_MD5, NULL, 0),
+            nullptr);
+}
+
 // -----------------------------------------------------------------------------
 
 INSTANTIATE_TEST_SUITE_P(
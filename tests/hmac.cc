@@ -7,6 +7,7 @@
  */
 #include <fstream>
 #include <gtest/gtest.h>
+#include <thread>
 #include <nlohmann/json.hpp>
 
 #include "EverCrypt_HMAC.h"
@@ -254,6 +255,193 @@ TEST_P(HMACEverCryptSuite, KAT)
   }
 }
 
+// ----- Precomputed keys ------------------------------------------------------
+
+static const Spec_Hash_Definitions_hash_alg hmac_key_algs[] = {
+  Spec_Hash_Definitions_SHA1,        Spec_Hash_Definitions_SHA2_256,
+  Spec_Hash_Definitions_SHA2_384,    Spec_Hash_Definitions_SHA2_512,
+  Spec_Hash_Definitions_Blake2S,     Spec_Hash_Definitions_Blake2B,
+};
+
+TEST(HMACKeySuite, ComputeWithKey)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes data(300);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = (uint8_t)(i * 7 + 3);
+  }
+  bytes key(200);
+  for (size_t i = 0; i < key.size(); i++) {
+    key[i] = (uint8_t)(i * 13 + 1);
+  }
+
+  for (auto alg : hmac_key_algs) {
+    for (uint32_t key_len : { 0, 1, 32, 64, 65, 128, 129, 200 }) {
+      EverCrypt_HMAC_key_t* k =
+        EverCrypt_HMAC_malloc_key(alg, key.data(), key_len);
+      ASSERT_NE(k, nullptr);
+      EverCrypt_HMAC_key_t* k_copy = EverCrypt_HMAC_copy_key(k);
+
+      for (uint32_t data_len = 0; data_len <= data.size(); data_len++) {
+        bytes expected(64);
+        bytes got(64);
+        bytes got_copy(64);
+        EverCrypt_HMAC_compute(
+          alg, expected.data(), key.data(), key_len, data.data(), data_len);
+        EverCrypt_HMAC_compute_with_key(k, got.data(), data.data(), data_len);
+        EverCrypt_HMAC_compute_with_key(
+          k_copy, got_copy.data(), data.data(), data_len);
+        EXPECT_EQ(got, expected) << "alg " << alg << " key_len " << key_len
+                                 << " data_len " << data_len;
+        EXPECT_EQ(got_copy, expected);
+      }
+
+      EverCrypt_HMAC_free_key(k_copy);
+      EverCrypt_HMAC_free_key(k);
+    }
+  }
+
+  EXPECT_EQ(EverCrypt_HMAC_malloc_key(Spec_Hash_Definitions_MD5, key.data(), 16),
+            nullptr);
+}
+
+// One precomputed key is only read, so threads can share it.
+TEST(HMACKeySuite, SharedKey)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes key(32, 0x0b);
+  bytes data(1000, 0x2a);
+  bytes expected(32);
+  EverCrypt_HMAC_compute(Spec_Hash_Definitions_SHA2_256,
+                         expected.data(),
+                         key.data(),
+                         key.size(),
+                         data.data(),
+                         data.size());
+
+  EverCrypt_HMAC_key_t* k = EverCrypt_HMAC_malloc_key(
+    Spec_Hash_Definitions_SHA2_256, key.data(), key.size());
+  ASSERT_NE(k, nullptr);
+
+  const size_t n_threads = 8;
+  std::vector<bytes> out(n_threads, bytes(32));
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < n_threads; t++) {
+    threads.emplace_back([&, t]() {
+      for (size_t i = 0; i < 1000; i++) {
+        EverCrypt_HMAC_compute_with_key(
+          k, out[t].data(), data.data(), data.size());
+        if (out[t] != expected) {
+          return;
+        }
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  for (size_t t = 0; t < n_threads; t++) {
+    EXPECT_EQ(out[t], expected) << "thread " << t;
+  }
+
+  EverCrypt_HMAC_free_key(k);
+}
+
+TEST(HMACKeySuite, Streaming)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes data(1000);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = (uint8_t)(i * 5 + 11);
+  }
+  bytes key(32, 0x42);
+
+  for (auto alg : hmac_key_algs) {
+    EverCrypt_HMAC_key_t* k =
+      EverCrypt_HMAC_malloc_key(alg, key.data(), key.size());
+    ASSERT_NE(k, nullptr);
+
+    for (uint32_t chunk_len : { 1, 7, 63, 64, 65, 128, 129, 1000 }) {
+      EverCrypt_HMAC_state_t* st = EverCrypt_HMAC_malloc_with_key(k);
+      size_t fed = 0;
+      while (true) {
+        // Digest at every chunk boundary to check it is non-destructive.
+        bytes expected(64);
+        bytes got(64);
+        EverCrypt_HMAC_compute(
+          alg, expected.data(), key.data(), key.size(), data.data(), fed);
+        EverCrypt_HMAC_digest(st, got.data());
+        EXPECT_EQ(got, expected) << "alg " << alg << " chunk_len " << chunk_len
+                                 << " fed " << fed;
+        if (fed == data.size()) {
+          break;
+        }
+        uint32_t len = std::min((size_t)chunk_len, data.size() - fed);
+        EXPECT_EQ(EverCrypt_HMAC_update(st, data.data() + fed, len),
+                  EverCrypt_Error_Success);
+        fed += len;
+      }
+      EverCrypt_HMAC_free(st);
+    }
+
+    EverCrypt_HMAC_free_key(k);
+  }
+}
+
+TEST(HMACKeySuite, StreamingMallocReset)
+{
+  EverCrypt_AutoConfig2_init();
+
+  bytes data(4096);
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = (uint8_t)(i * 31 + 17);
+  }
+  bytes key(150);
+  for (size_t i = 0; i < key.size(); i++) {
+    key[i] = (uint8_t)(i ^ 0xa5);
+  }
+  // Irregular chunk lengths, repeated until all data has been fed.
+  const uint32_t chunk_lens[] = { 0, 3, 64, 1, 127, 128, 0, 200, 65, 9 };
+
+  for (auto alg : hmac_key_algs) {
+    for (uint32_t key_len : { 16, 150 }) {
+      bytes expected(64);
+      EverCrypt_HMAC_compute(
+        alg, expected.data(), key.data(), key_len, data.data(), data.size());
+
+      EverCrypt_HMAC_state_t* st =
+        EverCrypt_HMAC_malloc(alg, key.data(), key_len);
+      ASSERT_NE(st, nullptr);
+      EXPECT_EQ(EverCrypt_HMAC_alg_of_state(st), alg);
+
+      for (int round = 0; round < 2; round++) {
+        // Feed some unrelated data first, then reset.
+        EXPECT_EQ(EverCrypt_HMAC_update(st, key.data(), key.size()),
+                  EverCrypt_Error_Success);
+        EverCrypt_HMAC_reset(st);
+
+        size_t fed = 0;
+        for (size_t i = 0; fed < data.size(); i++) {
+          uint32_t len = std::min((size_t)chunk_lens[i % 10], data.size() - fed);
+          EXPECT_EQ(EverCrypt_HMAC_update(st, data.data() + fed, len),
+                    EverCrypt_Error_Success);
+          fed += len;
+        }
+        bytes got(64);
+        EverCrypt_HMAC_digest(st, got.data());
+        EXPECT_EQ(got, expected) << "alg " << alg << " key_len " << key_len;
+      }
+      EverCrypt_HMAC_free(st);
+    }
+  }
+
+  EXPECT_EQ(EverCrypt_HMAC_malloc(Spec_Hash_Definitions_SHA3_256, key.data(), 16),
+            nullptr);
+}
+
 // -----------------------------------------------------------------------------
 
 INSTANTIATE_TEST_SUITE_P(HmacSha1Kat,
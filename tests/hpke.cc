@@ -0,0 +1,1448 @@
+/*
+ *    Copyright 2023 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
+#include "EverCrypt_HPKE.h"
+#include "Hacl_Curve25519_51.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP32_SHA512.h"
+#include "Hacl_HPKE_P256MLKEM768_CP32_SHA256.h"
+#include "Hacl_HPKE_P256_CP32_SHA256.h"
+#include "Hacl_HPKE_X25519MLKEM768_CP32_SHA256.h"
+#include "Hacl_Hash_SHA3.h"
+#include "Hacl_P256.h"
+#include "config.h"
+#include "util.h"
+
+#ifdef HACL_CAN_COMPILE_VEC128
+#include "Hacl_HPKE_Curve51_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP128_SHA512.h"
+#include "Hacl_HPKE_P256_CP128_SHA256.h"
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_HPKE_Curve51_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve51_CP256_SHA512.h"
+#include "Hacl_HPKE_P256_CP256_SHA256.h"
+#endif
+
+#ifdef HACL_CAN_COMPILE_VALE
+#include "Hacl_HPKE_Curve64_CP32_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP32_SHA512.h"
+#ifdef HACL_CAN_COMPILE_VEC128
+#include "Hacl_HPKE_Curve64_CP128_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP128_SHA512.h"
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_HPKE_Curve64_CP256_SHA256.h"
+#include "Hacl_HPKE_Curve64_CP256_SHA512.h"
+#endif
+#endif
+
+using namespace std;
+
+typedef uint32_t (*setupBaseS_t)(uint8_t* o_pkE,
+                                 Hacl_Impl_HPKE_context_s o_ctx,
+                                 uint8_t* skE,
+                                 uint8_t* pkR,
+                                 uint32_t infolen,
+                                 uint8_t* info);
+typedef uint32_t (*setupBaseR_t)(Hacl_Impl_HPKE_context_s o_ctx,
+                                 uint8_t* enc,
+                                 uint8_t* skR,
+                                 uint32_t infolen,
+                                 uint8_t* info);
+typedef uint32_t (*setupPSKS_t)(uint8_t* o_pkE,
+                                Hacl_Impl_HPKE_context_s o_ctx,
+                                uint8_t* skE,
+                                uint8_t* pkR,
+                                uint32_t infolen,
+                                uint8_t* info,
+                                uint32_t psklen,
+                                uint8_t* psk,
+                                uint32_t psk_idlen,
+                                uint8_t* psk_id);
+typedef uint32_t (*setupPSKR_t)(Hacl_Impl_HPKE_context_s o_ctx,
+                                uint8_t* enc,
+                                uint8_t* skR,
+                                uint32_t infolen,
+                                uint8_t* info,
+                                uint32_t psklen,
+                                uint8_t* psk,
+                                uint32_t psk_idlen,
+                                uint8_t* psk_id);
+typedef uint32_t (*setupAuthS_t)(uint8_t* o_pkE,
+                                 Hacl_Impl_HPKE_context_s o_ctx,
+                                 uint8_t* skE,
+                                 uint8_t* pkR,
+                                 uint8_t* skS,
+                                 uint32_t infolen,
+                                 uint8_t* info);
+typedef uint32_t (*setupAuthR_t)(Hacl_Impl_HPKE_context_s o_ctx,
+                                 uint8_t* enc,
+                                 uint8_t* skR,
+                                 uint8_t* pkS,
+                                 uint32_t infolen,
+                                 uint8_t* info);
+typedef uint32_t (*setupAuthPSKS_t)(uint8_t* o_pkE,
+                                    Hacl_Impl_HPKE_context_s o_ctx,
+                                    uint8_t* skE,
+                                    uint8_t* pkR,
+                                    uint8_t* skS,
+                                    uint32_t infolen,
+                                    uint8_t* info,
+                                    uint32_t psklen,
+                                    uint8_t* psk,
+                                    uint32_t psk_idlen,
+                                    uint8_t* psk_id);
+typedef uint32_t (*setupAuthPSKR_t)(Hacl_Impl_HPKE_context_s o_ctx,
+                                    uint8_t* enc,
+                                    uint8_t* skR,
+                                    uint8_t* pkS,
+                                    uint32_t infolen,
+                                    uint8_t* info,
+                                    uint32_t psklen,
+                                    uint8_t* psk,
+                                    uint32_t psk_idlen,
+                                    uint8_t* psk_id);
+typedef uint32_t (*sealBase_t)(uint8_t* skE,
+                               uint8_t* pkR,
+                               uint32_t infolen,
+                               uint8_t* info,
+                               uint32_t aadlen,
+                               uint8_t* aad,
+                               uint32_t plainlen,
+                               uint8_t* plain,
+                               uint8_t* o_enc,
+                               uint8_t* o_ct);
+typedef uint32_t (*openBase_t)(uint8_t* pkE,
+                               uint8_t* skR,
+                               uint32_t infolen,
+                               uint8_t* info,
+                               uint32_t aadlen,
+                               uint8_t* aad,
+                               uint32_t ctlen,
+                               uint8_t* ct,
+                               uint8_t* o_pt);
+typedef uint32_t (*context_seal_t)(Hacl_Impl_HPKE_context_s ctx,
+                                   uint32_t aadlen,
+                                   uint8_t* aad,
+                                   uint32_t plainlen,
+                                   uint8_t* plain,
+                                   uint8_t* o_ct);
+typedef uint32_t (*context_open_t)(Hacl_Impl_HPKE_context_s ctx,
+                                   uint32_t aadlen,
+                                   uint8_t* aad,
+                                   uint32_t ctlen,
+                                   uint8_t* ct,
+                                   uint8_t* o_pt);
+typedef uint32_t (*context_export_t)(Hacl_Impl_HPKE_context_s ctx,
+                                     uint32_t exp_ctxlen,
+                                     uint8_t* exp_ctx,
+                                     uint32_t l,
+                                     uint8_t* o_secret);
+
+struct Context
+{
+  bytes key = bytes(32);
+  bytes nonce = bytes(12);
+  uint64_t seq = 0;
+  bytes exporter;
+
+  Context(size_t exporter_len = 32)
+    : exporter(exporter_len)
+  {
+  }
+
+  Hacl_Impl_HPKE_context_s get()
+  {
+    return { key.data(), nonce.data(), &seq, exporter.data() };
+  }
+};
+
+// Seal three messages with one sender context and open them with one receiver
+// context. The first ciphertext must match the single-shot sealBase, messages
+// must be opened in order and the 32-byte export for "TestContext" must match
+// `exported`.
+static void
+check_context(setupBaseS_t setupBaseS,
+              setupBaseR_t setupBaseR,
+              sealBase_t sealBase,
+              context_seal_t context_seal,
+              context_open_t context_open,
+              context_export_t context_export,
+              size_t exporter_len,
+              bytes& info,
+              bytes& skE,
+              bytes& pkR,
+              bytes& skR,
+              size_t enc_len,
+              const char* exported)
+{
+  bytes aad = iota(11, 2);
+  bytes enc(enc_len), enc0(enc_len);
+  Context s(exporter_len), r(exporter_len);
+  EXPECT_EQ(setupBaseS(
+              enc.data(), s.get(), skE.data(), pkR.data(), info.size(), info.data()),
+            0);
+  EXPECT_EQ(
+    setupBaseR(r.get(), enc.data(), skR.data(), info.size(), info.data()), 0);
+
+  vector<bytes> plain, ct;
+  for (size_t i = 0; i < 3; i++) {
+    plain.push_back(iota(40 + i, (uint8_t)(3 * i)));
+    ct.push_back(bytes(plain[i].size() + 16));
+    EXPECT_EQ(context_seal(s.get(),
+                           aad.size(),
+                           aad.data(),
+                           plain[i].size(),
+                           plain[i].data(),
+                           ct[i].data()),
+              0);
+  }
+  EXPECT_EQ(s.seq, 3);
+
+  bytes ct0(ct[0].size());
+  EXPECT_EQ(sealBase(skE.data(),
+                     pkR.data(),
+                     info.size(),
+                     info.data(),
+                     aad.size(),
+                     aad.data(),
+                     plain[0].size(),
+                     plain[0].data(),
+                     enc0.data(),
+                     ct0.data()),
+            0);
+  EXPECT_EQ(enc0, enc);
+  EXPECT_EQ(ct0, ct[0]);
+
+  // The second message does not open under the first nonce, and a failed open
+  // leaves the sequence number unchanged.
+  bytes pt(plain[1].size());
+  EXPECT_EQ(context_open(
+              r.get(), aad.size(), aad.data(), ct[1].size(), ct[1].data(), pt.data()),
+            1);
+  EXPECT_EQ(r.seq, 0);
+  for (size_t i = 0; i < 3; i++) {
+    bytes pt(plain[i].size());
+    EXPECT_EQ(context_open(r.get(),
+                           aad.size(),
+                           aad.data(),
+                           ct[i].size(),
+                           ct[i].data(),
+                           pt.data()),
+              0);
+    EXPECT_EQ(pt, plain[i]);
+  }
+
+  string label = "TestContext";
+  bytes exp_ctx(label.begin(), label.end()), out_s(32), out_r(32);
+  EXPECT_EQ(
+    context_export(s.get(), exp_ctx.size(), exp_ctx.data(), 32, out_s.data()), 0);
+  EXPECT_EQ(
+    context_export(r.get(), exp_ctx.size(), exp_ctx.data(), 32, out_r.data()), 0);
+  EXPECT_EQ(out_s, out_r);
+  EXPECT_EQ(bytes_to_hex(out_s), exported);
+
+  bytes too_long(255 * exporter_len + 1);
+  EXPECT_EQ(context_export(s.get(),
+                           exp_ctx.size(),
+                           exp_ctx.data(),
+                           too_long.size(),
+                           too_long.data()),
+            1);
+
+  // Once the sequence number is exhausted, nothing must be encrypted.
+  Context last(exporter_len);
+  last.seq = UINT64_MAX;
+  bytes ct_last(16);
+  EXPECT_EQ(context_seal(last.get(), 0, NULL, 0, NULL, ct_last.data()), 1);
+  EXPECT_EQ(ct_last, bytes(16));
+  EXPECT_EQ(last.seq, UINT64_MAX);
+}
+
+struct HybridKem
+{
+  const char* name;
+  size_t pk_len;
+  size_t sk_len;
+  size_t enc_len;
+  uint32_t (*keypair)(uint8_t* pk, uint8_t* sk, uint8_t* seed);
+  setupBaseS_t setupBaseS;
+  setupBaseR_t setupBaseR;
+  sealBase_t sealBase;
+  openBase_t openBase;
+  context_seal_t context_seal;
+  context_open_t context_open;
+  context_export_t context_export;
+  // SHA3-256 of pk, sk and enc for seed = 0 .. 31 and skE = 32 .. 95, and the
+  // resulting key schedule for info = "Ode on a Grecian Urn", as computed by a
+  // direct transcription of FIPS 203, RFC 7748 and RFC 9180.
+  const char* pk_digest;
+  const char* sk_digest;
+  const char* enc_digest;
+  const char* key;
+  const char* nonce;
+  const char* exporter;
+  // The export for "TestContext" after the key schedule above.
+  const char* exported;
+};
+
+ostream&
+operator<<(ostream& os, const HybridKem& kem)
+{
+  return os << kem.name;
+}
+
+class HPKEHybrid : public ::testing::TestWithParam<HybridKem>
+{};
+
+static bytes
+info_bytes()
+{
+  string info = "Ode on a Grecian Urn";
+  return bytes(info.begin(), info.end());
+}
+
+static string
+sha3_256_hex(bytes& b)
+{
+  bytes digest(32);
+  Hacl_Hash_SHA3_sha3_256(digest.data(), b.data(), b.size());
+  return bytes_to_hex(digest);
+}
+
+// The X25519 key generation cannot fail; wrap it so that it fits the common
+// signature.
+static uint32_t
+x25519mlkem768_keypair(uint8_t* pk, uint8_t* sk, uint8_t* seed)
+{
+  Hacl_HPKE_X25519MLKEM768_CP32_SHA256_keypair(pk, sk, seed);
+  return 0;
+}
+
+TEST_P(HPKEHybrid, KnownAnswer)
+{
+  HybridKem kem = GetParam();
+  bytes info = info_bytes();
+
+  for (int avx2 = 0; avx2 < 2; avx2++) {
+    EverCrypt_AutoConfig2_init();
+    if (!avx2) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    EverCrypt_Dispatch_refresh();
+    bytes pk(kem.pk_len), sk(kem.sk_len), enc(kem.enc_len);
+    bytes seed = iota(32, 0), skE = iota(64, 32);
+    EXPECT_EQ(kem.keypair(pk.data(), sk.data(), seed.data()), 0);
+    EXPECT_EQ(sha3_256_hex(pk), kem.pk_digest);
+    EXPECT_EQ(sha3_256_hex(sk), kem.sk_digest);
+
+    Context s, r;
+    EXPECT_EQ(kem.setupBaseS(
+                enc.data(), s.get(), skE.data(), pk.data(), info.size(), info.data()),
+              0);
+    EXPECT_EQ(sha3_256_hex(enc), kem.enc_digest);
+    EXPECT_EQ(bytes_to_hex(s.key), kem.key);
+    EXPECT_EQ(bytes_to_hex(s.nonce), kem.nonce);
+    EXPECT_EQ(bytes_to_hex(s.exporter), kem.exporter);
+
+    EXPECT_EQ(
+      kem.setupBaseR(r.get(), enc.data(), sk.data(), info.size(), info.data()),
+      0);
+    EXPECT_EQ(r.key, s.key);
+    EXPECT_EQ(r.nonce, s.nonce);
+    EXPECT_EQ(r.exporter, s.exporter);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+TEST_P(HPKEHybrid, SealOpen)
+{
+  HybridKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(kem.pk_len), sk(kem.sk_len), enc(kem.enc_len);
+  bytes seed = iota(32, 7), skE = iota(64, 99), info = iota(5, 1),
+        aad = iota(9, 2), plain = iota(77, 3);
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data(), seed.data()), 0);
+
+  bytes ct(plain.size() + 16), pt(plain.size());
+  EXPECT_EQ(kem.sealBase(skE.data(),
+                         pk.data(),
+                         info.size(),
+                         info.data(),
+                         aad.size(),
+                         aad.data(),
+                         plain.size(),
+                         plain.data(),
+                         enc.data(),
+                         ct.data()),
+            0);
+  EXPECT_EQ(kem.openBase(enc.data(),
+                         sk.data(),
+                         info.size(),
+                         info.data(),
+                         aad.size(),
+                         aad.data(),
+                         ct.size(),
+                         ct.data(),
+                         pt.data()),
+            0);
+  EXPECT_EQ(pt, plain);
+
+  // Either half of the encapsulation changes the shared secret.
+  for (size_t i : { (size_t)0, kem.enc_len - 1 }) {
+    bytes bad_enc = enc;
+    bad_enc[i] ^= 1;
+    EXPECT_EQ(kem.openBase(bad_enc.data(),
+                           sk.data(),
+                           info.size(),
+                           info.data(),
+                           aad.size(),
+                           aad.data(),
+                           ct.size(),
+                           ct.data(),
+                           pt.data()),
+              1);
+  }
+}
+
+// X-Wing does not reject a low-order X25519 point: decapsulation succeeds and
+// the ML-KEM secret still determines the key.
+TEST(HPKEXWing, LowOrderPoint)
+{
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(1216), sk(2464), enc(1120);
+  bytes seed = iota(32, 0), skE = iota(64, 32), info = info_bytes();
+  Hacl_HPKE_X25519MLKEM768_CP32_SHA256_keypair(
+    pk.data(), sk.data(), seed.data());
+
+  Context s, r;
+  EXPECT_EQ(Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS(enc.data(),
+                                                            s.get(),
+                                                            skE.data(),
+                                                            pk.data(),
+                                                            info.size(),
+                                                            info.data()),
+            0);
+  fill(enc.end() - 32, enc.end(), 0);
+  EXPECT_EQ(Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseR(
+              r.get(), enc.data(), sk.data(), info.size(), info.data()),
+            0);
+  EXPECT_NE(r.key, s.key);
+}
+
+TEST_P(HPKEHybrid, Context)
+{
+  HybridKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(kem.pk_len), sk(kem.sk_len);
+  bytes seed = iota(32, 0), skE = iota(64, 32), info = info_bytes();
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data(), seed.data()), 0);
+  check_context(kem.setupBaseS,
+                kem.setupBaseR,
+                kem.sealBase,
+                kem.context_seal,
+                kem.context_open,
+                kem.context_export,
+                32,
+                info,
+                skE,
+                pk,
+                sk,
+                kem.enc_len,
+                kem.exported);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  HPKE,
+  HPKEHybrid,
+  ::testing::Values(
+    HybridKem{
+      "X25519MLKEM768",
+      1216,
+      2464,
+      1120,
+      x25519mlkem768_keypair,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseR,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_sealBase,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_openBase,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_seal,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_open,
+      Hacl_HPKE_X25519MLKEM768_CP32_SHA256_context_export,
+      "02ed14d55121ca47e2aa279a7fdba9867f7d9bbc3c5ab4f004f94354565c8158",
+      "769038a2f13210a432984ed9f0a5c6fb042deda00346110bb1687d0e30f47a58",
+      "5621c113326b4e35184dfd0ceba74a3da95c9c50b30e194dc1005d9f6df9e75a",
+      "c92931ffdd66fcb4afe3c089a5d77022235d666772f79e3b2b66c86cdc59eeb8",
+      "cd63ce08775f8eefe2b44686",
+      "3ec8909299f9d192c9f99aac2b27f8b0ba400eb62c144db5037b43a3f7c19fc6",
+      "276dfe5b050abdd96a36a5a9ab67f32ede727159b043bfb591a0a29c821a18e6" },
+    HybridKem{
+      "P256MLKEM768",
+      1249,
+      2497,
+      1153,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_keypair,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseR,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_sealBase,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_openBase,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_seal,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_open,
+      Hacl_HPKE_P256MLKEM768_CP32_SHA256_context_export,
+      "3d9fd9d5095ad39599e654b008dccd98e80068fabca1e42e5cfd1227151194ee",
+      "3e8eb89c5a226f5f68dd841e0b27a7cff43d63672230e3d2e08d09059b5dd004",
+      "d8798b85ec59984421cac1ec35b57210e92cd8df5603dbf61e79bcaac6d7bce7",
+      "0a0106e682e3db39efb0efa1d5857cb58003baa5d6232796147224796fb45eb0",
+      "3d26f504bd7f3a3789d4f1c7",
+      "12083a84c2a1df6efb26d5f3b946b38f5ecedaa28354917f4ff2763ba767dbdf",
+      "1c74ba4df88d08a541591c152d50b32d15be661746acf0c3d524c8a692331ea4" }));
+
+struct DhkemSuite
+{
+  const char* name;
+  bool (*available)();
+  // Computes the public key in the format setupBaseS expects.
+  void (*public_key)(uint8_t* pk, uint8_t* sk);
+  size_t pk_len;
+  size_t enc_len;
+  size_t exporter_len;
+  setupBaseS_t setupBaseS;
+  setupBaseR_t setupBaseR;
+  sealBase_t sealBase;
+  context_seal_t context_seal;
+  context_open_t context_open;
+  context_export_t context_export;
+  setupPSKS_t setupPSKS;
+  setupPSKR_t setupPSKR;
+  setupAuthS_t setupAuthS;
+  setupAuthR_t setupAuthR;
+  setupAuthPSKS_t setupAuthPSKS;
+  setupAuthPSKR_t setupAuthPSKR;
+  // The key schedule for skR = 0 .. 31, skE = 32 .. 63 and
+  // info = "Ode on a Grecian Urn", and the export for "TestContext", as
+  // computed by a direct transcription of RFC 9180.
+  const char* key;
+  const char* nonce;
+  const char* exporter;
+  const char* exported;
+  // The key and export in the psk, auth and auth_psk modes, with
+  // skS = 64 .. 95, psk = 96 .. 127 and psk_id = "Ennyn Durin Aran Moria".
+  const char* psk_key;
+  const char* psk_exported;
+  const char* auth_key;
+  const char* auth_exported;
+  const char* auth_psk_key;
+  const char* auth_psk_exported;
+};
+
+ostream&
+operator<<(ostream& os, const DhkemSuite& suite)
+{
+  return os << suite.name;
+}
+
+class HPKEDhkem : public ::testing::TestWithParam<DhkemSuite>
+{};
+
+TEST_P(HPKEDhkem, Context)
+{
+  DhkemSuite suite = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  if (!suite.available()) {
+    GTEST_SKIP() << suite.name << " is not supported on this CPU";
+  }
+
+  bytes skR = iota(32, 0), skE = iota(32, 32), info = info_bytes();
+  bytes pkR(suite.pk_len), enc(suite.enc_len);
+  suite.public_key(pkR.data(), skR.data());
+
+  Context s(suite.exporter_len);
+  EXPECT_EQ(suite.setupBaseS(
+              enc.data(), s.get(), skE.data(), pkR.data(), info.size(), info.data()),
+            0);
+  EXPECT_EQ(bytes_to_hex(s.key), suite.key);
+  EXPECT_EQ(bytes_to_hex(s.nonce), suite.nonce);
+  EXPECT_EQ(bytes_to_hex(s.exporter), suite.exporter);
+
+  check_context(suite.setupBaseS,
+                suite.setupBaseR,
+                suite.sealBase,
+                suite.context_seal,
+                suite.context_open,
+                suite.context_export,
+                suite.exporter_len,
+                info,
+                skE,
+                pkR,
+                skR,
+                suite.enc_len,
+                suite.exported);
+}
+
+// Every mode agrees between sender and receiver and matches the known answers.
+// A missing PSK and a wrong sender key are detected.
+TEST_P(HPKEDhkem, Modes)
+{
+  DhkemSuite suite = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  if (!suite.available()) {
+    GTEST_SKIP() << suite.name << " is not supported on this CPU";
+  }
+
+  bytes skR = iota(32, 0), skE = iota(32, 32), skS = iota(32, 64),
+        psk = iota(32, 96), info = info_bytes();
+  string id = "Ennyn Durin Aran Moria";
+  bytes psk_id(id.begin(), id.end()), test_context = { 'T', 'e', 's', 't',
+                                                        'C', 'o', 'n', 't',
+                                                        'e', 'x', 't' };
+  bytes pkR(suite.pk_len), pkS(suite.pk_len), enc(suite.enc_len);
+  suite.public_key(pkR.data(), skR.data());
+  suite.public_key(pkS.data(), skS.data());
+
+  for (int mode = 1; mode < 4; mode++) {
+    Context s(suite.exporter_len), r(suite.exporter_len);
+    uint32_t res_s, res_r;
+    const char *key, *exported;
+    if (mode == 1) {
+      res_s = suite.setupPSKS(enc.data(),
+                              s.get(),
+                              skE.data(),
+                              pkR.data(),
+                              info.size(),
+                              info.data(),
+                              psk.size(),
+                              psk.data(),
+                              psk_id.size(),
+                              psk_id.data());
+      res_r = suite.setupPSKR(r.get(),
+                              enc.data(),
+                              skR.data(),
+                              info.size(),
+                              info.data(),
+                              psk.size(),
+                              psk.data(),
+                              psk_id.size(),
+                              psk_id.data());
+      key = suite.psk_key;
+      exported = suite.psk_exported;
+    } else if (mode == 2) {
+      res_s = suite.setupAuthS(enc.data(),
+                               s.get(),
+                               skE.data(),
+                               pkR.data(),
+                               skS.data(),
+                               info.size(),
+                               info.data());
+      res_r = suite.setupAuthR(r.get(),
+                               enc.data(),
+                               skR.data(),
+                               pkS.data(),
+                               info.size(),
+                               info.data());
+      key = suite.auth_key;
+      exported = suite.auth_exported;
+    } else {
+      res_s = suite.setupAuthPSKS(enc.data(),
+                                  s.get(),
+                                  skE.data(),
+                                  pkR.data(),
+                                  skS.data(),
+                                  info.size(),
+                                  info.data(),
+                                  psk.size(),
+                                  psk.data(),
+                                  psk_id.size(),
+                                  psk_id.data());
+      res_r = suite.setupAuthPSKR(r.get(),
+                                  enc.data(),
+                                  skR.data(),
+                                  pkS.data(),
+                                  info.size(),
+                                  info.data(),
+                                  psk.size(),
+                                  psk.data(),
+                                  psk_id.size(),
+                                  psk_id.data());
+      key = suite.auth_psk_key;
+      exported = suite.auth_psk_exported;
+    }
+    EXPECT_EQ(res_s, 0) << "mode = " << mode;
+    EXPECT_EQ(res_r, 0) << "mode = " << mode;
+    EXPECT_EQ(bytes_to_hex(s.key), key) << "mode = " << mode;
+    EXPECT_EQ(r.key, s.key);
+    EXPECT_EQ(r.nonce, s.nonce);
+    EXPECT_EQ(r.exporter, s.exporter);
+
+    bytes secret(32);
+    EXPECT_EQ(suite.context_export(s.get(),
+                                   test_context.size(),
+                                   test_context.data(),
+                                   secret.size(),
+                                   secret.data()),
+              0);
+    EXPECT_EQ(bytes_to_hex(secret), exported) << "mode = " << mode;
+  }
+
+  // The PSK and its identifier must be given together.
+  Context c(suite.exporter_len);
+  EXPECT_EQ(suite.setupPSKS(enc.data(),
+                            c.get(),
+                            skE.data(),
+                            pkR.data(),
+                            info.size(),
+                            info.data(),
+                            0,
+                            NULL,
+                            psk_id.size(),
+                            psk_id.data()),
+            1);
+  EXPECT_EQ(suite.setupPSKR(c.get(),
+                            enc.data(),
+                            skR.data(),
+                            info.size(),
+                            info.data(),
+                            psk.size(),
+                            psk.data(),
+                            0,
+                            NULL),
+            1);
+
+  // The receiver authenticates the sender.
+  Context s(suite.exporter_len), r(suite.exporter_len);
+  EXPECT_EQ(suite.setupAuthS(enc.data(),
+                             s.get(),
+                             skE.data(),
+                             pkR.data(),
+                             skS.data(),
+                             info.size(),
+                             info.data()),
+            0);
+  EXPECT_EQ(suite.setupAuthR(r.get(),
+                             enc.data(),
+                             skR.data(),
+                             pkR.data(),
+                             info.size(),
+                             info.data()),
+            0);
+  EXPECT_NE(r.key, s.key);
+}
+
+static bool
+always()
+{
+  return true;
+}
+
+static bool
+vec128()
+{
+  return EverCrypt_AutoConfig2_has_vec128();
+}
+
+static bool
+vec256()
+{
+  return EverCrypt_AutoConfig2_has_vec256();
+}
+
+static bool
+curve64()
+{
+  return EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx();
+}
+
+static bool
+curve64_vec128()
+{
+  return curve64() && vec128();
+}
+
+static bool
+curve64_vec256()
+{
+  return curve64() && vec256();
+}
+
+static void
+p256_public_key(uint8_t* pk, uint8_t* sk)
+{
+  Hacl_P256_dh_initiator(pk, sk);
+}
+
+#define X25519_SHA256                                                          \
+  "99ff33bc02dfe91e9afebff5d4e25d9a13bb4087c43a1776940fb80f61106c4f",          \
+    "41a7d35f070ab26d03184475",                                                \
+    "ccb9a077d213b1918478690469db9f23f3629f2ecaf2b609427bd2d73eee4ab1",        \
+    "1654f9efa6e4d702390451aa993cef55479eb407f639a23cc8bcc6536780bdf1",        \
+    "830334eb42c49d32a253321d258412a115779cd88710c371bb7a7d070c14c797",        \
+    "cfaa836a0cfb19836798c2cf466d88ab4182ca2c7c4c46cd33f755c757e43e2d",        \
+    "e48bd9b2ee43dd077d1d6ed626815d28e46245c339d53c5395aea227a1927bcb",        \
+    "40a0475386b1c746e47b84cbc999a61c430eec876c988b7ed351e16c2a7af0fa",        \
+    "4c11cf8fd79d436db5ecef38059429096e9f6740806da91b1c2ba0f040449ef8",        \
+    "7ba10b1aa765af82b6de7bbf133afb811f6be774241506e67d0d2ab0ac7fd619"
+
+#define X25519_SHA512                                                          \
+  "de75e4a6eb8a8a5ff53820b10722d4f0f9b2f6eedc7a8c6fbb83dca5cdbbccf1",          \
+    "7d76baffc334af2e73430f20",                                                \
+    "a94c63085167c770ceed26a5543272827cbedc2f6fcc9e71b7ce6d89e83171058cea08c6" \
+    "46454a81cf37962a2b0cb456e95ef97e1625dafa5f8fc8e5b4e146ef",                \
+    "9de3eb9e80fd62828ff73946bd8780214b5eb0e355692f82c21007f7546872f3",        \
+    "6212a1c34b5b63b81718b0d082c1a7f838d0a8ee6f7e06e46fc40e0968834b49",        \
+    "36ac06dd7b8e4eb9a9dbcc313d77c3d2c38d9ddbd7671429d518df377d9b2c87",        \
+    "fb7893d8aebf65507f87eb23b6b494a3fd251eb82d27a3b1ec06c0cb3906a0b8",        \
+    "a04b4fd5d56348a23d5402f0d35a25b01b8d3ae3c57163f4bbb6e791d2386078",        \
+    "79716745b980eca68178df69f05a5b247d63e068a07dc71c25ca44300110897c",        \
+    "2804cf9c58d1e87a6bad63b28f90124e98339842dea9edf09134b4389d2a5065"
+
+#define P256_SHA256                                                            \
+  "764914c39f1730be97a1a1803f1aba7289b295ff0ca65dcd43e47046967172b4",          \
+    "357638aab91b0f29295571ce",                                                \
+    "f5e61163d865b273e609bf4bb1f9d7caa62328c52fd8464b2694d8cf7893d83b",        \
+    "b40c497826f800f036f1793b33fd1ff2e1ca0f201bdf38711737e1a03697ef7a",        \
+    "7105a6723297aeaeadca82037d89e199f68a421229c9397f6cfcd896a9dc288b",        \
+    "73fbc6624994a76fe6515c5b1444879c0080833b826e585a8ab671ed2f7292b5",        \
+    "495e55142e0291d011e8b0da9b8f0b66ed31c8b1dc543cab50345313a055727e",        \
+    "ad03d1f412a90143d1fbb2d46d0eda5cbeb9e42ba34b001539ac34253289e3c5",        \
+    "d1a74a217f6fbfc269ea4874607e2a75192dff9e5c3824f48aaa69cf5ceda3bd",        \
+    "5167c7e0864a21e188f91ed08be1bf62aa3439bb8ba0c84ed7fb817118dca4d0"
+
+#define DHKEM_SUITE(S, available, public_key, pk_len, enc_len, nh, expected)   \
+  DhkemSuite                                                                   \
+  {                                                                            \
+    #S, available, public_key, pk_len, enc_len, nh, Hacl_HPKE_##S##_setupBaseS, \
+      Hacl_HPKE_##S##_setupBaseR, Hacl_HPKE_##S##_sealBase,                    \
+      Hacl_HPKE_##S##_context_seal, Hacl_HPKE_##S##_context_open,              \
+      Hacl_HPKE_##S##_context_export, Hacl_HPKE_##S##_setupPSKS,               \
+      Hacl_HPKE_##S##_setupPSKR, Hacl_HPKE_##S##_setupAuthS,                   \
+      Hacl_HPKE_##S##_setupAuthR, Hacl_HPKE_##S##_setupAuthPSKS,               \
+      Hacl_HPKE_##S##_setupAuthPSKR, expected                                  \
+  }
+
+static vector<DhkemSuite>
+dhkem_suites()
+{
+  vector<DhkemSuite> suites = {
+    DHKEM_SUITE(Curve51_CP32_SHA256,
+                always,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve51_CP32_SHA512,
+                always,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+    DHKEM_SUITE(
+      P256_CP32_SHA256, always, p256_public_key, 64, 65, 32, P256_SHA256),
+#ifdef HACL_CAN_COMPILE_VEC128
+    DHKEM_SUITE(Curve51_CP128_SHA256,
+                vec128,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve51_CP128_SHA512,
+                vec128,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+    DHKEM_SUITE(
+      P256_CP128_SHA256, vec128, p256_public_key, 64, 65, 32, P256_SHA256),
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+    DHKEM_SUITE(Curve51_CP256_SHA256,
+                vec256,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve51_CP256_SHA512,
+                vec256,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+    DHKEM_SUITE(
+      P256_CP256_SHA256, vec256, p256_public_key, 64, 65, 32, P256_SHA256),
+#endif
+#ifdef HACL_CAN_COMPILE_VALE
+    DHKEM_SUITE(Curve64_CP32_SHA256,
+                curve64,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve64_CP32_SHA512,
+                curve64,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+#ifdef HACL_CAN_COMPILE_VEC128
+    DHKEM_SUITE(Curve64_CP128_SHA256,
+                curve64_vec128,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve64_CP128_SHA512,
+                curve64_vec128,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+    DHKEM_SUITE(Curve64_CP256_SHA256,
+                curve64_vec256,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                32,
+                X25519_SHA256),
+    DHKEM_SUITE(Curve64_CP256_SHA512,
+                curve64_vec256,
+                Hacl_Curve25519_51_secret_to_public,
+                32,
+                32,
+                64,
+                X25519_SHA512),
+#endif
+#endif
+  };
+  return suites;
+}
+
+INSTANTIATE_TEST_SUITE_P(HPKE, HPKEDhkem, ::testing::ValuesIn(dhkem_suites()));
+
+// RFC 9180, Appendix A.2: DHKEM(X25519, HKDF-SHA256), HKDF-SHA256,
+// ChaCha20Poly1305, in the base, psk, auth and auth_psk modes.
+struct Rfc9180Vector
+{
+  uint8_t mode;
+  const char* skEm;
+  const char* pkEm;
+  const char* skRm;
+  const char* pkRm;
+  const char* skSm;
+  const char* pkSm;
+  const char* key;
+  const char* base_nonce;
+  const char* exporter_secret;
+  // The first ciphertext, for sequence number 0.
+  const char* ct;
+  // The 32-byte export for an empty context.
+  const char* exported;
+};
+
+static const Rfc9180Vector rfc9180_vectors[] = {
+  { 0,
+    "f4ec9b33b792c372c1d2c2063507b684ef925b8c75a42dbcbf57d63ccd381600",
+    "1afa08d3dec047a643885163f1180476fa7ddb54c6a8029ea33f95796bf2ac4a",
+    "8057991eef8f1f1af18f4a9491d16a1ce333f695d4db8e38da75975c4478e0fb",
+    "4310ee97d88cc1f088a5576c77ab0cf5c3ac797f3d95139c6c84b5429c59662a",
+    "",
+    "",
+    "ad2744de8e17f4ebba575b3f5f5a8fa1f69c2a07f6e7500bc60ca6e3e3ec1c91",
+    "5c4d98150661b848853b547f",
+    "a3b010d4994890e2c6968a36f64470d3c824c8f5029942feb11e7a74b2921922",
+    "1c5250d8034ec2b784ba2cfd69dbdb8af406cfe3ff938e131f0def8c8b60b4db21993c62ce"
+    "81883d2dd1b51a28",
+    "4bbd6243b8bb54cec311fac9df81841b6fd61f56538a775e7c80a9f40160606e" },
+  { 1,
+    "0c35fdf49df7aa01cd330049332c40411ebba36e0c718ebc3edf5845795f6321",
+    "2261299c3f40a9afc133b969a97f05e95be2c514e54f3de26cbe5644ac735b04",
+    "77d114e0212be51cb1d76fa99dd41cfd4d0166b08caa09074430a6c59ef17879",
+    "13640af826b722fc04feaa4de2f28fbd5ecc03623b317834e7ff4120dbe73062",
+    "",
+    "",
+    "600d2fdb0313a7e5c86a9ce9221cd95bed069862421744cfb4ab9d7203a9c019",
+    "112e0465562045b7368653e7",
+    "73b506dc8b6b4269027f80b0362def5cbb57ee50eed0c2873dac9181f453c5ac",
+    "4a177f9c0d6f15cfdf533fb65bf84aecdc6ab16b8b85b4cf65a370e07fc1d78d28fb073214"
+    "525276f4a89608ff",
+    "813c1bfc516c99076ae0f466671f0ba5ff244a41699f7b2417e4c59d46d39f40" },
+  { 2,
+    "c94619e1af28971c8fa7957192b7e62a71ca2dcdde0a7cc4a8a9e741d600ab13",
+    "f7674cc8cd7baa5872d1f33dbaffe3314239f6197ddf5ded1746760bfc847e0e",
+    "3ca22a6d1cda1bb9480949ec5329d3bf0b080ca4c45879c95eddb55c70b80b82",
+    "1a478716d63cb2e16786ee93004486dc151e988b34b475043d3e0175bdb01c44",
+    "2def0cb58ffcf83d1062dd085c8aceca7f4c0c3fd05912d847b61f3e54121f05",
+    "f0f4f9e96c54aeed3f323de8534fffd7e0577e4ce269896716bcb95643c8712b",
+    "b071fd1136680600eb447a845a967d35e9db20749cdf9ce098bcc4deef4b1356",
+    "d20577dff16d7cea2c4bf780",
+    "be2d93b82071318cdb88510037cf504344151f2f9b9da8ab48974d40a2251dd7",
+    "ab1a13c9d4f01a87ec3440dbd756e2677bd2ecf9df0ce7ed73869b98e00c09be111cb9fdf0"
+    "77347aeb88e61bdf",
+    "070cffafd89b67b7f0eeb800235303a223e6ff9d1e774dce8eac585c8688c872" },
+  { 3,
+    "5e6dd73e82b856339572b7245d3cbb073a7561c0bee52873490e305cbb710410",
+    "656a2e00dc9990fd189e6e473459392df556e9a2758754a09db3f51179a3fc02",
+    "7b36a42822e75bf3362dfabbe474b3016236408becb83b859a6909e22803cb0c",
+    "a5099431c35c491ec62ca91df1525d6349cb8aa170c51f9581f8627be6334851",
+    "90761c5b0a7ef0985ed66687ad708b921d9803d51637c8d1cb72d03ed0f64418",
+    "3ac5bd4dd66ff9f2740bef0d6ccb66daa77bff7849d7895182b07fb74d087c45",
+    "49c7e6d7d2d257aded2a746fe6a9bf12d4de8007c4862b1fdffe8c35fb65054c",
+    "abac79931e8c1bcb8a23960a",
+    "7c6cc1bb98993cd93e2599322247a58fd41fdecd3db895fb4c5fd8d6bbe606b5",
+    "9aa52e29274fc6172e38a4461361d2342585d3aeec67fb3b721ecd63f059577c7fe886be0e"
+    "de01456ebc67d597",
+    "c23ebd4e7a0ad06a5dddf779f65004ce9481069ce0f0e6dd51a04539ddcbd5cd" },
+};
+
+TEST(HPKERfc9180, Curve51CP32SHA256)
+{
+  bytes info = info_bytes(),
+        psk = from_hex(
+          "0247fd33b913760fa1fa51e1892d9f307fbe65eb171e8132c2af18555a738b82");
+  string id = "Ennyn Durin aran Moria";
+  string pt_str = "Beauty is truth, truth beauty";
+  bytes psk_id(id.begin(), id.end()), pt(pt_str.begin(), pt_str.end()),
+    aad = { 'C', 'o', 'u', 'n', 't', '-', '0' };
+
+  for (const Rfc9180Vector& v : rfc9180_vectors) {
+    bytes skE = from_hex(v.skEm), skR = from_hex(v.skRm),
+          pkR = from_hex(v.pkRm), skS = from_hex(v.skSm),
+          pkS = from_hex(v.pkSm), enc(32);
+    Context s, r;
+    uint32_t res_s, res_r;
+    switch (v.mode) {
+      case 0:
+        res_s = Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS(
+          enc.data(), s.get(), skE.data(), pkR.data(), info.size(), info.data());
+        res_r = Hacl_HPKE_Curve51_CP32_SHA256_setupBaseR(
+          r.get(), enc.data(), skR.data(), info.size(), info.data());
+        break;
+      case 1:
+        res_s = Hacl_HPKE_Curve51_CP32_SHA256_setupPSKS(enc.data(),
+                                                        s.get(),
+                                                        skE.data(),
+                                                        pkR.data(),
+                                                        info.size(),
+                                                        info.data(),
+                                                        psk.size(),
+                                                        psk.data(),
+                                                        psk_id.size(),
+                                                        psk_id.data());
+        res_r = Hacl_HPKE_Curve51_CP32_SHA256_setupPSKR(r.get(),
+                                                        enc.data(),
+                                                        skR.data(),
+                                                        info.size(),
+                                                        info.data(),
+                                                        psk.size(),
+                                                        psk.data(),
+                                                        psk_id.size(),
+                                                        psk_id.data());
+        break;
+      case 2:
+        res_s = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthS(enc.data(),
+                                                         s.get(),
+                                                         skE.data(),
+                                                         pkR.data(),
+                                                         skS.data(),
+                                                         info.size(),
+                                                         info.data());
+        res_r = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthR(r.get(),
+                                                         enc.data(),
+                                                         skR.data(),
+                                                         pkS.data(),
+                                                         info.size(),
+                                                         info.data());
+        break;
+      default:
+        res_s = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKS(enc.data(),
+                                                            s.get(),
+                                                            skE.data(),
+                                                            pkR.data(),
+                                                            skS.data(),
+                                                            info.size(),
+                                                            info.data(),
+                                                            psk.size(),
+                                                            psk.data(),
+                                                            psk_id.size(),
+                                                            psk_id.data());
+        res_r = Hacl_HPKE_Curve51_CP32_SHA256_setupAuthPSKR(r.get(),
+                                                            enc.data(),
+                                                            skR.data(),
+                                                            pkS.data(),
+                                                            info.size(),
+                                                            info.data(),
+                                                            psk.size(),
+                                                            psk.data(),
+                                                            psk_id.size(),
+                                                            psk_id.data());
+    }
+    int mode = v.mode;
+    EXPECT_EQ(res_s, 0) << "mode = " << mode;
+    EXPECT_EQ(res_r, 0) << "mode = " << mode;
+    EXPECT_EQ(bytes_to_hex(enc), v.pkEm) << "mode = " << mode;
+    EXPECT_EQ(bytes_to_hex(s.key), v.key) << "mode = " << mode;
+    EXPECT_EQ(bytes_to_hex(s.nonce), v.base_nonce) << "mode = " << mode;
+    EXPECT_EQ(bytes_to_hex(s.exporter), v.exporter_secret) << "mode = " << mode;
+    EXPECT_EQ(r.key, s.key);
+    EXPECT_EQ(r.nonce, s.nonce);
+    EXPECT_EQ(r.exporter, s.exporter);
+
+    bytes ct(pt.size() + 16), out(pt.size());
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_context_seal(
+                s.get(), aad.size(), aad.data(), pt.size(), pt.data(), ct.data()),
+              0);
+    EXPECT_EQ(bytes_to_hex(ct), v.ct) << "mode = " << mode;
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_context_open(
+                r.get(), aad.size(), aad.data(), ct.size(), ct.data(), out.data()),
+              0);
+    EXPECT_EQ(out, pt);
+
+    bytes exported(32);
+    EXPECT_EQ(Hacl_HPKE_Curve51_CP32_SHA256_context_export(
+                s.get(), 0, NULL, exported.size(), exported.data()),
+              0);
+    EXPECT_EQ(bytes_to_hex(exported), v.exported) << "mode = " << mode;
+  }
+}
+
+static uint32_t
+x25519_keypair(uint8_t* pk, uint8_t* sk, uint8_t* seed)
+{
+  memcpy(sk, seed, 32);
+  Hacl_Curve25519_51_secret_to_public(pk, sk);
+  return 0;
+}
+
+static uint32_t
+p256_keypair(uint8_t* pk, uint8_t* sk, uint8_t* seed)
+{
+  memcpy(sk, seed, 32);
+  return !Hacl_P256_dh_initiator(pk, sk);
+}
+
+struct AgileSuite
+{
+  const char* name;
+  uint16_t kem;
+  uint16_t kdf;
+  uint32_t (*keypair)(uint8_t* pk, uint8_t* sk, uint8_t* seed);
+  // The portable instantiation that every choice must agree with.
+  setupBaseS_t setupBaseS;
+  sealBase_t sealBase;
+};
+
+ostream&
+operator<<(ostream& os, const AgileSuite& suite)
+{
+  return os << suite.name;
+}
+
+class HPKEAgile : public ::testing::TestWithParam<AgileSuite>
+{};
+
+// The instantiation that EverCrypt_HPKE should pick with the current CPU
+// features.
+static string
+expected_implementation(const AgileSuite& suite)
+{
+  string width = "32";
+#ifdef HACL_CAN_COMPILE_VEC128
+  if (EverCrypt_AutoConfig2_has_vec128()) {
+    width = "128";
+  }
+#endif
+#ifdef HACL_CAN_COMPILE_VEC256
+  if (EverCrypt_AutoConfig2_has_vec256()) {
+    width = "256";
+  }
+#endif
+  string hash = suite.kdf == 1 ? "SHA256" : "SHA512";
+  switch (suite.kem) {
+    case EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256: {
+      string curve = "Curve51";
+#ifdef HACL_CAN_COMPILE_VALE
+      if (EverCrypt_AutoConfig2_has_bmi2() && EverCrypt_AutoConfig2_has_adx()) {
+        curve = "Curve64";
+      }
+#endif
+      return "Hacl_HPKE_" + curve + "_CP" + width + "_" + hash;
+    }
+    case EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256:
+      return "Hacl_HPKE_P256_CP" + width + "_" + hash;
+    default:
+      return string("Hacl_HPKE_") + suite.name + "_CP32_SHA256";
+  }
+}
+
+TEST_P(HPKEAgile, Dispatch)
+{
+  AgileSuite suite = GetParam();
+  const uint16_t aead = EverCrypt_HPKE_aead_chacha20_poly1305;
+  uint32_t pk_len = EverCrypt_HPKE_public_key_len(suite.kem),
+           sk_len = EverCrypt_HPKE_secret_key_len(suite.kem),
+           enc_len = EverCrypt_HPKE_enc_len(suite.kem);
+  bytes pk(pk_len), sk(sk_len), seed = iota(32, 0),
+    skE = iota(EverCrypt_HPKE_ephemeral_key_len(suite.kem), 32),
+    info = info_bytes(), aad = iota(7, 1), plain = iota(100, 2);
+  EXPECT_EQ(suite.keypair(pk.data(), sk.data(), seed.data()), 0);
+
+  Context reference(EverCrypt_HPKE_exporter_len(suite.kdf));
+  bytes reference_enc(enc_len), reference_ct(plain.size() + 16);
+  EXPECT_EQ(suite.setupBaseS(reference_enc.data(),
+                             reference.get(),
+                             skE.data(),
+                             pk.data(),
+                             info.size(),
+                             info.data()),
+            0);
+  EXPECT_EQ(suite.sealBase(skE.data(),
+                           pk.data(),
+                           info.size(),
+                           info.data(),
+                           aad.size(),
+                           aad.data(),
+                           plain.size(),
+                           plain.data(),
+                           reference_enc.data(),
+                           reference_ct.data()),
+            0);
+
+  // Disable BMI2, AVX2 and AVX in turn.
+  for (int mask = 0; mask < 8; mask++) {
+    EverCrypt_AutoConfig2_init();
+    if (mask & 1) {
+      EverCrypt_AutoConfig2_disable_bmi2();
+    }
+    if (mask & 2) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    if (mask & 4) {
+      EverCrypt_AutoConfig2_disable_avx();
+    }
+    EverCrypt_Dispatch_refresh();
+    EXPECT_EQ(EverCrypt_HPKE_implementation(suite.kem, suite.kdf, aead),
+              expected_implementation(suite))
+      << "mask = " << mask;
+
+    Context s(EverCrypt_HPKE_exporter_len(suite.kdf)),
+      r(EverCrypt_HPKE_exporter_len(suite.kdf));
+    bytes enc(enc_len), ct(plain.size() + 16), pt(plain.size());
+    EXPECT_EQ(EverCrypt_HPKE_setupBaseS(suite.kem,
+                                        suite.kdf,
+                                        aead,
+                                        enc.data(),
+                                        s.get(),
+                                        skE.data(),
+                                        pk.data(),
+                                        info.size(),
+                                        info.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(enc, reference_enc);
+    EXPECT_EQ(s.key, reference.key);
+    EXPECT_EQ(s.nonce, reference.nonce);
+    EXPECT_EQ(s.exporter, reference.exporter);
+    EXPECT_EQ(EverCrypt_HPKE_setupBaseR(suite.kem,
+                                        suite.kdf,
+                                        aead,
+                                        r.get(),
+                                        enc.data(),
+                                        sk.data(),
+                                        info.size(),
+                                        info.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(r.key, s.key);
+
+    EXPECT_EQ(EverCrypt_HPKE_context_seal(suite.kem,
+                                          suite.kdf,
+                                          aead,
+                                          s.get(),
+                                          aad.size(),
+                                          aad.data(),
+                                          plain.size(),
+                                          plain.data(),
+                                          ct.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(ct, reference_ct);
+    EXPECT_EQ(EverCrypt_HPKE_context_open(suite.kem,
+                                          suite.kdf,
+                                          aead,
+                                          r.get(),
+                                          aad.size(),
+                                          aad.data(),
+                                          ct.size(),
+                                          ct.data(),
+                                          pt.data()),
+              EverCrypt_Error_Success);
+    EXPECT_EQ(pt, plain);
+
+    EXPECT_EQ(EverCrypt_HPKE_openBase(suite.kem,
+                                      suite.kdf,
+                                      aead,
+                                      enc.data(),
+                                      sk.data(),
+                                      info.size(),
+                                      info.data(),
+                                      aad.size(),
+                                      aad.data(),
+                                      ct.size(),
+                                      ct.data(),
+                                      pt.data()),
+              EverCrypt_Error_Success);
+    ct[0] ^= 1;
+    EXPECT_EQ(EverCrypt_HPKE_openBase(suite.kem,
+                                      suite.kdf,
+                                      aead,
+                                      enc.data(),
+                                      sk.data(),
+                                      info.size(),
+                                      info.data(),
+                                      aad.size(),
+                                      aad.data(),
+                                      ct.size(),
+                                      ct.data(),
+                                      pt.data()),
+              EverCrypt_Error_AuthenticationFailure);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+TEST_P(HPKEAgile, Errors)
+{
+  AgileSuite suite = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+  const uint16_t aead = EverCrypt_HPKE_aead_chacha20_poly1305;
+  bytes pk(EverCrypt_HPKE_public_key_len(suite.kem)),
+    sk(EverCrypt_HPKE_secret_key_len(suite.kem)), seed = iota(32, 0),
+    skE = iota(EverCrypt_HPKE_ephemeral_key_len(suite.kem), 32),
+    enc(EverCrypt_HPKE_enc_len(suite.kem)), psk = iota(32, 96),
+    secret(255 * 64 + 1);
+  EXPECT_EQ(suite.keypair(pk.data(), sk.data(), seed.data()), 0);
+
+  // AES-128-GCM and HKDF-SHA384 are not available.
+  Context c(EverCrypt_HPKE_exporter_len(suite.kdf));
+  EXPECT_EQ(EverCrypt_HPKE_implementation(suite.kem, suite.kdf, 1), nullptr);
+  EXPECT_EQ(EverCrypt_HPKE_implementation(suite.kem, 2, aead), nullptr);
+  EXPECT_EQ(EverCrypt_HPKE_setupBaseS(suite.kem,
+                                      suite.kdf,
+                                      1,
+                                      enc.data(),
+                                      c.get(),
+                                      skE.data(),
+                                      pk.data(),
+                                      0,
+                                      NULL),
+            EverCrypt_Error_UnsupportedAlgorithm);
+
+  // Only the DHKEMs have the PSK and Auth modes.
+  EXPECT_EQ(EverCrypt_HPKE_setupPSKS(suite.kem,
+                                     suite.kdf,
+                                     aead,
+                                     enc.data(),
+                                     c.get(),
+                                     skE.data(),
+                                     pk.data(),
+                                     0,
+                                     NULL,
+                                     psk.size(),
+                                     psk.data(),
+                                     psk.size(),
+                                     psk.data()),
+            suite.kem < 0x0030 ? EverCrypt_Error_Success
+                               : EverCrypt_Error_UnsupportedAlgorithm);
+
+  uint32_t nh = EverCrypt_HPKE_exporter_len(suite.kdf);
+  EXPECT_EQ(EverCrypt_HPKE_setupBaseS(suite.kem,
+                                      suite.kdf,
+                                      aead,
+                                      enc.data(),
+                                      c.get(),
+                                      skE.data(),
+                                      pk.data(),
+                                      0,
+                                      NULL),
+            EverCrypt_Error_Success);
+  EXPECT_EQ(EverCrypt_HPKE_context_export(
+              suite.kem, suite.kdf, aead, c.get(), 0, NULL, 255 * nh, secret.data()),
+            EverCrypt_Error_Success);
+  EXPECT_EQ(EverCrypt_HPKE_context_export(suite.kem,
+                                          suite.kdf,
+                                          aead,
+                                          c.get(),
+                                          0,
+                                          NULL,
+                                          255 * nh + 1,
+                                          secret.data()),
+            EverCrypt_Error_MaximumLengthExceeded);
+
+  bytes ct(16);
+  c.seq = UINT64_MAX;
+  EXPECT_EQ(EverCrypt_HPKE_context_seal(
+              suite.kem, suite.kdf, aead, c.get(), 0, NULL, 0, NULL, ct.data()),
+            EverCrypt_Error_MaximumLengthExceeded);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  HPKE,
+  HPKEAgile,
+  ::testing::Values(
+    AgileSuite{ "X25519_SHA256",
+                EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256,
+                EverCrypt_HPKE_kdf_hkdf_sha256,
+                x25519_keypair,
+                Hacl_HPKE_Curve51_CP32_SHA256_setupBaseS,
+                Hacl_HPKE_Curve51_CP32_SHA256_sealBase },
+    AgileSuite{ "X25519_SHA512",
+                EverCrypt_HPKE_kem_dhkem_x25519_hkdf_sha256,
+                EverCrypt_HPKE_kdf_hkdf_sha512,
+                x25519_keypair,
+                Hacl_HPKE_Curve51_CP32_SHA512_setupBaseS,
+                Hacl_HPKE_Curve51_CP32_SHA512_sealBase },
+    AgileSuite{ "P256_SHA256",
+                EverCrypt_HPKE_kem_dhkem_p256_hkdf_sha256,
+                EverCrypt_HPKE_kdf_hkdf_sha256,
+                p256_keypair,
+                Hacl_HPKE_P256_CP32_SHA256_setupBaseS,
+                Hacl_HPKE_P256_CP32_SHA256_sealBase },
+    AgileSuite{ "X25519MLKEM768",
+                EverCrypt_HPKE_kem_xwing,
+                EverCrypt_HPKE_kdf_hkdf_sha256,
+                x25519mlkem768_keypair,
+                Hacl_HPKE_X25519MLKEM768_CP32_SHA256_setupBaseS,
+                Hacl_HPKE_X25519MLKEM768_CP32_SHA256_sealBase },
+    AgileSuite{ "P256MLKEM768",
+                EverCrypt_HPKE_kem_p256_mlkem768,
+                EverCrypt_HPKE_kdf_hkdf_sha256,
+                Hacl_HPKE_P256MLKEM768_CP32_SHA256_keypair,
+                Hacl_HPKE_P256MLKEM768_CP32_SHA256_setupBaseS,
+                Hacl_HPKE_P256MLKEM768_CP32_SHA256_sealBase }));
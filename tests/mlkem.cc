@@ -0,0 +1,232 @@
+/*
+ *    Copyright 2023 Cryspen Sarl
+ *
+ *    Licensed under the Apache License, Version 2.0 or MIT.
+ *    - http://www.apache.org/licenses/LICENSE-2.0
+ *    - http://opensource.org/licenses/MIT
+ */
+
+#include <gtest/gtest.h>
+
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
+#include "Hacl_Hash_SHA3.h"
+#include "Hacl_MLKEM1024.h"
+#include "Hacl_MLKEM512.h"
+#include "Hacl_MLKEM768.h"
+#include "util.h"
+
+using namespace std;
+
+struct MLKem
+{
+  const char* name;
+  uint32_t* publickeybytes;
+  uint32_t* secretkeybytes;
+  uint32_t* ciphertextbytes;
+  uint32_t (*keypair)(uint8_t* pk, uint8_t* sk);
+  uint32_t (*enc)(uint8_t* ct, uint8_t* ss, uint8_t* pk);
+  uint32_t (*dec)(uint8_t* ss, uint8_t* ct, uint8_t* sk);
+  void (*keypair_derand)(uint8_t* pk, uint8_t* sk, uint8_t* coins);
+  uint32_t (*enc_derand)(uint8_t* ct, uint8_t* ss, uint8_t* pk, uint8_t* coins);
+  uint32_t (*keypair_batch)(uint32_t n, uint8_t* pk, uint8_t* sk);
+  uint32_t (*enc_batch)(uint32_t n, uint8_t* ct, uint8_t* ss, uint8_t* pk);
+  uint32_t (*dec_batch)(uint32_t n, uint8_t* ss, uint8_t* ct, uint8_t* sk);
+  // SHA3-256(pk || sk || ct || ss) for d = 0 .. 31, z = 32 .. 63 and
+  // m = 64 .. 95, and ss itself, as computed by a direct transcription of
+  // FIPS 203.
+  const char* digest;
+  const char* ss;
+};
+
+ostream&
+operator<<(ostream& os, const MLKem& kem)
+{
+  return os << kem.name;
+}
+
+class MLKEM : public ::testing::TestWithParam<MLKem>
+{};
+
+TEST_P(MLKEM, KnownAnswer)
+{
+  MLKem kem = GetParam();
+
+  // Portable and AVX2 code compute exactly the same values.
+  for (int avx2 = 0; avx2 < 2; avx2++) {
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (!avx2) {
+      EverCrypt_AutoConfig2_disable_avx2();
+      EverCrypt_Dispatch_refresh();
+      EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_MLKEM),
+                EverCrypt_Dispatch_Portable);
+    }
+    bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+      ct(*kem.ciphertextbytes), ss(32), digest(32);
+    bytes coins = iota(64, 0), m = iota(32, 64);
+    kem.keypair_derand(pk.data(), sk.data(), coins.data());
+    EXPECT_EQ(kem.enc_derand(ct.data(), ss.data(), pk.data(), m.data()), 0);
+
+    bytes all;
+    all.insert(all.end(), pk.begin(), pk.end());
+    all.insert(all.end(), sk.begin(), sk.end());
+    all.insert(all.end(), ct.begin(), ct.end());
+    all.insert(all.end(), ss.begin(), ss.end());
+    Hacl_Hash_SHA3_sha3_256(digest.data(), all.data(), all.size());
+    EXPECT_EQ(bytes_to_hex(digest), kem.digest) << "avx2 = " << avx2;
+    EXPECT_EQ(bytes_to_hex(ss), kem.ss) << "avx2 = " << avx2;
+
+    bytes ss2(32);
+    EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss, ss2);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+TEST_P(MLKEM, Roundtrip)
+{
+  MLKem kem = GetParam();
+
+  for (int mask = 0; mask < 8; mask++) {
+    bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+      ct(*kem.ciphertextbytes), ss1(32), ss2(32);
+
+    EverCrypt_AutoConfig2_init();
+    if (mask & 1) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    EverCrypt_Dispatch_refresh();
+    EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+
+    EverCrypt_AutoConfig2_init();
+    if (mask & 2) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    EverCrypt_Dispatch_refresh();
+    EXPECT_EQ(kem.enc(ct.data(), ss1.data(), pk.data()), 0);
+
+    EverCrypt_AutoConfig2_init();
+    if (mask & 4) {
+      EverCrypt_AutoConfig2_disable_avx2();
+    }
+    EverCrypt_Dispatch_refresh();
+    EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss1, ss2) << "mask = " << mask;
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+// A modified ciphertext decapsulates to J(z || ct).
+TEST_P(MLKEM, ImplicitRejection)
+{
+  MLKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+    ct(*kem.ciphertextbytes), ss1(32), ss2(32), expected(32);
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+  EXPECT_EQ(kem.enc(ct.data(), ss1.data(), pk.data()), 0);
+
+  ct[ct.size() - 1] ^= 1;
+  EXPECT_EQ(kem.dec(ss2.data(), ct.data(), sk.data()), 0);
+
+  bytes j_input(sk.end() - 32, sk.end());
+  j_input.insert(j_input.end(), ct.begin(), ct.end());
+  Hacl_Hash_SHA3_shake256(expected.data(), 32, j_input.data(), j_input.size());
+  EXPECT_NE(ss1, ss2);
+  EXPECT_EQ(ss2, expected);
+}
+
+// Keys with a coefficient of t that is not reduced, or with a wrong H(ek), are
+// rejected.
+TEST_P(MLKEM, InputChecks)
+{
+  MLKem kem = GetParam();
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+
+  bytes pk(*kem.publickeybytes), sk(*kem.secretkeybytes),
+    ct(*kem.ciphertextbytes), ss(32);
+  EXPECT_EQ(kem.keypair(pk.data(), sk.data()), 0);
+  EXPECT_EQ(kem.enc(ct.data(), ss.data(), pk.data()), 0);
+
+  bytes bad_pk = pk;
+  bad_pk[0] = 0xff;
+  bad_pk[1] |= 0x0f;
+  EXPECT_EQ(kem.enc(ct.data(), ss.data(), bad_pk.data()), 1);
+
+  bytes bad_sk = sk;
+  bad_sk[sk.size() - 33] ^= 1;
+  EXPECT_EQ(kem.dec(ss.data(), ct.data(), bad_sk.data()), 1);
+}
+
+// Batches of more than four operations are split into chunks sharing the
+// matrix sampling; every operation must still match the single ones.
+TEST_P(MLKEM, Batch)
+{
+  MLKem kem = GetParam();
+  const uint32_t n = 7;
+
+  for (int avx2 = 0; avx2 < 2; avx2++) {
+    EverCrypt_AutoConfig2_init();
+    EverCrypt_Dispatch_refresh();
+    if (!avx2) {
+      EverCrypt_AutoConfig2_disable_avx2();
+      EverCrypt_Dispatch_refresh();
+      EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_MLKEM),
+                EverCrypt_Dispatch_Portable);
+    }
+    bytes pk(n * *kem.publickeybytes), sk(n * *kem.secretkeybytes),
+      ct(n * *kem.ciphertextbytes), ss1(n * 32), ss2(n * 32);
+    EXPECT_EQ(kem.keypair_batch(n, pk.data(), sk.data()), 0);
+    EXPECT_EQ(kem.enc_batch(n, ct.data(), ss1.data(), pk.data()), 0);
+    EXPECT_EQ(kem.dec_batch(n, ss2.data(), ct.data(), sk.data()), 0);
+    EXPECT_EQ(ss1, ss2) << "avx2 = " << avx2;
+
+    for (uint32_t i = 0; i < n; i++) {
+      bytes ss(32);
+      EXPECT_EQ(kem.dec(ss.data(),
+                        ct.data() + i * *kem.ciphertextbytes,
+                        sk.data() + i * *kem.secretkeybytes),
+                0);
+      EXPECT_TRUE(equal(ss.begin(), ss.end(), ss1.begin() + 32 * i));
+    }
+
+    pk[(n - 1) * *kem.publickeybytes] = 0xff;
+    pk[(n - 1) * *kem.publickeybytes + 1] |= 0x0f;
+    EXPECT_EQ(kem.enc_batch(n, ct.data(), ss1.data(), pk.data()), 1);
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
+#define MLKEM_PARAMS(N)                                                        \
+  &Hacl_MLKEM##N##_crypto_publickeybytes,                                      \
+    &Hacl_MLKEM##N##_crypto_secretkeybytes,                                    \
+    &Hacl_MLKEM##N##_crypto_ciphertextbytes, Hacl_MLKEM##N##_crypto_kem_keypair, \
+    Hacl_MLKEM##N##_crypto_kem_enc, Hacl_MLKEM##N##_crypto_kem_dec,            \
+    Hacl_MLKEM##N##_crypto_kem_keypair_derand,                                 \
+    Hacl_MLKEM##N##_crypto_kem_enc_derand,                                     \
+    Hacl_MLKEM##N##_crypto_kem_keypair_batch,                                  \
+    Hacl_MLKEM##N##_crypto_kem_enc_batch, Hacl_MLKEM##N##_crypto_kem_dec_batch
+
+INSTANTIATE_TEST_SUITE_P(
+  MLKEM,
+  MLKEM,
+  ::testing::Values(
+    MLKem{ "MLKEM512",
+           MLKEM_PARAMS(512),
+           "18f9b9202aa8793837369f5bad6795a1066356039f0eacb47c0df8bb451b7aab",
+           "14cace3e48771b316676afad2cfcfe8488daaa4fad954e57236caa3f24a42cf7" },
+    MLKem{ "MLKEM768",
+           MLKEM_PARAMS(768),
+           "04182bace5128633e0238b75c770fff441992a875058fec5b1c75a2bc9d0ca00",
+           "9cddd089ffe70e3996e76f7c8d06746df34d07e8657bc0fcf2bb0e1c3084aea1" },
+    MLKem{ "MLKEM1024",
+           MLKEM_PARAMS(1024),
+           "c65104220bac53e5f1e819d29048ce747e19bb5e30390a1732aa124faf71f725",
+           "0ad8d1ea1b8dd788979b4379581218df9321bdce5567eca42ae6be7d395f1a54" }));
@@ -11,9 +11,21 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 
+#include "EverCrypt_AutoConfig2.h"
+#include "EverCrypt_Dispatch.h"
+#include "EverCrypt_NaCl.h"
 #include "Hacl_NaCl.h"
+#include "hacl-cpu-features.h"
 #include "util.h"
 
+#ifdef HACL_CAN_COMPILE_VEC128
+#include "Hacl_Salsa20_Vec128.h"
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+#include "Hacl_Salsa20_Vec256.h"
+#endif
+
 // ANCHOR(example define box)
 // Note: HACL Packages will provide this (or a similar) define in a later
 // version.
@@ -368,6 +380,29 @@ TEST_P(NaClBoxSuite, EasyKAT)
     ASSERT_EQ(res, 0);
     EXPECT_EQ(test.plaintext, got_plaintext);
   }
+
+  // EverCrypt_NaCl, with the dispatched Salsa20 and Poly1305.
+  {
+    bytes got_ciphertext(HACL_NACL_CRYPTO_BOX_MACBYTES + test.plaintext.size());
+    uint32_t res = EverCrypt_NaCl_crypto_box_easy(got_ciphertext.data(),
+                                                  test.plaintext.data(),
+                                                  test.plaintext.size(),
+                                                  test.nonce.data(),
+                                                  test.bob_pk.data(),
+                                                  test.alice_sk.data());
+    ASSERT_EQ(res, 0);
+    EXPECT_EQ(test.ciphertext, got_ciphertext);
+
+    bytes got_plaintext(test.plaintext.size());
+    res = EverCrypt_NaCl_crypto_box_open_easy(got_plaintext.data(),
+                                              test.ciphertext.data(),
+                                              test.ciphertext.size(),
+                                              test.nonce.data(),
+                                              test.alice_pk.data(),
+                                              test.bob_sk.data());
+    ASSERT_EQ(res, 0);
+    EXPECT_EQ(test.plaintext, got_plaintext);
+  }
 }
 
 TEST_P(NaClBoxSuite, EasyDetachedKAT)
@@ -687,6 +722,114 @@ TEST_P(NaClSecretBoxSuite, InvalidKAT)
   }
 }
 
+// ----- Vectorized Salsa20 ----------------------------------------------------
+
+TEST(Salsa20Vec, MatchesScalar)
+{
+  hacl_init_cpu_features();
+
+  bytes key(32), nonce(8);
+  generate_random(key.data(), key.size());
+  generate_random(nonce.data(), nonce.size());
+
+  for (uint32_t len : { 0, 1, 63, 64, 255, 256, 257, 511, 512, 513, 1000, 4113 }) {
+    for (uint32_t ctr : { 0U, 1U, 0xfffffffeU }) {
+      bytes msg(len);
+      generate_random(msg.data(), msg.size());
+      bytes expected(len);
+      Hacl_Salsa20_salsa20_encrypt(
+        len, expected.data(), msg.data(), key.data(), nonce.data(), ctr);
+
+#ifdef HACL_CAN_COMPILE_VEC128
+      if (hacl_vec128_support()) {
+        bytes got(len);
+        Hacl_Salsa20_Vec128_salsa20_encrypt_128(
+          len, got.data(), msg.data(), key.data(), nonce.data(), ctr);
+        EXPECT_EQ(got, expected) << "vec128, len " << len << ", ctr " << ctr;
+        Hacl_Salsa20_Vec128_salsa20_decrypt_128(
+          len, got.data(), got.data(), key.data(), nonce.data(), ctr);
+        EXPECT_EQ(got, msg);
+      }
+#endif
+
+#ifdef HACL_CAN_COMPILE_VEC256
+      if (hacl_vec256_support()) {
+        bytes got(len);
+        Hacl_Salsa20_Vec256_salsa20_encrypt_256(
+          len, got.data(), msg.data(), key.data(), nonce.data(), ctr);
+        EXPECT_EQ(got, expected) << "vec256, len " << len << ", ctr " << ctr;
+        Hacl_Salsa20_Vec256_salsa20_decrypt_256(
+          len, got.data(), got.data(), key.data(), nonce.data(), ctr);
+        EXPECT_EQ(got, msg);
+      }
+#endif
+    }
+  }
+}
+
+TEST(Salsa20Vec, SecretBoxDispatch)
+{
+  bytes key(HACL_NACL_CRYPTO_SECRETBOX_KEYBYTES);
+  bytes nonce(HACL_NACL_CRYPTO_SECRETBOX_NONCEBYTES);
+  generate_random(key.data(), key.size());
+  generate_random(nonce.data(), nonce.size());
+
+  for (uint32_t len : { 0, 31, 32, 33, 300, 544, 4096 }) {
+    bytes msg(len);
+    generate_random(msg.data(), msg.size());
+
+    // Scalar, 128-bit and 256-bit vectors, in this order.
+    bytes expected;
+    for (int vec = 0; vec < 3; vec++) {
+      EverCrypt_AutoConfig2_init();
+      if (vec < 2) {
+        EverCrypt_AutoConfig2_disable_avx2();
+      }
+      EverCrypt_Dispatch_refresh();
+      if (vec < 1) {
+        EverCrypt_AutoConfig2_disable_avx();
+        EverCrypt_Dispatch_refresh();
+        EXPECT_EQ(EverCrypt_Dispatch_implementation(EverCrypt_Dispatch_NACL),
+                  EverCrypt_Dispatch_Portable);
+      }
+
+      bytes cipher(HACL_NACL_CRYPTO_SECRETBOX_MACBYTES + len);
+      ASSERT_EQ(EverCrypt_NaCl_crypto_secretbox_easy(
+                  cipher.data(), msg.data(), len, nonce.data(), key.data()),
+                0);
+      if (vec == 0) {
+        // Hacl_NaCl is always scalar.
+        bytes hacl(cipher.size());
+        ASSERT_EQ(Hacl_NaCl_crypto_secretbox_easy(
+                    hacl.data(), msg.data(), len, nonce.data(), key.data()),
+                  0);
+        EXPECT_EQ(cipher, hacl);
+        expected = cipher;
+      }
+      EXPECT_EQ(cipher, expected) << "vec " << vec << ", len " << len;
+
+      bytes got(len);
+      ASSERT_EQ(EverCrypt_NaCl_crypto_secretbox_open_easy(got.data(),
+                                                          cipher.data(),
+                                                          cipher.size(),
+                                                          nonce.data(),
+                                                          key.data()),
+                0);
+      EXPECT_EQ(got, msg);
+
+      cipher[cipher.size() - 1] ^= 1;
+      EXPECT_NE(EverCrypt_NaCl_crypto_secretbox_open_easy(got.data(),
+                                                          cipher.data(),
+                                                          cipher.size(),
+                                                          nonce.data(),
+                                                          key.data()),
+                0);
+    }
+  }
+  EverCrypt_AutoConfig2_init();
+  EverCrypt_Dispatch_refresh();
+}
+
 vector<BoxTestCase>
 read_json_box(char* path)
 {
@@ -218,6 +218,57 @@ TEST_P(Poly1305Suite, KAT)
   }
 }
 
+#ifdef HACL_CAN_COMPILE_VEC256
+TEST(Poly1305MultiKeySuite, Mac4)
+{
+  // This must be called before `hacl_vec{128,256}_support()`.
+  hacl_init_cpu_features();
+
+  if (!hacl_vec256_support()) {
+    cout << "No support for VEC256 on this CPU." << endl;
+    return;
+  }
+
+  for (uint32_t len = 0; len < 300; len++) {
+    vector<bytes> keys(4, bytes(POLY1305_KEY_SIZE));
+    vector<bytes> texts(4, bytes(len));
+    for (size_t lane = 0; lane < 4; lane++) {
+      for (size_t i = 0; i < POLY1305_KEY_SIZE; i++) {
+        keys[lane][i] = (uint8_t)(0xff - 7 * i - 31 * lane - len);
+      }
+      for (size_t i = 0; i < len; i++) {
+        texts[lane][i] = (uint8_t)(3 * i + 17 * lane + len);
+      }
+    }
+
+    vector<bytes> tags(4, bytes(POLY1305_TAG_SIZE));
+    Hacl_MAC_Poly1305_Simd256_mac4(tags[0].data(),
+                                   tags[1].data(),
+                                   tags[2].data(),
+                                   tags[3].data(),
+                                   len,
+                                   texts[0].data(),
+                                   texts[1].data(),
+                                   texts[2].data(),
+                                   texts[3].data(),
+                                   keys[0].data(),
+                                   keys[1].data(),
+                                   keys[2].data(),
+                                   keys[3].data());
+
+    for (size_t lane = 0; lane < 4; lane++) {
+      bytes expected_tag = bytes(POLY1305_TAG_SIZE);
+      Hacl_MAC_Poly1305_mac(expected_tag.data(),
+                            texts[lane].data(),
+                            len,
+                            keys[lane].data());
+      EXPECT_EQ(expected_tag, tags[lane])
+        << "Lane " << lane << " differs for length " << len;
+    }
+  }
+}
+#endif
+
 vector<TestCase>
 read_json(string path)
 {
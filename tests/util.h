@@ -118,6 +118,17 @@ make_lengths()
   return { {}, { 0, 1, 2, 3, 4, 5, 8, 9, 16, 17, 32, 33, 64, 65, 128, 129 } };
 }
 
+// `len` bytes counting up from `start`, wrapping around at 256.
+bytes
+iota(size_t len, uint8_t start)
+{
+  bytes b(len);
+  for (size_t i = 0; i < len; i++) {
+    b[i] = (uint8_t)(start + i);
+  }
+  return b;
+}
+
 // Only used in examples. Do not use otherwise.
 void
 generate_random(uint8_t* output, uint32_t output_len)
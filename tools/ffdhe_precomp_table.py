@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+#
+#    Copyright 2023 Cryspen Sarl
+#
+#    Licensed under the Apache License, Version 2.0 or MIT.
+#    * http://www.apache.org/licenses/LICENSE-2.0
+#    * http://opensource.org/licenses/MIT
+
+"""Generates include/internal/Hacl_FFDHE_PrecompTable.h.
+
+For every FFDHE group, the table holds the 16 entries of a 4-teeth comb for
+the generator g = 2, as used by ffdhe_compute_exp_g2 in src/Hacl_FFDHE.c.
+With nLen 64-bit limbs and d = 16 * nLen, entry v is
+
+    prod { g ^ (2 ^ (d * i)) | bit i of v is set } * R mod p,  R = 2 ^ (64 * nLen)
+
+i.e. in Montgomery form, stored as nLen little-endian limbs.
+
+The primes are read from include/internal/Hacl_Impl_FFDHE_Constants.h.
+
+Usage: python3 tools/ffdhe_precomp_table.py [--check]
+"""
+
+import re
+import sys
+from os.path import abspath, dirname, join
+
+ROOT = abspath(join(dirname(__file__), ".."))
+CONSTANTS = join(ROOT, "include", "internal", "Hacl_Impl_FFDHE_Constants.h")
+OUTPUT = join(ROOT, "include", "internal", "Hacl_FFDHE_PrecompTable.h")
+GROUPS = [2048, 3072, 4096, 6144, 8192]
+TEETH = 4
+WIDTH = 100
+
+LICENSE = """/* MIT License
+ *
+ * Copyright (c) 2016-2022 INRIA, CMU and Microsoft Corporation
+ * Copyright (c) 2022-2023 HACL* Contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+"""
+
+PROLOGUE = """
+#ifndef __internal_Hacl_FFDHE_PrecompTable_H
+#define __internal_Hacl_FFDHE_PrecompTable_H
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <string.h>
+#include "krml/internal/types.h"
+#include "krml/lowstar_endianness.h"
+#include "krml/internal/target.h"
+
+"""
+
+EPILOGUE = """#if defined(__cplusplus)
+}
+#endif
+
+#define __internal_Hacl_FFDHE_PrecompTable_H_DEFINED
+#endif
+"""
+
+
+def read_prime(constants, bits):
+    name = "Hacl_Impl_FFDHE_Constants_ffdhe_p%d" % bits
+    m = re.search(re.escape(name) + r"\[\d+U\]\s*=\s*\{([^}]*)\}", constants)
+    if m is None:
+        raise Exception("%s not found in %s" % (name, CONSTANTS))
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})U", m.group(1)))
+    if len(data) != bits // 8:
+        raise Exception("%s has %d bytes" % (name, len(data)))
+    return int.from_bytes(data, "big")
+
+
+def comb_table(p, bits):
+    n_len = bits // 64
+    d = 16 * n_len
+    r = pow(2, 64 * n_len, p)
+    rows = [pow(2, 1 << (d * i), p) for i in range(TEETH)]
+    limbs = []
+    for v in range(1 << TEETH):
+        x = r
+        for i in range(TEETH):
+            if v >> i & 1:
+                x = x * rows[i] % p
+        limbs.extend((x >> (64 * k)) & 0xFFFFFFFFFFFFFFFF for k in range(n_len))
+    return limbs
+
+
+def wrap(limbs):
+    tokens = ["%dULL," % x for x in limbs]
+    tokens[-1] = tokens[-1][:-1]
+    lines = []
+    line = "   "
+    for t in tokens:
+        if len(line) + 1 + len(t) > WIDTH:
+            lines.append(line)
+            line = "   "
+        line = line + " " + t
+    lines.append(line)
+    return "\n".join(lines) + "\n"
+
+
+def generate():
+    with open(CONSTANTS) as f:
+        constants = f.read()
+    out = LICENSE + PROLOGUE
+    for bits in GROUPS:
+        limbs = comb_table(read_prime(constants, bits), bits)
+        out += "static const\nuint64_t\n"
+        out += "Hacl_FFDHE_PrecompTable_ffdhe_g2_comb_table_%d[%dU] =\n" % (bits, len(limbs))
+        out += "  {\n" + wrap(limbs) + "  };\n\n"
+    return out + EPILOGUE
+
+
+def main():
+    table = generate()
+    if "--check" in sys.argv[1:]:
+        with open(OUTPUT) as f:
+            if f.read() != table:
+                print("%s is out of date" % OUTPUT)
+                sys.exit(1)
+        return
+    with open(OUTPUT, "w") as f:
+        f.write(table)
+
+
+if __name__ == "__main__":
+    main()